@@ -0,0 +1,155 @@
+// Native HAL shim: Arduino core subset used by the DSP, color and pattern code.
+// Timing is wall-clock (steady_clock) since process start unless a test pins it
+// with hal_set_time_us(). Serial writes to stdout.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <algorithm>
+#include <string>
+
+#include <math.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+// ============================================================================
+// CONSTANTS & ATTRIBUTES
+// ============================================================================
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#endif
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define EXT_RAM_ATTR
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_float(addr) (*(const float*)(addr))
+#define memcpy_P memcpy
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+
+// ============================================================================
+// MATH HELPERS (Arduino semantics)
+// ============================================================================
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+inline long random(long howbig) { return howbig <= 0 ? 0 : std::rand() % howbig; }
+inline long random(long howsmall, long howbig) {
+    return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall);
+}
+
+// ============================================================================
+// TIMING
+// ============================================================================
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+inline void yield() {}
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+
+// ============================================================================
+// STRING / SERIAL / ESP
+// ============================================================================
+
+class String : public std::string {
+public:
+    String() {}
+    String(const char* s) : std::string(s ? s : "") {}
+    String(const std::string& s) : std::string(s) {}
+    String(int v) : std::string(std::to_string(v)) {}
+    String(unsigned int v) : std::string(std::to_string(v)) {}
+    String(long v) : std::string(std::to_string(v)) {}
+    String(unsigned long v) : std::string(std::to_string(v)) {}
+    String(float v, unsigned int decimals = 2) { char b[32]; snprintf(b, sizeof(b), "%.*f", decimals, v); assign(b); }
+    String(double v, unsigned int decimals = 2) { char b[32]; snprintf(b, sizeof(b), "%.*f", decimals, v); assign(b); }
+    unsigned int length() const { return (unsigned int)size(); }
+    bool isEmpty() const { return empty(); }
+    bool concat(const char* s, unsigned int len) { append(s, len); return true; }
+    bool concat(const String& s) { append(s); return true; }
+};
+
+class HardwareSerial {
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    void flush() { std::fflush(stdout); }
+    int available() { return 0; }
+    int read() { return -1; }
+    operator bool() const { return true; }
+
+    size_t write(uint8_t c) { return std::fputc(c, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t* buf, size_t len) { return std::fwrite(buf, 1, len, stdout); }
+
+    size_t print(const char* s) { return std::fputs(s, stdout) < 0 ? 0 : std::strlen(s); }
+    size_t print(const String& s) { return print(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return (size_t)std::printf("%d", v); }
+    size_t print(unsigned int v) { return (size_t)std::printf("%u", v); }
+    size_t print(long v) { return (size_t)std::printf("%ld", v); }
+    size_t print(unsigned long v) { return (size_t)std::printf("%lu", v); }
+    size_t print(double v, int decimals = 2) { return (size_t)std::printf("%.*f", decimals, v); }
+
+    size_t println() { return print("\n"); }
+    template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+    size_t println(double v, int decimals) { size_t n = print(v, decimals); return n + println(); }
+
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, fmt);
+        int n = std::vprintf(fmt, args);
+        va_end(args);
+        return n < 0 ? 0 : (size_t)n;
+    }
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() { return 256 * 1024; }
+    uint32_t getHeapSize() { return 320 * 1024; }
+    uint32_t getMinFreeHeap() { return 200 * 1024; }
+    uint32_t getMaxAllocHeap() { return 128 * 1024; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getCycleCount();  // Host wall clock scaled to getCpuFreqMHz()
+    void restart() { std::exit(0); }
+};
+
+extern EspClass ESP;
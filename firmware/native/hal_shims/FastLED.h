@@ -0,0 +1,92 @@
+// Native HAL shim: FastLED CRGB and controller registration (no output).
+// show() only counts frames so host runs can check transmit cadence.
+
+#pragma once
+
+#include <stdint.h>
+#include <cstdlib>
+
+struct CHSV {
+    uint8_t h;
+    uint8_t s;
+    uint8_t v;
+
+    CHSV() : h(0), s(0), v(0) {}
+    CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB {
+    union {
+        struct {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+        };
+        uint8_t raw[3];
+    };
+
+    CRGB() : r(0), g(0), b(0) {}
+    CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    CRGB(const CHSV& hsv);
+    uint8_t& operator[](uint8_t x) { return raw[x]; }
+    const uint8_t& operator[](uint8_t x) const { return raw[x]; }
+};
+
+// Six-sector HSV -> RGB. Close to, not bit-exact with, FastLED's hsv2rgb_rainbow.
+inline CRGB::CRGB(const CHSV& hsv) {
+    uint8_t sector = hsv.h / 43;
+    uint8_t frac = (uint8_t)((hsv.h - sector * 43) * 6);
+    uint8_t p = (uint8_t)((hsv.v * (255 - hsv.s)) >> 8);
+    uint8_t q = (uint8_t)((hsv.v * (255 - ((hsv.s * frac) >> 8))) >> 8);
+    uint8_t t = (uint8_t)((hsv.v * (255 - ((hsv.s * (255 - frac)) >> 8))) >> 8);
+    switch (sector) {
+        case 0: r = hsv.v; g = t; b = p; break;
+        case 1: r = q; g = hsv.v; b = p; break;
+        case 2: r = p; g = hsv.v; b = t; break;
+        case 3: r = p; g = q; b = hsv.v; break;
+        case 4: r = t; g = p; b = hsv.v; break;
+        default: r = hsv.v; g = p; b = q; break;
+    }
+}
+
+inline uint8_t random8() { return (uint8_t)(std::rand() & 0xFF); }
+inline uint8_t random8(uint8_t lim) { return lim == 0 ? 0 : (uint8_t)(std::rand() % lim); }
+inline uint8_t random8(uint8_t min, uint8_t lim) { return lim <= min ? min : (uint8_t)(min + random8(lim - min)); }
+inline uint16_t random16() { return (uint16_t)(std::rand() & 0xFFFF); }
+inline uint16_t random16(uint16_t lim) { return lim == 0 ? 0 : (uint16_t)(std::rand() % lim); }
+inline uint16_t random16(uint16_t min, uint16_t lim) { return lim <= min ? min : (uint16_t)(min + random16(lim - min)); }
+
+enum EOrder { RGB = 0012, RBG = 0021, GRB = 0102, GBR = 0120, BRG = 0201, BGR = 0210 };
+enum LEDColorCorrection { UncorrectedColor = 0xFFFFFF, TypicalLEDStrip = 0xFFB0F0 };
+
+template <uint8_t DATA_PIN, EOrder RGB_ORDER = GRB> class WS2812B {};
+
+class CFastLED {
+public:
+    template <template <uint8_t, EOrder> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+    CFastLED& addLeds(CRGB* data, int num_leds) {
+        leds_ = data;
+        num_leds_ = num_leds;
+        return *this;
+    }
+
+    void setBrightness(uint8_t scale) { brightness_ = scale; }
+    uint8_t getBrightness() const { return brightness_; }
+    void setCorrection(LEDColorCorrection) {}
+    void setDither(uint8_t) {}
+    void show() { frames_shown_++; }
+    void clear(bool write_data = false) {
+        for (int i = 0; i < num_leds_; i++) leds_[i] = CRGB();
+        if (write_data) show();
+    }
+
+    uint32_t frames_shown() const { return frames_shown_; }
+
+private:
+    CRGB* leds_ = nullptr;
+    int num_leds_ = 0;
+    uint8_t brightness_ = 255;
+    uint32_t frames_shown_ = 0;
+};
+
+extern CFastLED FastLED;
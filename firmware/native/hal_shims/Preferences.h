@@ -0,0 +1,38 @@
+// Native HAL shim: NVS-backed Preferences kept in process memory.
+// Values survive end()/begin() within one run, not across runs.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Arduino.h"
+
+class Preferences {
+public:
+    bool begin(const char* name, bool read_only = false, const char* partition_label = nullptr);
+    void end();
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    bool getBool(const char* key, bool default_value = false);
+    uint32_t getUInt(const char* key, uint32_t default_value = 0);
+    float getFloat(const char* key, float default_value = NAN);
+    String getString(const char* key, const String& default_value = String());
+    size_t getBytes(const char* key, void* buf, size_t max_len);
+    size_t getBytesLength(const char* key);
+
+    size_t putBool(const char* key, bool value);
+    size_t putUInt(const char* key, uint32_t value);
+    size_t putFloat(const char* key, float value);
+    size_t putString(const char* key, const String& value);
+    size_t putString(const char* key, const char* value);
+    size_t putBytes(const char* key, const void* value, size_t len);
+
+private:
+    std::string full_key(const char* key) const;
+
+    std::string namespace_;
+    bool started_ = false;
+    bool read_only_ = false;
+};
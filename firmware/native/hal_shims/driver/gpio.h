@@ -0,0 +1,9 @@
+// Native HAL shim: GPIO numbers only
+
+#pragma once
+
+typedef enum {
+    GPIO_NUM_NC = -1,
+    GPIO_NUM_0 = 0,
+    GPIO_NUM_MAX = 49
+} gpio_num_t;
@@ -0,0 +1,130 @@
+// Native HAL shim: ESP-IDF v5 I2S standard-mode RX driver.
+// Reads come from a host-supplied source (hal_i2s_set_source), or silence.
+// Channels with an on_recv callback get a fake DMA ring instead: each
+// hal_i2s_dma_run() step fills the next descriptor and fires the callback.
+// Struct layouts follow IDF field order so designated initializers compile.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../esp_err.h"
+#include "../freertos/FreeRTOS.h"
+#include "gpio.h"
+
+typedef enum { I2S_NUM_0 = 0, I2S_NUM_1 = 1, I2S_NUM_AUTO } i2s_port_t;
+typedef enum { I2S_ROLE_MASTER, I2S_ROLE_SLAVE } i2s_role_t;
+typedef enum {
+    I2S_DATA_BIT_WIDTH_8BIT = 8,
+    I2S_DATA_BIT_WIDTH_16BIT = 16,
+    I2S_DATA_BIT_WIDTH_24BIT = 24,
+    I2S_DATA_BIT_WIDTH_32BIT = 32
+} i2s_data_bit_width_t;
+typedef enum {
+    I2S_SLOT_BIT_WIDTH_AUTO = 0,
+    I2S_SLOT_BIT_WIDTH_8BIT = 8,
+    I2S_SLOT_BIT_WIDTH_16BIT = 16,
+    I2S_SLOT_BIT_WIDTH_24BIT = 24,
+    I2S_SLOT_BIT_WIDTH_32BIT = 32
+} i2s_slot_bit_width_t;
+typedef enum { I2S_SLOT_MODE_MONO = 1, I2S_SLOT_MODE_STEREO = 2 } i2s_slot_mode_t;
+typedef enum { I2S_STD_SLOT_LEFT = 1, I2S_STD_SLOT_RIGHT = 2, I2S_STD_SLOT_BOTH = 3 } i2s_std_slot_mask_t;
+typedef enum { I2S_CLK_SRC_DEFAULT = 0 } i2s_clock_src_t;
+typedef enum { I2S_MCLK_MULTIPLE_256 = 256 } i2s_mclk_multiple_t;
+
+#define I2S_GPIO_UNUSED GPIO_NUM_NC
+
+typedef struct hal_i2s_channel* i2s_chan_handle_t;
+
+typedef struct {
+    i2s_port_t id;
+    i2s_role_t role;
+    uint32_t dma_desc_num;
+    uint32_t dma_frame_num;
+    bool auto_clear;
+} i2s_chan_config_t;
+
+typedef struct {
+    uint32_t sample_rate_hz;
+    i2s_clock_src_t clk_src;
+    i2s_mclk_multiple_t mclk_multiple;
+} i2s_std_clk_config_t;
+
+typedef struct {
+    i2s_data_bit_width_t data_bit_width;
+    i2s_slot_bit_width_t slot_bit_width;
+    i2s_slot_mode_t slot_mode;
+    i2s_std_slot_mask_t slot_mask;
+    uint32_t ws_width;
+    bool ws_pol;
+    bool bit_shift;
+    bool left_align;
+    bool big_endian;
+    bool bit_order_lsb;
+} i2s_std_slot_config_t;
+
+typedef struct {
+    gpio_num_t mclk;
+    gpio_num_t bclk;
+    gpio_num_t ws;
+    gpio_num_t dout;
+    gpio_num_t din;
+    struct {
+        bool mclk_inv;
+        bool bclk_inv;
+        bool ws_inv;
+    } invert_flags;
+} i2s_std_gpio_config_t;
+
+typedef struct {
+    i2s_std_clk_config_t clk_cfg;
+    i2s_std_slot_config_t slot_cfg;
+    i2s_std_gpio_config_t gpio_cfg;
+} i2s_std_config_t;
+
+#define I2S_CHANNEL_DEFAULT_CONFIG(i2s_num, i2s_role) { \
+    .id = i2s_num, .role = i2s_role, .dma_desc_num = 6, .dma_frame_num = 240, .auto_clear = false }
+
+#define I2S_STD_CLK_DEFAULT_CONFIG(rate) { \
+    .sample_rate_hz = rate, .clk_src = I2S_CLK_SRC_DEFAULT, .mclk_multiple = I2S_MCLK_MULTIPLE_256 }
+
+// Event payload as of IDF 5.0-5.3: `data` is the secondary pointer to the
+// descriptor buffer that just completed
+typedef struct {
+    void* data;
+    size_t size;
+} i2s_event_data_t;
+
+typedef bool (*i2s_isr_callback_t)(i2s_chan_handle_t handle, i2s_event_data_t* event, void* user_ctx);
+
+typedef struct {
+    i2s_isr_callback_t on_recv;
+    i2s_isr_callback_t on_recv_q_ovf;
+    i2s_isr_callback_t on_sent;
+    i2s_isr_callback_t on_send_q_ovf;
+} i2s_event_callbacks_t;
+
+esp_err_t i2s_new_channel(const i2s_chan_config_t* chan_cfg, i2s_chan_handle_t* tx_handle,
+                          i2s_chan_handle_t* rx_handle);
+esp_err_t i2s_channel_init_std_mode(i2s_chan_handle_t handle, const i2s_std_config_t* std_cfg);
+esp_err_t i2s_channel_enable(i2s_chan_handle_t handle);
+esp_err_t i2s_channel_disable(i2s_chan_handle_t handle);
+esp_err_t i2s_del_channel(i2s_chan_handle_t handle);
+// Must be called before i2s_channel_enable(), as on IDF
+esp_err_t i2s_channel_register_event_callback(i2s_chan_handle_t handle,
+                                              const i2s_event_callbacks_t* callbacks, void* user_ctx);
+esp_err_t i2s_channel_read(i2s_chan_handle_t handle, void* dest, size_t size, size_t* bytes_read,
+                           uint32_t timeout_ms);
+
+// Host hook: fills `words` raw 32-bit slot words (as the mic DMA would) and
+// returns how many were produced. Fewer than requested reads as a timeout.
+typedef size_t (*hal_i2s_source_t)(uint32_t* dest, size_t words, void* ctx);
+void hal_i2s_set_source(hal_i2s_source_t source, void* ctx);
+
+// Fake DMA: completes up to `descriptors` buffers on every enabled channel
+// with an on_recv callback, in ring order, filling each from the source and
+// invoking on_recv inline (as the ISR would). Descriptors are reused
+// round-robin, so a consumer that falls dma_desc_num buffers behind sees them
+// overwritten exactly as on hardware. A short source read stalls the DMA.
+// Returns the number of descriptors completed.
+size_t hal_i2s_dma_run(size_t descriptors);
@@ -0,0 +1,109 @@
+// Native HAL shim: scalar ESP-DSP kernels used by the audio path
+
+#pragma once
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "esp_err.h"
+
+inline esp_err_t dsps_mulc_f32(const float* input, float* output, int len, float c, int step_in, int step_out) {
+    for (int i = 0; i < len; i++) output[i * step_out] = input[i * step_in] * c;
+    return ESP_OK;
+}
+
+inline esp_err_t dsps_addc_f32(const float* input, float* output, int len, float c, int step_in, int step_out) {
+    for (int i = 0; i < len; i++) output[i * step_out] = input[i * step_in] + c;
+    return ESP_OK;
+}
+
+inline esp_err_t dsps_add_f32(const float* input1, const float* input2, float* output, int len,
+                              int step1, int step2, int step_out) {
+    for (int i = 0; i < len; i++) output[i * step_out] = input1[i * step1] + input2[i * step2];
+    return ESP_OK;
+}
+
+inline esp_err_t dsps_mul_f32(const float* input1, const float* input2, float* output, int len,
+                              int step1, int step2, int step_out) {
+    for (int i = 0; i < len; i++) output[i * step_out] = input1[i * step1] * input2[i * step2];
+    return ESP_OK;
+}
+
+inline esp_err_t dsps_dotprod_f32(const float* src1, const float* src2, float* dest, int len) {
+    float acc = 0.0f;
+    for (int i = 0; i < len; i++) acc += src1[i] * src2[i];
+    *dest = acc;
+    return ESP_OK;
+}
+
+// Direct form II, matching dsps_biquad_f32_ansi: coef = {b0, b1, b2, a1, a2}
+inline esp_err_t dsps_biquad_f32(const float* input, float* output, int len, float* coef, float* w) {
+    for (int i = 0; i < len; i++) {
+        float d0 = input[i] - coef[3] * w[0] - coef[4] * w[1];
+        output[i] = coef[0] * d0 + coef[1] * w[0] + coef[2] * w[1];
+        w[1] = w[0];
+        w[0] = d0;
+    }
+    return ESP_OK;
+}
+
+// Radix-2 FFT, matching the dsps_fft2r_fc32_ansi contract: complex data
+// {re, im} interleaved, natural order in, bit-reversed order out (follow with
+// dsps_bit_rev_fc32), twiddles from a shared table sized by dsps_fft2r_init_fc32()
+inline std::vector<float>& dsps_fft2r_shim_table() {
+    static std::vector<float> table;
+    return table;
+}
+
+inline esp_err_t dsps_fft2r_init_fc32(float* fft_table_buff, int table_size) {
+    (void)fft_table_buff;
+    if (table_size < 2 || (table_size & (table_size - 1)) != 0) return ESP_ERR_INVALID_ARG;
+    std::vector<float>& table = dsps_fft2r_shim_table();
+    table.resize(table_size);
+    for (int k = 0; k < table_size / 2; k++) {
+        table[2 * k] = (float)std::cos(2.0 * M_PI * k / table_size);
+        table[2 * k + 1] = (float)-std::sin(2.0 * M_PI * k / table_size);
+    }
+    return ESP_OK;
+}
+
+inline void dsps_fft2r_deinit_fc32() {
+    dsps_fft2r_shim_table().clear();
+}
+
+inline esp_err_t dsps_fft2r_fc32(float* data, int N) {
+    const std::vector<float>& table = dsps_fft2r_shim_table();
+    if ((int)table.size() < N) return ESP_ERR_INVALID_ARG;
+    for (int half = N / 2; half >= 1; half >>= 1) {
+        const int stride = (int)table.size() / (2 * half);
+        for (int j = 0; j < half; j++) {
+            const float wr = table[2 * j * stride];
+            const float wi = table[2 * j * stride + 1];
+            for (int i = j; i < N; i += 2 * half) {
+                float* a = data + 2 * i;
+                float* b = data + 2 * (i + half);
+                const float dr = a[0] - b[0];
+                const float di = a[1] - b[1];
+                a[0] += b[0];
+                a[1] += b[1];
+                b[0] = dr * wr - di * wi;
+                b[1] = dr * wi + di * wr;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+inline esp_err_t dsps_bit_rev_fc32(float* data, int N) {
+    for (int i = 1, j = 0; i < N; i++) {
+        int bit = N >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            std::swap(data[2 * i], data[2 * j]);
+            std::swap(data[2 * i + 1], data[2 * j + 1]);
+        }
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,21 @@
+// Native HAL shim: heap_caps_* on the host heap
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <cstdlib>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_32BIT (1 << 1)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+inline void* heap_caps_malloc(size_t size, uint32_t) { return std::malloc(size); }
+inline void* heap_caps_calloc(size_t n, size_t size, uint32_t) { return std::calloc(n, size); }
+inline void heap_caps_free(void* ptr) { std::free(ptr); }
+inline size_t heap_caps_get_free_size(uint32_t) { return 256 * 1024; }
+inline size_t heap_caps_get_largest_free_block(uint32_t) { return 128 * 1024; }
+inline size_t heap_caps_get_minimum_free_size(uint32_t) { return 200 * 1024; }
@@ -0,0 +1,9 @@
+// Native HAL shim: esp_system.h heap/reset queries
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+inline uint32_t esp_get_free_heap_size() { return 256 * 1024; }
+inline uint32_t esp_get_minimum_free_heap_size() { return 200 * 1024; }
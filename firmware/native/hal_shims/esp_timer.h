@@ -0,0 +1,13 @@
+// Native HAL shim: esp_timer_get_time() (microseconds since start)
+
+#pragma once
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
+
+// Host test hooks: pin the clock to a fixed value (deterministic runs) or
+// return to the wall clock with hal_release_time()
+void hal_set_time_us(int64_t us);
+void hal_advance_time_us(int64_t us);
+void hal_release_time();
@@ -0,0 +1,43 @@
+// Native HAL shim: FreeRTOS base types. One tick = 1 ms.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t StackType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFu)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(((TickType_t)(ms) * (TickType_t)configTICK_RATE_HZ) / (TickType_t)1000U))
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+// Critical sections: a spinlock per mux, so host threads still exclude each other
+typedef struct {
+    std::atomic_flag flag = ATOMIC_FLAG_INIT;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {}
+
+inline void portENTER_CRITICAL(portMUX_TYPE* mux) {
+    while (mux->flag.test_and_set(std::memory_order_acquire)) {}
+}
+inline void portEXIT_CRITICAL(portMUX_TYPE* mux) {
+    mux->flag.clear(std::memory_order_release);
+}
+#define portENTER_CRITICAL_ISR portENTER_CRITICAL
+#define portEXIT_CRITICAL_ISR portEXIT_CRITICAL
+#define taskENTER_CRITICAL portENTER_CRITICAL
+#define taskEXIT_CRITICAL portEXIT_CRITICAL
+
+inline BaseType_t xPortGetCoreID() { return 0; }
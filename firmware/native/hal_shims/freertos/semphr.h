@@ -0,0 +1,16 @@
+// Native HAL shim: FreeRTOS semaphores on std::mutex + condition_variable
+
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef struct hal_semaphore* SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks_to_wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+
+#define xSemaphoreGiveFromISR(sem, woken) xSemaphoreGive(sem)
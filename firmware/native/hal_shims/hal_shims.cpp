@@ -0,0 +1,476 @@
+// Native HAL shim implementations: clock, Serial, FreeRTOS tasks/semaphores,
+// I2S RX source and the FastLED controller object.
+
+#include "Arduino.h"
+#include "FastLED.h"
+#include "esp_timer.h"
+#include "driver/i2s_std.h"
+#include "Preferences.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+CFastLED FastLED;
+
+// ============================================================================
+// CLOCK
+// ============================================================================
+
+namespace {
+
+const std::chrono::steady_clock::time_point kStart = std::chrono::steady_clock::now();
+std::atomic<bool> g_time_pinned{false};
+std::atomic<int64_t> g_pinned_us{0};
+
+}  // namespace
+
+int64_t esp_timer_get_time() {
+    if (g_time_pinned.load(std::memory_order_acquire)) {
+        return g_pinned_us.load(std::memory_order_relaxed);
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - kStart).count();
+}
+
+void hal_set_time_us(int64_t us) {
+    g_pinned_us.store(us, std::memory_order_relaxed);
+    g_time_pinned.store(true, std::memory_order_release);
+}
+
+void hal_advance_time_us(int64_t us) {
+    if (!g_time_pinned.load(std::memory_order_acquire)) {
+        hal_set_time_us(esp_timer_get_time());
+    }
+    g_pinned_us.fetch_add(us, std::memory_order_relaxed);
+}
+
+void hal_release_time() {
+    g_time_pinned.store(false, std::memory_order_release);
+}
+
+// Unaffected by hal_set_time_us(): profiling measures real host work
+uint32_t EspClass::getCycleCount() {
+    const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - kStart).count();
+    return (uint32_t)(ns * getCpuFreqMHz() / 1000);
+}
+
+uint32_t millis() { return (uint32_t)(esp_timer_get_time() / 1000); }
+uint32_t micros() { return (uint32_t)esp_timer_get_time(); }
+
+void delay(uint32_t ms) {
+    if (g_time_pinned.load(std::memory_order_acquire)) {
+        hal_advance_time_us((int64_t)ms * 1000);
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+    if (g_time_pinned.load(std::memory_order_acquire)) {
+        hal_advance_time_us(us);
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+const char* esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+        default: return "UNKNOWN_ERROR";
+    }
+}
+
+// ============================================================================
+// FREERTOS TASKS
+// ============================================================================
+
+struct hal_task {
+    std::thread::id id;
+    std::mutex notify_lock;
+    std::condition_variable notify_cv;
+    uint32_t notify_count = 0;
+};
+
+namespace {
+
+// Set by created tasks; other threads get a handle on first use
+thread_local hal_task* t_current_task = nullptr;
+
+}  // namespace
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack_depth,
+                                   void* param, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core_id) {
+    (void)name; (void)stack_depth; (void)priority; (void)core_id;
+    hal_task* task = new hal_task();
+    std::thread thread([fn, param, task]() {
+        t_current_task = task;
+        fn(param);
+    });
+    task->id = thread.get_id();
+    thread.detach();
+    if (handle) *handle = task;
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack_depth,
+                       void* param, UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(fn, name, stack_depth, param, priority, handle, tskNO_AFFINITY);
+}
+
+// Host threads cannot be killed from outside; a task deleting itself just returns
+void vTaskDelete(TaskHandle_t task) {
+    (void)task;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    delay(ticks * portTICK_PERIOD_MS);
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(millis() / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    if (t_current_task == nullptr) {
+        thread_local hal_task self;
+        self.id = std::this_thread::get_id();
+        t_current_task = &self;
+    }
+    return t_current_task;
+}
+
+// Waits on wall-clock time even when the clock is pinned, like xSemaphoreTake
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait) {
+    hal_task* task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> guard(task->notify_lock);
+    auto ready = [task]() { return task->notify_count > 0; };
+    if (ticks_to_wait == portMAX_DELAY) {
+        task->notify_cv.wait(guard, ready);
+    } else if (!task->notify_cv.wait_for(guard, std::chrono::milliseconds(ticks_to_wait * portTICK_PERIOD_MS), ready)) {
+        return 0;
+    }
+    uint32_t count = task->notify_count;
+    task->notify_count = clear_count_on_exit ? 0 : count - 1;
+    return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (task == nullptr) return pdFAIL;
+    {
+        std::lock_guard<std::mutex> guard(task->notify_lock);
+        task->notify_count++;
+    }
+    task->notify_cv.notify_one();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higher_priority_task_woken) {
+    xTaskNotifyGive(task);
+    if (higher_priority_task_woken) *higher_priority_task_woken = pdFALSE;
+}
+
+// ============================================================================
+// FREERTOS SEMAPHORES
+// ============================================================================
+
+// Mutexes and binary semaphores are counting semaphores with max_count 1
+struct hal_semaphore {
+    std::mutex lock;
+    std::condition_variable cv;
+    UBaseType_t count;
+    UBaseType_t max_count;
+};
+
+static SemaphoreHandle_t create_semaphore(UBaseType_t max_count, UBaseType_t initial_count) {
+    hal_semaphore* sem = new hal_semaphore();
+    sem->count = initial_count;
+    sem->max_count = max_count;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return create_semaphore(1, 1); }
+SemaphoreHandle_t xSemaphoreCreateBinary() { return create_semaphore(1, 0); }
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count) {
+    return create_semaphore(max_count, initial_count);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks_to_wait) {
+    if (sem == nullptr) return pdFALSE;
+    std::unique_lock<std::mutex> guard(sem->lock);
+    auto ready = [sem]() { return sem->count > 0; };
+    if (ticks_to_wait == portMAX_DELAY) {
+        sem->cv.wait(guard, ready);
+    } else if (!sem->cv.wait_for(guard, std::chrono::milliseconds(ticks_to_wait * portTICK_PERIOD_MS), ready)) {
+        return pdFALSE;
+    }
+    sem->count--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    if (sem == nullptr) return pdFALSE;
+    {
+        std::lock_guard<std::mutex> guard(sem->lock);
+        if (sem->count >= sem->max_count) return pdFALSE;
+        sem->count++;
+    }
+    sem->cv.notify_one();
+    return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    delete sem;
+}
+
+// ============================================================================
+// I2S RX
+// ============================================================================
+
+struct hal_i2s_channel {
+    bool enabled;
+    uint32_t sample_rate_hz;
+    uint32_t dma_desc_num;
+    uint32_t dma_frame_num;
+    uint32_t slot_words;
+    i2s_event_callbacks_t callbacks;
+    void* callback_ctx;
+    std::vector<std::vector<uint32_t>> dma_buffers;
+    void* dma_buffer_ptrs[16];
+    uint32_t dma_next;
+};
+
+namespace {
+
+hal_i2s_source_t g_i2s_source = nullptr;
+void* g_i2s_source_ctx = nullptr;
+std::vector<hal_i2s_channel*> g_i2s_channels;
+
+hal_i2s_channel* new_i2s_channel(const i2s_chan_config_t* chan_cfg) {
+    hal_i2s_channel* channel = new hal_i2s_channel{};
+    channel->dma_desc_num = chan_cfg->dma_desc_num;
+    channel->dma_frame_num = chan_cfg->dma_frame_num;
+    channel->slot_words = 2;
+    g_i2s_channels.push_back(channel);
+    return channel;
+}
+
+size_t fill_from_source(uint32_t* out, size_t words) {
+    if (g_i2s_source) return g_i2s_source(out, words, g_i2s_source_ctx);
+    for (size_t i = 0; i < words; i++) out[i] = 0;
+    return words;
+}
+
+}  // namespace
+
+void hal_i2s_set_source(hal_i2s_source_t source, void* ctx) {
+    g_i2s_source = source;
+    g_i2s_source_ctx = ctx;
+}
+
+esp_err_t i2s_new_channel(const i2s_chan_config_t* chan_cfg, i2s_chan_handle_t* tx_handle,
+                          i2s_chan_handle_t* rx_handle) {
+    if (chan_cfg == nullptr || (tx_handle == nullptr && rx_handle == nullptr)) return ESP_ERR_INVALID_ARG;
+    if (chan_cfg->dma_desc_num < 2 || chan_cfg->dma_desc_num > 16) return ESP_ERR_INVALID_ARG;
+    if (tx_handle) *tx_handle = new_i2s_channel(chan_cfg);
+    if (rx_handle) *rx_handle = new_i2s_channel(chan_cfg);
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_init_std_mode(i2s_chan_handle_t handle, const i2s_std_config_t* std_cfg) {
+    if (handle == nullptr || std_cfg == nullptr) return ESP_ERR_INVALID_ARG;
+    handle->sample_rate_hz = std_cfg->clk_cfg.sample_rate_hz;
+    if (std_cfg->slot_cfg.slot_bit_width != I2S_SLOT_BIT_WIDTH_32BIT) return ESP_ERR_NOT_SUPPORTED;
+    handle->slot_words = std_cfg->slot_cfg.slot_mode == I2S_SLOT_MODE_STEREO ? 2 : 1;
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_register_event_callback(i2s_chan_handle_t handle,
+                                              const i2s_event_callbacks_t* callbacks, void* user_ctx) {
+    if (handle == nullptr || callbacks == nullptr) return ESP_ERR_INVALID_ARG;
+    if (handle->enabled) return ESP_ERR_INVALID_STATE;
+    handle->callbacks = *callbacks;
+    handle->callback_ctx = user_ctx;
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_enable(i2s_chan_handle_t handle) {
+    if (handle == nullptr) return ESP_ERR_INVALID_ARG;
+    if (handle->callbacks.on_recv && handle->dma_buffers.empty()) {
+        handle->dma_buffers.assign(handle->dma_desc_num,
+                                   std::vector<uint32_t>(handle->dma_frame_num * handle->slot_words));
+        for (uint32_t i = 0; i < handle->dma_desc_num; i++) {
+            handle->dma_buffer_ptrs[i] = handle->dma_buffers[i].data();
+        }
+        handle->dma_next = 0;
+    }
+    handle->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_disable(i2s_chan_handle_t handle) {
+    if (handle == nullptr) return ESP_ERR_INVALID_ARG;
+    handle->enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t i2s_del_channel(i2s_chan_handle_t handle) {
+    g_i2s_channels.erase(std::remove(g_i2s_channels.begin(), g_i2s_channels.end(), handle),
+                         g_i2s_channels.end());
+    delete handle;
+    return ESP_OK;
+}
+
+size_t hal_i2s_dma_run(size_t descriptors) {
+    size_t completed = 0;
+    for (hal_i2s_channel* channel : g_i2s_channels) {
+        if (!channel->enabled || channel->callbacks.on_recv == nullptr) continue;
+        for (size_t n = 0; n < descriptors; n++) {
+            std::vector<uint32_t>& buffer = channel->dma_buffers[channel->dma_next];
+            if (fill_from_source(buffer.data(), buffer.size()) < buffer.size()) break;
+            i2s_event_data_t event = {&channel->dma_buffer_ptrs[channel->dma_next],
+                                      buffer.size() * sizeof(uint32_t)};
+            channel->dma_next = (channel->dma_next + 1) % channel->dma_desc_num;
+            channel->callbacks.on_recv(channel, &event, channel->callback_ctx);
+            completed++;
+        }
+    }
+    return completed;
+}
+
+esp_err_t i2s_channel_read(i2s_chan_handle_t handle, void* dest, size_t size, size_t* bytes_read,
+                           uint32_t timeout_ms) {
+    (void)timeout_ms;
+    if (bytes_read) *bytes_read = 0;
+    if (handle == nullptr || dest == nullptr) return ESP_ERR_INVALID_ARG;
+    if (!handle->enabled) return ESP_ERR_INVALID_STATE;
+
+    size_t words = size / sizeof(uint32_t);
+    uint32_t* out = static_cast<uint32_t*>(dest);
+    size_t produced = fill_from_source(out, words);
+
+    if (bytes_read) *bytes_read = produced * sizeof(uint32_t);
+    return produced < words ? ESP_ERR_TIMEOUT : ESP_OK;
+}
+
+// ============================================================================
+// PREFERENCES
+// ============================================================================
+
+namespace {
+
+std::mutex g_prefs_lock;
+
+std::map<std::string, std::string>& prefs_store() {
+    static std::map<std::string, std::string> store;
+    return store;
+}
+
+}  // namespace
+
+bool Preferences::begin(const char* name, bool read_only, const char* partition_label) {
+    (void)partition_label;
+    if (name == nullptr) return false;
+    namespace_ = name;
+    read_only_ = read_only;
+    started_ = true;
+    return true;
+}
+
+void Preferences::end() {
+    started_ = false;
+}
+
+std::string Preferences::full_key(const char* key) const {
+    return namespace_ + "/" + (key ? key : "");
+}
+
+bool Preferences::clear() {
+    if (!started_ || read_only_) return false;
+    std::lock_guard<std::mutex> guard(g_prefs_lock);
+    const std::string prefix = namespace_ + "/";
+    auto& store = prefs_store();
+    for (auto it = store.begin(); it != store.end();) {
+        if (it->first.compare(0, prefix.size(), prefix) == 0) it = store.erase(it);
+        else ++it;
+    }
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!started_ || read_only_) return false;
+    std::lock_guard<std::mutex> guard(g_prefs_lock);
+    return prefs_store().erase(full_key(key)) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    if (!started_) return false;
+    std::lock_guard<std::mutex> guard(g_prefs_lock);
+    return prefs_store().count(full_key(key)) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+    if (!started_ || read_only_ || key == nullptr || (value == nullptr && len > 0)) return 0;
+    std::lock_guard<std::mutex> guard(g_prefs_lock);
+    prefs_store()[full_key(key)] = std::string(static_cast<const char*>(value), len);
+    return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    if (!started_) return 0;
+    std::lock_guard<std::mutex> guard(g_prefs_lock);
+    auto it = prefs_store().find(full_key(key));
+    return it == prefs_store().end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t max_len) {
+    if (!started_ || buf == nullptr) return 0;
+    std::lock_guard<std::mutex> guard(g_prefs_lock);
+    auto it = prefs_store().find(full_key(key));
+    if (it == prefs_store().end() || it->second.size() > max_len) return 0;
+    std::memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+template <typename T>
+static T prefs_get_value(Preferences& prefs, const char* key, T default_value) {
+    T value;
+    if (prefs.getBytesLength(key) != sizeof(T) || prefs.getBytes(key, &value, sizeof(T)) != sizeof(T)) {
+        return default_value;
+    }
+    return value;
+}
+
+bool Preferences::getBool(const char* key, bool default_value) { return prefs_get_value(*this, key, default_value); }
+uint32_t Preferences::getUInt(const char* key, uint32_t default_value) { return prefs_get_value(*this, key, default_value); }
+float Preferences::getFloat(const char* key, float default_value) { return prefs_get_value(*this, key, default_value); }
+
+String Preferences::getString(const char* key, const String& default_value) {
+    size_t len = getBytesLength(key);
+    if (!isKey(key)) return default_value;
+    std::string value(len, '\0');
+    getBytes(key, &value[0], len);
+    return String(value);
+}
+
+size_t Preferences::putBool(const char* key, bool value) { return putBytes(key, &value, sizeof(value)); }
+size_t Preferences::putUInt(const char* key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+size_t Preferences::putFloat(const char* key, float value) { return putBytes(key, &value, sizeof(value)); }
+size_t Preferences::putString(const char* key, const String& value) { return putBytes(key, value.data(), value.size()); }
+size_t Preferences::putString(const char* key, const char* value) { return putString(key, String(value)); }
@@ -0,0 +1,265 @@
+// Host audio sources implementation (see host_audio_sources.h)
+
+#include "host_audio_sources.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "audio/audio_config.h"
+#include "audio/mic_frontend.h"
+
+int64_t host_monotonic_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t rd_u32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint16_t rd_u16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint64_t rd_u64(const uint8_t* p) { return rd_u32(p) | ((uint64_t)rd_u32(p + 4) << 32); }
+
+// ============================================================================
+// WAV LOADING
+// ============================================================================
+
+// Decode to mono float (-1.0..1.0). Returns false with a message on bad input.
+static bool load_wav(const std::string& path, std::vector<float>& mono, uint32_t& rate, std::string& err) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) { err = "cannot open " + path; return false; }
+    std::vector<uint8_t> buf((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    if (buf.size() < 12 || memcmp(buf.data(), "RIFF", 4) != 0 || memcmp(buf.data() + 8, "WAVE", 4) != 0) {
+        err = "not a RIFF/WAVE file"; return false;
+    }
+
+    uint16_t format = 0, channels = 0, bits = 0;
+    const uint8_t* data = nullptr;
+    size_t data_len = 0;
+    size_t pos = 12;
+    while (pos + 8 <= buf.size()) {
+        const uint8_t* ck = buf.data() + pos;
+        uint32_t len = rd_u32(ck + 4);
+        size_t avail = std::min<size_t>(len, buf.size() - pos - 8);
+        if (memcmp(ck, "fmt ", 4) == 0 && avail >= 16) {
+            format = rd_u16(ck + 8);
+            channels = rd_u16(ck + 10);
+            rate = rd_u32(ck + 12);
+            bits = rd_u16(ck + 22);
+            if (format == 0xFFFE && avail >= 26) format = rd_u16(ck + 32);  // WAVE_FORMAT_EXTENSIBLE sub-format
+        } else if (memcmp(ck, "data", 4) == 0) {
+            data = ck + 8;
+            data_len = avail;
+        }
+        pos += 8 + len + (len & 1);
+    }
+    if (!data || channels == 0 || rate == 0) { err = "missing fmt or data chunk"; return false; }
+    bool pcm = (format == 1 && (bits == 16 || bits == 24 || bits == 32));
+    bool flt = (format == 3 && bits == 32);
+    if (!pcm && !flt) { err = "unsupported format " + std::to_string(format) + "/" + std::to_string(bits) + "-bit"; return false; }
+
+    const size_t bytes = bits / 8;
+    const size_t frames = data_len / (bytes * channels);
+    mono.resize(frames);
+    for (size_t i = 0; i < frames; ++i) {
+        float acc = 0.0f;
+        for (uint16_t c = 0; c < channels; ++c) {
+            const uint8_t* s = data + (i * channels + c) * bytes;
+            float v;
+            if (flt) { uint32_t u = rd_u32(s); memcpy(&v, &u, 4); }
+            else if (bits == 16) v = (int16_t)rd_u16(s) / 32768.0f;
+            else if (bits == 24) v = (int32_t)((s[0] << 8) | (s[1] << 16) | ((uint32_t)s[2] << 24)) / 2147483648.0f;
+            else v = (int32_t)rd_u32(s) / 2147483648.0f;
+            acc += v;
+        }
+        mono[i] = acc / channels;
+    }
+    return true;
+}
+
+// Resample to the firmware capture rate. Downsampling averages the source
+// samples under each output period (boxcar anti-alias) before interpolating;
+// crude, but deterministic and enough for regression runs.
+static std::vector<float> resample(const std::vector<float>& in, uint32_t from, uint32_t to) {
+    if (from == to || in.empty()) return in;
+    const double step = (double)from / to;
+    std::vector<float> src = in;
+    const size_t width = step > 1.0 ? (size_t)step : 1;
+    if (width > 1) {
+        double acc = 0.0;
+        for (size_t i = 0; i < in.size(); ++i) {
+            acc += in[i];
+            if (i >= width) acc -= in[i - width];
+            src[i] = (float)(acc / (double)std::min(i + 1, width));
+        }
+    }
+    size_t n = (size_t)((double)in.size() * to / from);
+    std::vector<float> out(n);
+    for (size_t i = 0; i < n; ++i) {
+        double x = i * step;
+        size_t i0 = (size_t)x;
+        size_t i1 = std::min(i0 + 1, src.size() - 1);
+        float t = (float)(x - i0);
+        out[i] = src[i0] + (src[i1] - src[i0]) * t;
+    }
+    return out;
+}
+
+// ============================================================================
+// WAV FILE SOURCE
+// ============================================================================
+
+static esp_err_t wav_read_chunk(void* ctx, uint32_t* scratch, uint32_t** words, uint32_t timeout_ms) {
+    (void)timeout_ms;
+    WavFileSource* src = static_cast<WavFileSource*>(ctx);
+    const size_t size = src->samples.size();
+    for (size_t i = 0; i < AUDIO_CAPTURE_CHUNK_SIZE; ++i) {
+        if (src->loop && size > 0 && src->cursor >= size) src->cursor = 0;
+        const float s = (src->cursor < size) ? src->samples[src->cursor++] : 0.0f;
+        scratch[i] = mic_frontend_encode_sample(s);
+    }
+    *words = scratch;
+    return ESP_OK;
+}
+
+bool wav_file_source_open(WavFileSource* src, const std::string& path, bool loop, std::string* err) {
+    std::vector<float> raw;
+    uint32_t rate = 0;
+    std::string message;
+    if (!load_wav(path, raw, rate, message)) {
+        if (err) *err = message;
+        return false;
+    }
+    src->source = {"wav", wav_read_chunk, src};
+    src->samples = resample(raw, rate, AUDIO_CAPTURE_RATE_HZ);
+    src->file_rate_hz = rate;
+    src->cursor = 0;
+    src->loop = loop;
+    return true;
+}
+
+size_t wav_file_source_chunks(const WavFileSource* src) {
+    return src->samples.size() / AUDIO_CAPTURE_CHUNK_SIZE;
+}
+
+bool wav_file_source_finished(const WavFileSource* src) {
+    return !src->loop && src->cursor >= src->samples.size();
+}
+
+// ============================================================================
+// UDP PCM SOURCE
+// ============================================================================
+
+static void udp_push_samples(UdpPcmSource* src, const uint8_t* pcm, size_t samples, int64_t sent_us) {
+    const size_t cap = src->ring.size();
+    for (size_t i = 0; i < samples; ++i) {
+        if (src->count == cap) {  // Consumer fell behind: drop the oldest
+            src->head = (src->head + 1) % cap;
+            src->count--;
+            src->overflow_samples++;
+        }
+        const size_t at = (src->head + src->count) % cap;
+        src->ring[at] = (int16_t)rd_u16(pcm + 2 * i) / 32768.0f;
+        src->sent_us[at] = sent_us;
+        src->count++;
+    }
+}
+
+// Read every datagram already queued on the socket
+static void udp_drain_socket(UdpPcmSource* src) {
+    uint8_t packet[UDP_PCM_HEADER_BYTES + 2 * UDP_PCM_MAX_SAMPLES];
+    for (;;) {
+        const ssize_t len = recv(src->fd, packet, sizeof(packet), MSG_DONTWAIT);
+        if (len < 0) return;  // EAGAIN: queue empty
+        const size_t samples = (len >= UDP_PCM_HEADER_BYTES) ? rd_u16(packet + 20) : 0;
+        if (len < UDP_PCM_HEADER_BYTES || memcmp(packet, UDP_PCM_MAGIC, 4) != 0 ||
+            samples > UDP_PCM_MAX_SAMPLES || (size_t)len != UDP_PCM_HEADER_BYTES + 2 * samples ||
+            rd_u32(packet + 16) != AUDIO_CAPTURE_RATE_HZ) {
+            if (src->bad_packets++ == 0) {
+                fprintf(stderr, "udp_pcm: dropping malformed packet (%zd bytes; need \"%s\" header, %u Hz)\n",
+                        len, UDP_PCM_MAGIC, (unsigned)AUDIO_CAPTURE_RATE_HZ);
+            }
+            continue;
+        }
+        const uint32_t seq = rd_u32(packet + 4);
+        if (src->have_seq && seq != src->next_seq) {
+            src->lost_packets += (uint32_t)(seq - src->next_seq);
+        }
+        src->have_seq = true;
+        src->next_seq = seq + 1;
+        src->packets++;
+        udp_push_samples(src, packet + UDP_PCM_HEADER_BYTES, samples, (int64_t)rd_u64(packet + 8));
+    }
+}
+
+static esp_err_t udp_read_chunk(void* ctx, uint32_t* scratch, uint32_t** words, uint32_t timeout_ms) {
+    UdpPcmSource* src = static_cast<UdpPcmSource*>(ctx);
+    const int64_t deadline_us = host_monotonic_us() + (int64_t)timeout_ms * 1000;
+    udp_drain_socket(src);
+    while (src->count < AUDIO_CAPTURE_CHUNK_SIZE) {
+        const int64_t left_us = deadline_us - host_monotonic_us();
+        if (left_us <= 0) return ESP_ERR_TIMEOUT;
+        pollfd pfd = {src->fd, POLLIN, 0};
+        const int ready = poll(&pfd, 1, (int)((left_us + 999) / 1000));
+        if (ready < 0 && errno != EINTR) return ESP_FAIL;
+        udp_drain_socket(src);
+    }
+
+    const size_t cap = src->ring.size();
+    for (size_t i = 0; i < AUDIO_CAPTURE_CHUNK_SIZE; ++i) {
+        scratch[i] = mic_frontend_encode_sample(src->ring[src->head]);
+        src->chunk_sent_us = src->sent_us[src->head];
+        src->head = (src->head + 1) % cap;
+    }
+    src->count -= AUDIO_CAPTURE_CHUNK_SIZE;
+    *words = scratch;
+    return ESP_OK;
+}
+
+bool udp_pcm_source_open(UdpPcmSource* src, uint16_t port, std::string* err) {
+    src->fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (src->fd < 0) {
+        if (err) *err = std::string("socket: ") + strerror(errno);
+        return false;
+    }
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = sizeof(addr);
+    if (bind(src->fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        getsockname(src->fd, reinterpret_cast<sockaddr*>(&addr), &addr_len) != 0) {
+        if (err) *err = "bind 127.0.0.1:" + std::to_string(port) + ": " + strerror(errno);
+        close(src->fd);
+        src->fd = -1;
+        return false;
+    }
+
+    src->source = {"udp", udp_read_chunk, src};
+    src->port = ntohs(addr.sin_port);
+    src->ring.assign(UDP_PCM_BUFFER_SAMPLES, 0.0f);
+    src->sent_us.assign(UDP_PCM_BUFFER_SAMPLES, 0);
+    src->head = 0;
+    src->count = 0;
+    src->next_seq = 0;
+    src->have_seq = false;
+    src->chunk_sent_us = 0;
+    src->packets = 0;
+    src->lost_packets = 0;
+    src->bad_packets = 0;
+    src->overflow_samples = 0;
+    return true;
+}
+
+void udp_pcm_source_close(UdpPcmSource* src) {
+    if (src->fd >= 0) close(src->fd);
+    src->fd = -1;
+}
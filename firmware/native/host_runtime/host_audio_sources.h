@@ -0,0 +1,89 @@
+// Host audio sources: AudioSource stand-ins for the I2S microphone
+// (src/audio/audio_source.h), for driving the full pipeline on Linux.
+//
+//   WavFileSource: a WAV file mixed to mono and resampled to
+//     AUDIO_CAPTURE_RATE_HZ, one chunk per read, never blocks. Deterministic;
+//     for regression runs (tools/wav_replay.cpp) and throughput benchmarks.
+//   UdpPcmSource: int16 PCM datagrams on 127.0.0.1, blocking up to the read
+//     timeout like the microphone does. Packets carry the sender's
+//     CLOCK_MONOTONIC send time, so audio -> LED latency can be measured on
+//     one machine (tools/udp_pcm_send.py, tools/audio_pipeline_bench.cpp).
+//
+//   WavFileSource wav;
+//   wav_file_source_open(&wav, "track.wav", false, &err);
+//   audio_source_select(&wav.source);
+//   ... host_audio_step(); ...
+//   audio_source_select(nullptr);   // back to I2S before wav goes away
+//
+// UDP packet (little-endian):
+//   0  char[4]  "K1PC"
+//   4  u32      sequence number (gaps count as lost packets)
+//   8  u64      send time, CLOCK_MONOTONIC microseconds
+//   16 u32      sample rate (must equal AUDIO_CAPTURE_RATE_HZ)
+//   20 u16      sample count (<= UDP_PCM_MAX_SAMPLES)
+//   22 u16      reserved (0)
+//   24 i16      samples[count]
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "audio/audio_source.h"
+
+#define UDP_PCM_MAGIC          "K1PC"
+#define UDP_PCM_HEADER_BYTES   24
+#define UDP_PCM_MAX_SAMPLES    1024
+#define UDP_PCM_BUFFER_SAMPLES 32768   // ~2.5 s at 12.8 kHz; oldest samples drop beyond this
+
+// ============================================================================
+// WAV FILE
+// ============================================================================
+
+struct WavFileSource {
+    AudioSource source;           // Pass &source to audio_source_select()
+    std::vector<float> samples;   // Mono, AUDIO_CAPTURE_RATE_HZ, -1.0..1.0
+    uint32_t file_rate_hz;        // Rate before resampling
+    size_t cursor;                // Next sample to deliver
+    bool loop;                    // Wrap at the end; otherwise pad with silence
+};
+
+// Load path (PCM 16/24/32-bit or 32-bit float, any channel count, any rate).
+// Returns false with a message in *err on unreadable or unsupported files.
+bool wav_file_source_open(WavFileSource* src, const std::string& path, bool loop, std::string* err);
+
+// Whole chunks in the file
+size_t wav_file_source_chunks(const WavFileSource* src);
+
+// True once every sample has been delivered (never when looping)
+bool wav_file_source_finished(const WavFileSource* src);
+
+// ============================================================================
+// UDP PCM
+// ============================================================================
+
+struct UdpPcmSource {
+    AudioSource source;           // Pass &source to audio_source_select()
+    int fd;
+    uint16_t port;                // Bound port (resolved when opened with 0)
+    std::vector<float> ring;      // Received samples not yet delivered
+    std::vector<int64_t> sent_us; // Send time of the packet each sample came in
+    size_t head;                  // Oldest buffered sample
+    size_t count;                 // Buffered samples
+    uint32_t next_seq;
+    bool have_seq;
+    int64_t chunk_sent_us;        // Send time of the newest sample in the last chunk read
+    uint64_t packets;             // Accepted packets
+    uint64_t lost_packets;        // Sequence gaps
+    uint64_t bad_packets;         // Wrong magic, size or sample rate
+    uint64_t overflow_samples;    // Dropped because the consumer fell behind
+};
+
+// Bind 127.0.0.1:port (0 picks a free port; see src->port). Returns false with
+// a message in *err if the socket cannot be bound.
+bool udp_pcm_source_open(UdpPcmSource* src, uint16_t port, std::string* err);
+void udp_pcm_source_close(UdpPcmSource* src);
+
+// CLOCK_MONOTONIC in microseconds: the clock packets are stamped with
+int64_t host_monotonic_us();
@@ -0,0 +1,186 @@
+// Host runtime implementation (see host_runtime.h)
+
+#include "host_runtime.h"
+
+#include <Arduino.h>
+#include <cstring>
+
+#include "audio/goertzel.h"
+#include "audio/tempo.h"
+#include "audio/microphone.h"
+#include "audio/mic_frontend.h"
+#include "audio/vu.h"
+#include "audio/validation/tempo_validation.h"
+#include "beat_events.h"
+#include "color_pipeline.h"
+#include "led_driver.h"
+#include "parameters.h"
+#include "pattern_execution.h"
+#include "pattern_render_context.h"
+#include "shared_pattern_buffers.h"
+#include "transitions/transition_adapter.hpp"
+
+// Debug toggles owned by main.cpp on device
+bool audio_debug_enabled = false;
+bool tempo_debug_enabled = false;
+bool audio_trace_enabled = false;
+
+static void reset_classic_tempo_bins() {
+    for (uint16_t i = 0; i < NUM_TEMPI; ++i) {
+        tempi[i].magnitude = 0.0f;
+        tempi[i].magnitude_full_scale = 0.0f;
+        tempi_smooth[i] = 0.0f;
+    }
+    tempi_power_sum = 0.0f;
+    reset_beat_tracker();
+}
+
+float host_best_bpm() {
+    float max_magnitude = 0.0f;
+    uint16_t best_bin = 0;
+    for (uint16_t i = 0; i < NUM_TEMPI; i++) {
+        if (tempi_smooth[i] > max_magnitude) {
+            max_magnitude = tempi_smooth[i];
+            best_bin = i;
+        }
+    }
+
+    float weighted_hz_sum = 0.0f;
+    float weight_sum = 0.0f;
+    for (int8_t offset = -1; offset <= 1; ++offset) {
+        int32_t idx = static_cast<int32_t>(best_bin) + offset;
+        if (idx < 0 || idx >= static_cast<int32_t>(NUM_TEMPI)) continue;
+        float w = tempi_smooth[idx];
+        if (w <= 0.0f) continue;
+        weighted_hz_sum += w * tempi_bpm_values_hz[idx];
+        weight_sum += w;
+    }
+
+    float bpm = 120.0f;
+    if (weight_sum > 0.0f) bpm = (weighted_hz_sum / weight_sum) * 60.0f;
+    return roundf(bpm * 2.0f) / 2.0f;
+}
+
+// Confidence + refractory gating from audio_task()
+static bool beat_gate(uint32_t now_ms) {
+    static uint32_t last_beat_event_ms = 0;
+
+    float novelty_recent = novelty_curve_normalized[NOVELTY_HISTORY_LENGTH - 1];
+    float adaptive = get_params().beat_threshold + (0.20f * (1.0f - silence_level)) +
+                     (0.10f * fminf(novelty_recent, 1.0f));
+    if (audio_level < VU_LOCK_GATE) return false;
+
+    float bpm_for_period = fmaxf(30.0f, fminf(200.0f, host_best_bpm()));
+    uint32_t expected_period_ms = (uint32_t)(60000.0f / bpm_for_period);
+    OctaveRelationship octave_rel = get_current_octave_relationship();
+    float refractory_multiplier = 0.6f;
+    if (octave_rel.relationship >= 1.8f && octave_rel.relationship <= 2.2f) {
+        refractory_multiplier = 0.3f;
+    }
+    uint32_t refractory_ms = (uint32_t)(expected_period_ms * refractory_multiplier);
+    if (refractory_ms < 200) refractory_ms = 200;
+
+    if (tempo_confidence <= adaptive || (now_ms - last_beat_event_ms) < refractory_ms) return false;
+
+    uint32_t ts_us = (uint32_t)esp_timer_get_time();
+    if (ts_us == 0) ts_us = 1;
+    uint16_t conf_u16 = (uint16_t)(fminf(tempo_confidence, 1.0f) * 65535.0f);
+    if (conf_u16 == 0) conf_u16 = 1;
+    if (!beat_events_push(ts_us, conf_u16)) return false;
+    last_beat_event_ms = now_ms;
+    return true;
+}
+
+void host_runtime_init() {
+    init_rmt_driver();
+    init_audio_stubs();
+    init_i2s_microphone();
+    init_audio_data_sync();
+    init_goertzel_constants_musical();
+    init_vu();
+    init_tempo_goertzel_constants();
+    load_audio_warm_start();
+    beat_events_init(128);
+    init_params();
+    init_pattern_registry();
+    init_shared_pattern_buffers();
+}
+
+bool host_audio_step() {
+    if (audio_source_active() == &audio_source_i2s) {
+        hal_i2s_dma_run(1);  // The DMA ring completes one chunk per audio period
+    }
+    acquire_sample_chunk();
+    calculate_magnitudes();
+    get_chromagram();
+
+    t_now_us = micros();
+    t_now_ms = millis();
+
+    run_vu();
+    update_novelty();
+
+    bool silence_frame = !audio_input_is_active();
+    static bool prev_silence_frame = true;
+    if (silence_frame || prev_silence_frame) {
+        tempo_confidence = 0.0f;
+        reset_classic_tempo_bins();
+    }
+    prev_silence_frame = silence_frame;
+
+    static uint32_t last_phase_us = 0;
+    if (!silence_frame) {
+        update_tempo();
+
+        if (last_phase_us == 0) last_phase_us = t_now_us;
+        uint32_t dt_us = t_now_us - last_phase_us;
+        last_phase_us = t_now_us;
+        float delta = dt_us / (1000000.0f / REFERENCE_FPS);
+        if (delta > 5.0f) delta = 5.0f;
+        update_tempi_phase(delta);
+    } else {
+        last_phase_us = t_now_us;
+    }
+
+    audio_back.payload.tempo_confidence = tempo_confidence;
+    audio_back.payload.is_valid = true;
+    audio_back.payload.is_silence = silence_frame;
+    audio_back.payload.locked_tempo_bpm = tempo_lock_tracker.locked_tempo_bpm;
+    audio_back.payload.tempo_lock_state = tempo_lock_tracker.state;
+    for (uint16_t i = 0; i < NUM_TEMPI; i++) {
+        audio_back.payload.tempo_magnitude[i] = tempi_smooth[i];
+        audio_back.payload.tempo_phase[i] = tempi[i].phase;
+    }
+
+    finish_audio_frame();
+    service_audio_warm_start(t_now_ms);
+
+    return !silence_frame && beat_gate(millis());
+}
+
+void host_render_frame(float time_s) {
+    const PatternParameters& params = get_params();
+    extern uint8_t g_pattern_channel_index;
+    g_pattern_channel_index = g_transition_adapter.getLiveChannel();
+    global_brightness = 1.0f;
+
+#if AUDIO_TRIPLE_BUFFER_ENABLED
+    const AudioDataSnapshot& audio_snapshot = *acquire_audio_frame();
+#else
+    AudioDataSnapshot audio_snapshot;
+    get_audio_snapshot(&audio_snapshot);
+#endif
+    PatternRenderContext context(leds, NUM_LEDS, time_s, params, audio_snapshot);
+    if (g_transition_adapter.isActive()) {
+        g_transition_adapter.update(context);
+    } else {
+        draw_current_pattern(context);
+    }
+
+    apply_color_pipeline(params);
+    transmit_leds();
+}
+
+uint32_t host_i2s_word(float sample) {
+    return mic_frontend_encode_sample(sample);
+}
@@ -0,0 +1,38 @@
+// Host runtime: the slice of main.cpp the DSP and render paths need, without
+// Wi-Fi, web server, RMT or FreeRTOS tasks. Lets host tests and profilers
+// (perf, cachegrind) drive the real audio and pattern code one step at a time:
+//
+//   host_runtime_init();
+//   hal_i2s_set_source(my_source, ctx);   // optional, silence otherwise
+//   audio_source_select(&wav.source);     // or bypass I2S (host_audio_sources.h)
+//   for (...) { host_audio_step(); host_render_frame(t); }
+//
+// Steps mirror audio_task() and loop_gpu(); keep them in sync when those change.
+
+#pragma once
+
+#include <stdint.h>
+#include <driver/i2s_std.h>
+
+// setup() minus network, RMT and task creation
+void host_runtime_init();
+
+// One audio_task() iteration: the fake I2S DMA completes one chunk (I2S
+// source only), then acquire -> Goertzel -> chromagram -> VU -> novelty ->
+// tempo -> publish -> warm-start save (if due) -> beat gate. Diagnostics
+// logging is skipped.
+// Returns true if a beat event was pushed this step.
+bool host_audio_step();
+
+// get_best_bpm() from main.cpp: weighted BPM around the strongest tempo bin
+float host_best_bpm();
+
+// One loop_gpu() iteration: render the current pattern (or the active
+// transition) -> color pipeline -> transmit_leds(). time_s is the pattern
+// animation time.
+void host_render_frame(float time_s);
+
+// Raw I2S slot word that mic_frontend's integer stage and scale convert back
+// to `sample` (-1.0..1.0), for hal_i2s_set_source() callbacks. The DC blocker
+// is not inverted: DC in the source is removed as it would be on hardware.
+uint32_t host_i2s_word(float sample);
@@ -0,0 +1,88 @@
+// Syntax-check shim: ArduinoJson 6 surface used by the web server.
+// Declarations only, permissive by design (every node is a JsonVariant), so
+// it catches typos, wrong arity and type errors in our code, not misuse of
+// the library. Never linked; see platformio.ini [env:native] for the command.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Arduino.h"
+
+class JsonVariant;
+typedef JsonVariant JsonObject;
+typedef JsonVariant JsonArray;
+typedef JsonVariant JsonObjectConst;
+typedef JsonVariant JsonArrayConst;
+typedef JsonVariant JsonVariantConst;
+
+class JsonVariant {
+public:
+    JsonVariant() {}
+
+    template <typename T> JsonVariant& operator=(const T&) { return *this; }
+    template <typename T> JsonVariant operator[](const T&) const { return JsonVariant(); }
+    template <typename T> operator T() const { return T(); }
+
+    template <typename T> T as() const { return T(); }
+    template <typename T> bool is() const { return false; }
+    template <typename T> T operator|(const T& fallback) const { return fallback; }
+    const char* operator|(const char* fallback) const { return fallback; }
+
+    template <typename T> bool set(const T&) { return true; }
+    template <typename T> bool add(const T&) { return true; }
+    template <typename T> bool containsKey(const T&) const { return false; }
+    template <typename T> void remove(const T&) {}
+    JsonObject createNestedObject() { return JsonObject(); }
+    JsonArray createNestedArray() { return JsonArray(); }
+    template <typename T> JsonObject createNestedObject(const T&) { return JsonObject(); }
+    template <typename T> JsonArray createNestedArray(const T&) { return JsonArray(); }
+    bool isNull() const { return true; }
+    size_t size() const { return 0; }
+    void clear() {}
+
+    const JsonVariant* begin() const { return nullptr; }
+    const JsonVariant* end() const { return nullptr; }
+    const char* key() const { return ""; }
+    JsonVariant value() const { return JsonVariant(); }
+};
+
+class JsonDocument : public JsonVariant {
+public:
+    template <typename T> JsonDocument& operator=(const T&) { return *this; }
+    template <typename T> T to() { return T(); }
+    size_t capacity() const { return 0; }
+    size_t memoryUsage() const { return 0; }
+    bool overflowed() const { return false; }
+};
+
+template <size_t N>
+class StaticJsonDocument : public JsonDocument {};
+
+class DynamicJsonDocument : public JsonDocument {
+public:
+    explicit DynamicJsonDocument(size_t) {}
+};
+
+class DeserializationError {
+public:
+    enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory, TooDeep };
+    DeserializationError(Code code = Ok) : code_(code) {}
+    Code code() const { return code_; }
+    const char* c_str() const { return ""; }
+    explicit operator bool() const { return code_ != Ok; }
+    bool operator==(Code code) const { return code_ == code; }
+    bool operator!=(Code code) const { return code_ != code; }
+
+private:
+    Code code_;
+};
+
+template <typename Input>
+DeserializationError deserializeJson(JsonDocument&, const Input&) { return DeserializationError(); }
+template <typename Input>
+DeserializationError deserializeJson(JsonDocument&, Input*, size_t) { return DeserializationError(); }
+
+size_t serializeJson(const JsonVariant&, String&);
+size_t serializeJson(const JsonVariant&, char*, size_t);
+size_t measureJson(const JsonVariant&);
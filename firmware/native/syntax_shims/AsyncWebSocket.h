@@ -0,0 +1,4 @@
+// Syntax-check shim: the real header comes with ESPAsyncWebServer
+#pragma once
+
+#include "ESPAsyncWebServer.h"
@@ -0,0 +1,197 @@
+// Syntax-check shim: ESPAsyncWebServer (server, requests, WebSocket) as used
+// by webserver*.cpp. Declarations only, following the library's signatures;
+// never linked. See platformio.ini [env:native] for the command.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include "Arduino.h"
+#include "WiFi.h"
+#include "SPIFFS.h"
+
+// ============================================================================
+// HTTP
+// ============================================================================
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebParameter {
+public:
+    const String& name() const;
+    const String& value() const;
+    size_t size() const;
+    bool isPost() const;
+    bool isFile() const;
+};
+
+class AsyncWebHeader {
+public:
+    const String& name() const;
+    const String& value() const;
+};
+
+class AsyncWebServerResponse {
+public:
+    virtual ~AsyncWebServerResponse() {}
+    void setCode(int code);
+    void setContentLength(size_t len);
+    void setContentType(const String& type);
+    void addHeader(const String& name, const String& value);
+};
+
+class AsyncWebServerRequest {
+public:
+    void* _tempObject;
+
+    WebRequestMethodComposite method() const;
+    const String& url() const;
+    const String& host() const;
+    const String& contentType() const;
+    size_t contentLength() const;
+    IPAddress remoteIP() const;
+
+    bool hasParam(const String& name, bool post = false, bool file = false) const;
+    AsyncWebParameter* getParam(const String& name, bool post = false, bool file = false) const;
+    size_t params() const;
+    const String& arg(const String& name) const;
+    bool hasArg(const char* name) const;
+    bool hasHeader(const String& name) const;
+    AsyncWebHeader* getHeader(const String& name) const;
+    const String& header(const char* name) const;
+
+    void send(AsyncWebServerResponse* response);
+    void send(int code, const String& content_type = String(), const String& content = String());
+    AsyncWebServerResponse* beginResponse(int code, const String& content_type = String(),
+                                          const String& content = String());
+    void redirect(const String& url);
+};
+
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data,
+                           size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index,
+                           size_t total)> ArBodyHandlerFunction;
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() {}
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {};
+
+class AsyncStaticWebHandler : public AsyncWebHandler {
+public:
+    AsyncStaticWebHandler& setDefaultFile(const char* filename);
+    AsyncStaticWebHandler& setCacheControl(const char* cache_control);
+};
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t port);
+    void begin();
+    void end();
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler);
+    AsyncCallbackWebHandler& on(const char* uri, ArRequestHandlerFunction on_request);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction on_request);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction on_request,
+                                ArUploadHandlerFunction on_upload);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction on_request,
+                                ArUploadHandlerFunction on_upload, ArBodyHandlerFunction on_body);
+    AsyncStaticWebHandler& serveStatic(const char* uri, fs::FS& fs, const char* path,
+                                       const char* cache_control = nullptr);
+    void onNotFound(ArRequestHandlerFunction fn);
+};
+
+class DefaultHeaders {
+public:
+    void addHeader(const String& name, const String& value);
+    static DefaultHeaders& Instance();
+};
+
+// ============================================================================
+// WEBSOCKET
+// ============================================================================
+
+typedef enum {
+    WS_CONTINUATION,
+    WS_TEXT,
+    WS_BINARY,
+    WS_DISCONNECT = 0x08,
+    WS_PING,
+    WS_PONG,
+} AwsFrameType;
+
+typedef enum {
+    WS_DISCONNECTED,
+    WS_CONNECTED,
+    WS_DISCONNECTING,
+} AwsClientStatus;
+
+typedef enum {
+    WS_EVT_CONNECT,
+    WS_EVT_DISCONNECT,
+    WS_EVT_PING,
+    WS_EVT_PONG,
+    WS_EVT_ERROR,
+    WS_EVT_DATA,
+} AwsEventType;
+
+typedef struct {
+    uint8_t message_opcode;
+    uint32_t num;
+    uint8_t final;
+    uint8_t masked;
+    uint8_t opcode;
+    uint64_t len;
+    uint8_t mask[4];
+    uint64_t index;
+} AwsFrameInfo;
+
+class AsyncWebSocket;
+
+class AsyncWebSocketClient {
+public:
+    uint32_t id() const;
+    AwsClientStatus status() const;
+    IPAddress remoteIP() const;
+    AsyncWebSocket* server();
+    void close(uint16_t code = 0, const char* message = nullptr);
+    void ping(const uint8_t* data = nullptr, size_t len = 0);
+    bool queueIsFull() const;
+    void text(const char* message);
+    void text(const String& message);
+    void binary(const uint8_t* message, size_t len);
+};
+
+typedef std::function<void(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg,
+                           uint8_t* data, size_t len)> AwsEventHandler;
+
+class AsyncWebSocket : public AsyncWebHandler {
+public:
+    explicit AsyncWebSocket(const String& url);
+    void onEvent(AwsEventHandler handler);
+    size_t count() const;
+    AsyncWebSocketClient* client(uint32_t id);
+    bool hasClient(uint32_t id);
+    void cleanupClients(uint16_t max_clients = 8);
+    void close(uint32_t id, uint16_t code = 0, const char* message = nullptr);
+    void closeAll(uint16_t code = 0, const char* message = nullptr);
+    void text(uint32_t id, const char* message);
+    void text(uint32_t id, const String& message);
+    void textAll(const char* message);
+    void textAll(const String& message);
+    void binary(uint32_t id, const uint8_t* message, size_t len);
+    void binaryAll(const uint8_t* message, size_t len);
+};
@@ -0,0 +1,18 @@
+// Syntax-check shim: ESPmDNS responder used by the web server.
+// Declarations only; see platformio.ini [env:native] for the command.
+
+#pragma once
+
+#include <stdint.h>
+#include "Arduino.h"
+
+class MDNSResponder {
+public:
+    bool begin(const char* hostname);
+    void end();
+    void setInstanceName(const char* name);
+    bool addService(const char* service, const char* proto, uint16_t port);
+    bool addServiceTxt(const char* service, const char* proto, const char* key, const char* value);
+};
+
+extern MDNSResponder MDNS;
@@ -0,0 +1,25 @@
+// Syntax-check shim: SPIFFS filesystem object used to serve the web UI.
+// Declarations only; see platformio.ini [env:native] for the command.
+
+#pragma once
+
+#include <stddef.h>
+#include "Arduino.h"
+
+namespace fs {
+class FS {
+public:
+    bool exists(const char* path);
+};
+}  // namespace fs
+
+class SPIFFSFS : public fs::FS {
+public:
+    bool begin(bool format_on_fail = false, const char* base_path = "/spiffs", uint8_t max_open_files = 10,
+               const char* partition_label = nullptr);
+    void end();
+    size_t totalBytes();
+    size_t usedBytes();
+};
+
+extern SPIFFSFS SPIFFS;
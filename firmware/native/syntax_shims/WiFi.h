@@ -0,0 +1,45 @@
+// Syntax-check shim: Arduino WiFi class (station side) used by the web server.
+// Declarations only; see platformio.ini [env:native] for the command.
+
+#pragma once
+
+#include <stdint.h>
+#include "Arduino.h"
+#include "esp_wifi.h"
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED,
+} wl_status_t;
+
+class IPAddress {
+public:
+    IPAddress() {}
+    IPAddress(uint8_t, uint8_t, uint8_t, uint8_t) {}
+    String toString() const;
+};
+
+class WiFiClass {
+public:
+    wl_status_t status();
+    IPAddress localIP();
+    String macAddress();
+    String SSID();
+    String SSID(uint8_t index);
+    int8_t RSSI();
+    int32_t RSSI(uint8_t index);
+    wifi_auth_mode_t encryptionType(uint8_t index);
+    int16_t scanNetworks(bool async = false, bool show_hidden = false);
+    int16_t scanComplete();
+    void scanDelete();
+};
+
+extern WiFiClass WiFi;
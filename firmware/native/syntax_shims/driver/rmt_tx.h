@@ -0,0 +1,24 @@
+// Syntax-check shim: RMT TX channel types used by diagnostics/rmt_probe.h.
+// Declarations only; see platformio.ini [env:native] for the command.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+typedef struct rmt_channel_t* rmt_channel_handle_t;
+
+typedef struct {
+    size_t num_symbols;
+} rmt_tx_done_event_data_t;
+
+typedef bool (*rmt_tx_done_callback_t)(rmt_channel_handle_t tx_chan, const rmt_tx_done_event_data_t* edata,
+                                       void* user_ctx);
+
+typedef struct {
+    rmt_tx_done_callback_t on_trans_done;
+} rmt_tx_event_callbacks_t;
+
+esp_err_t rmt_tx_register_event_callbacks(rmt_channel_handle_t tx_channel, const rmt_tx_event_callbacks_t* cbs,
+                                          void* user_data);
@@ -7,9 +7,18 @@ Import("env")
 # Define DSP files that need performance optimization
 dsp_files = [
     "src/audio/goertzel.cpp",
+    "src/audio/goertzel_block.cpp",
+    "src/audio/constant_q.cpp",
+    "src/audio/octave_pyramid.cpp",
+    "src/audio/hpss.cpp",
+    "src/audio/audio_features.cpp",
+    "src/audio/beat_tracker.cpp",
+    "src/audio/running_stats.cpp",
     "src/audio/tempo.cpp", 
     "src/audio/multi_scale_tempogram.cpp",
     "src/audio/microphone.cpp",
+    "src/audio/mic_frontend.cpp",
+    "src/audio/polyphase_decimator.cpp",
     "src/audio/vu.cpp",
     "src/audio/validation/tempo_validation.cpp",
     "src/beat_events.cpp"
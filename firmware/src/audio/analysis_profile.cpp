@@ -0,0 +1,102 @@
+// Analysis Profiles Implementation
+// Profile table, bin derivation and slot interpolation (see analysis_profile.h)
+
+#include "analysis_profile.h"
+#include <cmath>
+#include <cstring>
+
+// ============================================================================
+// PROFILE TABLE
+// ============================================================================
+
+const AnalysisProfile ANALYSIS_PROFILES[ANALYSIS_PROFILE_COUNT] = {
+	{"low_latency", "32 whole-tone bins, 3/4-length blocks", 2, 0.75f, 1},
+	{"standard", "64 half-step bins (goertzel_lut.h)", 1, 1.0f, 1},
+	{"high_res", "64 half-step bins, double-length blocks, sweep every 2nd chunk", 1, 2.0f, 2},
+};
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+int analysis_profile_find(const char* name) {
+	if (name == nullptr) {
+		return -1;
+	}
+	for (int i = 0; i < ANALYSIS_PROFILE_COUNT; i++) {
+		if (strcmp(ANALYSIS_PROFILES[i].name, name) == 0) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+uint16_t analysis_profile_num_bins(const AnalysisProfile* profile, uint16_t num_slots) {
+	return (num_slots + profile->bin_stride - 1) / profile->bin_stride;
+}
+
+GoertzelBlockBin analysis_profile_bin(const AnalysisProfile* profile, const GoertzelBlockBin* base,
+                                      float base_k, float target_freq, float sample_rate_hz,
+                                      uint16_t max_block_size, float* k) {
+	if (profile->block_scale == 1.0f && base->block_size <= max_block_size) {
+		*k = base_k;
+		return *base;
+	}
+
+	// Whole cycles in the scaled block, then the block (a multiple of 4) that
+	// fits them best, so the centre stays on the note
+	const float cycles_per_sample = target_freq / sample_rate_hz;
+	float cycles = (float)(int)(0.5f + base->block_size * profile->block_scale * cycles_per_sample);
+	if (cycles < 1.0f) {
+		cycles = 1.0f;
+	}
+	uint32_t block_size = 4 * (uint32_t)(0.5f + cycles / cycles_per_sample / 4.0f);
+	if (block_size > max_block_size) {
+		block_size = max_block_size & ~3u;
+		cycles = (float)(int)(0.5f + block_size * cycles_per_sample);
+	}
+	if (block_size < 4) {
+		block_size = 4;
+	}
+
+	GoertzelBlockBin bin;
+	bin.block_size = (uint16_t)block_size;
+	bin.window_step = 4096.0f / block_size;
+	bin.coeff = (float)(2.0 * cos(2.0 * M_PI * cycles / block_size));
+	*k = cycles;
+	return bin;
+}
+
+void analysis_profile_expand(const AnalysisProfile* profile, const float* bins, uint16_t num_slots,
+                             float* slots) {
+	const uint16_t stride = profile->bin_stride;
+	if (stride == 1) {
+		memcpy(slots, bins, sizeof(float) * num_slots);
+		return;
+	}
+	const uint16_t num_bins = analysis_profile_num_bins(profile, num_slots);
+	for (uint16_t s = 0; s < num_slots; s++) {
+		const uint16_t b = s / stride;
+		const uint16_t offset = s % stride;
+		if (offset == 0 || b + 1 >= num_bins) {
+			slots[s] = bins[b];
+		}
+		else {
+			const float t = (float)offset / stride;
+			slots[s] = bins[b] + (bins[b + 1] - bins[b]) * t;
+		}
+	}
+}
+
+void analysis_profile_record(AnalysisProfileStats* stats, uint32_t cycles) {
+	if (stats->frames == 0) {
+		stats->cycles_per_frame = (float)cycles;
+	}
+	else {
+		stats->cycles_per_frame += ((float)cycles - stats->cycles_per_frame) / ANALYSIS_PROFILE_STATS_SMOOTHING;
+	}
+	if (cycles > stats->peak_cycles) {
+		stats->peak_cycles = cycles;
+	}
+	stats->frames++;
+}
@@ -0,0 +1,82 @@
+// Analysis Profiles - Runtime trade-offs for the note spectrum
+//
+// The spectrogram always has NUM_FREQS half-step slots (the frame payload,
+// patterns and REST arrays are sized for it), but how those slots are
+// analysed can change at runtime without a reflash:
+//   - bin_stride: analyse every slot (1) or every second one (2, whole tones);
+//     skipped slots are interpolated from their analysed neighbours
+//   - block_scale: block length relative to the standard bins (goertzel_lut.h);
+//     shorter blocks react faster and cost less, longer ones resolve more
+//   - hop_chunks: chunks per bin sweep; in between the last sweep is reused
+//
+// Derived bins keep the standard bins' form (block a multiple of 4, integer
+// k, coeff = 2 * cos(2 * pi * k / N)), but the block is fitted to the whole
+// cycles it holds, so the centre stays on the note at any block length. The
+// standard profile returns the standard bins unchanged, so it costs no trig
+// and reads exactly like the fixed configuration.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef ANALYSIS_PROFILE_H
+#define ANALYSIS_PROFILE_H
+
+#include <stdint.h>
+#include "goertzel_block.h"
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define ANALYSIS_PROFILE_COUNT 3
+#define ANALYSIS_PROFILE_LOW_LATENCY 0
+#define ANALYSIS_PROFILE_STANDARD 1
+#define ANALYSIS_PROFILE_HIGH_RES 2
+
+#define ANALYSIS_PROFILE_STATS_SMOOTHING 32  // Frames in the cycles-per-frame moving average
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	const char* name;           // REST identifier
+	const char* description;
+	uint8_t bin_stride;         // Analyse every bin_stride-th slot (1 or 2)
+	float block_scale;          // Block length relative to the standard bins
+	uint8_t hop_chunks;         // Audio chunks per bin sweep
+} AnalysisProfile;
+
+// Measured cost of a profile while it was active
+typedef struct {
+	float cycles_per_frame;     // Moving average (ANALYSIS_PROFILE_STATS_SMOOTHING frames)
+	uint32_t peak_cycles;       // Most expensive frame
+	uint32_t frames;            // Frames measured
+} AnalysisProfileStats;
+
+extern const AnalysisProfile ANALYSIS_PROFILES[ANALYSIS_PROFILE_COUNT];
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// Index of the profile called name, or -1
+int analysis_profile_find(const char* name);
+
+// Analysed bins for num_slots spectrogram slots (slot = bin * bin_stride)
+uint16_t analysis_profile_num_bins(const AnalysisProfile* profile, uint16_t num_slots);
+
+// The profile's bin for a slot whose standard bin is base (DFT index base_k),
+// with the block capped at max_block_size. Returns the bin's DFT index via k.
+GoertzelBlockBin analysis_profile_bin(const AnalysisProfile* profile, const GoertzelBlockBin* base,
+                                      float base_k, float target_freq, float sample_rate_hz,
+                                      uint16_t max_block_size, float* k);
+
+// Spread analysed bin values over num_slots slots; skipped slots are the mean
+// of their neighbours (the last slot repeats the last analysed bin)
+void analysis_profile_expand(const AnalysisProfile* profile, const float* bins, uint16_t num_slots,
+                             float* slots);
+
+// Add one frame's cycle count to a profile's stats
+void analysis_profile_record(AnalysisProfileStats* stats, uint32_t cycles);
+
+#endif  // ANALYSIS_PROFILE_H
@@ -11,6 +11,26 @@
 #define AUDIO_SAMPLE_RATE_HZ 12800
 #define AUDIO_CHUNK_SIZE     64
 
+// I2S capture rate. Defaults to the analysis rate (no resampling). 16000 or
+// 32000 also keeps the SPH0645 clock in spec (BCLK >= 1.024 MHz); the capture
+// is then band-limited and resampled to AUDIO_SAMPLE_RATE_HZ by the polyphase
+// decimator (polyphase_decimator.h), so treble above the analysis Nyquist
+// cannot alias into notes[].
+#ifndef AUDIO_CAPTURE_RATE_HZ
+#define AUDIO_CAPTURE_RATE_HZ AUDIO_SAMPLE_RATE_HZ
+#endif
+
+// I2S words per chunk: one chunk covers the same time at either rate
+#define AUDIO_CAPTURE_CHUNK_SIZE (AUDIO_CHUNK_SIZE * AUDIO_CAPTURE_RATE_HZ / AUDIO_SAMPLE_RATE_HZ)
+#define AUDIO_CAPTURE_RESAMPLED  (AUDIO_CAPTURE_RATE_HZ != AUDIO_SAMPLE_RATE_HZ)
+
+#if AUDIO_CAPTURE_RATE_HZ < AUDIO_SAMPLE_RATE_HZ
+#error "AUDIO_CAPTURE_RATE_HZ must be at least AUDIO_SAMPLE_RATE_HZ"
+#endif
+#if (AUDIO_CHUNK_SIZE * AUDIO_CAPTURE_RATE_HZ) % AUDIO_SAMPLE_RATE_HZ != 0 || AUDIO_CAPTURE_CHUNK_SIZE % 2 != 0
+#error "AUDIO_CAPTURE_RATE_HZ must map AUDIO_CHUNK_SIZE to a whole, even number of I2S words"
+#endif
+
 // C++ constants for type-safe usage in code
 constexpr uint32_t kAudioSampleRateHz = AUDIO_SAMPLE_RATE_HZ;
 constexpr uint16_t kAudioChunkSize    = AUDIO_CHUNK_SIZE;
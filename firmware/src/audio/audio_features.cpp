@@ -0,0 +1,84 @@
+// Audio Features Implementation
+// Band means, centroid, flatness, flux and chroma peak of one frame (see audio_features.h)
+
+#include "audio_features.h"
+#include <cmath>
+#include <cstring>
+
+// Floor inside the flatness log so a silent bin does not zero the geometric mean
+#define FLATNESS_EPSILON 1e-6f
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void audio_features_init(AudioFeatureState* state, uint16_t num_bins) {
+	memset(state, 0, sizeof(AudioFeatureState));
+	state->num_bins = (num_bins > AUDIO_FEATURES_MAX_BINS) ? AUDIO_FEATURES_MAX_BINS : num_bins;
+}
+
+float audio_band_mean(const float* spectrum, uint16_t num_bins, int start_bin, int end_bin) {
+	if (start_bin < 0 || start_bin >= num_bins ||
+	    end_bin < 0 || end_bin >= num_bins ||
+	    start_bin > end_bin) {
+		return 0.0f;
+	}
+	float sum = 0.0f;
+	for (int i = start_bin; i <= end_bin; i++) {
+		sum += spectrum[i];
+	}
+	return sum / (float)(end_bin - start_bin + 1);
+}
+
+void audio_features_compute(AudioFeatureState* state, const float* spectrum,
+                            const float* spectrum_absolute, const float* chroma,
+                            AudioFeatures* out) {
+	const uint16_t n = state->num_bins;
+
+	out->bass = audio_band_mean(spectrum, n, FEATURE_BASS_START, FEATURE_BASS_END);
+	out->mids = audio_band_mean(spectrum, n, FEATURE_MIDS_START, FEATURE_MIDS_END);
+	out->treble = audio_band_mean(spectrum, n, FEATURE_TREBLE_START, FEATURE_TREBLE_END);
+	out->kick = audio_band_mean(spectrum, n, FEATURE_KICK_START, FEATURE_KICK_END);
+	out->snare = audio_band_mean(spectrum, n, FEATURE_SNARE_START, FEATURE_SNARE_END);
+	out->vocal = audio_band_mean(spectrum, n, FEATURE_VOCAL_START, FEATURE_VOCAL_END);
+	out->hats = audio_band_mean(spectrum, n, FEATURE_HATS_START, FEATURE_HATS_END);
+
+	out->bass_abs = audio_band_mean(spectrum_absolute, n, FEATURE_BASS_START, FEATURE_BASS_END);
+	out->mids_abs = audio_band_mean(spectrum_absolute, n, FEATURE_MIDS_START, FEATURE_MIDS_END);
+	out->treble_abs = audio_band_mean(spectrum_absolute, n, FEATURE_TREBLE_START, FEATURE_TREBLE_END);
+
+	// One pass for the shape descriptors
+	float sum = 0.0f;
+	float weighted = 0.0f;
+	float log_sum = 0.0f;
+	float flux = 0.0f;
+	for (uint16_t i = 0; i < n; i++) {
+		const float v = fmaxf(spectrum[i], 0.0f);
+		sum += v;
+		weighted += v * i;
+		log_sum += logf(v + FLATNESS_EPSILON);
+		flux += fmaxf(0.0f, v - state->previous[i]);
+		state->previous[i] = v;
+	}
+
+	if (n > 0 && sum > n * FLATNESS_EPSILON) {
+		const float mean = sum / n;
+		out->centroid = (n > 1) ? (weighted / sum) / (n - 1) : 0.0f;
+		out->flatness = fminf(1.0f, expf(log_sum / n) / (mean + FLATNESS_EPSILON));
+	}
+	else {
+		out->centroid = 0.0f;
+		out->flatness = 0.0f;
+	}
+	out->flux = (n > 0) ? flux / n : 0.0f;
+
+	// First strict maximum, as get_dominant_chroma_hue() picks it
+	out->chroma_peak = 0;
+	out->chroma_peak_value = 0.0f;
+	for (uint8_t i = 0; i < AUDIO_FEATURES_CHROMA_BINS; i++) {
+		if (chroma[i] > out->chroma_peak_value) {
+			out->chroma_peak_value = chroma[i];
+			out->chroma_peak = i;
+		}
+	}
+}
@@ -0,0 +1,91 @@
+// Audio Features - Per-frame band energies and spectral descriptors
+//
+// Computed once per audio frame on the audio task and published in the audio
+// payload, so patterns read a field instead of re-summing spectrum ranges on
+// every AUDIO_BASS() / AUDIO_KICK() / ... call.
+//
+// Band energies are the plain mean of the bins in the band, summed in bin
+// order, exactly as get_audio_band_energy() computes them, so the published
+// values equal the old per-call results bit for bit.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef AUDIO_FEATURES_H
+#define AUDIO_FEATURES_H
+
+#include <stdint.h>
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define AUDIO_FEATURES_MAX_BINS 64
+#define AUDIO_FEATURES_CHROMA_BINS 12
+
+// Band ranges (inclusive bin indices)
+#define FEATURE_BASS_START    0
+#define FEATURE_BASS_END      8
+#define FEATURE_MIDS_START    16
+#define FEATURE_MIDS_END      32
+#define FEATURE_TREBLE_START  48
+#define FEATURE_TREBLE_END    63
+#define FEATURE_KICK_START    0
+#define FEATURE_KICK_END      4
+#define FEATURE_SNARE_START   8
+#define FEATURE_SNARE_END     16
+#define FEATURE_VOCAL_START   16
+#define FEATURE_VOCAL_END     40
+#define FEATURE_HATS_START    48
+#define FEATURE_HATS_END      63
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	// Band means of the auto-ranged spectrum (0.0-1.0)
+	float bass;
+	float mids;
+	float treble;
+	float kick;
+	float snare;
+	float vocal;
+	float hats;
+
+	// Band means of the pre-normalized spectrum (absolute loudness)
+	float bass_abs;
+	float mids_abs;
+	float treble_abs;
+
+	// Spectral shape of the auto-ranged spectrum
+	float centroid;            // Energy-weighted bin position, 0.0 (lowest) - 1.0 (highest)
+	float flatness;            // Geometric / arithmetic mean: 0.0 tonal - 1.0 noise-like
+	float flux;                // Mean positive bin change since the previous frame
+
+	// Strongest pitch class (0 = C ... 11 = B; 0 when the chromagram is silent)
+	float chroma_peak_value;
+	uint8_t chroma_peak;
+} AudioFeatures;
+
+typedef struct {
+	float previous[AUDIO_FEATURES_MAX_BINS];   // Last frame, for flux
+	uint16_t num_bins;
+} AudioFeatureState;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// Forget the previous frame (the next flux is taken against silence)
+void audio_features_init(AudioFeatureState* state, uint16_t num_bins);
+
+// Mean of spectrum[start..end] (inclusive); 0.0 for an invalid range
+float audio_band_mean(const float* spectrum, uint16_t num_bins, int start_bin, int end_bin);
+
+// Fill `out` from one frame: spectrum / spectrum_absolute have state->num_bins
+// bins, chroma has AUDIO_FEATURES_CHROMA_BINS
+void audio_features_compute(AudioFeatureState* state, const float* spectrum,
+                            const float* spectrum_absolute, const float* chroma,
+                            AudioFeatures* out);
+
+#endif  // AUDIO_FEATURES_H
@@ -0,0 +1,46 @@
+// Audio Source - Where acquire_sample_chunk() gets its raw slot words
+//
+// Every source delivers AUDIO_CAPTURE_CHUNK_SIZE SPH0645-format slot words per
+// chunk at AUDIO_CAPTURE_RATE_HZ, so the front end, decimator and everything
+// downstream run unchanged whichever source is active. The I2S microphone
+// (DMA handoff or blocking read) is the default; host builds add WAV-file and
+// localhost UDP PCM sources (native/host_runtime/host_audio_sources.h) to drive
+// the whole pipeline deterministically or from a live stream.
+//
+// Sources that start from PCM build words with mic_frontend_encode_sample().
+
+#ifndef AUDIO_SOURCE_H
+#define AUDIO_SOURCE_H
+
+#include <stdint.h>
+#include <esp_err.h>
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	const char* name;
+	// Produce the next chunk: fill scratch (AUDIO_CAPTURE_CHUNK_SIZE words) and
+	// point *words at it, or point *words at source-owned memory that stays
+	// valid and writable until the next call (DMA descriptors; converted in
+	// place). Block at most timeout_ms; ESP_ERR_TIMEOUT if nothing arrived.
+	// Any error makes acquire_sample_chunk() substitute silence.
+	esp_err_t (*read_chunk)(void* ctx, uint32_t* scratch, uint32_t** words, uint32_t timeout_ms);
+	void* ctx;
+} AudioSource;
+
+// ============================================================================
+// API (defined in microphone.cpp)
+// ============================================================================
+
+// The I2S microphone
+extern const AudioSource audio_source_i2s;
+
+// Switch the source read by acquire_sample_chunk(); nullptr restores the I2S
+// microphone. Takes effect at the next chunk. The source must outlive its
+// selection.
+void audio_source_select(const AudioSource* source);
+const AudioSource* audio_source_active();
+
+#endif  // AUDIO_SOURCE_H
@@ -0,0 +1,156 @@
+// Audio Warm Start Implementation
+// Record serialisation, validation and tempo prior packing (see audio_warm_start.h)
+
+#include "audio_warm_start.h"
+#include <cmath>
+#include <cstring>
+
+// ============================================================================
+// INTERNAL HELPERS
+// ============================================================================
+
+// Exponent test instead of isfinite(): stays correct under -ffast-math
+static bool in_range(float value, float lo, float hi) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	if ((bits & 0x7F800000u) == 0x7F800000u) {
+		return false;
+	}
+	return value >= lo && value <= hi;
+}
+
+// Checksummed contents can still come from a buggy writer: only restore
+// values the live code could have produced (gain/floor match the REST limits)
+static bool record_is_plausible(const AudioWarmStart* record) {
+	for (uint16_t i = 0; i < AUDIO_WARM_START_NOISE_BINS; i++) {
+		if (!in_range(record->noise_spectrum[i], 0.0f, 1.0e6f)) {
+			return false;
+		}
+	}
+	return in_range(record->microphone_gain, 0.5f, 2.0f) &&
+	       in_range(record->vu_floor_pct, 0.5f, 0.98f) &&
+	       in_range(record->autoranger_ceiling, 0.0f, 1.0e6f) &&
+	       in_range(record->novelty_ceiling, 0.0f, 1.0e6f) &&
+	       in_range(record->tempo_prior_peak, 0.0f, 1.0e6f);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+uint32_t audio_warm_start_crc32(const uint8_t* data, size_t length) {
+	uint32_t crc = 0xFFFFFFFFu;
+	for (size_t i = 0; i < length; i++) {
+		crc ^= data[i];
+		for (uint8_t bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+		}
+	}
+	return ~crc;
+}
+
+size_t audio_warm_start_encode(const AudioWarmStart* record, uint8_t* out) {
+	AudioWarmStartHeader header;
+	header.magic = AUDIO_WARM_START_MAGIC;
+	header.version = AUDIO_WARM_START_VERSION;
+	header.length = (uint16_t)sizeof(AudioWarmStart);
+	header.crc = audio_warm_start_crc32((const uint8_t*)record, sizeof(AudioWarmStart));
+
+	memcpy(out, &header, sizeof(header));
+	memcpy(out + sizeof(header), record, sizeof(AudioWarmStart));
+	return AUDIO_WARM_START_BLOB_SIZE;
+}
+
+AudioWarmStartStatus audio_warm_start_decode(const uint8_t* blob, size_t length, AudioWarmStart* record) {
+	if (length == 0) {
+		return AUDIO_WARM_START_EMPTY;
+	}
+	if (length < sizeof(AudioWarmStartHeader)) {
+		return AUDIO_WARM_START_BAD_LENGTH;
+	}
+
+	AudioWarmStartHeader header;
+	memcpy(&header, blob, sizeof(header));
+	if (header.magic != AUDIO_WARM_START_MAGIC) {
+		return AUDIO_WARM_START_BAD_MAGIC;
+	}
+	if (header.version != AUDIO_WARM_START_VERSION) {
+		return AUDIO_WARM_START_BAD_VERSION;
+	}
+	if (header.length != sizeof(AudioWarmStart) || length != AUDIO_WARM_START_BLOB_SIZE) {
+		return AUDIO_WARM_START_BAD_LENGTH;
+	}
+
+	const uint8_t* payload = blob + sizeof(header);
+	if (audio_warm_start_crc32(payload, sizeof(AudioWarmStart)) != header.crc) {
+		return AUDIO_WARM_START_BAD_CHECKSUM;
+	}
+
+	AudioWarmStart candidate;
+	memcpy(&candidate, payload, sizeof(candidate));
+	if (!record_is_plausible(&candidate)) {
+		return AUDIO_WARM_START_BAD_VALUES;
+	}
+	*record = candidate;
+	return AUDIO_WARM_START_OK;
+}
+
+AudioWarmStartStatus audio_warm_start_save(const AudioWarmStartStore* store, const AudioWarmStart* record) {
+	uint8_t blob[AUDIO_WARM_START_BLOB_SIZE];
+	const size_t length = audio_warm_start_encode(record, blob);
+	if (!store->write(store->context, blob, length)) {
+		return AUDIO_WARM_START_WRITE_FAILED;
+	}
+	return AUDIO_WARM_START_OK;
+}
+
+AudioWarmStartStatus audio_warm_start_load(const AudioWarmStartStore* store, AudioWarmStart* record) {
+	uint8_t blob[AUDIO_WARM_START_BLOB_SIZE];
+	const size_t length = store->read(store->context, blob, sizeof(blob));
+	if (length > sizeof(blob)) {
+		return AUDIO_WARM_START_BAD_LENGTH;
+	}
+	return audio_warm_start_decode(blob, length, record);
+}
+
+void audio_warm_start_pack_tempo(AudioWarmStart* record, const float* tempi_smooth, uint16_t count) {
+	if (count > AUDIO_WARM_START_TEMPO_BINS) {
+		count = AUDIO_WARM_START_TEMPO_BINS;
+	}
+	float peak = 0.0f;
+	for (uint16_t i = 0; i < count; i++) {
+		peak = fmaxf(peak, tempi_smooth[i]);
+	}
+
+	memset(record->tempo_prior, 0, sizeof(record->tempo_prior));
+	record->tempo_prior_peak = peak;
+	if (peak <= 0.0f) {
+		return;
+	}
+	for (uint16_t i = 0; i < count; i++) {
+		const float q = fmaxf(0.0f, tempi_smooth[i]) / peak * 255.0f;
+		record->tempo_prior[i] = (uint8_t)(q + 0.5f);
+	}
+}
+
+bool audio_warm_start_unpack_tempo(const AudioWarmStart* record, float* tempi_smooth, uint16_t count) {
+	const float step = record->tempo_prior_peak / 255.0f;
+	for (uint16_t i = 0; i < count; i++) {
+		tempi_smooth[i] = (i < AUDIO_WARM_START_TEMPO_BINS) ? record->tempo_prior[i] * step : 0.0f;
+	}
+	return record->tempo_prior_peak > 0.0f;
+}
+
+const char* audio_warm_start_status_name(AudioWarmStartStatus status) {
+	switch (status) {
+		case AUDIO_WARM_START_OK: return "ok";
+		case AUDIO_WARM_START_EMPTY: return "empty";
+		case AUDIO_WARM_START_BAD_MAGIC: return "bad_magic";
+		case AUDIO_WARM_START_BAD_VERSION: return "bad_version";
+		case AUDIO_WARM_START_BAD_LENGTH: return "bad_length";
+		case AUDIO_WARM_START_BAD_CHECKSUM: return "bad_checksum";
+		case AUDIO_WARM_START_BAD_VALUES: return "bad_values";
+		case AUDIO_WARM_START_WRITE_FAILED: return "write_failed";
+	}
+	return "unknown";
+}
@@ -0,0 +1,109 @@
+// Audio Warm Start - Persisted calibration and adaptive state across reboots
+//
+// Without it every boot starts from zero: no noise profile, the spectrum
+// auto-ranger ceiling creeping up from its default, an empty tempogram, so
+// the first 10-20 seconds look flat or mistimed. The record holds what those
+// stages converge to:
+//   - the noise profile from the last calibration (noise_spectrum[])
+//   - the audio configuration (microphone gain, VU floor multiplier)
+//   - the spectrum auto-ranger and novelty normalisation ceilings
+//   - a compact tempo prior: tempi_smooth[] quantised to 8 bits of its peak
+//
+// Serialised as a fixed header (magic, version, payload length, CRC-32 of the
+// payload) followed by the record. Anything that does not check out is
+// rejected whole and the caller keeps its defaults. Bump
+// AUDIO_WARM_START_VERSION whenever AudioWarmStart changes.
+//
+// Storage goes through AudioWarmStartStore (one blob in, one blob out), so the
+// firmware can back it with NVS and host tests with a byte array.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef AUDIO_WARM_START_H
+#define AUDIO_WARM_START_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define AUDIO_WARM_START_MAGIC 0x5357314Bu       // "K1WS" little-endian
+#define AUDIO_WARM_START_VERSION 1
+#define AUDIO_WARM_START_NOISE_BINS 64            // NUM_FREQS
+#define AUDIO_WARM_START_TEMPO_BINS 192           // NUM_TEMPI
+
+#define AUDIO_WARM_START_FLAG_NOISE_PROFILE 0x01  // noise_spectrum[] came from a finished calibration
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	float noise_spectrum[AUDIO_WARM_START_NOISE_BINS];
+	float microphone_gain;
+	float vu_floor_pct;
+	float autoranger_ceiling;                         // Spectrum auto-ranger smoothed peak
+	float novelty_ceiling;                            // Novelty normalisation peak
+	float tempo_prior_peak;                           // tempi_smooth[] peak (0 = no prior)
+	uint8_t tempo_prior[AUDIO_WARM_START_TEMPO_BINS]; // tempi_smooth[] / peak * 255
+	uint8_t flags;                                    // AUDIO_WARM_START_FLAG_*
+	uint8_t reserved[3];
+} AudioWarmStart;
+
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t length;          // Payload bytes (sizeof(AudioWarmStart))
+	uint32_t crc;             // CRC-32 of the payload
+} AudioWarmStartHeader;
+
+#define AUDIO_WARM_START_BLOB_SIZE (sizeof(AudioWarmStartHeader) + sizeof(AudioWarmStart))
+
+typedef enum {
+	AUDIO_WARM_START_OK = 0,
+	AUDIO_WARM_START_EMPTY,           // Nothing stored yet
+	AUDIO_WARM_START_BAD_MAGIC,
+	AUDIO_WARM_START_BAD_VERSION,     // Written by a different firmware layout
+	AUDIO_WARM_START_BAD_LENGTH,
+	AUDIO_WARM_START_BAD_CHECKSUM,
+	AUDIO_WARM_START_BAD_VALUES,      // Checksum fine, contents out of range
+	AUDIO_WARM_START_WRITE_FAILED,
+} AudioWarmStartStatus;
+
+// One blob of persistent storage
+typedef struct {
+	void* context;
+	// Copy the stored blob into buffer; returns its length (0 if none).
+	// A blob longer than capacity returns its full length without copying.
+	size_t (*read)(void* context, uint8_t* buffer, size_t capacity);
+	// Replace the stored blob; returns false on failure
+	bool (*write)(void* context, const uint8_t* data, size_t length);
+} AudioWarmStartStore;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// CRC-32 (IEEE 802.3, reflected, as zlib)
+uint32_t audio_warm_start_crc32(const uint8_t* data, size_t length);
+
+// Serialise into out (AUDIO_WARM_START_BLOB_SIZE bytes); returns the length
+size_t audio_warm_start_encode(const AudioWarmStart* record, uint8_t* out);
+
+// Parse and validate a blob; record is only written on AUDIO_WARM_START_OK
+AudioWarmStartStatus audio_warm_start_decode(const uint8_t* blob, size_t length, AudioWarmStart* record);
+
+AudioWarmStartStatus audio_warm_start_save(const AudioWarmStartStore* store, const AudioWarmStart* record);
+AudioWarmStartStatus audio_warm_start_load(const AudioWarmStartStore* store, AudioWarmStart* record);
+
+// Quantise tempi_smooth[0..count) into the record's tempo prior
+void audio_warm_start_pack_tempo(AudioWarmStart* record, const float* tempi_smooth, uint16_t count);
+
+// Expand the tempo prior into tempi_smooth[0..count); false (and zeros) if there is none
+bool audio_warm_start_unpack_tempo(const AudioWarmStart* record, float* tempi_smooth, uint16_t count);
+
+const char* audio_warm_start_status_name(AudioWarmStartStatus status);
+
+#endif  // AUDIO_WARM_START_H
@@ -0,0 +1,186 @@
+// Beat Tracker Implementation
+// Top-K tempogram peaks, each followed by a phase/frequency-correcting loop (see beat_tracker.h)
+
+#include "beat_tracker.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#define BEAT_TRACKER_TWO_PI 6.28318530718f
+#define BEAT_TRACKER_PI 3.14159265359f
+#define BEAT_TRACKER_BEAT_PHASE 1.57079632679f
+
+// ============================================================================
+// INTERNAL HELPERS
+// ============================================================================
+
+static inline float wrap_phase(float phase) {
+	if (phase > BEAT_TRACKER_PI || phase < -BEAT_TRACKER_PI) {
+		phase = fmodf(phase + BEAT_TRACKER_PI, BEAT_TRACKER_TWO_PI);
+		if (phase < 0.0f) {
+			phase += BEAT_TRACKER_TWO_PI;
+		}
+		phase -= BEAT_TRACKER_PI;
+	}
+	return phase;
+}
+
+static inline float clamp_tempo(float tempo_hz, float center_hz) {
+	const float low = center_hz * (1.0f - BEAT_TRACKER_FREQ_RANGE);
+	const float high = center_hz * (1.0f + BEAT_TRACKER_FREQ_RANGE);
+	return (tempo_hz < low) ? low : (tempo_hz > high) ? high : tempo_hz;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void beat_tracker_init(BeatTracker* tracker) {
+	memset(tracker, 0, sizeof(BeatTracker));
+}
+
+void beat_tracker_clear(BeatTracker* tracker) {
+	memset(tracker->hypotheses, 0, sizeof(tracker->hypotheses));
+}
+
+void beat_tracker_advance(BeatTracker* tracker, float dt_s) {
+	for (uint8_t k = 0; k < BEAT_TRACKER_HYPOTHESES; k++) {
+		BeatHypothesis* h = &tracker->hypotheses[k];
+		if (h->active) {
+			h->phase = wrap_phase(h->phase + BEAT_TRACKER_TWO_PI * h->tempo_hz * dt_s);
+		}
+	}
+}
+
+void beat_tracker_select(BeatTracker* tracker, const float* magnitude, const float* bin_hz,
+                         const float* bin_phase, uint16_t num_bins) {
+	float strongest = 0.0f;
+	for (uint16_t i = 0; i < num_bins; i++) {
+		if (magnitude[i] > strongest) {
+			strongest = magnitude[i];
+		}
+	}
+	if (strongest <= 0.0f) {
+		beat_tracker_clear(tracker);
+		return;
+	}
+
+	// Local maxima above the dead floor, kept sorted strongest first
+	uint16_t peaks[BEAT_TRACKER_HYPOTHESES];
+	float heights[BEAT_TRACKER_HYPOTHESES];
+	uint8_t num_peaks = 0;
+	const float floor = strongest * BEAT_TRACKER_DEAD_FRACTION;
+	for (uint16_t i = 0; i < num_bins; i++) {
+		const float m = magnitude[i];
+		if (m < floor) continue;
+		if (i > 0 && magnitude[i - 1] > m) continue;
+		if (i + 1 < num_bins && magnitude[i + 1] >= m) continue;
+
+		uint8_t slot = num_peaks;
+		while (slot > 0 && heights[slot - 1] < m) {
+			slot--;
+		}
+		if (slot >= BEAT_TRACKER_HYPOTHESES) continue;
+		const uint8_t last = (num_peaks < BEAT_TRACKER_HYPOTHESES) ? num_peaks : BEAT_TRACKER_HYPOTHESES - 1;
+		for (uint8_t j = last; j > slot; j--) {
+			peaks[j] = peaks[j - 1];
+			heights[j] = heights[j - 1];
+		}
+		peaks[slot] = i;
+		heights[slot] = m;
+		if (num_peaks < BEAT_TRACKER_HYPOTHESES) {
+			num_peaks++;
+		}
+	}
+
+	// Hand each peak the nearest running loop, or start a new one
+	BeatHypothesis next[BEAT_TRACKER_HYPOTHESES];
+	memset(next, 0, sizeof(next));
+	bool taken[BEAT_TRACKER_HYPOTHESES] = {false};
+	for (uint8_t p = 0; p < num_peaks; p++) {
+		const uint16_t bin = peaks[p];
+		int8_t match = -1;
+		int best_distance = BEAT_TRACKER_MATCH_BINS + 1;
+		for (uint8_t k = 0; k < BEAT_TRACKER_HYPOTHESES; k++) {
+			const BeatHypothesis* h = &tracker->hypotheses[k];
+			if (!h->active || taken[k]) continue;
+			const int distance = abs((int)h->bin - (int)bin);
+			if (distance < best_distance) {
+				best_distance = distance;
+				match = (int8_t)k;
+			}
+		}
+
+		BeatHypothesis* h = &next[p];
+		if (match >= 0) {
+			*h = tracker->hypotheses[match];
+			taken[match] = true;
+		}
+		else {
+			h->phase = bin_phase[bin];
+			h->tempo_hz = bin_hz[bin];
+		}
+		h->bin = bin;
+		h->center_hz = bin_hz[bin];
+		h->tempo_hz = clamp_tempo(h->tempo_hz, h->center_hz);
+		h->salience = heights[p] / strongest;
+		h->confidence = h->lock * h->salience;
+		h->active = true;
+	}
+
+	// Most confident first; new loops (no lock yet) by salience after the locked ones
+	for (uint8_t i = 1; i < num_peaks; i++) {
+		const BeatHypothesis moving = next[i];
+		uint8_t j = i;
+		while (j > 0 && (next[j - 1].confidence < moving.confidence ||
+		                 (next[j - 1].confidence == moving.confidence && next[j - 1].salience < moving.salience))) {
+			next[j] = next[j - 1];
+			j--;
+		}
+		next[j] = moving;
+	}
+	memcpy(tracker->hypotheses, next, sizeof(next));
+}
+
+bool beat_tracker_novelty(BeatTracker* tracker, float novelty, float tick_s) {
+	const float candidate = tracker->novelty_prev;
+	const bool onset = candidate > tracker->novelty_prev2 && candidate >= novelty &&
+	                   candidate > tracker->novelty_mean * BEAT_TRACKER_ONSET_RATIO + BEAT_TRACKER_ONSET_FLOOR;
+
+	tracker->novelty_mean += BEAT_TRACKER_MEAN_ALPHA * (novelty - tracker->novelty_mean);
+	tracker->novelty_prev2 = tracker->novelty_prev;
+	tracker->novelty_prev = novelty;
+	tracker->onset_peak *= BEAT_TRACKER_PEAK_DECAY;
+	if (!onset) {
+		return false;
+	}
+	tracker->onsets++;
+
+	if (candidate > tracker->onset_peak) {
+		tracker->onset_peak = candidate;
+	}
+	const float ratio = candidate / tracker->onset_peak;
+	const float weight = ratio * ratio;
+
+	for (uint8_t k = 0; k < BEAT_TRACKER_HYPOTHESES; k++) {
+		BeatHypothesis* h = &tracker->hypotheses[k];
+		if (!h->active) continue;
+
+		// The onset was one tick ago; compare the loop's phase back then with the beat
+		const float onset_phase = h->phase - BEAT_TRACKER_TWO_PI * h->tempo_hz * tick_s;
+		const float error = wrap_phase(BEAT_TRACKER_BEAT_PHASE - onset_phase);
+		h->phase_error = error;
+		if (h->onsets < UINT16_MAX) {
+			h->onsets++;
+		}
+		h->lock += BEAT_TRACKER_LOCK_ALPHA * weight * (fmaxf(0.0f, cosf(error)) - h->lock);
+
+		if (fabsf(error) < BEAT_TRACKER_CAPTURE) {
+			h->phase = wrap_phase(h->phase + BEAT_TRACKER_PHASE_GAIN * weight * error);
+			h->tempo_hz = clamp_tempo(h->tempo_hz * (1.0f + BEAT_TRACKER_FREQ_GAIN * weight * error / BEAT_TRACKER_TWO_PI),
+			                          h->center_hz);
+		}
+		h->confidence = h->lock * h->salience;
+	}
+	return true;
+}
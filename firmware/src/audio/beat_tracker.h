@@ -0,0 +1,100 @@
+// Beat Tracker - Phase-locked loops on the strongest tempo hypotheses
+//
+// The tempogram (tempi_smooth[]) says which tempi are present; its per-bin
+// phases are re-estimated once per novelty tick and only drift-corrected by
+// a free-running advance in between. The tracker follows just the top
+// BEAT_TRACKER_HYPOTHESES tempogram peaks with a second-order PLL each:
+//
+//   - selection: the strongest local maxima of the tempogram above
+//     BEAT_TRACKER_DEAD_FRACTION of the strongest peak. A peak within
+//     BEAT_TRACKER_MATCH_BINS of a running hypothesis keeps that hypothesis's
+//     loop state; a new peak starts from the tempogram's own phase estimate.
+//     Hypotheses are ordered by confidence, so hypotheses[0] is the beat to
+//     follow.
+//   - onsets: peaks of the novelty curve above BEAT_TRACKER_ONSET_RATIO times
+//     its running mean (one novelty tick of look-ahead).
+//   - correction: on each onset, every hypothesis measures its phase error
+//     against the beat; errors inside the capture range pull the phase
+//     (BEAT_TRACKER_PHASE_GAIN) and the frequency (BEAT_TRACKER_FREQ_GAIN),
+//     the frequency staying within BEAT_TRACKER_FREQ_RANGE of the peak's bin.
+//     Each onset counts by the square of its height relative to the recent
+//     strongest onset, so quiet off-beat hits barely move the loops.
+//   - confidence: salience (peak height relative to the strongest) times lock
+//     (running mean of how well onsets land on the beat). Onsets between
+//     beats pull lock down, which separates a tempo from its half tempo.
+//
+// Phase convention matches tempo_phase[]: radians in -pi..pi, sin(phase)
+// peaks on the beat (phase = pi/2).
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef BEAT_TRACKER_H
+#define BEAT_TRACKER_H
+
+#include <stdint.h>
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define BEAT_TRACKER_HYPOTHESES 3
+#define BEAT_TRACKER_MATCH_BINS 3          // A hypothesis follows its peak this far
+#define BEAT_TRACKER_DEAD_FRACTION 0.2f    // Peaks below this share of the strongest are ignored
+#define BEAT_TRACKER_ONSET_RATIO 1.5f      // Onset threshold over the novelty running mean
+#define BEAT_TRACKER_ONSET_FLOOR 1e-4f     // Absolute onset floor (silence)
+#define BEAT_TRACKER_MEAN_ALPHA 0.05f      // Novelty running mean per tick (~0.4 s at 50 Hz)
+#define BEAT_TRACKER_CAPTURE 1.2f          // Phase errors (radians) that steer the loop
+#define BEAT_TRACKER_PHASE_GAIN 0.4f      // Share of the phase error corrected per onset
+#define BEAT_TRACKER_FREQ_GAIN 0.08f       // Share of the period error corrected per onset
+#define BEAT_TRACKER_FREQ_RANGE 0.03f      // Loop frequency stays within +-3% of its bin
+#define BEAT_TRACKER_LOCK_ALPHA 0.2f      // Lock average per onset
+#define BEAT_TRACKER_PEAK_DECAY 0.995f     // Onset peak decay per tick (~4 s at 50 Hz)
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	float tempo_hz;           // Loop frequency (beats per second)
+	float center_hz;          // Frequency of the tempogram bin it follows
+	float phase;              // Radians, -pi..pi; sin(phase) peaks on the beat
+	float lock;               // Onset alignment, 0.0-1.0
+	float salience;           // Peak height relative to the strongest, 0.0-1.0
+	float confidence;         // lock * salience
+	float phase_error;        // Error at the last onset (radians, + = onset came before the loop's beat)
+	uint16_t bin;             // Tempogram bin it follows
+	uint16_t onsets;          // Onsets seen since it started
+	bool active;
+} BeatHypothesis;
+
+typedef struct {
+	BeatHypothesis hypotheses[BEAT_TRACKER_HYPOTHESES];   // Most confident first; inactive last
+	float novelty_prev;       // Novelty one tick ago (the onset candidate)
+	float novelty_prev2;      // Two ticks ago
+	float novelty_mean;       // Running mean for the onset threshold
+	float onset_peak;         // Decaying peak of onset heights (weights each onset)
+	uint32_t onsets;          // Onsets detected since init
+} BeatTracker;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void beat_tracker_init(BeatTracker* tracker);
+
+// Drop every hypothesis (onset detection state is kept)
+void beat_tracker_clear(BeatTracker* tracker);
+
+// Advance every active loop by dt_s seconds
+void beat_tracker_advance(BeatTracker* tracker, float dt_s);
+
+// Re-pick the hypotheses from a tempogram of num_bins bins: magnitude[],
+// bin frequencies in Hz and the tempogram's own phase per bin (for new loops)
+void beat_tracker_select(BeatTracker* tracker, const float* magnitude, const float* bin_hz,
+                         const float* bin_phase, uint16_t num_bins);
+
+// Feed one novelty sample (one tick of tick_s seconds). Returns true when the
+// previous sample was an onset and the loops were corrected.
+bool beat_tracker_novelty(BeatTracker* tracker, float novelty, float tick_s);
+
+#endif  // BEAT_TRACKER_H
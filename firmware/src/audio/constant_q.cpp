@@ -0,0 +1,216 @@
+// Constant-Q FFT Implementation
+// Sparse spectral kernels, packed real FFT and band smoothing (see constant_q.h)
+
+#include "constant_q.h"
+#include "../dsps_helpers.h"
+#include <cmath>
+#include <cstring>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+// Band auto-ranger (same tracking rate and floor as the spectrogram's)
+#define CONSTANT_Q_BAND_RANGE_RATE 0.005f
+#define CONSTANT_Q_BAND_RANGE_FLOOR 0.0025f
+#define CONSTANT_Q_BAND_SMOOTHING 0.35f     // Weight of the newest frame in smooth[]
+
+static inline float clip_unit(float x) {
+	return x < 0.0f ? 0.0f : (x > 1.0f ? 1.0f : x);
+}
+
+// X[0 .. M/2] of the M real samples packed in frame[] (z[m] = x[2m] + j x[2m+1]),
+// in place. With H = M/2 and Z the H-point FFT of z:
+//     E[f] = (Z[f] + conj(Z[H-f])) / 2,  O[f] = (Z[f] - conj(Z[H-f])) / 2j
+//     X[f] = E[f] + W^f O[f],  X[H-f] = conj(E[f] - W^f O[f])
+static void split_real_spectrum(float* frame, const float* twiddle) {
+	const uint32_t half = CONSTANT_Q_FFT_SIZE / 2;
+	const float z0_re = frame[0];
+	const float z0_im = frame[1];
+	frame[0] = z0_re + z0_im;
+	frame[1] = 0.0f;
+	frame[2 * half] = z0_re - z0_im;
+	frame[2 * half + 1] = 0.0f;
+
+	for (uint32_t f = 1; f <= half / 2; f++) {
+		float* a = frame + 2 * f;
+		float* b = frame + 2 * (half - f);
+		const float e_re = 0.5f * (a[0] + b[0]);
+		const float e_im = 0.5f * (a[1] - b[1]);
+		const float o_re = 0.5f * (a[1] + b[1]);
+		const float o_im = -0.5f * (a[0] - b[0]);
+		const float w_re = twiddle[2 * f];
+		const float w_im = twiddle[2 * f + 1];
+		const float wo_re = w_re * o_re - w_im * o_im;
+		const float wo_im = w_re * o_im + w_im * o_re;
+		a[0] = e_re + wo_re;
+		a[1] = e_im + wo_im;
+		b[0] = e_re - wo_re;
+		b[1] = -(e_im - wo_im);
+	}
+}
+
+// Hann-windowed |X[f]|^2: 0.5 X[f] - 0.25 (X[f-1] + X[f+1]), mirrored at 0 and M/2
+static inline float hann_power(const float* spectrum, uint32_t f) {
+	const uint32_t last = CONSTANT_Q_FFT_SIZE / 2;
+	const uint32_t lo = f > 0 ? f - 1 : 1;
+	const uint32_t hi = f < last ? f + 1 : last - 1;
+	const float lo_im = f > 0 ? spectrum[2 * lo + 1] : -spectrum[2 * lo + 1];
+	const float hi_im = f < last ? spectrum[2 * hi + 1] : -spectrum[2 * hi + 1];
+	const float re = 0.5f * spectrum[2 * f] - 0.25f * (spectrum[2 * lo] + spectrum[2 * hi]);
+	const float im = 0.5f * spectrum[2 * f + 1] - 0.25f * (lo_im + hi_im);
+	return re * re + im * im;
+}
+
+// |sum_i kernel[i] * X[first + i]|, the bin's magnitude
+static inline float kernel_response(const float* spectrum, uint32_t first, uint32_t length,
+                                    const float* kernel) {
+	const float* x = spectrum + 2 * first;
+	float re = 0.0f;
+	float im = 0.0f;
+	for (uint32_t i = 0; i < length; i++) {
+		re += kernel[2 * i] * x[2 * i] - kernel[2 * i + 1] * x[2 * i + 1];
+		im += kernel[2 * i] * x[2 * i + 1] + kernel[2 * i + 1] * x[2 * i];
+	}
+	return sqrtf(re * re + im * im);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+bool constant_q_init(ConstantQ* cq, const GoertzelBlockBin* bins, uint16_t num_bins,
+                     const float* window, float threshold) {
+	const uint32_t frame_size = CONSTANT_Q_FFT_SIZE;
+	if (num_bins > CONSTANT_Q_MAX_BINS || !dsps_fft2r_init_f32(frame_size)) {
+		return false;
+	}
+	cq->num_bins = num_bins;
+	cq->kernel_used = 0;
+	cq->band_max_smooth = 0.1f;
+
+	for (uint32_t f = 0; f <= frame_size / 4; f++) {
+		const double theta = -2.0 * M_PI * f / frame_size;
+		cq->twiddle[2 * f] = (float)cos(theta);
+		cq->twiddle[2 * f + 1] = (float)sin(theta);
+	}
+
+	for (uint16_t b = 0; b < num_bins; b++) {
+		const uint16_t block_size = bins[b].block_size;
+		if (block_size == 0 || block_size > frame_size) {
+			return false;
+		}
+
+		// t[m]: the bin's windowed tone at the end of the frame, scaled by
+		// 1 / (N / 2) like the block engine; the window position accumulates in
+		// float exactly as goertzel_block_magnitude() indexes it
+		memset(cq->frame, 0, sizeof(cq->frame));
+		const double omega = acos((double)bins[b].coeff / 2.0);
+		const double scale = 2.0 / block_size;
+		float window_pos = 0.0f;
+		float* t = cq->frame + 2 * (frame_size - block_size);
+		for (uint32_t n = 0; n < block_size; n++) {
+			const double w = window[uint32_t(window_pos)] * scale;
+			t[2 * n] = (float)(w * cos(omega * n));
+			t[2 * n + 1] = (float)(w * sin(omega * n));
+			window_pos += bins[b].window_step;
+		}
+		dsps_fft2r_f32_inplace(cq->frame, frame_size);
+
+		// Keep the run of positive-frequency coefficients above threshold. The
+		// main lobe is kept whole; what is dropped is the far sidelobe leakage
+		// of the truncated window (and the negative-frequency image, which only
+		// matters for the lowest bins below that level)
+		const uint32_t last_f = frame_size / 2;
+		float peak = 0.0f;
+		for (uint32_t f = 0; f <= last_f; f++) {
+			peak = fmaxf(peak, hypotf(cq->frame[2 * f], cq->frame[2 * f + 1]));
+		}
+		uint32_t first = last_f;
+		uint32_t last = 0;
+		for (uint32_t f = 0; f <= last_f; f++) {
+			if (hypotf(cq->frame[2 * f], cq->frame[2 * f + 1]) >= threshold * peak) {
+				first = f < first ? f : first;
+				last = f;
+			}
+		}
+		const uint32_t length = last - first + 1;
+		if (cq->kernel_used + length > CONSTANT_Q_KERNEL_CAPACITY) {
+			return false;
+		}
+
+		cq->bins[b] = {(uint16_t)first, (uint16_t)length, cq->kernel_used};
+		float* kernel = cq->kernel + 2 * cq->kernel_used;
+		for (uint32_t i = 0; i < length; i++) {
+			kernel[2 * i] = cq->frame[2 * (first + i)] / frame_size;
+			kernel[2 * i + 1] = -cq->frame[2 * (first + i) + 1] / frame_size;
+		}
+
+		// Truncation loses some of the main-lobe response too; rescale so a
+		// tone at the bin centre reads what the block engine reads
+		double exact_re = 0.0;
+		double exact_im = 0.0;
+		window_pos = 0.0f;
+		for (uint32_t n = 0; n < block_size; n++) {
+			const double x = cos(omega * (frame_size - block_size + n));
+			const double w = window[uint32_t(window_pos)] * scale;
+			exact_re += x * w * cos(omega * n);
+			exact_im -= x * w * sin(omega * n);
+			window_pos += bins[b].window_step;
+		}
+		memset(cq->frame, 0, sizeof(cq->frame));
+		for (uint32_t m = 0; m < frame_size; m++) {
+			cq->frame[2 * m] = (float)cos(omega * m);
+		}
+		dsps_fft2r_f32_inplace(cq->frame, frame_size);
+		const float truncated = kernel_response(cq->frame, first, length, kernel);
+		const float gain = truncated > 0.0f ? (float)(hypot(exact_re, exact_im) / truncated) : 1.0f;
+		for (uint32_t i = 0; i < 2 * length; i++) {
+			kernel[i] *= gain;
+		}
+		cq->kernel_used += length;
+	}
+	memset(cq->frame, 0, sizeof(cq->frame));
+	return true;
+}
+
+void constant_q_analyze(ConstantQ* cq, const SampleRing* history, uint32_t age,
+                        float* magnitudes, float* bands) {
+	// Real samples double as the packed complex input, so the copy is the packing
+	const SampleSpan span = sample_ring_window(history, CONSTANT_Q_FFT_SIZE, age);
+	sample_span_copy(span, cq->frame);
+	dsps_fft2r_f32_inplace(cq->frame, CONSTANT_Q_FFT_SIZE / 2);
+	split_real_spectrum(cq->frame, cq->twiddle);
+
+	for (uint16_t b = 0; b < cq->num_bins; b++) {
+		const ConstantQBin& bin = cq->bins[b];
+		magnitudes[b] = kernel_response(cq->frame, bin.first, bin.length, cq->kernel + 2 * bin.offset);
+	}
+
+	if (bands) {
+		// A full-scale sine's Hann-windowed power sums to 1.5 * (M / 4)^2
+		const uint32_t per_band = (CONSTANT_Q_FFT_SIZE / 2) / CONSTANT_Q_FFT_BANDS;
+		const float norm = 1.0f / (1.5f * (CONSTANT_Q_FFT_SIZE / 4.0f) * (CONSTANT_Q_FFT_SIZE / 4.0f));
+		for (uint16_t k = 0; k < CONSTANT_Q_FFT_BANDS; k++) {
+			float power = 0.0f;
+			for (uint32_t f = k * per_band; f < (k + 1) * per_band; f++) {
+				power += hann_power(cq->frame, f);
+			}
+			bands[k] = sqrtf(power * norm);
+		}
+	}
+}
+
+void constant_q_smooth_bands(ConstantQ* cq, const float* bands, float* smooth) {
+	float max_val = 0.0f;
+	for (uint16_t k = 0; k < CONSTANT_Q_FFT_BANDS; k++) {
+		max_val = fmaxf(max_val, bands[k]);
+	}
+	cq->band_max_smooth += (max_val - cq->band_max_smooth) * CONSTANT_Q_BAND_RANGE_RATE;
+	cq->band_max_smooth = fmaxf(cq->band_max_smooth, CONSTANT_Q_BAND_RANGE_FLOOR);
+
+	const float scale = 1.0f / cq->band_max_smooth;
+	for (uint16_t k = 0; k < CONSTANT_Q_FFT_BANDS; k++) {
+		smooth[k] += (clip_unit(bands[k] * scale) - smooth[k]) * CONSTANT_Q_BAND_SMOOTHING;
+	}
+}
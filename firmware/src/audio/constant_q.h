@@ -0,0 +1,90 @@
+// Constant-Q FFT - Note bins and a linear spectrum from one transform per hop
+// Brown & Puckette, "An efficient algorithm for the calculation of a constant
+// Q transform" (JASA 92(5), 1992)
+//
+// Each note bin is the Goertzel block engine's windowed DFT over its last N
+// samples (goertzel_block.h). By Parseval that inner product can be taken in
+// the frequency domain instead:
+//     sum_m x[m] * conj(t[m]) = (1 / M) * sum_f X[f] * conj(T[f])
+// where t is the bin's windowed complex exponential placed at the end of an
+// M-sample frame. T is computed once at init; being a Gaussian-windowed tone
+// it is concentrated around the bin's frequency, so only one contiguous run of
+// coefficients above a threshold is kept per bin. Per hop the whole analysis
+// is then one real FFT of the newest M samples plus a short complex dot
+// product per bin, independent of the block sizes.
+//
+// The real FFT packs the M samples as M/2 complex points (even + j * odd),
+// runs one M/2-point complex FFT (ESP-DSP dsps_fft2r_fc32 on device, portable
+// radix-2 on host, see dsps_helpers.h) and splits the result.
+//
+// The same spectrum also yields CONSTANT_Q_FFT_BANDS linear bands (0 .. fs/2,
+// Hann-windowed by a 3-tap convolution in the frequency domain), which
+// constant_q_smooth_bands() turns into the auto-ranged fft_smooth[] payload.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef CONSTANT_Q_H
+#define CONSTANT_Q_H
+
+#include <stdint.h>
+#include "sample_ring.h"
+#include "goertzel_block.h"
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define CONSTANT_Q_FFT_SIZE 2048            // Frame M; must cover the longest note block
+#define CONSTANT_Q_MAX_BINS 64
+#define CONSTANT_Q_FFT_BANDS 128            // Linear bands of fs / 2 (fft_smooth[])
+#define CONSTANT_Q_KERNEL_CAPACITY 5120     // Complex kernel coefficients across all bins (40 KB)
+
+// Kernel coefficients below this fraction of their bin's peak are dropped.
+// 0.1 keeps ~4200 coefficients for the 64 note bins; tone sweeps then track
+// the block engine to ~2% RMS of the peak bin (tools/spectrum_engine_bench.cpp)
+#define CONSTANT_Q_DEFAULT_THRESHOLD 0.1f
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	uint16_t first;                         // FFT bin of the first kept coefficient
+	uint16_t length;                        // Coefficients kept (contiguous run)
+	uint32_t offset;                        // Start in ConstantQ::kernel (complex index)
+} ConstantQBin;
+
+typedef struct {
+	ConstantQBin bins[CONSTANT_Q_MAX_BINS];
+	uint16_t num_bins;
+	uint32_t kernel_used;                           // Complex coefficients in use
+	float kernel[CONSTANT_Q_KERNEL_CAPACITY * 2];   // conj(T[f]) / M, {re, im} interleaved
+	float twiddle[(CONSTANT_Q_FFT_SIZE / 4 + 1) * 2];  // e^(-j 2 pi f / M), f <= M / 4 (real split)
+	float frame[CONSTANT_Q_FFT_SIZE * 2];           // FFT work buffer; X[0 .. M/2] after analysis
+	float band_max_smooth;                          // Auto-ranger state of constant_q_smooth_bands()
+} ConstantQ;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// Build the sparse kernels for num_bins block-engine bins (same layout as the
+// Goertzel block engine, window indexed as in goertzel_block_magnitude()).
+// threshold is relative to each bin's kernel peak. Returns false if a block is
+// longer than CONSTANT_Q_FFT_SIZE, the kernels overflow
+// CONSTANT_Q_KERNEL_CAPACITY, or the FFT cannot be set up.
+bool constant_q_init(ConstantQ* cq, const GoertzelBlockBin* bins, uint16_t num_bins,
+                     const float* window, float threshold);
+
+// Analyse the CONSTANT_Q_FFT_SIZE samples whose newest has the given age.
+// magnitudes[num_bins] match goertzel_block_magnitude() (|X| / (N / 2)) up to
+// kernel truncation; bands[CONSTANT_Q_FFT_BANDS] (optional, nullptr skips) are
+// RMS band magnitudes, a full-scale sine reading about 1.0.
+void constant_q_analyze(ConstantQ* cq, const SampleRing* history, uint32_t age,
+                        float* magnitudes, float* bands);
+
+// Auto-range bands against a slowly tracked peak and low-pass them into
+// smooth[CONSTANT_Q_FFT_BANDS] (0.0-1.0)
+void constant_q_smooth_bands(ConstantQ* cq, const float* bands, float* smooth);
+
+#endif  // CONSTANT_Q_H
@@ -0,0 +1,85 @@
+// Frame Triple Buffer - Lock-free single-writer/single-reader slot rotation
+//
+// Three slots rotate between the writer (filling), a shared "middle" (latest
+// completed frame) and the reader (borrowed). Publishing and acquiring are one
+// atomic exchange each, so neither side ever copies the other's data, waits or
+// retries. The reader's slot cannot be touched by the writer until the reader
+// acquires again, so a borrowed pointer stays stable for a whole render frame.
+//
+// Only slot indices live here; callers own the slot storage (slots[3]).
+// Exactly ONE writer task and ONE reader task may use a given buffer.
+//
+// Header-only and dependency-free so it can be stress tested on host.
+
+#ifndef FRAME_TRIPLE_BUFFER_H
+#define FRAME_TRIPLE_BUFFER_H
+
+#include <stdint.h>
+#include <atomic>
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define FRAME_TRIPLE_BUFFER_SLOTS 3
+#define FRAME_TRIPLE_BUFFER_FRESH 0x80      // Set on middle when it holds an unread frame
+#define FRAME_TRIPLE_BUFFER_INDEX 0x03
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	std::atomic<uint8_t> middle;            // Latest completed slot (| FRESH if unread)
+	uint8_t write_index;                    // Owned by the writer
+	uint8_t read_index;                     // Owned by the reader
+	uint32_t published;                     // Writer-side publish count
+	uint32_t acquired;                      // Reader-side count of fresh acquires
+} FrameTripleBuffer;
+
+// ============================================================================
+// API
+// ============================================================================
+
+inline void frame_triple_buffer_init(FrameTripleBuffer* tb) {
+	tb->write_index = 0;
+	tb->middle.store(1, std::memory_order_relaxed);
+	tb->read_index = 2;
+	tb->published = 0;
+	tb->acquired = 0;
+}
+
+// Slot the writer should fill next
+inline uint8_t frame_triple_buffer_write_slot(const FrameTripleBuffer* tb) {
+	return tb->write_index;
+}
+
+// Writer: hand the filled slot to the reader side and take the old middle back.
+// memory_order_acq_rel: slot contents are visible before the index is, and the
+// returned slot is no longer being read.
+inline void frame_triple_buffer_publish(FrameTripleBuffer* tb) {
+	uint8_t previous = tb->middle.exchange(tb->write_index | FRAME_TRIPLE_BUFFER_FRESH,
+	                                       std::memory_order_acq_rel);
+	tb->write_index = previous & FRAME_TRIPLE_BUFFER_INDEX;
+	tb->published++;
+}
+
+// Reader: swap in the newest completed slot if there is one.
+// Returns true when the read slot changed. The previous read slot must no
+// longer be referenced after this call.
+inline bool frame_triple_buffer_acquire(FrameTripleBuffer* tb) {
+	if ((tb->middle.load(std::memory_order_relaxed) & FRAME_TRIPLE_BUFFER_FRESH) == 0) {
+		return false;
+	}
+	uint8_t previous = tb->middle.exchange(tb->read_index, std::memory_order_acq_rel);
+	tb->read_index = previous & FRAME_TRIPLE_BUFFER_INDEX;
+	tb->acquired++;
+	return true;
+}
+
+// Slot the reader currently owns (stable until the next acquire)
+inline uint8_t frame_triple_buffer_read_slot(const FrameTripleBuffer* tb) {
+	return tb->read_index;
+}
+
+#endif  // FRAME_TRIPLE_BUFFER_H
@@ -14,10 +14,20 @@
 // Frequency domain analysis via constant-Q Goertzel filter
 
 #include "goertzel.h"
+#include "goertzel_lut.h"
+#include "sliding_goertzel.h"
+#include "goertzel_block.h"
+#include "constant_q.h"
+#include "octave_pyramid.h"
+#include "analysis_profile.h"
+#include "running_stats.h"
+#include "audio_warm_start.h"
+#include "tempo.h"
 #include <cmath>
 #include <cstring>
 #include <atomic>
 #include <Arduino.h>
+#include <Preferences.h>
 #include "../logging/logger.h"
 #include "../parameters.h"
 
@@ -36,14 +46,58 @@ float audio_level = 0.0f;
 tempo tempi[NUM_TEMPI];
 float tempi_smooth[NUM_TEMPI] = {0};
 
-// Sample history buffer
-float sample_history[SAMPLE_HISTORY_LENGTH] = {0};
+// Sample history ring buffer
+static_assert((SAMPLE_HISTORY_LENGTH & (SAMPLE_HISTORY_LENGTH - 1)) == 0,
+              "SAMPLE_HISTORY_LENGTH must be a power of two");
+static float sample_history_storage[SAMPLE_HISTORY_LENGTH] = {0};
+SampleRing sample_history = {
+	sample_history_storage,
+	SAMPLE_HISTORY_LENGTH,
+	SAMPLE_HISTORY_LENGTH - 1,
+	0,
+};
 
-// Goertzel state
+// Goertzel state (constant tables are generated into goertzel_lut.h)
+static_assert(GOERTZEL_LUT_SAMPLE_RATE_HZ == AUDIO_SAMPLE_RATE_HZ && GOERTZEL_LUT_NUM_FREQS == NUM_FREQS &&
+              GOERTZEL_LUT_BOTTOM_NOTE == BOTTOM_NOTE && GOERTZEL_LUT_NOTE_STEP == NOTE_STEP,
+              "goertzel_lut.h is stale; rerun tools/generate_goertzel_luts.py");
 freq frequencies_musical[NUM_FREQS];
-float window_lookup[4096];
 uint16_t max_goertzel_block_size = 0;
 std::atomic<bool> magnitudes_locked{false};
+#if GOERTZEL_SLIDING_ENABLED
+static SlidingGoertzelBin sliding_goertzel_bins[NUM_FREQS];
+static SlidingGoertzelBank sliding_goertzel_bank;
+#else
+static GoertzelBlockBin goertzel_block_bins[NUM_FREQS];
+#endif
+#if CONSTANT_Q_FFT_ENABLED
+static_assert(NUM_FREQS <= CONSTANT_Q_MAX_BINS, "constant-Q engine holds at most CONSTANT_Q_MAX_BINS bins");
+static_assert(CONSTANT_Q_FFT_SIZE < SAMPLE_HISTORY_LENGTH, "constant-Q frame must fit the sample history");
+static_assert(CONSTANT_Q_FFT_BANDS == sizeof(AudioDataPayload::fft_smooth) / sizeof(float),
+              "fft_smooth[] holds one value per constant-Q band");
+static ConstantQ constant_q;
+static bool constant_q_ready = false;
+static float fft_smooth[CONSTANT_Q_FFT_BANDS] = {0};
+#endif
+#if GOERTZEL_OCTAVE_PYRAMID_ENABLED
+static_assert(NUM_FREQS <= OCTAVE_PYRAMID_MAX_BINS, "octave pyramid holds at most OCTAVE_PYRAMID_MAX_BINS bins");
+static OctavePyramid octave_pyramid;
+static bool octave_pyramid_ready = false;
+#endif
+
+// Analysis profile (analysis_profile.h): requested from any task, applied by the
+// audio task at its next frame. The engine bins above hold the analysed bins.
+#if CONSTANT_Q_FFT_ENABLED
+#define ANALYSIS_MAX_BLOCK_SIZE CONSTANT_Q_FFT_SIZE
+#else
+#define ANALYSIS_MAX_BLOCK_SIZE (SAMPLE_HISTORY_LENGTH - 4)   // Block read at age 1, multiple of 4
+#endif
+static uint8_t analysis_profile_index = ANALYSIS_PROFILE_STANDARD;
+static std::atomic<uint8_t> analysis_profile_requested{ANALYSIS_PROFILE_STANDARD};
+static AnalysisProfileStats analysis_profile_stats[ANALYSIS_PROFILE_COUNT];
+static uint16_t analysis_num_bins = NUM_FREQS;
+static uint8_t analysis_hop_count = 0;
+static uint32_t analysis_ingest_cycles = 0;   // Ingest cycles since the last frame
 
 // Audio processing state
 uint32_t noise_calibration_active_frames_remaining = 0;
@@ -62,6 +116,21 @@ int16_t audio_debug_recording[MAX_AUDIO_RECORDING_SAMPLES];
 float spectrogram_average[NUM_SPECTROGRAM_AVERAGE_SAMPLES][NUM_FREQS];
 uint8_t spectrogram_average_index = 0;
 
+// Shared 8-bit spectrogram history for patterns
+SpectrogramHistory spectrogram_history;
+
+// Previous frame for the published spectral flux
+static AudioFeatureState audio_feature_state;
+
+// Auto-ranger smoothed peak (warm-started from flash)
+static float autoranger_ceiling = 0.1f;
+
+// Running per-bin sums over spectrogram_average (its head mirrors spectrogram_average_index)
+static float spectrogram_average_sums[NUM_FREQS] = {0.0f};
+static RunningSum spectrogram_window = {
+	&spectrogram_average[0][0], spectrogram_average_sums, NUM_SPECTROGRAM_AVERAGE_SAMPLES, NUM_FREQS, 0
+};
+
 // Double-buffering for thread-safe audio sync
 AudioDataSnapshot audio_front;
 AudioDataSnapshot audio_back;
@@ -71,12 +140,12 @@ static bool audio_sync_initialized = false;
 static uint32_t g_last_sync_warn_writer_ms = 0;
 static uint32_t g_last_sync_warn_torn_ms = 0;
 
-// Lookup tables
-const float notes[] = {
-	55.0, 56.635235, 58.27047, 60.00294, 61.73541, 63.5709, 65.40639, 67.351025, 69.29566, 71.355925, 73.41619, 75.59897, 77.78175, 80.09432, 82.40689, 84.856975, 87.30706, 89.902835, 92.49861, 95.248735, 97.99886, 100.91253, 103.8262, 106.9131, 110.0, 113.27045, 116.5409, 120.00585, 123.4708, 127.1418, 130.8128, 134.70205, 138.5913, 142.71185, 146.8324, 151.19795, 155.5635, 160.18865, 164.8138, 169.71395, 174.6141, 179.80565, 184.9972, 190.49745, 195.9977, 201.825, 207.6523, 213.82615, 220.0, 226.54095, 233.0819, 240.0118, 246.9417, 254.28365, 261.6256, 269.4041, 277.1826, 285.4237, 293.6648, 302.3959, 311.127, 320.3773, 329.6276, 339.4279, 349.2282, 359.6113, 369.9944, 380.9949, 391.9954, 403.65005, 415.3047, 427.65235, 440.0, 453.0819, 466.1638, 480.02355, 493.8833, 508.5672, 523.2511, 538.8082, 554.3653, 570.8474, 587.3295, 604.79175, 622.254, 640.75455, 659.2551, 678.8558, 698.4565, 719.22265, 739.9888, 761.98985, 783.9909, 807.30015, 830.6094, 855.3047, 880.0, 906.16375, 932.3275, 960.04705, 987.7666, 1017.1343, 1046.502, 1077.6165, 1108.731, 1141.695, 1174.659, 1209.5835, 1244.508, 1281.509, 1318.51, 1357.7115, 1396.913, 1438.4455, 1479.978, 1523.98, 1567.982, 1614.6005, 1661.219, 1710.6095, 1760.0, 1812.3275, 1864.655, 1920.094, 1975.533, 2034.269, 2093.005, 2155.233, 2217.461, 2283.3895, 2349.318, 2419.167, 2489.016, 2563.018, 2637.02, 2715.4225, 2793.825, 2876.8905, 2959.956, 3047.96, 3135.964, 3229.2005, 3322.437, 3421.2185, 3520.0, 3624.655, 3729.31, 3840.1875, 3951.065, 4068.537, 4186.009, 4310.4655, 4434.922, 4566.779, 4698.636, 4838.334, 4978.032, 5126.0365, 5274.041, 5430.8465, 5587.652, 5753.7815, 5919.911, 6095.919, 6271.927, 6458.401, 6644.875, 6842.4375, 7040.0, 7249.31, 7458.62, 7680.375, 7902.13, 8137.074, 8372.018, 8620.931, 8869.844, 9133.558, 9397.272, 9676.668, 9956.064, 10252.072, 10548.08, 10861.69, 11175.3, 11507.56, 11839.82, 12191.835, 12543.85, 12916.8, 13289.75, 13684.875, 14080.0, 14498.62, 14917.24, 15360.75, 15804.26, 16274.145, 16744.03, 17241.855, 17739.68, 18267.11, 18794.54, 19353.36, 19912.18, 20504.17, 21096.16, 21723.38, 22350.6, 23015.12, 23679.64, 24383.67, 25087.7, 25833.6, 26579.5, 27369.75, 28160.0, 28997.24, 29834.48, 30721.5, 31608.52, 32548.295, 33488.07, 34483.72, 35479.37, 36534.225, 37589.08, 38706.665, 39824.25, 41008.285, 42192.32, 43446.76, 44701.2, 46030.24, 47359.28, 48767.34, 50175.4, 51667.2
-};
+// Triple-buffered frames for the render task (see frame_triple_buffer.h)
+static AudioDataSnapshot audio_frames[FRAME_TRIPLE_BUFFER_SLOTS];
+static FrameTripleBuffer audio_frame_buffer;
 
-float full_spectrum_frequencies[64] = {
+// Lookup tables (notes[] and window_lookup[] are in goertzel_lut.h)
+const float full_spectrum_frequencies[64] = {
 	50.0, 150.79, 251.59, 352.38, 453.17, 553.97, 654.76, 755.56,
 	856.35, 957.14, 1057.94, 1158.73, 1259.52, 1360.32, 1461.11, 1561.90,
 	1662.70, 1763.49, 1864.29, 1965.08, 2065.87, 2166.67, 2267.46, 2368.25,
@@ -112,6 +181,15 @@ void init_audio_data_sync() {
 	audio_front.payload.is_valid = false;
 	audio_back.payload.is_valid = false;
 
+	for (uint8_t i = 0; i < FRAME_TRIPLE_BUFFER_SLOTS; i++) {
+		memset(&audio_frames[i].payload, 0, sizeof(AudioDataPayload));
+		audio_frames[i].sequence.store(0, std::memory_order_relaxed);
+		audio_frames[i].sequence_end.store(0, std::memory_order_relaxed);
+	}
+	frame_triple_buffer_init(&audio_frame_buffer);
+	spectrogram_history_init(&spectrogram_history);
+	audio_features_init(&audio_feature_state, NUM_FREQS);
+
 	audio_sync_initialized = true;
 
 	LOG_INFO(TAG_SYNC, "Initialized successfully");
@@ -238,89 +316,127 @@ void commit_audio_data() {
 	// memory_order_release: Ensure sequence_end is consistent with sequence
 	audio_front.sequence_end.store(audio_front.sequence.load(std::memory_order_relaxed),
 	                                std::memory_order_release);
-}
 
-void init_goertzel(uint16_t frequency_slot, float frequency, float bandwidth) {
-		// Calculate the block size based on the desired bandwidth
-		frequencies_musical[frequency_slot].block_size = AUDIO_SAMPLE_RATE_HZ / (bandwidth);
+#if AUDIO_TRIPLE_BUFFER_ENABLED
+	// Fill the writer-owned slot, then publish it with a single exchange.
+	// The render task never sees a partially written slot, so it needs no retries.
+	AudioDataSnapshot* frame = &audio_frames[frame_triple_buffer_write_slot(&audio_frame_buffer)];
+	memcpy(&frame->payload, &audio_back.payload, sizeof(AudioDataPayload));
+	frame->sequence.store(seq + 1, std::memory_order_relaxed);
+	frame->sequence_end.store(seq + 1, std::memory_order_relaxed);
+	frame_triple_buffer_publish(&audio_frame_buffer);
+#endif
+}
 
-	// Adjust the block size to be divisible by 4
-	while (frequencies_musical[frequency_slot].block_size % 4 != 0) {
-		frequencies_musical[frequency_slot].block_size -= 1;
+// =============================================================================
+// Borrow the newest completed audio frame (triple buffer reader)
+//
+// Single reader: only the render task (loop_gpu) may call this. The returned
+// slot is owned by the reader until the next call, so patterns can read it in
+// place for the whole frame. Returns the previous frame when nothing new has
+// been published.
+// =============================================================================
+const AudioDataSnapshot* acquire_audio_frame() {
+	if (audio_sync_initialized) {
+		frame_triple_buffer_acquire(&audio_frame_buffer);
 	}
+	return &audio_frames[frame_triple_buffer_read_slot(&audio_frame_buffer)];
+}
+
+const AudioDataSnapshot* current_audio_frame() {
+	return &audio_frames[frame_triple_buffer_read_slot(&audio_frame_buffer)];
+}
 
-	// Limit the block size to the maximum sample history length
-	if (frequencies_musical[frequency_slot].block_size > SAMPLE_HISTORY_LENGTH - 1) {
-		frequencies_musical[frequency_slot].block_size = SAMPLE_HISTORY_LENGTH - 1;
+// Configure one analysed bin of a profile from its slot's standard constants
+void init_goertzel(uint16_t bin_index, const AnalysisProfile* profile) {
+	// Constants are generated at build time (tools/generate_goertzel_luts.py)
+	const uint16_t slot = bin_index * profile->bin_stride;
+	const GoertzelBinConstants& constants = GOERTZEL_BIN_LUT[slot];
+	const GoertzelBlockBin base = {constants.block_size, constants.window_step, constants.coeff};
+	float k;
+	const GoertzelBlockBin bin = analysis_profile_bin(profile, &base, constants.k, constants.target_freq,
+	                                                  AUDIO_SAMPLE_RATE_HZ, ANALYSIS_MAX_BLOCK_SIZE, &k);
+
+	// Interpolated slots report the bin they are read from
+	for (uint16_t s = slot; s < slot + profile->bin_stride && s < NUM_FREQS; s++) {
+		frequencies_musical[s].block_size = bin.block_size;
+		frequencies_musical[s].window_step = bin.window_step;
+		frequencies_musical[s].coeff = bin.coeff;
 	}
 
 	// Update the maximum goertzel block size
-	max_goertzel_block_size = max(max_goertzel_block_size, frequencies_musical[frequency_slot].block_size);
+	max_goertzel_block_size = max(max_goertzel_block_size, bin.block_size);
+
+#if GOERTZEL_SLIDING_ENABLED
+	// Rebuilt from the history, so a profile switch does not restart the window
+	sliding_goertzel_configure_bin(&sliding_goertzel_bank, bin_index, bin.block_size, k);
+	sliding_goertzel_resync_bin(&sliding_goertzel_bank, bin_index, &sample_history);
+#else
+	goertzel_block_bins[bin_index] = bin;
+#endif
+}
 
-	// Calculate the window step size
-	frequencies_musical[frequency_slot].window_step = 4096.0 / frequencies_musical[frequency_slot].block_size;
+// Build the analysed bins of a profile and (re)initialise the engine on them.
+// Audio task (or setup()) only.
+static void configure_analysis_bins(const AnalysisProfile* profile) {
+	analysis_num_bins = analysis_profile_num_bins(profile, NUM_FREQS);
+	max_goertzel_block_size = 0;
+#if GOERTZEL_SLIDING_ENABLED
+	sliding_goertzel_reset(&sliding_goertzel_bank, sliding_goertzel_bins, analysis_num_bins, window_lookup, 4096);
+#endif
+	for (uint16_t b = 0; b < analysis_num_bins; b++) {
+		init_goertzel(b, profile);
+	}
 
-	// Calculate the coefficients for the goertzel algorithm
-	float k = (int)(0.5 + ((frequencies_musical[frequency_slot].block_size * frequencies_musical[frequency_slot].target_freq) / AUDIO_SAMPLE_RATE_HZ));
-	float w = (2.0 * PI * k) / frequencies_musical[frequency_slot].block_size;
-	float cosine = cos(w);
-    (void)sin(w);
-	frequencies_musical[frequency_slot].coeff = 2.0 * cosine;
+#if CONSTANT_Q_FFT_ENABLED
+	// Kernels are built from the block engine's bins and window
+	constant_q_ready = constant_q_init(&constant_q, goertzel_block_bins, analysis_num_bins, window_lookup,
+	                                   CONSTANT_Q_DEFAULT_THRESHOLD);
+	if (constant_q_ready) {
+		LOG_INFO(TAG_AUDIO, "Constant-Q FFT engine: %u kernel coefficients", (unsigned)constant_q.kernel_used);
+	}
+	else {
+		LOG_ERROR(TAG_AUDIO, "Constant-Q FFT init failed; using the Goertzel block engine");
+	}
+#endif
+#if GOERTZEL_OCTAVE_PYRAMID_ENABLED
+	// Levels are mapped from the full-rate block bins; samples arrive via goertzel_ingest_samples().
+	// Re-init clears the decimated levels, so low bins refill for a block after a switch.
+	octave_pyramid_ready = octave_pyramid_init(&octave_pyramid, goertzel_block_bins, analysis_num_bins,
+	                                           AUDIO_SAMPLE_RATE_HZ, OCTAVE_PYRAMID_MAX_LEVELS);
+	if (octave_pyramid_ready) {
+		LOG_INFO(TAG_AUDIO, "Octave pyramid: lowest bin on level %u of %u",
+		         (unsigned)octave_pyramid.bin_level[0], (unsigned)OCTAVE_PYRAMID_MAX_LEVELS);
+	}
+	else {
+		LOG_ERROR(TAG_AUDIO, "Octave pyramid init failed; using the full-rate block engine");
+	}
+#endif
+	analysis_hop_count = 0;
 }
 
 void init_goertzel_constants_musical() {
+	// Half-step slots from notes[BOTTOM_NOTE], bandwidth 4x the quarter-step neighbour distance
 	for (uint16_t i = 0; i < NUM_FREQS; i++) {
-		// INIT MUSICAL FREQS
-		uint16_t note = BOTTOM_NOTE + (i * NOTE_STEP);
-		frequencies_musical[i].target_freq = notes[note];
-
-		float neighbor_left;
-		float neighbor_right;
-
-		if (note == 0) {
-			neighbor_left = notes[note];
-			neighbor_right = notes[note + 1];
-		}
-		else if (note == NUM_FREQS - 1) {
-			neighbor_left = notes[note - 1];
-			neighbor_right = notes[note];
-		}
-		else {
-			neighbor_left = notes[note - 1];
-			neighbor_right = notes[note + 1];
-		}
-
-		float neighbor_distance_hz = max(
-			fabs(frequencies_musical[i].target_freq - neighbor_left),
-			fabs(frequencies_musical[i].target_freq - neighbor_right));
-
-		init_goertzel(i, frequencies_musical[i].target_freq, neighbor_distance_hz * 4.0);
+		frequencies_musical[i].target_freq = GOERTZEL_BIN_LUT[i].target_freq;
 	}
+	configure_analysis_bins(&ANALYSIS_PROFILES[analysis_profile_index]);
 }
 
-void init_window_lookup() {
-    float sigma = 0.8; // For gaussian window
-
-    for (uint16_t i = 0; i < 2048; i++) {
-        // precomputed ratio not used; keep calculation folded by compiler if needed
-        // (void) to silence warnings on some toolchains
-        (void)i;
-
-        float n_minus_halfN = i - 2048 / 2;
-        float gaussian_weighing_factor = exp(-0.5 * pow((n_minus_halfN / (sigma * 2048 / 2)), 2));
-
-        // Hamming window
-        //float weighing_factor = 0.54 * (1.0 - cos(TWOPI * ratio));
-
-        // Blackman-Harris window
-        //float weighing_factor = 0.3635819 - (0.4891775 * cos(TWOPI * ratio)) + (0.1365995 * cos(FOURPI * ratio)) - (0.0106411 * cos(SIXPI * ratio));
+bool set_analysis_profile(uint8_t index) {
+	if (index >= ANALYSIS_PROFILE_COUNT) {
+		return false;
+	}
+	analysis_profile_requested.store(index, std::memory_order_release);
+	return true;
+}
 
-        // Gaussian window
-        float weighing_factor = gaussian_weighing_factor;
+uint8_t get_analysis_profile() {
+	return analysis_profile_requested.load(std::memory_order_acquire);
+}
 
-        window_lookup[i] = weighing_factor;
-        window_lookup[4095 - i] = weighing_factor; // Mirror the value for the second half
-    }
+AnalysisProfileStats get_analysis_profile_stats(uint8_t index) {
+	return analysis_profile_stats[index < ANALYSIS_PROFILE_COUNT ? index : ANALYSIS_PROFILE_STANDARD];
 }
 
 // Function to find the median in a small array of floats
@@ -363,37 +479,11 @@ void median_filter(float* spectrogram_column) {
 	memcpy(spectrogram_column, output, sizeof(output));
 }
 
-float calculate_magnitude_of_bin(uint16_t bin_number) {
-	float normalized_magnitude;
+// Frequency-dependent scale and final sqrt, shared by every engine
+static float scale_bin_magnitude(uint16_t bin_number, float normalized_magnitude) {
 	float scale;
 
 	profile_function([&]() {
-		float q0 = 0;
-		float q1 = 0;
-		float q2 = 0;
-		float window_pos = 0.0;
-
-		const uint16_t block_size = frequencies_musical[bin_number].block_size;
-
-		float coeff = frequencies_musical[bin_number].coeff;
-		float window_step = frequencies_musical[bin_number].window_step;
-
-		float* sample_ptr = &sample_history[(SAMPLE_HISTORY_LENGTH - 1) - block_size];
-
-		for (uint16_t i = 0; i < block_size; i++) {
-			float windowed_sample = sample_ptr[i] * window_lookup[uint32_t(window_pos)];
-			q0 = coeff * q1 - q2 + windowed_sample;
-			q2 = q1;
-			q1 = q0;
-
-			window_pos += window_step;
-		}
-
-		float magnitude_squared = (q1 * q1) + (q2 * q2) - q1 * q2 * coeff;
-		float magnitude = sqrt(magnitude_squared);
-		// EMOTISCOPE VERBATIM: Divide by N/2 (not N)
-		normalized_magnitude = magnitude / (block_size / 2.0);
-
 		// EMOTISCOPE VERBATIM: Frequency-dependent scale factor (progress^4)
 		float progress = float(bin_number) / NUM_FREQS;
 		progress *= progress;
@@ -405,11 +495,12 @@ float calculate_magnitude_of_bin(uint16_t bin_number) {
 			extern bool audio_trace_enabled;
 			static uint32_t trace_counter_goertzel = 0;
 			if (audio_trace_enabled && ++trace_counter_goertzel % 100 == 0) {
+				const uint16_t block_size = frequencies_musical[bin_number].block_size;
 				LOG_INFO(TAG_TRACE, "[PT2-GOERTZEL] bin32: normalized_mag=%.6f scale=%.6f result=%.6f | history[0-2]=%.4f %.4f %.4f",
 					normalized_magnitude, scale, normalized_magnitude * scale,
-					sample_history[SAMPLE_HISTORY_LENGTH - 1 - block_size],
-					sample_history[SAMPLE_HISTORY_LENGTH - 1 - block_size + 1],
-					sample_history[SAMPLE_HISTORY_LENGTH - 1 - block_size + 2]);
+					sample_ring_at(&sample_history, block_size),
+					sample_ring_at(&sample_history, block_size - 1),
+					sample_ring_at(&sample_history, block_size - 2));
 			}
 		}
 
@@ -419,6 +510,56 @@ float calculate_magnitude_of_bin(uint16_t bin_number) {
 	return sqrt(normalized_magnitude * scale);
 }
 
+// Magnitudes of the analysed bins (before scale_bin_magnitude()) into magnitudes[analysis_num_bins]
+static void analyze_bins(float* magnitudes) {
+#if CONSTANT_Q_FFT_ENABLED
+	if (constant_q_ready) {
+		// One FFT: the note bins and the linear bands for fft_smooth[]
+		static float fft_bands[CONSTANT_Q_FFT_BANDS];
+		constant_q_analyze(&constant_q, &sample_history, 1, magnitudes, fft_bands);
+		constant_q_smooth_bands(&constant_q, fft_bands, fft_smooth);
+		return;
+	}
+#endif
+#if GOERTZEL_OCTAVE_PYRAMID_ENABLED
+	if (octave_pyramid_ready) {
+		// Block engine on the pyramid: each level's bins GOERTZEL_BLOCK_LANES at a time
+		octave_pyramid_magnitudes(&octave_pyramid, &sample_history, window_lookup, GOERTZEL_BLOCK_LANES,
+		                          magnitudes);
+		return;
+	}
+#endif
+#if GOERTZEL_SLIDING_ENABLED
+	// Resonators were advanced sample-by-sample in goertzel_ingest_samples()
+	for (uint16_t b = 0; b < analysis_num_bins; b++) {
+		magnitudes[b] = sliding_goertzel_magnitude(&sliding_goertzel_bank, b);
+	}
+#else
+	// Block engine: blocks end one sample before the newest (legacy [LEN - 1 - N, LEN - 2]
+	// range), bins swept GOERTZEL_BLOCK_LANES at a time.
+	// EMOTISCOPE VERBATIM: Divide by N/2 (not N)
+	goertzel_block_magnitudes(&sample_history, 1, window_lookup, goertzel_block_bins, analysis_num_bins,
+	                          GOERTZEL_BLOCK_LANES, magnitudes);
+#endif
+}
+
+void goertzel_ingest_samples(const float* new_samples, uint16_t count) {
+#if GOERTZEL_SLIDING_ENABLED
+	// sample_history still holds the pre-chunk window here, so x[n - N] is in range
+	const uint32_t c_start = ESP.getCycleCount();
+	sliding_goertzel_ingest(&sliding_goertzel_bank, &sample_history, new_samples, count);
+	analysis_ingest_cycles += ESP.getCycleCount() - c_start;
+#elif GOERTZEL_OCTAVE_PYRAMID_ENABLED
+	// Decimated levels follow the same chunks as sample_history
+	const uint32_t c_start = ESP.getCycleCount();
+	octave_pyramid_push(&octave_pyramid, new_samples, count);
+	analysis_ingest_cycles += ESP.getCycleCount() - c_start;
+#else
+	(void)new_samples;
+	(void)count;
+#endif
+}
+
 float collect_and_filter_noise(float input_magnitude, uint16_t bin) {
 	if (noise_calibration_active_frames_remaining == 0) {
 		float output_magnitude = input_magnitude - noise_spectrum[bin];
@@ -461,10 +602,43 @@ void calculate_magnitudes() {
 		static uint32_t iter = 0;
 		iter++;
 
+		// Apply a profile requested over REST (the engines are only touched by this task)
+		const uint8_t requested_profile = analysis_profile_requested.load(std::memory_order_acquire);
+		if (requested_profile != analysis_profile_index) {
+			analysis_profile_index = requested_profile;
+			configure_analysis_bins(&ANALYSIS_PROFILES[analysis_profile_index]);
+			LOG_INFO(TAG_AUDIO, "Analysis profile: %s (%u bins, max block %u)",
+			         ANALYSIS_PROFILES[analysis_profile_index].name, (unsigned)analysis_num_bins,
+			         (unsigned)max_goertzel_block_size);
+		}
+		const AnalysisProfile* profile = &ANALYSIS_PROFILES[analysis_profile_index];
+		const uint32_t c_analysis = ESP.getCycleCount();  // CCOUNT; wraps every ~18 s, fine for one frame
+
+#if GOERTZEL_SLIDING_ENABLED
+		// Rebuild one bin per frame from raw history to bound float drift
+		// (full sweep every analysed-bin-count frames)
+		sliding_goertzel_resync_next(&sliding_goertzel_bank, &sample_history);
+#endif
+
+		// Sweep the analysed bins every hop_chunks frames and spread them over the
+		// slots; frames in between reuse the last sweep
+		static float bin_magnitudes[NUM_FREQS];
+		static float slot_magnitudes[NUM_FREQS];
+		if (analysis_hop_count == 0) {
+			analyze_bins(bin_magnitudes);
+			analysis_profile_expand(profile, bin_magnitudes, NUM_FREQS, slot_magnitudes);
+		}
+		analysis_hop_count = (analysis_hop_count + 1) % profile->hop_chunks;
+
+		const uint32_t analysis_cycles = (ESP.getCycleCount() - c_analysis) + analysis_ingest_cycles;
+		analysis_ingest_cycles = 0;
+		analysis_profile_record(&analysis_profile_stats[analysis_profile_index], analysis_cycles);
+
 		// Iterate over all target frequencies - calculate ALL bins every frame (no interlacing)
+		float max_val = 0.0f;
 		for (uint16_t i = 0; i < NUM_FREQS; i++) {
 			// Get raw magnitude of frequency
-			magnitudes_raw[i] = calculate_magnitude_of_bin(i);  // fast_mode enabled (downsampled audio)
+			magnitudes_raw[i] = scale_bin_magnitude(i, slot_magnitudes[i]);
 			magnitudes_unfiltered[i] = magnitudes_raw[i];  // CRITICAL: Save BEFORE noise filter destroys the signal
 			magnitudes_raw[i] = collect_and_filter_noise(magnitudes_raw[i], i);
 
@@ -484,23 +658,19 @@ void calculate_magnitudes() {
 
 			// Store averaged value
 			magnitudes_smooth[i] = magnitudes_avg_result;
-		}
 
-		// EMOTISCOPE VERBATIM: Find max magnitude for auto-ranging
-		float max_val = 0.0f;
-		for (uint16_t i = 0; i < NUM_FREQS; i++) {
-			if (magnitudes_smooth[i] > max_val) {
-				max_val = magnitudes_smooth[i];
-			}
-		}
+			// Preserve raw magnitudes for AUDIO_SPECTRUM_ABSOLUTE consumers
+			spectrogram_absolute[i] = magnitudes_avg_result;
 
-		// Preserve raw magnitudes for AUDIO_SPECTRUM_ABSOLUTE consumers
-		for (uint16_t i = 0; i < NUM_FREQS; i++) {
-			spectrogram_absolute[i] = magnitudes_smooth[i];
+			// EMOTISCOPE VERBATIM: Find max magnitude for auto-ranging
+			// (folded into the averaging pass instead of a second scan)
+			if (magnitudes_avg_result > max_val) {
+				max_val = magnitudes_avg_result;
+			}
 		}
 
 		// EMOTISCOPE VERBATIM: Auto-ranger (IIR smoothed peak normalization)
-		static float max_val_smooth = 0.1f;
+		float& max_val_smooth = autoranger_ceiling;
 
 		// Smooth max_val increases
 		if (max_val > max_val_smooth) {
@@ -542,13 +712,8 @@ void calculate_magnitudes() {
 		}
 
 		// Build spectrogram_smooth[] from PREVIOUS AGC-processed frames
-		for(uint16_t i = 0; i < NUM_FREQS; i++){
-			spectrogram_smooth[i] = 0;
-			for(uint16_t a = 0; a < NUM_SPECTROGRAM_AVERAGE_SAMPLES; a++){
-				spectrogram_smooth[i] += spectrogram_average[a][i];
-			}
-			spectrogram_smooth[i] /= float(NUM_SPECTROGRAM_AVERAGE_SAMPLES);
-		}
+		// (running sums: O(NUM_FREQS) instead of re-adding all 12 frames)
+		running_sum_means(&spectrogram_window, spectrogram_smooth);
 
 			// TRACE POINT 3: Averaging output (COMMENTED - re-enable for debugging)
 			// if (++trace_counter_avg % 100 == 0) {
@@ -571,13 +736,8 @@ void calculate_magnitudes() {
 
 		// SAVE AGC-PROCESSED VALUES TO AVERAGING BUFFER (for next frame's spectrogram_smooth)
 		// CRITICAL: This must happen AFTER AGC processing, not before
-		spectrogram_average_index++;
-		if(spectrogram_average_index >= NUM_SPECTROGRAM_AVERAGE_SAMPLES){
-			spectrogram_average_index = 0;
-		}
-		for(uint16_t i = 0; i < NUM_FREQS; i++){
-			spectrogram_average[spectrogram_average_index][i] = spectrogram[i];
-		}
+		running_sum_push(&spectrogram_window, spectrogram);
+		spectrogram_average_index = (uint8_t)spectrogram_window.head;
 
 		// CALCULATE VU FROM AGC-PROCESSED SPECTRUM (CRITICAL: Must be AFTER AGC)
 		// VU must reflect the actual boosted signal that beat detection sees
@@ -631,6 +791,10 @@ void calculate_magnitudes() {
 			audio_back.payload.vu_level = vu_level_calculated;
 			audio_back.payload.vu_level_raw = vu_level_calculated;  // Same as vu_level (no auto-ranging)
 
+#if CONSTANT_Q_FFT_ENABLED
+			memcpy(audio_back.payload.fft_smooth, fft_smooth, sizeof(fft_smooth));
+#endif
+
 			// PHASE 2: Tempo data sync for beat/tempo reactive patterns
 			// tempo.h will populate these arrays after calculating tempi[] and tempi_smooth[]
 			// CRITICAL FIX: Sync calculated tempo data to audio snapshot
@@ -639,6 +803,8 @@ void calculate_magnitudes() {
 				audio_back.payload.tempo_magnitude[i] = tempi_smooth[i];  // Smoothed tempo energy
 				audio_back.payload.tempo_phase[i] = tempi[i].phase;        // Beat phase for synchronization
 			}
+			audio_back.payload.percussive_energy = percussive_energy;
+			audio_back.payload.harmonic_energy = harmonic_energy;
 
 			// Update metadata
 			audio_back.payload.update_counter++;
@@ -708,10 +874,160 @@ void finish_audio_frame() {
 		return;
 	}
 
+	// Band features once per frame, so patterns read fields instead of re-summing bins
+	audio_features_compute(&audio_feature_state, audio_back.payload.spectrogram,
+	                       audio_back.payload.spectrogram_absolute, audio_back.payload.chromagram,
+	                       &audio_back.payload.features);
+
+	// Beat hypotheses as update_tempi_phase() left them (cleared on silence)
+	const BeatTracker* tracker = get_beat_tracker();
+	for (uint8_t k = 0; k < BEAT_TRACKER_HYPOTHESES; k++) {
+		const BeatHypothesis* hypothesis = &tracker->hypotheses[k];
+		audio_back.payload.beat_bpm[k] = hypothesis->active ? hypothesis->tempo_hz * 60.0f : 0.0f;
+		audio_back.payload.beat_phase[k] = hypothesis->active ? hypothesis->phase : 0.0f;
+		audio_back.payload.beat_confidence[k] = hypothesis->active ? hypothesis->confidence : 0.0f;
+	}
+
+	// One history row per frame, stamped into the payload so readers can
+	// index history relative to the spectrum they are drawing
+	audio_back.payload.history_frame =
+		spectrogram_history_push(&spectrogram_history, audio_back.payload.spectrogram_smooth) - 1;
+
 	// Commit the back buffer to the front buffer (atomic swap)
 	commit_audio_data();
 }
 
+// ============================================================================
+// WARM START (audio_warm_start.h)
+// ============================================================================
+// One record in NVS, restored by load_audio_warm_start() at boot. Saves are
+// requested from any task (save_config(), save_noise_spectrum()) and written
+// by service_audio_warm_start() on the audio task once the input is silent,
+// which also refreshes the record when music stops. Flash writes stall the
+// cache on both cores (LED hitches, dropped I2S chunks), so none land mid-song.
+
+#define AUDIO_WARM_START_NVS_NAMESPACE "audio"
+#define AUDIO_WARM_START_NVS_KEY "warm_start"
+
+static_assert(NUM_FREQS == AUDIO_WARM_START_NOISE_BINS, "warm start noise profile must match NUM_FREQS");
+static_assert(NUM_TEMPI == AUDIO_WARM_START_TEMPO_BINS, "warm start tempo prior must match NUM_TEMPI");
+
+static size_t nvs_warm_start_read(void* context, uint8_t* buffer, size_t capacity) {
+	Preferences prefs;
+	if (!prefs.begin(AUDIO_WARM_START_NVS_NAMESPACE, true)) {
+		return 0;
+	}
+	const size_t length = prefs.getBytesLength(AUDIO_WARM_START_NVS_KEY);
+	if (length > 0 && length <= capacity) {
+		prefs.getBytes(AUDIO_WARM_START_NVS_KEY, buffer, capacity);
+	}
+	prefs.end();
+	return length;
+}
+
+static bool nvs_warm_start_write(void* context, const uint8_t* data, size_t length) {
+	Preferences prefs;
+	if (!prefs.begin(AUDIO_WARM_START_NVS_NAMESPACE, false)) {
+		return false;
+	}
+	const size_t written = prefs.putBytes(AUDIO_WARM_START_NVS_KEY, data, length);
+	prefs.end();
+	return written == length;
+}
+
+static const AudioWarmStartStore nvs_warm_start_store = {nullptr, nvs_warm_start_read, nvs_warm_start_write};
+static const AudioWarmStartStore* warm_start_store = &nvs_warm_start_store;
+static std::atomic<bool> warm_start_save_requested{false};
+static bool noise_profile_calibrated = false;
+static uint32_t warm_start_last_save_ms = 0;
+static bool warm_start_dirty = false;  // Music has played since the last save
+
+void set_audio_warm_start_store(const AudioWarmStartStore* store) {
+	warm_start_store = (store != nullptr) ? store : &nvs_warm_start_store;
+}
+
+void save_config() {
+	warm_start_save_requested.store(true, std::memory_order_release);
+}
+
+void save_noise_spectrum() {
+	noise_profile_calibrated = true;
+	warm_start_save_requested.store(true, std::memory_order_release);
+}
+
+bool load_audio_warm_start() {
+	static AudioWarmStart record;
+	const AudioWarmStartStatus status = audio_warm_start_load(warm_start_store, &record);
+	if (status != AUDIO_WARM_START_OK) {
+		if (status == AUDIO_WARM_START_EMPTY) {
+			LOG_INFO(TAG_AUDIO, "Warm start: nothing stored, starting cold");
+		}
+		else {
+			LOG_WARN(TAG_AUDIO, "Warm start rejected (%s), starting cold", audio_warm_start_status_name(status));
+		}
+		return false;
+	}
+
+	if (record.flags & AUDIO_WARM_START_FLAG_NOISE_PROFILE) {
+		memcpy(noise_spectrum, record.noise_spectrum, sizeof(float) * NUM_FREQS);
+		noise_profile_calibrated = true;
+	}
+	configuration.microphone_gain = record.microphone_gain;
+	configuration.vu_floor_pct = record.vu_floor_pct;
+	autoranger_ceiling = fmaxf(record.autoranger_ceiling, 0.0025f);
+	set_novelty_ceiling(record.novelty_ceiling);
+
+	float prior[NUM_TEMPI];
+	const bool has_prior = audio_warm_start_unpack_tempo(&record, prior, NUM_TEMPI);
+	if (has_prior) {
+		set_tempo_prior(prior);
+	}
+
+	LOG_INFO(TAG_AUDIO, "Warm start restored (noise profile %s, tempo prior %s)",
+	         noise_profile_calibrated ? "yes" : "no", has_prior ? "yes" : "no");
+	return true;
+}
+
+void service_audio_warm_start(uint32_t now_ms) {
+	if (warm_start_last_save_ms == 0) {
+		warm_start_last_save_ms = now_ms;
+	}
+
+	// Requests stay pending until the music stops
+	if (!silence_detected) {
+		warm_start_dirty = true;
+		return;
+	}
+	// A half-built noise profile is never worth keeping
+	if (noise_calibration_active_frames_remaining > 0) {
+		return;
+	}
+	bool due = warm_start_save_requested.exchange(false, std::memory_order_acq_rel);
+	if (!due && warm_start_dirty && now_ms - warm_start_last_save_ms >= AUDIO_WARM_START_MIN_SAVE_INTERVAL_MS) {
+		due = true;
+	}
+	if (!due) {
+		return;
+	}
+	warm_start_last_save_ms = now_ms;
+	warm_start_dirty = false;
+
+	static AudioWarmStart record;
+	memset(&record, 0, sizeof(record));
+	memcpy(record.noise_spectrum, noise_spectrum, sizeof(float) * NUM_FREQS);
+	record.microphone_gain = configuration.microphone_gain;
+	record.vu_floor_pct = configuration.vu_floor_pct;
+	record.autoranger_ceiling = autoranger_ceiling;
+	record.novelty_ceiling = get_novelty_ceiling();
+	audio_warm_start_pack_tempo(&record, tempi_smooth, NUM_TEMPI);
+	record.flags = noise_profile_calibrated ? AUDIO_WARM_START_FLAG_NOISE_PROFILE : 0;
+
+	const AudioWarmStartStatus status = audio_warm_start_save(warm_start_store, &record);
+	if (status != AUDIO_WARM_START_OK) {
+		LOG_WARN(TAG_AUDIO, "Warm start save failed (%s)", audio_warm_start_status_name(status));
+	}
+}
+
 // Emotiscope-specific debug output (no-op stub for K1)
 void broadcast(const char* msg) {
 	// Serial output for K1 (Emotiscope specific logging - disabled for K1)
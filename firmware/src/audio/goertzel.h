@@ -26,6 +26,13 @@
 #include <cmath>
 #include <atomic>
 #include "validation/tempo_validation.h"
+#include "sample_ring.h"
+#include "frame_triple_buffer.h"
+#include "analysis_profile.h"
+#include "audio_warm_start.h"
+#include "spectrogram_history.h"
+#include "audio_features.h"
+#include "beat_tracker.h"
 
 // Profiling macro - simplified for now (just execute lambda)
 #define profile_function(lambda, name) lambda()
@@ -37,7 +44,7 @@
 
 // Audio sample buffer
 #include "audio_config.h"
-#define SAMPLE_HISTORY_LENGTH 4096
+#define SAMPLE_HISTORY_LENGTH 4096  // Must stay a power of two (ring buffer mask)
 
 #define TWOPI   6.28318530
 #define FOURPI 12.56637061
@@ -45,6 +52,11 @@
 
 #define NOISE_CALIBRATION_FRAMES 512
 
+// Minimum spacing of the warm-start refreshes taken when music stops (NVS wear)
+#ifndef AUDIO_WARM_START_MIN_SAVE_INTERVAL_MS
+#define AUDIO_WARM_START_MIN_SAVE_INTERVAL_MS (10u * 60u * 1000u)
+#endif
+
 // Frequency analysis configuration
 #define NUM_FREQS 64
 
@@ -57,6 +69,60 @@
 // Goertzel processing
 #define MAX_AUDIO_RECORDING_SAMPLES 1024
 
+// Constant-Q FFT engine (constant_q.h): one real FFT per frame with sparse
+// spectral kernels replaces the Goertzel bank for the note bins, and the same
+// transform fills fft_smooth[]. ~60 KB of static RAM; compare engines per
+// deployment with tools/spectrum_engine_bench.cpp.
+#ifndef CONSTANT_Q_FFT_ENABLED
+#define CONSTANT_Q_FFT_ENABLED 0
+#endif
+
+// Octave pyramid (octave_pyramid.h): the block engine runs each bin on the
+// coarsest half-band decimated copy of the history that still covers it, so
+// the low octaves' long blocks shrink by 2-32x. ~18 KB of static RAM.
+#ifndef GOERTZEL_OCTAVE_PYRAMID_ENABLED
+#define GOERTZEL_OCTAVE_PYRAMID_ENABLED 0
+#endif
+#if GOERTZEL_OCTAVE_PYRAMID_ENABLED && CONSTANT_Q_FFT_ENABLED
+#error "GOERTZEL_OCTAVE_PYRAMID_ENABLED and CONSTANT_Q_FFT_ENABLED are alternative engines; enable one"
+#endif
+
+// Sliding (recursive) Goertzel: bins are advanced per sample as chunks arrive
+// instead of re-running every block each frame. Set to 0 for the block engine.
+#ifndef GOERTZEL_SLIDING_ENABLED
+#define GOERTZEL_SLIDING_ENABLED (!CONSTANT_Q_FFT_ENABLED && !GOERTZEL_OCTAVE_PYRAMID_ENABLED)
+#endif
+#if CONSTANT_Q_FFT_ENABLED && GOERTZEL_SLIDING_ENABLED
+#error "CONSTANT_Q_FFT_ENABLED replaces the sliding engine; leave GOERTZEL_SLIDING_ENABLED unset or 0"
+#endif
+#if GOERTZEL_OCTAVE_PYRAMID_ENABLED && GOERTZEL_SLIDING_ENABLED
+#error "GOERTZEL_OCTAVE_PYRAMID_ENABLED runs the block engine; leave GOERTZEL_SLIDING_ENABLED unset or 0"
+#endif
+
+// Block engine only: bins advanced per pass over the history (goertzel_block.h).
+// 1 runs one bin at a time; 4 or 8 interleave bins sharing each sample load.
+#ifndef GOERTZEL_BLOCK_LANES
+#define GOERTZEL_BLOCK_LANES 4
+#endif
+#if GOERTZEL_BLOCK_LANES != 1 && GOERTZEL_BLOCK_LANES != 4 && GOERTZEL_BLOCK_LANES != 8
+#error "GOERTZEL_BLOCK_LANES must be 1, 4 or 8"
+#endif
+
+// CPU clock used to turn the measured analysis cycles (CCOUNT) into
+// microseconds for GET /api/audio/profile
+#ifdef CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+#define ANALYSIS_CPU_MHZ CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+#else
+#define ANALYSIS_CPU_MHZ 240
+#endif
+
+// Triple-buffered frame handoff to the render task: commit_audio_data() also
+// publishes each frame into one of three slots, and the GPU loop borrows a
+// read-only pointer to the newest slot instead of copying out of the seqlock.
+#ifndef AUDIO_TRIPLE_BUFFER_ENABLED
+#define AUDIO_TRIPLE_BUFFER_ENABLED 1
+#endif
+
 // ============================================================================
 // TYPE DEFINITIONS
 // ============================================================================
@@ -84,7 +150,6 @@ typedef struct {
 	float phase_target;                     // Target phase for synchronization
 	bool  phase_inverted;                   // Phase inversion flag
 	float phase_radians_per_reference_frame;// Phase advance per reference frame
-	float beat;                             // Beat trigger (-1.0 to 1.0, sin(phase))
 	float magnitude;                        // Current beat magnitude (normalized 0.0-1.0)
 	float magnitude_full_scale;             // Full-scale magnitude before auto-ranging
 	float magnitude_smooth;                 // Smoothed magnitude (tempo_smooth)
@@ -108,17 +173,28 @@ typedef struct {
 
 	// Tempo/beat detection
 	float novelty_curve;                    // Spectral flux (onset detection)
+	float percussive_energy;                // Percussive part of the spectrum (0.0-1.0, hpss.h)
+	float harmonic_energy;                  // Harmonic part of the spectrum (0.0-1.0)
 	float tempo_confidence;                 // Beat detection confidence (0.0-1.0)
 	float tempo_magnitude[NUM_TEMPI];       // Tempo bin magnitudes (96 bins)
 	float tempo_phase[NUM_TEMPI];           // Tempo bin phases (96 bins)
 	float locked_tempo_bpm;                 // BPM when tempo is locked and stable
 	TempoLockState tempo_lock_state;        // Current state of the tempo lock tracker
 
-	// FFT data (reserved for future full-spectrum analysis)
-	// Currently using Goertzel for musical note detection (more efficient)
-	float fft_smooth[128];                  // Smoothed FFT bins (placeholder)
+	// Strongest tempo hypotheses, most confident first (beat_tracker.h); zero when inactive
+	float beat_bpm[BEAT_TRACKER_HYPOTHESES];        // Loop tempo (BPM)
+	float beat_phase[BEAT_TRACKER_HYPOTHESES];      // Radians, sin() peaks on the beat
+	float beat_confidence[BEAT_TRACKER_HYPOTHESES]; // Lock * salience (0.0-1.0)
+
+	// Linear spectrum: 128 bands of 0 .. fs/2, auto-ranged and smoothed (0.0-1.0).
+	// Filled by the constant-Q FFT engine (CONSTANT_Q_FFT_ENABLED), zero otherwise
+	float fft_smooth[128];
+
+	// Band energies and spectral descriptors of this frame (audio_features.h)
+	AudioFeatures features;
 
 	// Metadata
+	uint32_t history_frame;                 // spectrogram_history frame holding spectrogram_smooth
 	uint32_t update_counter;                // Increments with each audio frame
 	uint32_t timestamp_us;                  // Microsecond timestamp (esp_timer)
 	bool is_valid;                          // True if data has been written at least once
@@ -163,12 +239,12 @@ extern float audio_level;                        // Overall RMS level (0.0-1.0)
 extern tempo tempi[NUM_TEMPI];                   // Tempo bin detectors
 extern float tempi_smooth[NUM_TEMPI];            // Smoothed tempo bins
 
-// Sample history buffer
-extern float sample_history[SAMPLE_HISTORY_LENGTH];
+// Sample history ring buffer (newest sample at age 0, see sample_ring.h)
+extern SampleRing sample_history;
 
 // Goertzel state
 extern freq frequencies_musical[NUM_FREQS];
-extern float window_lookup[4096];
+extern const float window_lookup[4096];            // Gaussian block window (flash, goertzel_lut.h)
 extern uint16_t max_goertzel_block_size;
 extern std::atomic<bool> magnitudes_locked;
 
@@ -193,6 +269,10 @@ extern int16_t audio_debug_recording[MAX_AUDIO_RECORDING_SAMPLES];
 extern float spectrogram_average[NUM_SPECTROGRAM_AVERAGE_SAMPLES][NUM_FREQS];
 extern uint8_t spectrogram_average_index;
 
+// 8-bit ring of recent spectrogram_smooth frames for patterns (spectrogram_history.h).
+// Written by finish_audio_frame(); readable from any task without locks.
+extern SpectrogramHistory spectrogram_history;
+
 // Tempo history ring buffer - REMOVED for memory optimization
 // #define NUM_TEMPO_HISTORY_FRAMES 64
 // extern float tempo_history[NUM_TEMPO_HISTORY_FRAMES][NUM_TEMPI];
@@ -215,9 +295,6 @@ void init_audio_stubs();
 // Initialize Goertzel DFT constants for musical note detection
 void init_goertzel_constants_musical();
 
-// Initialize window function lookup table for Goertzel smoothing
-void init_window_lookup();
-
 // Initialize audio data synchronization (double-buffering)
 void init_audio_data_sync();
 
@@ -229,6 +306,10 @@ void init_audio_data_sync();
 // Blocks on portMAX_DELAY until next chunk is ready (synchronization via I2S DMA)
 void acquire_sample_chunk();
 
+// Feed a new chunk to the sliding Goertzel engine (no-op for the block engine)
+// MUST be called before new_samples are written to sample_history
+void goertzel_ingest_samples(const float* new_samples, uint16_t count);
+
 // Calculate frequency magnitudes using Goertzel algorithm
 void calculate_magnitudes();
 
@@ -241,6 +322,32 @@ void finish_audio_frame();
 // Start noise floor calibration
 void start_noise_calibration();
 
+// Select an analysis profile (ANALYSIS_PROFILES[] index, analysis_profile.h).
+// Safe from any task: the audio task rebuilds its bins at its next frame.
+// Returns false if index is out of range.
+bool set_analysis_profile(uint8_t index);
+
+// Selected analysis profile (ANALYSIS_PROFILES[] index)
+uint8_t get_analysis_profile();
+
+// Measured analysis cost of a profile (zero frames if it has not run yet)
+AnalysisProfileStats get_analysis_profile_stats(uint8_t index);
+
+// Restore the persisted noise profile, audio configuration, auto-ranger and
+// novelty ceilings and tempo prior (audio_warm_start.h). Call once at boot
+// after init_tempo_goertzel_constants(). Returns false (keeping the defaults)
+// if nothing valid is stored.
+bool load_audio_warm_start();
+
+// Audio task, once per frame: while the input is silent, write the record if a
+// save was requested or music has played since the last one (at most once per
+// AUDIO_WARM_START_MIN_SAVE_INTERVAL_MS). Never writes during music: a flash
+// write stalls the cache on both cores, so requests wait for the next silence.
+void service_audio_warm_start(uint32_t now_ms);
+
+// Replace the NVS backing store (host tests); nullptr restores NVS
+void set_audio_warm_start_store(const AudioWarmStartStore* store);
+
 // ============================================================================
 // PUBLIC API - AUDIO DATA ACCESS (thread-safe, called from pattern rendering)
 // ============================================================================
@@ -252,6 +359,14 @@ bool get_audio_snapshot(AudioDataSnapshot* snapshot);
 // Used by test suites to validate lock-free synchronization
 void commit_audio_data();
 
+// Borrow the newest completed audio frame without copying (render task ONLY).
+// The pointer stays valid and unchanged until the next acquire_audio_frame()
+// call, so acquire once per render frame and pass it down. Never NULL.
+const AudioDataSnapshot* acquire_audio_frame();
+
+// Frame returned by the last acquire_audio_frame() (no swap; render task ONLY)
+const AudioDataSnapshot* current_audio_frame();
+
 // ============================================================================
 // UTILITY FUNCTIONS
 // ============================================================================
@@ -267,8 +382,9 @@ inline float clip_float(float val) {
 // Inline stubs for Emotiscope-specific functions (no-op in K1)
 // Note: broadcast is not inlined here to avoid Serial dependency
 void broadcast(const char* msg);  // Defined in goertzel.cpp
-inline void save_config() {}
-inline void save_noise_spectrum() {}
+// Request a warm-start save (any task; written by service_audio_warm_start())
+void save_config();
+void save_noise_spectrum();  // Also marks noise_spectrum[] as a finished calibration
 inline void save_audio_debug_recording() {}
 
 // ESP-DSP stubs removed - use proper wrappers from dsps_helpers.h instead
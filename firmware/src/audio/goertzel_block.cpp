@@ -0,0 +1,163 @@
+// Goertzel Block Kernel Implementation
+// One-bin reference and the lane-interleaved sweep (see goertzel_block.h)
+
+#include "goertzel_block.h"
+#include <cmath>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+// Resonator state of one bin part-way through its block
+typedef struct {
+	float q1;
+	float q2;
+	float window_pos;
+	float coeff;
+	float window_step;
+} GoertzelLane;
+
+static inline GoertzelLane lane_start(const GoertzelBlockBin* bin) {
+	return {0.0f, 0.0f, 0.0f, bin->coeff, bin->window_step};
+}
+
+static inline float lane_magnitude(const GoertzelLane& lane, uint16_t block_size) {
+	float magnitude_squared = (lane.q1 * lane.q1) + (lane.q2 * lane.q2) - lane.q1 * lane.q2 * lane.coeff;
+	float magnitude = sqrt(magnitude_squared);
+	return magnitude / (block_size / 2.0);
+}
+
+// Feed count contiguous samples to one lane
+static void lane_advance(GoertzelLane* lane, const float* x, uint32_t count, const float* window) {
+	float q1 = lane->q1;
+	float q2 = lane->q2;
+	float window_pos = lane->window_pos;
+	const float coeff = lane->coeff;
+	const float window_step = lane->window_step;
+	for (uint32_t i = 0; i < count; i++) {
+		float windowed_sample = x[i] * window[uint32_t(window_pos)];
+		float q0 = coeff * q1 - q2 + windowed_sample;
+		q2 = q1;
+		q1 = q0;
+		window_pos += window_step;
+	}
+	lane->q1 = q1;
+	lane->q2 = q2;
+	lane->window_pos = window_pos;
+}
+
+// Feed the same count contiguous samples to L lanes; state lives in locals so
+// the L recurrences stay in registers and overlap
+template <int L>
+static void lanes_advance(GoertzelLane* lanes, const float* x, uint32_t count, const float* window) {
+	float q1[L], q2[L], window_pos[L], coeff[L], window_step[L];
+	for (int j = 0; j < L; j++) {
+		q1[j] = lanes[j].q1;
+		q2[j] = lanes[j].q2;
+		window_pos[j] = lanes[j].window_pos;
+		coeff[j] = lanes[j].coeff;
+		window_step[j] = lanes[j].window_step;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		const float sample = x[i];
+		for (int j = 0; j < L; j++) {
+			float windowed_sample = sample * window[uint32_t(window_pos[j])];
+			float q0 = coeff[j] * q1[j] - q2[j] + windowed_sample;
+			q2[j] = q1[j];
+			q1[j] = q0;
+			window_pos[j] += window_step[j];
+		}
+	}
+	for (int j = 0; j < L; j++) {
+		lanes[j].q1 = q1[j];
+		lanes[j].q2 = q2[j];
+		lanes[j].window_pos = window_pos[j];
+	}
+}
+
+// Elements [from, to) of a span as at most two contiguous runs
+static uint8_t span_slice(const SampleSpan& span, uint32_t from, uint32_t to,
+                          const float* runs[2], uint32_t lengths[2]) {
+	uint8_t n = 0;
+	if (from < span.first_length) {
+		const uint32_t end = to < span.first_length ? to : span.first_length;
+		runs[n] = span.first + from;
+		lengths[n++] = end - from;
+	}
+	if (to > span.first_length) {
+		const uint32_t start = from > span.first_length ? from - span.first_length : 0;
+		runs[n] = span.second + start;
+		lengths[n++] = to - span.first_length - start;
+	}
+	return n;
+}
+
+// One group of L bins sharing a pass over the longest block
+template <int L>
+static void group_magnitudes(const SampleRing* history, uint32_t age, const float* window,
+                             const GoertzelBlockBin* bins, float* magnitudes) {
+	uint32_t longest = 0;
+	for (int j = 0; j < L; j++) {
+		longest = bins[j].block_size > longest ? bins[j].block_size : longest;
+	}
+	// Lane j's block starts at longest - N_j; all lanes run from the latest start
+	uint32_t shared_start = 0;
+	for (int j = 0; j < L; j++) {
+		const uint32_t start = longest - bins[j].block_size;
+		shared_start = start > shared_start ? start : shared_start;
+	}
+
+	const SampleSpan span = sample_ring_window(history, longest, age);
+	const float* runs[2];
+	uint32_t lengths[2];
+	GoertzelLane lanes[L];
+	for (int j = 0; j < L; j++) {
+		lanes[j] = lane_start(&bins[j]);
+		const uint8_t n = span_slice(span, longest - bins[j].block_size, shared_start, runs, lengths);
+		for (uint8_t r = 0; r < n; r++) {
+			lane_advance(&lanes[j], runs[r], lengths[r], window);
+		}
+	}
+
+	const uint8_t n = span_slice(span, shared_start, longest, runs, lengths);
+	for (uint8_t r = 0; r < n; r++) {
+		lanes_advance<L>(lanes, runs[r], lengths[r], window);
+	}
+
+	for (int j = 0; j < L; j++) {
+		magnitudes[j] = lane_magnitude(lanes[j], bins[j].block_size);
+	}
+}
+
+// ============================================================================
+// API
+// ============================================================================
+
+float goertzel_block_magnitude(const SampleRing* history, uint32_t age, const float* window,
+                               const GoertzelBlockBin* bin) {
+	GoertzelLane lane = lane_start(bin);
+	// The ring hands back at most two contiguous runs, no copy
+	const SampleSpan span = sample_ring_window(history, bin->block_size, age);
+	lane_advance(&lane, span.first, span.first_length, window);
+	lane_advance(&lane, span.second, span.second_length, window);
+	return lane_magnitude(lane, bin->block_size);
+}
+
+void goertzel_block_magnitudes(const SampleRing* history, uint32_t age, const float* window,
+                               const GoertzelBlockBin* bins, uint16_t count, uint16_t lanes,
+                               float* magnitudes) {
+	uint16_t i = 0;
+	if (lanes == 8) {
+		for (; i + 8 <= count; i += 8) {
+			group_magnitudes<8>(history, age, window, bins + i, magnitudes + i);
+		}
+	}
+	if (lanes >= 4) {
+		for (; i + 4 <= count; i += 4) {
+			group_magnitudes<4>(history, age, window, bins + i, magnitudes + i);
+		}
+	}
+	for (; i < count; i++) {
+		magnitudes[i] = goertzel_block_magnitude(history, age, window, &bins[i]);
+	}
+}
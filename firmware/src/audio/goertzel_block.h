@@ -0,0 +1,59 @@
+// Goertzel Block Kernel - Windowed block Goertzel over the sample ring
+// https://en.wikipedia.org/wiki/Goertzel_algorithm
+//
+// The block engine (GOERTZEL_SLIDING_ENABLED 0) re-runs every bin over its
+// last block_size samples each frame. One bin at a time, each pass reloads the
+// whole history and the resonator recurrence q0 = c * q1 - q2 + x * w is a
+// serial chain of dependent float ops, so the FPU mostly waits on latency.
+//
+// goertzel_block_magnitudes() advances `lanes` bins (4 or 8) per pass instead:
+// every sample is loaded once per group and feeds independent recurrences held
+// in registers, which the FPU overlaps. Bins in a group have different block
+// sizes but all blocks end at the same sample, so each lane first runs its own
+// (short) prefix alone, then the group shares the common tail. Each lane keeps
+// its own float window position, so the window gather and arithmetic are the
+// same as the one-bin kernel, operation for operation.
+//
+// Magnitudes are |X| / (N / 2), before the spectrogram's frequency scaling.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef GOERTZEL_BLOCK_H
+#define GOERTZEL_BLOCK_H
+
+#include <stdint.h>
+#include "sample_ring.h"
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define GOERTZEL_BLOCK_MAX_LANES 8          // Widest interleave
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	uint16_t block_size;      // N (samples)
+	float window_step;        // window_length / N: window index advance per sample
+	float coeff;              // 2 * cos(2 * pi * k / N)
+} GoertzelBlockBin;
+
+// ============================================================================
+// API
+// ============================================================================
+
+// One bin. The block is the block_size samples whose newest has the given age;
+// window is indexed by the float window position (window_length >= 4096 for
+// window_step = 4096 / N).
+float goertzel_block_magnitude(const SampleRing* history, uint32_t age, const float* window,
+                               const GoertzelBlockBin* bin);
+
+// count bins into magnitudes[], lanes (1, 4 or 8) at a time. Results match
+// goertzel_block_magnitude() bin for bin (identical operation order per lane).
+void goertzel_block_magnitudes(const SampleRing* history, uint32_t age, const float* window,
+                               const GoertzelBlockBin* bins, uint16_t count, uint16_t lanes,
+                               float* magnitudes);
+
+#endif  // GOERTZEL_BLOCK_H
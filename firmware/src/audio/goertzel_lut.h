@@ -0,0 +1,647 @@
+// Auto-generated by tools/generate_goertzel_luts.py
+// DO NOT EDIT MANUALLY
+//
+// Flash-resident tables for the Goertzel note analysis: the Gaussian block
+// window, the quarter-step note table and each note bin's constants.
+// Included by goertzel.cpp only (the arrays are defined here).
+
+#ifndef GOERTZEL_LUT_H
+#define GOERTZEL_LUT_H
+
+#include <stdint.h>
+
+// Configuration the tables were generated for
+#define GOERTZEL_LUT_SAMPLE_RATE_HZ 12800
+#define GOERTZEL_LUT_NUM_FREQS 64
+#define GOERTZEL_LUT_BOTTOM_NOTE 12
+#define GOERTZEL_LUT_NOTE_STEP 2
+#define GOERTZEL_LUT_WINDOW_LENGTH 4096
+
+// Note bin constants (init_goertzel())
+struct GoertzelBinConstants {
+    float target_freq;                   // Note frequency (Hz)
+    uint16_t block_size;                 // Samples per block (multiple of 4)
+    float window_step;                   // window_lookup[] increment per sample
+    float k;                             // DFT index of the note in the block
+    float coeff;                         // 2*cos(2*pi*k / block_size)
+};
+
+// 64 half-step bins from notes[12]
+const GoertzelBinConstants GOERTZEL_BIN_LUT[64] = {
+    {  77.7817535f, 1380,    2.96811604f,    8.0f,     1.99867344f },  // Bin  0
+    {  82.4068909f, 1304,    3.14110422f,    8.0f,     1.99851429f },  // Bin  1
+    {  87.3070602f, 1232,    3.32467532f,    8.0f,      1.9983356f },  // Bin  2
+    {  92.4986115f, 1160,    3.53103447f,    8.0f,     1.99812257f },  // Bin  3
+    {  97.9988632f, 1096,    3.73722625f,    8.0f,     1.99789703f },  // Bin  4
+    {  103.826202f, 1036,    3.95366788f,    8.0f,     1.99764633f },  // Bin  5
+    {       110.0f,  976,    4.19672108f,    8.0f,     1.99734819f },  // Bin  6
+    {  116.540901f,  920,    4.45217371f,    8.0f,      1.9970156f },  // Bin  7
+    {  123.470802f,  868,      4.718894f,    8.0f,     1.99664748f },  // Bin  8
+    {  130.812805f,  820,    4.99512196f,    8.0f,      1.9962436f },  // Bin  9
+    {  138.591293f,  776,    5.27835035f,    8.0f,     1.99580562f },  // Bin 10
+    {  146.832397f,  732,    5.59562826f,    8.0f,     1.99528646f },  // Bin 11
+    {  155.563507f,  688,    5.95348835f,    8.0f,     1.99466455f },  // Bin 12
+    {  164.813797f,  652,    6.28220844f,    8.0f,     1.99405944f },  // Bin 13
+    {  174.614105f,  616,    6.64935064f,    8.0f,     1.99334514f },  // Bin 14
+    {  184.997192f,  580,    7.06206894f,    8.0f,     1.99249399f },  // Bin 15
+    {  195.997696f,  548,     7.4744525f,    8.0f,     1.99159241f },  // Bin 16
+    {  207.652298f,  516,    7.93798447f,    8.0f,     1.99051809f },  // Bin 17
+    {       220.0f,  488,    8.39344215f,    8.0f,     1.98939979f },  // Bin 18
+    {  233.081894f,  460,    8.90434742f,    8.0f,     1.98807132f },  // Bin 19
+    {  246.941696f,  432,    9.48148155f,    8.0f,     1.98647666f },  // Bin 20
+    {   261.62561f,  408,     10.039216f,    8.0f,     1.98484099f },  // Bin 21
+    {  277.182587f,  388,    10.5567007f,    8.0f,     1.98324025f },  // Bin 22
+    {  293.664795f,  364,    11.2527475f,    8.0f,     1.98096085f },  // Bin 23
+    {  311.127014f,  344,    11.9069767f,    8.0f,     1.97868669f },  // Bin 24
+    {  329.627594f,  324,    12.6419754f,    8.0f,     1.97597969f },  // Bin 25
+    {   349.22821f,  308,    13.2987013f,    8.0f,     1.97342491f },  // Bin 26
+    {  369.994385f,  288,    14.2222223f,    8.0f,     1.96961546f },  // Bin 27
+    {  391.995392f,  272,    15.0588236f,    8.0f,      1.9659462f },  // Bin 28
+    {  415.304688f,  256,          16.0f,    8.0f,      1.9615705f },  // Bin 29
+    {       440.0f,  244,    16.7868843f,    8.0f,     1.95771134f },  // Bin 30
+    {  466.163788f,  228,    17.9649124f,    8.0f,      1.9515928f },  // Bin 31
+    {  493.883301f,  216,    18.9629631f,    8.0f,     1.94608974f },  // Bin 32
+    {  523.251099f,  204,    20.0784321f,    8.0f,     1.93959391f },  // Bin 33
+    {  554.365295f,  192,     21.333334f,    8.0f,     1.93185163f },  // Bin 34
+    {  587.329529f,  180,    22.7555561f,    8.0f,     1.92252338f },  // Bin 35
+    {  622.254028f,  172,    23.8139534f,    8.0f,     1.91520119f },  // Bin 36
+    {  659.255127f,  160,    25.6000004f,    8.0f,     1.90211308f },  // Bin 37
+    {  698.456482f,  152,    26.9473686f,    8.0f,     1.89163446f },  // Bin 38
+    {   739.98877f,  144,    28.4444447f,    8.0f,     1.87938523f },  // Bin 39
+    {  783.990906f,  136,    30.1176472f,    8.0f,     1.86494446f },  // Bin 40
+    {  830.609375f,  128,          32.0f,    8.0f,     1.84775901f },  // Bin 41
+    {       880.0f,  120,    34.1333351f,    8.0f,     1.82709086f },  // Bin 42
+    {  932.327515f,  112,    36.5714302f,    8.0f,      1.8019377f },  // Bin 43
+    {  987.766602f,  108,    37.9259262f,    8.0f,      1.7872653f },  // Bin 44
+    {  1046.50195f,  100,    40.9599991f,    8.0f,     1.75261331f },  // Bin 45
+    {  1108.73096f,   96,    42.6666679f,    8.0f,     1.73205078f },  // Bin 46
+    {  1174.65906f,   88,    46.5454559f,    8.0f,     1.68250704f },  // Bin 47
+    {  1244.50806f,   84,    48.7619057f,    8.0f,      1.6524775f },  // Bin 48
+    {  1318.51001f,   80,    51.2000008f,    8.0f,     1.61803401f },  // Bin 49
+    {  1396.91296f,   76,    53.8947372f,    8.0f,     1.57828104f },  // Bin 50
+    {  1479.97803f,   72,    56.8888893f,    8.0f,     1.53208888f },  // Bin 51
+    {  1567.98206f,   68,    60.2352943f,    8.0f,     1.47801781f },  // Bin 52
+    {  1661.21899f,   64,          64.0f,    8.0f,     1.41421354f },  // Bin 53
+    {      1760.0f,   60,    68.2666702f,    8.0f,     1.33826113f },  // Bin 54
+    {  1864.65503f,   56,    73.1428604f,    8.0f,     1.24697959f },  // Bin 55
+    {  1975.53296f,   52,    78.7692337f,    8.0f,      1.1361295f },  // Bin 56
+    {  2093.00488f,   48,    85.3333359f,    8.0f,     0.99999994f },  // Bin 57
+    {  2217.46094f,   48,    85.3333359f,    8.0f,     0.99999994f },  // Bin 58
+    {  2349.31812f,   44,    93.0909119f,    8.0f,    0.830830097f },  // Bin 59
+    {  2489.01611f,   40,    102.400002f,    8.0f,    0.618033946f },  // Bin 60
+    {  2637.02002f,   40,    102.400002f,    8.0f,    0.618033946f },  // Bin 61
+    {  2793.82495f,   36,    113.777779f,    8.0f,    0.347296447f },  // Bin 62
+    {  2959.95605f,   36,    113.777779f,    8.0f,    0.347296447f },  // Bin 63
+};
+
+// Quarter-step notes from 55 Hz (238 entries)
+const float notes[238] = {
+    55.0f, 56.6352348f, 58.2704697f, 60.0029411f, 61.7354088f, 63.5709f, 65.4063873f, 67.3510284f,
+    69.2956619f, 71.3559265f, 73.4161911f, 75.5989685f, 77.7817535f, 80.0943222f, 82.4068909f, 84.8569717f,
+    87.3070602f, 89.902832f, 92.4986115f, 95.2487335f, 97.9988632f, 100.912529f, 103.826202f, 106.913101f,
+    110.0f, 113.270447f, 116.540901f, 120.005852f, 123.470802f, 127.1418f, 130.812805f, 134.702057f,
+    138.591293f, 142.711853f, 146.832397f, 151.197952f, 155.563507f, 160.188644f, 164.813797f, 169.713943f,
+    174.614105f, 179.805649f, 184.997192f, 190.497452f, 195.997696f, 201.824997f, 207.652298f, 213.826157f,
+    220.0f, 226.540955f, 233.081894f, 240.011795f, 246.941696f, 254.283646f, 261.62561f, 269.404114f,
+    277.182587f, 285.423706f, 293.664795f, 302.395905f, 311.127014f, 320.377289f, 329.627594f, 339.427887f,
+    349.22821f, 359.611298f, 369.994385f, 380.994904f, 391.995392f, 403.650055f, 415.304688f, 427.652344f,
+    440.0f, 453.081909f, 466.163788f, 480.02356f, 493.883301f, 508.5672f, 523.251099f, 538.808228f,
+    554.365295f, 570.847412f, 587.329529f, 604.791748f, 622.254028f, 640.754578f, 659.255127f, 678.855774f,
+    698.456482f, 719.222656f, 739.98877f, 761.989868f, 783.990906f, 807.300171f, 830.609375f, 855.304688f,
+    880.0f, 906.163757f, 932.327515f, 960.047058f, 987.766602f, 1017.13428f, 1046.50195f, 1077.61646f,
+    1108.73096f, 1141.69495f, 1174.65906f, 1209.5835f, 1244.50806f, 1281.50903f, 1318.51001f, 1357.71155f,
+    1396.91296f, 1438.44556f, 1479.97803f, 1523.97998f, 1567.98206f, 1614.60046f, 1661.21899f, 1710.6095f,
+    1760.0f, 1812.32751f, 1864.65503f, 1920.09399f, 1975.53296f, 2034.26904f, 2093.00488f, 2155.23291f,
+    2217.46094f, 2283.3894f, 2349.31812f, 2419.16699f, 2489.01611f, 2563.01807f, 2637.02002f, 2715.42261f,
+    2793.82495f, 2876.89038f, 2959.95605f, 3047.95996f, 3135.96411f, 3229.20044f, 3322.43701f, 3421.21851f,
+    3520.0f, 3624.65503f, 3729.31006f, 3840.1875f, 3951.06494f, 4068.53711f, 4186.00879f, 4310.46533f,
+    4434.92188f, 4566.77881f, 4698.63623f, 4838.33398f, 4978.03223f, 5126.03662f, 5274.04102f, 5430.84668f,
+    5587.65186f, 5753.78174f, 5919.91113f, 6095.91895f, 6271.92676f, 6458.40088f, 6644.875f, 6842.4375f,
+    7040.0f, 7249.31006f, 7458.62012f, 7680.375f, 7902.12988f, 8137.07422f, 8372.01758f, 8620.93066f,
+    8869.84375f, 9133.55762f, 9397.27246f, 9676.66797f, 9956.06445f, 10252.0723f, 10548.0801f, 10861.6904f,
+    11175.2998f, 11507.5596f, 11839.8203f, 12191.835f, 12543.8496f, 12916.7998f, 13289.75f, 13684.875f,
+    14080.0f, 14498.6201f, 14917.2402f, 15360.75f, 15804.2598f, 16274.1445f, 16744.0293f, 17241.8555f,
+    17739.6797f, 18267.1094f, 18794.5391f, 19353.3594f, 19912.1797f, 20504.1699f, 21096.1602f, 21723.3809f,
+    22350.5996f, 23015.1191f, 23679.6406f, 24383.6699f, 25087.6992f, 25833.5996f, 26579.5f, 27369.75f,
+    28160.0f, 28997.2402f, 29834.4805f, 30721.5f, 31608.5195f, 32548.2949f, 33488.0703f, 34483.7188f,
+    35479.3711f, 36534.2266f, 37589.0781f, 38706.6641f, 39824.25f, 41008.2852f, 42192.3203f, 43446.7617f,
+    44701.1992f, 46030.2383f, 47359.2812f, 48767.3398f, 50175.3984f, 51667.1992f,
+};
+
+// Gaussian block window (sigma 0.8), mirrored about the centre
+const float window_lookup[4096] = {
+    0.45783335f, 0.458532155f, 0.459231317f, 0.459930867f, 0.460630804f, 0.461331129f, 0.462031811f, 0.462732852f,
+    0.463434309f, 0.464136094f, 0.464838266f, 0.465540826f, 0.466243744f, 0.466947019f, 0.467650652f, 0.468354672f,
+    0.46905902f, 0.469763756f, 0.470468819f, 0.47117427f, 0.471880049f, 0.472586215f, 0.473292708f, 0.47399953f,
+    0.474706739f, 0.475414276f, 0.476122171f, 0.476830393f, 0.477538973f, 0.478247881f, 0.478957117f, 0.47966671f,
+    0.480376631f, 0.48108691f, 0.481797487f, 0.482508421f, 0.483219653f, 0.483931243f, 0.484643131f, 0.485355347f,
+    0.486067921f, 0.486780763f, 0.487493962f, 0.488207459f, 0.488921285f, 0.489635438f, 0.490349889f, 0.491064638f,
+    0.491779715f, 0.49249509f, 0.493210763f, 0.493926734f, 0.494643033f, 0.495359629f, 0.496076494f, 0.496793687f,
+    0.497511178f, 0.498228937f, 0.498946995f, 0.49966535f, 0.500383973f, 0.501102924f, 0.501822174f, 0.502541661f,
+    0.503261447f, 0.503981471f, 0.504701853f, 0.505422413f, 0.506143332f, 0.506864488f, 0.507585943f, 0.508307636f,
+    0.509029627f, 0.509751856f, 0.510474324f, 0.51119709f, 0.511920154f, 0.512643397f, 0.513366938f, 0.514090776f,
+    0.514814794f, 0.51553911f, 0.516263664f, 0.516988456f, 0.517713487f, 0.518438756f, 0.519164324f, 0.51989007f,
+    0.520616114f, 0.521342337f, 0.522068799f, 0.522795558f, 0.523522496f, 0.524249673f, 0.524977088f, 0.525704682f,
+    0.526432514f, 0.527160645f, 0.527888894f, 0.528617442f, 0.529346168f, 0.530075133f, 0.530804276f, 0.531533659f,
+    0.532263219f, 0.532993019f, 0.533722997f, 0.534453213f, 0.535183609f, 0.535914183f, 0.536644995f, 0.537375987f,
+    0.538107157f, 0.538838506f, 0.539570093f, 0.540301859f, 0.541033804f, 0.541765928f, 0.542498231f, 0.543230712f,
+    0.543963373f, 0.544696212f, 0.54542923f, 0.546162426f, 0.546895802f, 0.547629297f, 0.54836303f, 0.549096882f,
+    0.549830914f, 0.550565064f, 0.551299393f, 0.552033901f, 0.552768588f, 0.553503394f, 0.554238319f, 0.554973423f,
+    0.555708706f, 0.556444108f, 0.55717963f, 0.55791533f, 0.558651149f, 0.559387088f, 0.560123205f, 0.560859382f,
+    0.561595798f, 0.562332273f, 0.563068867f, 0.56380558f, 0.564542472f, 0.565279424f, 0.566016555f, 0.566753745f,
+    0.567491114f, 0.568228543f, 0.568966091f, 0.569703758f, 0.570441544f, 0.57117939f, 0.571917355f, 0.572655439f,
+    0.573393643f, 0.574131906f, 0.574870229f, 0.57560873f, 0.576347232f, 0.577085853f, 0.577824593f, 0.578563392f,
+    0.579302311f, 0.58004123f, 0.580780268f, 0.581519425f, 0.582258582f, 0.582997859f, 0.583737195f, 0.58447659f,
+    0.585216045f, 0.58595556f, 0.586695135f, 0.587434769f, 0.588174462f, 0.588914216f, 0.589654028f, 0.590393841f,
+    0.591133773f, 0.591873705f, 0.592613697f, 0.593353689f, 0.5940938f, 0.594833851f, 0.595574021f, 0.596314192f,
+    0.597054362f, 0.597794592f, 0.598534882f, 0.599275172f, 0.600015461f, 0.600755751f, 0.6014961f, 0.60223645f,
+    0.602976799f, 0.603717208f, 0.604457557f, 0.605197966f, 0.605938315f, 0.606678724f, 0.607419133f, 0.608159542f,
+    0.608899891f, 0.6096403f, 0.61038065f, 0.611120999f, 0.611861348f, 0.612601697f, 0.613341987f, 0.614082277f,
+    0.614822567f, 0.615562797f, 0.616303027f, 0.617043197f, 0.617783368f, 0.618523479f, 0.61926353f, 0.620003581f,
+    0.620743632f, 0.621483564f, 0.622223496f, 0.622963369f, 0.623703182f, 0.624442935f, 0.625182629f, 0.625922322f,
+    0.626661897f, 0.627401471f, 0.628140926f, 0.628880322f, 0.629619658f, 0.630358934f, 0.631098151f, 0.631837249f,
+    0.632576346f, 0.633315265f, 0.634054184f, 0.634792984f, 0.635531664f, 0.636270344f, 0.637008846f, 0.637747288f,
+    0.63848567f, 0.639223874f, 0.639962077f, 0.640700102f, 0.641438067f, 0.642175853f, 0.64291358f, 0.643651247f,
+    0.644388735f, 0.645126104f, 0.645863354f, 0.646600544f, 0.647337556f, 0.648074448f, 0.648811221f, 0.649547875f,
+    0.65028435f, 0.651020706f, 0.651756942f, 0.65249306f, 0.653228998f, 0.653964818f, 0.654700458f, 0.655435979f,
+    0.656171381f, 0.656906545f, 0.65764159f, 0.658376515f, 0.659111261f, 0.659845829f, 0.660580218f, 0.661314428f,
+    0.662048519f, 0.662782371f, 0.663516104f, 0.664249659f, 0.664983034f, 0.665716171f, 0.666449189f, 0.667181969f,
+    0.667914569f, 0.668646991f, 0.669379234f, 0.670111299f, 0.670843124f, 0.671574712f, 0.67230618f, 0.67303741f,
+    0.673768401f, 0.674499214f, 0.675229788f, 0.675960183f, 0.67669034f, 0.677420259f, 0.678149939f, 0.67887944f,
+    0.679608703f, 0.680337727f, 0.681066513f, 0.681795061f, 0.68252337f, 0.683251441f, 0.683979332f, 0.684706867f,
+    0.685434222f, 0.686161339f, 0.686888158f, 0.687614739f, 0.688341081f, 0.689067185f, 0.689792991f, 0.690518498f,
+    0.691243827f, 0.691968799f, 0.692693532f, 0.693418026f, 0.694142222f, 0.694866121f, 0.695589721f, 0.696313083f,
+    0.697036147f, 0.697758913f, 0.698481381f, 0.699203551f, 0.699925423f, 0.700646996f, 0.701368272f, 0.70208925f,
+    0.70280993f, 0.703530312f, 0.704250395f, 0.704970121f, 0.705689549f, 0.70640862f, 0.707127452f, 0.707845867f,
+    0.708564043f, 0.709281862f, 0.709999323f, 0.710716486f, 0.711433291f, 0.712149739f, 0.712865889f, 0.713581681f,
+    0.714297116f, 0.715012193f, 0.715726912f, 0.716441333f, 0.717155337f, 0.717869043f, 0.718582332f, 0.719295323f,
+    0.720007896f, 0.720720112f, 0.721431971f, 0.722143412f, 0.722854495f, 0.723565221f, 0.724275589f, 0.72498554f,
+    0.725695133f, 0.726404309f, 0.727113068f, 0.727821469f, 0.728529513f, 0.72923708f, 0.729944289f, 0.73065114f,
+    0.731357515f, 0.732063532f, 0.732769072f, 0.733474255f, 0.73417902f, 0.734883368f, 0.735587239f, 0.736290753f,
+    0.73699379f, 0.737696469f, 0.738398671f, 0.739100456f, 0.739801764f, 0.740502656f, 0.741203129f, 0.741903126f,
+    0.742602706f, 0.743301868f, 0.744000494f, 0.744698763f, 0.745396495f, 0.74609381f, 0.746790648f, 0.747487068f,
+    0.748182952f, 0.748878419f, 0.74957341f, 0.750267923f, 0.750961959f, 0.751655459f, 0.752348542f, 0.753041148f,
+    0.753733277f, 0.75442487f, 0.755115986f, 0.755806625f, 0.756496787f, 0.757186413f, 0.757875562f, 0.758564174f,
+    0.75925231f, 0.759939909f, 0.760627031f, 0.761313617f, 0.761999726f, 0.762685299f, 0.763370335f, 0.764054835f,
+    0.764738858f, 0.765422285f, 0.766105235f, 0.766787648f, 0.767469525f, 0.768150806f, 0.768831611f, 0.769511878f,
+    0.77019155f, 0.770870686f, 0.771549284f, 0.772227347f, 0.772904813f, 0.773581743f, 0.774258137f, 0.774933934f,
+    0.775609195f, 0.77628386f, 0.776957929f, 0.777631462f, 0.778304458f, 0.778976798f, 0.779648602f, 0.78031981f,
+    0.780990422f, 0.781660438f, 0.782329917f, 0.782998741f, 0.783667028f, 0.78433466f, 0.785001755f, 0.785668194f,
+    0.786334038f, 0.786999285f, 0.787663877f, 0.788327873f, 0.788991272f, 0.789654076f, 0.790316224f, 0.790977776f,
+    0.791638672f, 0.792298973f, 0.792958617f, 0.793617606f, 0.794275999f, 0.794933736f, 0.795590818f, 0.796247303f,
+    0.796903133f, 0.797558248f, 0.798212767f, 0.79886663f, 0.799519837f, 0.800172389f, 0.800824285f, 0.801475525f,
+    0.80212605f, 0.802775919f, 0.803425193f, 0.804073691f, 0.804721594f, 0.805368781f, 0.806015253f, 0.806661129f,
+    0.80730623f, 0.807950675f, 0.808594465f, 0.80923754f, 0.809879899f, 0.810521603f, 0.811162531f, 0.811802804f,
+    0.812442422f, 0.813081264f, 0.813719392f, 0.814356863f, 0.81499356f, 0.815629542f, 0.816264868f, 0.816899419f,
+    0.817533255f, 0.818166375f, 0.818798721f, 0.819430411f, 0.820061326f, 0.820691466f, 0.821320891f, 0.821949601f,
+    0.822577536f, 0.823204756f, 0.823831201f, 0.82445693f, 0.825081885f, 0.825706065f, 0.82632947f, 0.826952159f,
+    0.827574074f, 0.828195214f, 0.828815579f, 0.82943517f, 0.830053985f, 0.830672026f, 0.831289351f, 0.831905842f,
+    0.832521498f, 0.833136439f, 0.833750606f, 0.834363937f, 0.834976494f, 0.835588217f, 0.836199164f, 0.836809337f,
+    0.837418675f, 0.838027239f, 0.838634968f, 0.839241922f, 0.839848042f, 0.840453327f, 0.841057837f, 0.841661513f,
+    0.842264354f, 0.842866361f, 0.843467534f, 0.844067931f, 0.844667435f, 0.845266163f, 0.845863998f, 0.846461058f,
+    0.847057223f, 0.847652555f, 0.848247051f, 0.848840714f, 0.849433541f, 0.850025475f, 0.850616574f, 0.851206779f,
+    0.85179615f, 0.852384686f, 0.852972329f, 0.853559136f, 0.85414505f, 0.85473007f, 0.855314255f, 0.855897546f,
+    0.856479943f, 0.857061446f, 0.857642114f, 0.858221889f, 0.858800769f, 0.859378755f, 0.859955847f, 0.860532045f,
+    0.861107349f, 0.8616817f, 0.862255216f, 0.862827837f, 0.863399506f, 0.86397028f, 0.86454016f, 0.865109086f,
+    0.865677178f, 0.866244256f, 0.866810501f, 0.867375731f, 0.867940128f, 0.868503571f, 0.86906606f, 0.869627595f,
+    0.870188236f, 0.870747924f, 0.871306717f, 0.871864498f, 0.872421384f, 0.872977316f, 0.873532295f, 0.87408632f,
+    0.874639452f, 0.875191569f, 0.875742733f, 0.876292944f, 0.876842201f, 0.877390504f, 0.877937794f, 0.87848419f,
+    0.879029572f, 0.879573941f, 0.880117416f, 0.880659878f, 0.881201327f, 0.881741822f, 0.882281363f, 0.882819891f,
+    0.883357465f, 0.883894026f, 0.884429574f, 0.884964168f, 0.885497749f, 0.886030316f, 0.886561871f, 0.887092471f,
+    0.887621999f, 0.888150573f, 0.888678133f, 0.889204681f, 0.889730215f, 0.890254676f, 0.890778184f, 0.891300678f,
+    0.8918221f, 0.892342508f, 0.892861903f, 0.893380284f, 0.893897653f, 0.894413948f, 0.894929171f, 0.895443439f,
+    0.895956635f, 0.896468759f, 0.896979868f, 0.897489905f, 0.897998929f, 0.89850688f, 0.899013817f, 0.899519682f,
+    0.900024474f, 0.900528193f, 0.901030898f, 0.901532531f, 0.902033031f, 0.902532518f, 0.903030932f, 0.903528273f,
+    0.904024541f, 0.904519737f, 0.905013859f, 0.905506909f, 0.905998886f, 0.90648973f, 0.906979561f, 0.907468259f,
+    0.907955825f, 0.908442378f, 0.908927798f, 0.909412146f, 0.90989536f, 0.910377502f, 0.910858512f, 0.911338449f,
+    0.911817253f, 0.912294984f, 0.912771583f, 0.913247049f, 0.913721442f, 0.914194703f, 0.914666831f, 0.915137887f,
+    0.91560781f, 0.916076541f, 0.916544199f, 0.917010725f, 0.917476118f, 0.917940378f, 0.918403506f, 0.918865502f,
+    0.919326365f, 0.919786096f, 0.920244694f, 0.9207021f, 0.921158373f, 0.921613514f, 0.922067523f, 0.922520339f,
+    0.922972023f, 0.923422575f, 0.923871934f, 0.924320161f, 0.924767256f, 0.925213099f, 0.925657868f, 0.926101446f,
+    0.926543832f, 0.926985025f, 0.927425086f, 0.927863955f, 0.928301692f, 0.928738177f, 0.929173529f, 0.929607689f,
+    0.930040717f, 0.930472493f, 0.930903137f, 0.931332529f, 0.931760788f, 0.932187796f, 0.932613671f, 0.933038294f,
+    0.933461785f, 0.933884025f, 0.934305072f, 0.934724927f, 0.93514353f, 0.935561001f, 0.935977221f, 0.936392248f,
+    0.936806023f, 0.937218666f, 0.937629998f, 0.938040197f, 0.938449144f, 0.93885684f, 0.939263344f, 0.939668596f,
+    0.940072656f, 0.940475464f, 0.94087708f, 0.941277444f, 0.941676557f, 0.942074478f, 0.942471147f, 0.942866564f,
+    0.943260729f, 0.943653643f, 0.944045365f, 0.944435835f, 0.944824994f, 0.94521296f, 0.945599675f, 0.945985138f,
+    0.94636935f, 0.94675225f, 0.947133958f, 0.947514415f, 0.94789356f, 0.948271453f, 0.948648155f, 0.949023485f,
+    0.949397624f, 0.94977051f, 0.950142086f, 0.95051235f, 0.950881422f, 0.951249182f, 0.951615632f, 0.951980889f,
+    0.952344775f, 0.952707469f, 0.953068793f, 0.953428924f, 0.953787684f, 0.954145193f, 0.95450145f, 0.954856396f,
+    0.95521003f, 0.955562353f, 0.955913424f, 0.956263185f, 0.956611633f, 0.95695883f, 0.957304657f, 0.957649231f,
+    0.957992494f, 0.958334446f, 0.958675086f, 0.959014416f, 0.959352434f, 0.95968914f, 0.960024595f, 0.960358679f,
+    0.960691452f, 0.961022913f, 0.961353064f, 0.961681843f, 0.96200937f, 0.962335527f, 0.962660372f, 0.962983906f,
+    0.963306129f, 0.963626981f, 0.963946521f, 0.96426475f, 0.964581609f, 0.964897156f, 0.965211391f, 0.965524256f,
+    0.96583581f, 0.966145992f, 0.966454864f, 0.966762364f, 0.967068553f, 0.967373371f, 0.967676878f, 0.967979014f,
+    0.968279779f, 0.968579233f, 0.968877316f, 0.969174027f, 0.969469428f, 0.969763458f, 0.970056117f, 0.970347464f,
+    0.970637381f, 0.970925987f, 0.971213222f, 0.971499085f, 0.971783578f, 0.9720667f, 0.972348511f, 0.972628891f,
+    0.97290796f, 0.973185599f, 0.973461926f, 0.973736823f, 0.974010348f, 0.974282563f, 0.974553347f, 0.97482276f,
+    0.975090802f, 0.975357473f, 0.975622714f, 0.975886643f, 0.976149142f, 0.97641027f, 0.976670027f, 0.976928413f,
+    0.977185369f, 0.977440953f, 0.977695167f, 0.97794795f, 0.978199363f, 0.978449345f, 0.978697956f, 0.978945196f,
+    0.979191065f, 0.979435444f, 0.979678512f, 0.979920149f, 0.980160356f, 0.980399191f, 0.980636597f, 0.980872631f,
+    0.981107235f, 0.981340468f, 0.98157227f, 0.981802642f, 0.982031643f, 0.982259214f, 0.982485414f, 0.982710123f,
+    0.982933462f, 0.983155429f, 0.983375907f, 0.983595014f, 0.98381269f, 0.984028935f, 0.98424381f, 0.984457195f,
+    0.984669209f, 0.984879792f, 0.985088944f, 0.985296667f, 0.985502958f, 0.985707879f, 0.98591131f, 0.98611331f,
+    0.986313939f, 0.986513078f, 0.986710846f, 0.986907125f, 0.987102032f, 0.987295449f, 0.987487435f, 0.987678051f,
+    0.987867177f, 0.988054872f, 0.988241136f, 0.98842597f, 0.988609374f, 0.988791287f, 0.988971829f, 0.989150882f,
+    0.989328504f, 0.989504695f, 0.989679456f, 0.989852726f, 0.990024567f, 0.990194976f, 0.990363955f, 0.990531445f,
+    0.990697503f, 0.990862131f, 0.991025329f, 0.991187036f, 0.991347313f, 0.9915061f, 0.991663456f, 0.991819382f,
+    0.991973817f, 0.992126822f, 0.992278397f, 0.992428482f, 0.992577136f, 0.992724299f, 0.992869973f, 0.993014276f,
+    0.993157089f, 0.993298411f, 0.993438303f, 0.993576705f, 0.993713677f, 0.993849158f, 0.993983209f, 0.99411577f,
+    0.9942469f, 0.99437654f, 0.99450469f, 0.99463141f, 0.994756639f, 0.994880438f, 0.995002747f, 0.995123625f,
+    0.995242953f, 0.995360911f, 0.995477319f, 0.995592296f, 0.995705783f, 0.99581784f, 0.995928347f, 0.996037483f,
+    0.99614507f, 0.996251225f, 0.996355891f, 0.996459067f, 0.996560752f, 0.996661007f, 0.996759772f, 0.996857107f,
+    0.996952891f, 0.997047246f, 0.99714011f, 0.997231483f, 0.997321367f, 0.997409821f, 0.997496784f, 0.997582257f,
+    0.99766624f, 0.997748733f, 0.997829795f, 0.997909307f, 0.99798739f, 0.998063982f, 0.998139083f, 0.998212695f,
+    0.998284876f, 0.998355508f, 0.998424709f, 0.99849242f, 0.998558581f, 0.998623312f, 0.998686552f, 0.998748362f,
+    0.998808622f, 0.998867393f, 0.998924732f, 0.998980522f, 0.999034882f, 0.999087691f, 0.999139071f, 0.99918896f,
+    0.999237359f, 0.999284267f, 0.999329686f, 0.999373615f, 0.999416053f, 0.999457002f, 0.99949646f, 0.999534428f,
+    0.999570966f, 0.999605954f, 0.999639452f, 0.999671459f, 0.999702036f, 0.999731064f, 0.999758601f, 0.999784708f,
+    0.999809265f, 0.999832392f, 0.999853969f, 0.999874115f, 0.999892712f, 0.999909878f, 0.999925494f, 0.99993968f,
+    0.999952316f, 0.999963522f, 0.999973178f, 0.999981403f, 0.999988079f, 0.999993324f, 0.99999702f, 0.999999285f,
+    1.0f, 0.999999285f, 0.99999702f, 0.999993324f, 0.999988079f, 0.999981403f, 0.999973178f, 0.999963522f,
+    0.999952316f, 0.99993968f, 0.999925494f, 0.999909878f, 0.999892712f, 0.999874115f, 0.999853969f, 0.999832392f,
+    0.999809265f, 0.999784708f, 0.999758601f, 0.999731064f, 0.999702036f, 0.999671459f, 0.999639452f, 0.999605954f,
+    0.999570966f, 0.999534428f, 0.99949646f, 0.999457002f, 0.999416053f, 0.999373615f, 0.999329686f, 0.999284267f,
+    0.999237359f, 0.99918896f, 0.999139071f, 0.999087691f, 0.999034882f, 0.998980522f, 0.998924732f, 0.998867393f,
+    0.998808622f, 0.998748362f, 0.998686552f, 0.998623312f, 0.998558581f, 0.99849242f, 0.998424709f, 0.998355508f,
+    0.998284876f, 0.998212695f, 0.998139083f, 0.998063982f, 0.99798739f, 0.997909307f, 0.997829795f, 0.997748733f,
+    0.99766624f, 0.997582257f, 0.997496784f, 0.997409821f, 0.997321367f, 0.997231483f, 0.99714011f, 0.997047246f,
+    0.996952891f, 0.996857107f, 0.996759772f, 0.996661007f, 0.996560752f, 0.996459067f, 0.996355891f, 0.996251225f,
+    0.99614507f, 0.996037483f, 0.995928347f, 0.99581784f, 0.995705783f, 0.995592296f, 0.995477319f, 0.995360911f,
+    0.995242953f, 0.995123625f, 0.995002747f, 0.994880438f, 0.994756639f, 0.99463141f, 0.99450469f, 0.99437654f,
+    0.9942469f, 0.99411577f, 0.993983209f, 0.993849158f, 0.993713677f, 0.993576705f, 0.993438303f, 0.993298411f,
+    0.993157089f, 0.993014276f, 0.992869973f, 0.992724299f, 0.992577136f, 0.992428482f, 0.992278397f, 0.992126822f,
+    0.991973817f, 0.991819382f, 0.991663456f, 0.9915061f, 0.991347313f, 0.991187036f, 0.991025329f, 0.990862131f,
+    0.990697503f, 0.990531445f, 0.990363955f, 0.990194976f, 0.990024567f, 0.989852726f, 0.989679456f, 0.989504695f,
+    0.989328504f, 0.989150882f, 0.988971829f, 0.988791287f, 0.988609374f, 0.98842597f, 0.988241136f, 0.988054872f,
+    0.987867177f, 0.987678051f, 0.987487435f, 0.987295449f, 0.987102032f, 0.986907125f, 0.986710846f, 0.986513078f,
+    0.986313939f, 0.98611331f, 0.98591131f, 0.985707879f, 0.985502958f, 0.985296667f, 0.985088944f, 0.984879792f,
+    0.984669209f, 0.984457195f, 0.98424381f, 0.984028935f, 0.98381269f, 0.983595014f, 0.983375907f, 0.983155429f,
+    0.982933462f, 0.982710123f, 0.982485414f, 0.982259214f, 0.982031643f, 0.981802642f, 0.98157227f, 0.981340468f,
+    0.981107235f, 0.980872631f, 0.980636597f, 0.980399191f, 0.980160356f, 0.979920149f, 0.979678512f, 0.979435444f,
+    0.979191065f, 0.978945196f, 0.978697956f, 0.978449345f, 0.978199363f, 0.97794795f, 0.977695167f, 0.977440953f,
+    0.977185369f, 0.976928413f, 0.976670027f, 0.97641027f, 0.976149142f, 0.975886643f, 0.975622714f, 0.975357473f,
+    0.975090802f, 0.97482276f, 0.974553347f, 0.974282563f, 0.974010348f, 0.973736823f, 0.973461926f, 0.973185599f,
+    0.97290796f, 0.972628891f, 0.972348511f, 0.9720667f, 0.971783578f, 0.971499085f, 0.971213222f, 0.970925987f,
+    0.970637381f, 0.970347464f, 0.970056117f, 0.969763458f, 0.969469428f, 0.969174027f, 0.968877316f, 0.968579233f,
+    0.968279779f, 0.967979014f, 0.967676878f, 0.967373371f, 0.967068553f, 0.966762364f, 0.966454864f, 0.966145992f,
+    0.96583581f, 0.965524256f, 0.965211391f, 0.964897156f, 0.964581609f, 0.96426475f, 0.963946521f, 0.963626981f,
+    0.963306129f, 0.962983906f, 0.962660372f, 0.962335527f, 0.96200937f, 0.961681843f, 0.961353064f, 0.961022913f,
+    0.960691452f, 0.960358679f, 0.960024595f, 0.95968914f, 0.959352434f, 0.959014416f, 0.958675086f, 0.958334446f,
+    0.957992494f, 0.957649231f, 0.957304657f, 0.95695883f, 0.956611633f, 0.956263185f, 0.955913424f, 0.955562353f,
+    0.95521003f, 0.954856396f, 0.95450145f, 0.954145193f, 0.953787684f, 0.953428924f, 0.953068793f, 0.952707469f,
+    0.952344775f, 0.951980889f, 0.951615632f, 0.951249182f, 0.950881422f, 0.95051235f, 0.950142086f, 0.94977051f,
+    0.949397624f, 0.949023485f, 0.948648155f, 0.948271453f, 0.94789356f, 0.947514415f, 0.947133958f, 0.94675225f,
+    0.94636935f, 0.945985138f, 0.945599675f, 0.94521296f, 0.944824994f, 0.944435835f, 0.944045365f, 0.943653643f,
+    0.943260729f, 0.942866564f, 0.942471147f, 0.942074478f, 0.941676557f, 0.941277444f, 0.94087708f, 0.940475464f,
+    0.940072656f, 0.939668596f, 0.939263344f, 0.93885684f, 0.938449144f, 0.938040197f, 0.937629998f, 0.937218666f,
+    0.936806023f, 0.936392248f, 0.935977221f, 0.935561001f, 0.93514353f, 0.934724927f, 0.934305072f, 0.933884025f,
+    0.933461785f, 0.933038294f, 0.932613671f, 0.932187796f, 0.931760788f, 0.931332529f, 0.930903137f, 0.930472493f,
+    0.930040717f, 0.929607689f, 0.929173529f, 0.928738177f, 0.928301692f, 0.927863955f, 0.927425086f, 0.926985025f,
+    0.926543832f, 0.926101446f, 0.925657868f, 0.925213099f, 0.924767256f, 0.924320161f, 0.923871934f, 0.923422575f,
+    0.922972023f, 0.922520339f, 0.922067523f, 0.921613514f, 0.921158373f, 0.9207021f, 0.920244694f, 0.919786096f,
+    0.919326365f, 0.918865502f, 0.918403506f, 0.917940378f, 0.917476118f, 0.917010725f, 0.916544199f, 0.916076541f,
+    0.91560781f, 0.915137887f, 0.914666831f, 0.914194703f, 0.913721442f, 0.913247049f, 0.912771583f, 0.912294984f,
+    0.911817253f, 0.911338449f, 0.910858512f, 0.910377502f, 0.90989536f, 0.909412146f, 0.908927798f, 0.908442378f,
+    0.907955825f, 0.907468259f, 0.906979561f, 0.90648973f, 0.905998886f, 0.905506909f, 0.905013859f, 0.904519737f,
+    0.904024541f, 0.903528273f, 0.903030932f, 0.902532518f, 0.902033031f, 0.901532531f, 0.901030898f, 0.900528193f,
+    0.900024474f, 0.899519682f, 0.899013817f, 0.89850688f, 0.897998929f, 0.897489905f, 0.896979868f, 0.896468759f,
+    0.895956635f, 0.895443439f, 0.894929171f, 0.894413948f, 0.893897653f, 0.893380284f, 0.892861903f, 0.892342508f,
+    0.8918221f, 0.891300678f, 0.890778184f, 0.890254676f, 0.889730215f, 0.889204681f, 0.888678133f, 0.888150573f,
+    0.887621999f, 0.887092471f, 0.886561871f, 0.886030316f, 0.885497749f, 0.884964168f, 0.884429574f, 0.883894026f,
+    0.883357465f, 0.882819891f, 0.882281363f, 0.881741822f, 0.881201327f, 0.880659878f, 0.880117416f, 0.879573941f,
+    0.879029572f, 0.87848419f, 0.877937794f, 0.877390504f, 0.876842201f, 0.876292944f, 0.875742733f, 0.875191569f,
+    0.874639452f, 0.87408632f, 0.873532295f, 0.872977316f, 0.872421384f, 0.871864498f, 0.871306717f, 0.870747924f,
+    0.870188236f, 0.869627595f, 0.86906606f, 0.868503571f, 0.867940128f, 0.867375731f, 0.866810501f, 0.866244256f,
+    0.865677178f, 0.865109086f, 0.86454016f, 0.86397028f, 0.863399506f, 0.862827837f, 0.862255216f, 0.8616817f,
+    0.861107349f, 0.860532045f, 0.859955847f, 0.859378755f, 0.858800769f, 0.858221889f, 0.857642114f, 0.857061446f,
+    0.856479943f, 0.855897546f, 0.855314255f, 0.85473007f, 0.85414505f, 0.853559136f, 0.852972329f, 0.852384686f,
+    0.85179615f, 0.851206779f, 0.850616574f, 0.850025475f, 0.849433541f, 0.848840714f, 0.848247051f, 0.847652555f,
+    0.847057223f, 0.846461058f, 0.845863998f, 0.845266163f, 0.844667435f, 0.844067931f, 0.843467534f, 0.842866361f,
+    0.842264354f, 0.841661513f, 0.841057837f, 0.840453327f, 0.839848042f, 0.839241922f, 0.838634968f, 0.838027239f,
+    0.837418675f, 0.836809337f, 0.836199164f, 0.835588217f, 0.834976494f, 0.834363937f, 0.833750606f, 0.833136439f,
+    0.832521498f, 0.831905842f, 0.831289351f, 0.830672026f, 0.830053985f, 0.82943517f, 0.828815579f, 0.828195214f,
+    0.827574074f, 0.826952159f, 0.82632947f, 0.825706065f, 0.825081885f, 0.82445693f, 0.823831201f, 0.823204756f,
+    0.822577536f, 0.821949601f, 0.821320891f, 0.820691466f, 0.820061326f, 0.819430411f, 0.818798721f, 0.818166375f,
+    0.817533255f, 0.816899419f, 0.816264868f, 0.815629542f, 0.81499356f, 0.814356863f, 0.813719392f, 0.813081264f,
+    0.812442422f, 0.811802804f, 0.811162531f, 0.810521603f, 0.809879899f, 0.80923754f, 0.808594465f, 0.807950675f,
+    0.80730623f, 0.806661129f, 0.806015253f, 0.805368781f, 0.804721594f, 0.804073691f, 0.803425193f, 0.802775919f,
+    0.80212605f, 0.801475525f, 0.800824285f, 0.800172389f, 0.799519837f, 0.79886663f, 0.798212767f, 0.797558248f,
+    0.796903133f, 0.796247303f, 0.795590818f, 0.794933736f, 0.794275999f, 0.793617606f, 0.792958617f, 0.792298973f,
+    0.791638672f, 0.790977776f, 0.790316224f, 0.789654076f, 0.788991272f, 0.788327873f, 0.787663877f, 0.786999285f,
+    0.786334038f, 0.785668194f, 0.785001755f, 0.78433466f, 0.783667028f, 0.782998741f, 0.782329917f, 0.781660438f,
+    0.780990422f, 0.78031981f, 0.779648602f, 0.778976798f, 0.778304458f, 0.777631462f, 0.776957929f, 0.77628386f,
+    0.775609195f, 0.774933934f, 0.774258137f, 0.773581743f, 0.772904813f, 0.772227347f, 0.771549284f, 0.770870686f,
+    0.77019155f, 0.769511878f, 0.768831611f, 0.768150806f, 0.767469525f, 0.766787648f, 0.766105235f, 0.765422285f,
+    0.764738858f, 0.764054835f, 0.763370335f, 0.762685299f, 0.761999726f, 0.761313617f, 0.760627031f, 0.759939909f,
+    0.75925231f, 0.758564174f, 0.757875562f, 0.757186413f, 0.756496787f, 0.755806625f, 0.755115986f, 0.75442487f,
+    0.753733277f, 0.753041148f, 0.752348542f, 0.751655459f, 0.750961959f, 0.750267923f, 0.74957341f, 0.748878419f,
+    0.748182952f, 0.747487068f, 0.746790648f, 0.74609381f, 0.745396495f, 0.744698763f, 0.744000494f, 0.743301868f,
+    0.742602706f, 0.741903126f, 0.741203129f, 0.740502656f, 0.739801764f, 0.739100456f, 0.738398671f, 0.737696469f,
+    0.73699379f, 0.736290753f, 0.735587239f, 0.734883368f, 0.73417902f, 0.733474255f, 0.732769072f, 0.732063532f,
+    0.731357515f, 0.73065114f, 0.729944289f, 0.72923708f, 0.728529513f, 0.727821469f, 0.727113068f, 0.726404309f,
+    0.725695133f, 0.72498554f, 0.724275589f, 0.723565221f, 0.722854495f, 0.722143412f, 0.721431971f, 0.720720112f,
+    0.720007896f, 0.719295323f, 0.718582332f, 0.717869043f, 0.717155337f, 0.716441333f, 0.715726912f, 0.715012193f,
+    0.714297116f, 0.713581681f, 0.712865889f, 0.712149739f, 0.711433291f, 0.710716486f, 0.709999323f, 0.709281862f,
+    0.708564043f, 0.707845867f, 0.707127452f, 0.70640862f, 0.705689549f, 0.704970121f, 0.704250395f, 0.703530312f,
+    0.70280993f, 0.70208925f, 0.701368272f, 0.700646996f, 0.699925423f, 0.699203551f, 0.698481381f, 0.697758913f,
+    0.697036147f, 0.696313083f, 0.695589721f, 0.694866121f, 0.694142222f, 0.693418026f, 0.692693532f, 0.691968799f,
+    0.691243827f, 0.690518498f, 0.689792991f, 0.689067185f, 0.688341081f, 0.687614739f, 0.686888158f, 0.686161339f,
+    0.685434222f, 0.684706867f, 0.683979332f, 0.683251441f, 0.68252337f, 0.681795061f, 0.681066513f, 0.680337727f,
+    0.679608703f, 0.67887944f, 0.678149939f, 0.677420259f, 0.67669034f, 0.675960183f, 0.675229788f, 0.674499214f,
+    0.673768401f, 0.67303741f, 0.67230618f, 0.671574712f, 0.670843124f, 0.670111299f, 0.669379234f, 0.668646991f,
+    0.667914569f, 0.667181969f, 0.666449189f, 0.665716171f, 0.664983034f, 0.664249659f, 0.663516104f, 0.662782371f,
+    0.662048519f, 0.661314428f, 0.660580218f, 0.659845829f, 0.659111261f, 0.658376515f, 0.65764159f, 0.656906545f,
+    0.656171381f, 0.655435979f, 0.654700458f, 0.653964818f, 0.653228998f, 0.65249306f, 0.651756942f, 0.651020706f,
+    0.65028435f, 0.649547875f, 0.648811221f, 0.648074448f, 0.647337556f, 0.646600544f, 0.645863354f, 0.645126104f,
+    0.644388735f, 0.643651247f, 0.64291358f, 0.642175853f, 0.641438067f, 0.640700102f, 0.639962077f, 0.639223874f,
+    0.63848567f, 0.637747288f, 0.637008846f, 0.636270344f, 0.635531664f, 0.634792984f, 0.634054184f, 0.633315265f,
+    0.632576346f, 0.631837249f, 0.631098151f, 0.630358934f, 0.629619658f, 0.628880322f, 0.628140926f, 0.627401471f,
+    0.626661897f, 0.625922322f, 0.625182629f, 0.624442935f, 0.623703182f, 0.622963369f, 0.622223496f, 0.621483564f,
+    0.620743632f, 0.620003581f, 0.61926353f, 0.618523479f, 0.617783368f, 0.617043197f, 0.616303027f, 0.615562797f,
+    0.614822567f, 0.614082277f, 0.613341987f, 0.612601697f, 0.611861348f, 0.611120999f, 0.61038065f, 0.6096403f,
+    0.608899891f, 0.608159542f, 0.607419133f, 0.606678724f, 0.605938315f, 0.605197966f, 0.604457557f, 0.603717208f,
+    0.602976799f, 0.60223645f, 0.6014961f, 0.600755751f, 0.600015461f, 0.599275172f, 0.598534882f, 0.597794592f,
+    0.597054362f, 0.596314192f, 0.595574021f, 0.594833851f, 0.5940938f, 0.593353689f, 0.592613697f, 0.591873705f,
+    0.591133773f, 0.590393841f, 0.589654028f, 0.588914216f, 0.588174462f, 0.587434769f, 0.586695135f, 0.58595556f,
+    0.585216045f, 0.58447659f, 0.583737195f, 0.582997859f, 0.582258582f, 0.581519425f, 0.580780268f, 0.58004123f,
+    0.579302311f, 0.578563392f, 0.577824593f, 0.577085853f, 0.576347232f, 0.57560873f, 0.574870229f, 0.574131906f,
+    0.573393643f, 0.572655439f, 0.571917355f, 0.57117939f, 0.570441544f, 0.569703758f, 0.568966091f, 0.568228543f,
+    0.567491114f, 0.566753745f, 0.566016555f, 0.565279424f, 0.564542472f, 0.56380558f, 0.563068867f, 0.562332273f,
+    0.561595798f, 0.560859382f, 0.560123205f, 0.559387088f, 0.558651149f, 0.55791533f, 0.55717963f, 0.556444108f,
+    0.555708706f, 0.554973423f, 0.554238319f, 0.553503394f, 0.552768588f, 0.552033901f, 0.551299393f, 0.550565064f,
+    0.549830914f, 0.549096882f, 0.54836303f, 0.547629297f, 0.546895802f, 0.546162426f, 0.54542923f, 0.544696212f,
+    0.543963373f, 0.543230712f, 0.542498231f, 0.541765928f, 0.541033804f, 0.540301859f, 0.539570093f, 0.538838506f,
+    0.538107157f, 0.537375987f, 0.536644995f, 0.535914183f, 0.535183609f, 0.534453213f, 0.533722997f, 0.532993019f,
+    0.532263219f, 0.531533659f, 0.530804276f, 0.530075133f, 0.529346168f, 0.528617442f, 0.527888894f, 0.527160645f,
+    0.526432514f, 0.525704682f, 0.524977088f, 0.524249673f, 0.523522496f, 0.522795558f, 0.522068799f, 0.521342337f,
+    0.520616114f, 0.51989007f, 0.519164324f, 0.518438756f, 0.517713487f, 0.516988456f, 0.516263664f, 0.51553911f,
+    0.514814794f, 0.514090776f, 0.513366938f, 0.512643397f, 0.511920154f, 0.51119709f, 0.510474324f, 0.509751856f,
+    0.509029627f, 0.508307636f, 0.507585943f, 0.506864488f, 0.506143332f, 0.505422413f, 0.504701853f, 0.503981471f,
+    0.503261447f, 0.502541661f, 0.501822174f, 0.501102924f, 0.500383973f, 0.49966535f, 0.498946995f, 0.498228937f,
+    0.497511178f, 0.496793687f, 0.496076494f, 0.495359629f, 0.494643033f, 0.493926734f, 0.493210763f, 0.49249509f,
+    0.491779715f, 0.491064638f, 0.490349889f, 0.489635438f, 0.488921285f, 0.488207459f, 0.487493962f, 0.486780763f,
+    0.486067921f, 0.485355347f, 0.484643131f, 0.483931243f, 0.483219653f, 0.482508421f, 0.481797487f, 0.48108691f,
+    0.480376631f, 0.47966671f, 0.478957117f, 0.478247881f, 0.477538973f, 0.476830393f, 0.476122171f, 0.475414276f,
+    0.474706739f, 0.47399953f, 0.473292708f, 0.472586215f, 0.471880049f, 0.47117427f, 0.470468819f, 0.469763756f,
+    0.46905902f, 0.468354672f, 0.467650652f, 0.466947019f, 0.466243744f, 0.465540826f, 0.464838266f, 0.464136094f,
+    0.463434309f, 0.462732852f, 0.462031811f, 0.461331129f, 0.460630804f, 0.459930867f, 0.459231317f, 0.458532155f,
+    0.458532155f, 0.459231317f, 0.459930867f, 0.460630804f, 0.461331129f, 0.462031811f, 0.462732852f, 0.463434309f,
+    0.464136094f, 0.464838266f, 0.465540826f, 0.466243744f, 0.466947019f, 0.467650652f, 0.468354672f, 0.46905902f,
+    0.469763756f, 0.470468819f, 0.47117427f, 0.471880049f, 0.472586215f, 0.473292708f, 0.47399953f, 0.474706739f,
+    0.475414276f, 0.476122171f, 0.476830393f, 0.477538973f, 0.478247881f, 0.478957117f, 0.47966671f, 0.480376631f,
+    0.48108691f, 0.481797487f, 0.482508421f, 0.483219653f, 0.483931243f, 0.484643131f, 0.485355347f, 0.486067921f,
+    0.486780763f, 0.487493962f, 0.488207459f, 0.488921285f, 0.489635438f, 0.490349889f, 0.491064638f, 0.491779715f,
+    0.49249509f, 0.493210763f, 0.493926734f, 0.494643033f, 0.495359629f, 0.496076494f, 0.496793687f, 0.497511178f,
+    0.498228937f, 0.498946995f, 0.49966535f, 0.500383973f, 0.501102924f, 0.501822174f, 0.502541661f, 0.503261447f,
+    0.503981471f, 0.504701853f, 0.505422413f, 0.506143332f, 0.506864488f, 0.507585943f, 0.508307636f, 0.509029627f,
+    0.509751856f, 0.510474324f, 0.51119709f, 0.511920154f, 0.512643397f, 0.513366938f, 0.514090776f, 0.514814794f,
+    0.51553911f, 0.516263664f, 0.516988456f, 0.517713487f, 0.518438756f, 0.519164324f, 0.51989007f, 0.520616114f,
+    0.521342337f, 0.522068799f, 0.522795558f, 0.523522496f, 0.524249673f, 0.524977088f, 0.525704682f, 0.526432514f,
+    0.527160645f, 0.527888894f, 0.528617442f, 0.529346168f, 0.530075133f, 0.530804276f, 0.531533659f, 0.532263219f,
+    0.532993019f, 0.533722997f, 0.534453213f, 0.535183609f, 0.535914183f, 0.536644995f, 0.537375987f, 0.538107157f,
+    0.538838506f, 0.539570093f, 0.540301859f, 0.541033804f, 0.541765928f, 0.542498231f, 0.543230712f, 0.543963373f,
+    0.544696212f, 0.54542923f, 0.546162426f, 0.546895802f, 0.547629297f, 0.54836303f, 0.549096882f, 0.549830914f,
+    0.550565064f, 0.551299393f, 0.552033901f, 0.552768588f, 0.553503394f, 0.554238319f, 0.554973423f, 0.555708706f,
+    0.556444108f, 0.55717963f, 0.55791533f, 0.558651149f, 0.559387088f, 0.560123205f, 0.560859382f, 0.561595798f,
+    0.562332273f, 0.563068867f, 0.56380558f, 0.564542472f, 0.565279424f, 0.566016555f, 0.566753745f, 0.567491114f,
+    0.568228543f, 0.568966091f, 0.569703758f, 0.570441544f, 0.57117939f, 0.571917355f, 0.572655439f, 0.573393643f,
+    0.574131906f, 0.574870229f, 0.57560873f, 0.576347232f, 0.577085853f, 0.577824593f, 0.578563392f, 0.579302311f,
+    0.58004123f, 0.580780268f, 0.581519425f, 0.582258582f, 0.582997859f, 0.583737195f, 0.58447659f, 0.585216045f,
+    0.58595556f, 0.586695135f, 0.587434769f, 0.588174462f, 0.588914216f, 0.589654028f, 0.590393841f, 0.591133773f,
+    0.591873705f, 0.592613697f, 0.593353689f, 0.5940938f, 0.594833851f, 0.595574021f, 0.596314192f, 0.597054362f,
+    0.597794592f, 0.598534882f, 0.599275172f, 0.600015461f, 0.600755751f, 0.6014961f, 0.60223645f, 0.602976799f,
+    0.603717208f, 0.604457557f, 0.605197966f, 0.605938315f, 0.606678724f, 0.607419133f, 0.608159542f, 0.608899891f,
+    0.6096403f, 0.61038065f, 0.611120999f, 0.611861348f, 0.612601697f, 0.613341987f, 0.614082277f, 0.614822567f,
+    0.615562797f, 0.616303027f, 0.617043197f, 0.617783368f, 0.618523479f, 0.61926353f, 0.620003581f, 0.620743632f,
+    0.621483564f, 0.622223496f, 0.622963369f, 0.623703182f, 0.624442935f, 0.625182629f, 0.625922322f, 0.626661897f,
+    0.627401471f, 0.628140926f, 0.628880322f, 0.629619658f, 0.630358934f, 0.631098151f, 0.631837249f, 0.632576346f,
+    0.633315265f, 0.634054184f, 0.634792984f, 0.635531664f, 0.636270344f, 0.637008846f, 0.637747288f, 0.63848567f,
+    0.639223874f, 0.639962077f, 0.640700102f, 0.641438067f, 0.642175853f, 0.64291358f, 0.643651247f, 0.644388735f,
+    0.645126104f, 0.645863354f, 0.646600544f, 0.647337556f, 0.648074448f, 0.648811221f, 0.649547875f, 0.65028435f,
+    0.651020706f, 0.651756942f, 0.65249306f, 0.653228998f, 0.653964818f, 0.654700458f, 0.655435979f, 0.656171381f,
+    0.656906545f, 0.65764159f, 0.658376515f, 0.659111261f, 0.659845829f, 0.660580218f, 0.661314428f, 0.662048519f,
+    0.662782371f, 0.663516104f, 0.664249659f, 0.664983034f, 0.665716171f, 0.666449189f, 0.667181969f, 0.667914569f,
+    0.668646991f, 0.669379234f, 0.670111299f, 0.670843124f, 0.671574712f, 0.67230618f, 0.67303741f, 0.673768401f,
+    0.674499214f, 0.675229788f, 0.675960183f, 0.67669034f, 0.677420259f, 0.678149939f, 0.67887944f, 0.679608703f,
+    0.680337727f, 0.681066513f, 0.681795061f, 0.68252337f, 0.683251441f, 0.683979332f, 0.684706867f, 0.685434222f,
+    0.686161339f, 0.686888158f, 0.687614739f, 0.688341081f, 0.689067185f, 0.689792991f, 0.690518498f, 0.691243827f,
+    0.691968799f, 0.692693532f, 0.693418026f, 0.694142222f, 0.694866121f, 0.695589721f, 0.696313083f, 0.697036147f,
+    0.697758913f, 0.698481381f, 0.699203551f, 0.699925423f, 0.700646996f, 0.701368272f, 0.70208925f, 0.70280993f,
+    0.703530312f, 0.704250395f, 0.704970121f, 0.705689549f, 0.70640862f, 0.707127452f, 0.707845867f, 0.708564043f,
+    0.709281862f, 0.709999323f, 0.710716486f, 0.711433291f, 0.712149739f, 0.712865889f, 0.713581681f, 0.714297116f,
+    0.715012193f, 0.715726912f, 0.716441333f, 0.717155337f, 0.717869043f, 0.718582332f, 0.719295323f, 0.720007896f,
+    0.720720112f, 0.721431971f, 0.722143412f, 0.722854495f, 0.723565221f, 0.724275589f, 0.72498554f, 0.725695133f,
+    0.726404309f, 0.727113068f, 0.727821469f, 0.728529513f, 0.72923708f, 0.729944289f, 0.73065114f, 0.731357515f,
+    0.732063532f, 0.732769072f, 0.733474255f, 0.73417902f, 0.734883368f, 0.735587239f, 0.736290753f, 0.73699379f,
+    0.737696469f, 0.738398671f, 0.739100456f, 0.739801764f, 0.740502656f, 0.741203129f, 0.741903126f, 0.742602706f,
+    0.743301868f, 0.744000494f, 0.744698763f, 0.745396495f, 0.74609381f, 0.746790648f, 0.747487068f, 0.748182952f,
+    0.748878419f, 0.74957341f, 0.750267923f, 0.750961959f, 0.751655459f, 0.752348542f, 0.753041148f, 0.753733277f,
+    0.75442487f, 0.755115986f, 0.755806625f, 0.756496787f, 0.757186413f, 0.757875562f, 0.758564174f, 0.75925231f,
+    0.759939909f, 0.760627031f, 0.761313617f, 0.761999726f, 0.762685299f, 0.763370335f, 0.764054835f, 0.764738858f,
+    0.765422285f, 0.766105235f, 0.766787648f, 0.767469525f, 0.768150806f, 0.768831611f, 0.769511878f, 0.77019155f,
+    0.770870686f, 0.771549284f, 0.772227347f, 0.772904813f, 0.773581743f, 0.774258137f, 0.774933934f, 0.775609195f,
+    0.77628386f, 0.776957929f, 0.777631462f, 0.778304458f, 0.778976798f, 0.779648602f, 0.78031981f, 0.780990422f,
+    0.781660438f, 0.782329917f, 0.782998741f, 0.783667028f, 0.78433466f, 0.785001755f, 0.785668194f, 0.786334038f,
+    0.786999285f, 0.787663877f, 0.788327873f, 0.788991272f, 0.789654076f, 0.790316224f, 0.790977776f, 0.791638672f,
+    0.792298973f, 0.792958617f, 0.793617606f, 0.794275999f, 0.794933736f, 0.795590818f, 0.796247303f, 0.796903133f,
+    0.797558248f, 0.798212767f, 0.79886663f, 0.799519837f, 0.800172389f, 0.800824285f, 0.801475525f, 0.80212605f,
+    0.802775919f, 0.803425193f, 0.804073691f, 0.804721594f, 0.805368781f, 0.806015253f, 0.806661129f, 0.80730623f,
+    0.807950675f, 0.808594465f, 0.80923754f, 0.809879899f, 0.810521603f, 0.811162531f, 0.811802804f, 0.812442422f,
+    0.813081264f, 0.813719392f, 0.814356863f, 0.81499356f, 0.815629542f, 0.816264868f, 0.816899419f, 0.817533255f,
+    0.818166375f, 0.818798721f, 0.819430411f, 0.820061326f, 0.820691466f, 0.821320891f, 0.821949601f, 0.822577536f,
+    0.823204756f, 0.823831201f, 0.82445693f, 0.825081885f, 0.825706065f, 0.82632947f, 0.826952159f, 0.827574074f,
+    0.828195214f, 0.828815579f, 0.82943517f, 0.830053985f, 0.830672026f, 0.831289351f, 0.831905842f, 0.832521498f,
+    0.833136439f, 0.833750606f, 0.834363937f, 0.834976494f, 0.835588217f, 0.836199164f, 0.836809337f, 0.837418675f,
+    0.838027239f, 0.838634968f, 0.839241922f, 0.839848042f, 0.840453327f, 0.841057837f, 0.841661513f, 0.842264354f,
+    0.842866361f, 0.843467534f, 0.844067931f, 0.844667435f, 0.845266163f, 0.845863998f, 0.846461058f, 0.847057223f,
+    0.847652555f, 0.848247051f, 0.848840714f, 0.849433541f, 0.850025475f, 0.850616574f, 0.851206779f, 0.85179615f,
+    0.852384686f, 0.852972329f, 0.853559136f, 0.85414505f, 0.85473007f, 0.855314255f, 0.855897546f, 0.856479943f,
+    0.857061446f, 0.857642114f, 0.858221889f, 0.858800769f, 0.859378755f, 0.859955847f, 0.860532045f, 0.861107349f,
+    0.8616817f, 0.862255216f, 0.862827837f, 0.863399506f, 0.86397028f, 0.86454016f, 0.865109086f, 0.865677178f,
+    0.866244256f, 0.866810501f, 0.867375731f, 0.867940128f, 0.868503571f, 0.86906606f, 0.869627595f, 0.870188236f,
+    0.870747924f, 0.871306717f, 0.871864498f, 0.872421384f, 0.872977316f, 0.873532295f, 0.87408632f, 0.874639452f,
+    0.875191569f, 0.875742733f, 0.876292944f, 0.876842201f, 0.877390504f, 0.877937794f, 0.87848419f, 0.879029572f,
+    0.879573941f, 0.880117416f, 0.880659878f, 0.881201327f, 0.881741822f, 0.882281363f, 0.882819891f, 0.883357465f,
+    0.883894026f, 0.884429574f, 0.884964168f, 0.885497749f, 0.886030316f, 0.886561871f, 0.887092471f, 0.887621999f,
+    0.888150573f, 0.888678133f, 0.889204681f, 0.889730215f, 0.890254676f, 0.890778184f, 0.891300678f, 0.8918221f,
+    0.892342508f, 0.892861903f, 0.893380284f, 0.893897653f, 0.894413948f, 0.894929171f, 0.895443439f, 0.895956635f,
+    0.896468759f, 0.896979868f, 0.897489905f, 0.897998929f, 0.89850688f, 0.899013817f, 0.899519682f, 0.900024474f,
+    0.900528193f, 0.901030898f, 0.901532531f, 0.902033031f, 0.902532518f, 0.903030932f, 0.903528273f, 0.904024541f,
+    0.904519737f, 0.905013859f, 0.905506909f, 0.905998886f, 0.90648973f, 0.906979561f, 0.907468259f, 0.907955825f,
+    0.908442378f, 0.908927798f, 0.909412146f, 0.90989536f, 0.910377502f, 0.910858512f, 0.911338449f, 0.911817253f,
+    0.912294984f, 0.912771583f, 0.913247049f, 0.913721442f, 0.914194703f, 0.914666831f, 0.915137887f, 0.91560781f,
+    0.916076541f, 0.916544199f, 0.917010725f, 0.917476118f, 0.917940378f, 0.918403506f, 0.918865502f, 0.919326365f,
+    0.919786096f, 0.920244694f, 0.9207021f, 0.921158373f, 0.921613514f, 0.922067523f, 0.922520339f, 0.922972023f,
+    0.923422575f, 0.923871934f, 0.924320161f, 0.924767256f, 0.925213099f, 0.925657868f, 0.926101446f, 0.926543832f,
+    0.926985025f, 0.927425086f, 0.927863955f, 0.928301692f, 0.928738177f, 0.929173529f, 0.929607689f, 0.930040717f,
+    0.930472493f, 0.930903137f, 0.931332529f, 0.931760788f, 0.932187796f, 0.932613671f, 0.933038294f, 0.933461785f,
+    0.933884025f, 0.934305072f, 0.934724927f, 0.93514353f, 0.935561001f, 0.935977221f, 0.936392248f, 0.936806023f,
+    0.937218666f, 0.937629998f, 0.938040197f, 0.938449144f, 0.93885684f, 0.939263344f, 0.939668596f, 0.940072656f,
+    0.940475464f, 0.94087708f, 0.941277444f, 0.941676557f, 0.942074478f, 0.942471147f, 0.942866564f, 0.943260729f,
+    0.943653643f, 0.944045365f, 0.944435835f, 0.944824994f, 0.94521296f, 0.945599675f, 0.945985138f, 0.94636935f,
+    0.94675225f, 0.947133958f, 0.947514415f, 0.94789356f, 0.948271453f, 0.948648155f, 0.949023485f, 0.949397624f,
+    0.94977051f, 0.950142086f, 0.95051235f, 0.950881422f, 0.951249182f, 0.951615632f, 0.951980889f, 0.952344775f,
+    0.952707469f, 0.953068793f, 0.953428924f, 0.953787684f, 0.954145193f, 0.95450145f, 0.954856396f, 0.95521003f,
+    0.955562353f, 0.955913424f, 0.956263185f, 0.956611633f, 0.95695883f, 0.957304657f, 0.957649231f, 0.957992494f,
+    0.958334446f, 0.958675086f, 0.959014416f, 0.959352434f, 0.95968914f, 0.960024595f, 0.960358679f, 0.960691452f,
+    0.961022913f, 0.961353064f, 0.961681843f, 0.96200937f, 0.962335527f, 0.962660372f, 0.962983906f, 0.963306129f,
+    0.963626981f, 0.963946521f, 0.96426475f, 0.964581609f, 0.964897156f, 0.965211391f, 0.965524256f, 0.96583581f,
+    0.966145992f, 0.966454864f, 0.966762364f, 0.967068553f, 0.967373371f, 0.967676878f, 0.967979014f, 0.968279779f,
+    0.968579233f, 0.968877316f, 0.969174027f, 0.969469428f, 0.969763458f, 0.970056117f, 0.970347464f, 0.970637381f,
+    0.970925987f, 0.971213222f, 0.971499085f, 0.971783578f, 0.9720667f, 0.972348511f, 0.972628891f, 0.97290796f,
+    0.973185599f, 0.973461926f, 0.973736823f, 0.974010348f, 0.974282563f, 0.974553347f, 0.97482276f, 0.975090802f,
+    0.975357473f, 0.975622714f, 0.975886643f, 0.976149142f, 0.97641027f, 0.976670027f, 0.976928413f, 0.977185369f,
+    0.977440953f, 0.977695167f, 0.97794795f, 0.978199363f, 0.978449345f, 0.978697956f, 0.978945196f, 0.979191065f,
+    0.979435444f, 0.979678512f, 0.979920149f, 0.980160356f, 0.980399191f, 0.980636597f, 0.980872631f, 0.981107235f,
+    0.981340468f, 0.98157227f, 0.981802642f, 0.982031643f, 0.982259214f, 0.982485414f, 0.982710123f, 0.982933462f,
+    0.983155429f, 0.983375907f, 0.983595014f, 0.98381269f, 0.984028935f, 0.98424381f, 0.984457195f, 0.984669209f,
+    0.984879792f, 0.985088944f, 0.985296667f, 0.985502958f, 0.985707879f, 0.98591131f, 0.98611331f, 0.986313939f,
+    0.986513078f, 0.986710846f, 0.986907125f, 0.987102032f, 0.987295449f, 0.987487435f, 0.987678051f, 0.987867177f,
+    0.988054872f, 0.988241136f, 0.98842597f, 0.988609374f, 0.988791287f, 0.988971829f, 0.989150882f, 0.989328504f,
+    0.989504695f, 0.989679456f, 0.989852726f, 0.990024567f, 0.990194976f, 0.990363955f, 0.990531445f, 0.990697503f,
+    0.990862131f, 0.991025329f, 0.991187036f, 0.991347313f, 0.9915061f, 0.991663456f, 0.991819382f, 0.991973817f,
+    0.992126822f, 0.992278397f, 0.992428482f, 0.992577136f, 0.992724299f, 0.992869973f, 0.993014276f, 0.993157089f,
+    0.993298411f, 0.993438303f, 0.993576705f, 0.993713677f, 0.993849158f, 0.993983209f, 0.99411577f, 0.9942469f,
+    0.99437654f, 0.99450469f, 0.99463141f, 0.994756639f, 0.994880438f, 0.995002747f, 0.995123625f, 0.995242953f,
+    0.995360911f, 0.995477319f, 0.995592296f, 0.995705783f, 0.99581784f, 0.995928347f, 0.996037483f, 0.99614507f,
+    0.996251225f, 0.996355891f, 0.996459067f, 0.996560752f, 0.996661007f, 0.996759772f, 0.996857107f, 0.996952891f,
+    0.997047246f, 0.99714011f, 0.997231483f, 0.997321367f, 0.997409821f, 0.997496784f, 0.997582257f, 0.99766624f,
+    0.997748733f, 0.997829795f, 0.997909307f, 0.99798739f, 0.998063982f, 0.998139083f, 0.998212695f, 0.998284876f,
+    0.998355508f, 0.998424709f, 0.99849242f, 0.998558581f, 0.998623312f, 0.998686552f, 0.998748362f, 0.998808622f,
+    0.998867393f, 0.998924732f, 0.998980522f, 0.999034882f, 0.999087691f, 0.999139071f, 0.99918896f, 0.999237359f,
+    0.999284267f, 0.999329686f, 0.999373615f, 0.999416053f, 0.999457002f, 0.99949646f, 0.999534428f, 0.999570966f,
+    0.999605954f, 0.999639452f, 0.999671459f, 0.999702036f, 0.999731064f, 0.999758601f, 0.999784708f, 0.999809265f,
+    0.999832392f, 0.999853969f, 0.999874115f, 0.999892712f, 0.999909878f, 0.999925494f, 0.99993968f, 0.999952316f,
+    0.999963522f, 0.999973178f, 0.999981403f, 0.999988079f, 0.999993324f, 0.99999702f, 0.999999285f, 1.0f,
+    0.999999285f, 0.99999702f, 0.999993324f, 0.999988079f, 0.999981403f, 0.999973178f, 0.999963522f, 0.999952316f,
+    0.99993968f, 0.999925494f, 0.999909878f, 0.999892712f, 0.999874115f, 0.999853969f, 0.999832392f, 0.999809265f,
+    0.999784708f, 0.999758601f, 0.999731064f, 0.999702036f, 0.999671459f, 0.999639452f, 0.999605954f, 0.999570966f,
+    0.999534428f, 0.99949646f, 0.999457002f, 0.999416053f, 0.999373615f, 0.999329686f, 0.999284267f, 0.999237359f,
+    0.99918896f, 0.999139071f, 0.999087691f, 0.999034882f, 0.998980522f, 0.998924732f, 0.998867393f, 0.998808622f,
+    0.998748362f, 0.998686552f, 0.998623312f, 0.998558581f, 0.99849242f, 0.998424709f, 0.998355508f, 0.998284876f,
+    0.998212695f, 0.998139083f, 0.998063982f, 0.99798739f, 0.997909307f, 0.997829795f, 0.997748733f, 0.99766624f,
+    0.997582257f, 0.997496784f, 0.997409821f, 0.997321367f, 0.997231483f, 0.99714011f, 0.997047246f, 0.996952891f,
+    0.996857107f, 0.996759772f, 0.996661007f, 0.996560752f, 0.996459067f, 0.996355891f, 0.996251225f, 0.99614507f,
+    0.996037483f, 0.995928347f, 0.99581784f, 0.995705783f, 0.995592296f, 0.995477319f, 0.995360911f, 0.995242953f,
+    0.995123625f, 0.995002747f, 0.994880438f, 0.994756639f, 0.99463141f, 0.99450469f, 0.99437654f, 0.9942469f,
+    0.99411577f, 0.993983209f, 0.993849158f, 0.993713677f, 0.993576705f, 0.993438303f, 0.993298411f, 0.993157089f,
+    0.993014276f, 0.992869973f, 0.992724299f, 0.992577136f, 0.992428482f, 0.992278397f, 0.992126822f, 0.991973817f,
+    0.991819382f, 0.991663456f, 0.9915061f, 0.991347313f, 0.991187036f, 0.991025329f, 0.990862131f, 0.990697503f,
+    0.990531445f, 0.990363955f, 0.990194976f, 0.990024567f, 0.989852726f, 0.989679456f, 0.989504695f, 0.989328504f,
+    0.989150882f, 0.988971829f, 0.988791287f, 0.988609374f, 0.98842597f, 0.988241136f, 0.988054872f, 0.987867177f,
+    0.987678051f, 0.987487435f, 0.987295449f, 0.987102032f, 0.986907125f, 0.986710846f, 0.986513078f, 0.986313939f,
+    0.98611331f, 0.98591131f, 0.985707879f, 0.985502958f, 0.985296667f, 0.985088944f, 0.984879792f, 0.984669209f,
+    0.984457195f, 0.98424381f, 0.984028935f, 0.98381269f, 0.983595014f, 0.983375907f, 0.983155429f, 0.982933462f,
+    0.982710123f, 0.982485414f, 0.982259214f, 0.982031643f, 0.981802642f, 0.98157227f, 0.981340468f, 0.981107235f,
+    0.980872631f, 0.980636597f, 0.980399191f, 0.980160356f, 0.979920149f, 0.979678512f, 0.979435444f, 0.979191065f,
+    0.978945196f, 0.978697956f, 0.978449345f, 0.978199363f, 0.97794795f, 0.977695167f, 0.977440953f, 0.977185369f,
+    0.976928413f, 0.976670027f, 0.97641027f, 0.976149142f, 0.975886643f, 0.975622714f, 0.975357473f, 0.975090802f,
+    0.97482276f, 0.974553347f, 0.974282563f, 0.974010348f, 0.973736823f, 0.973461926f, 0.973185599f, 0.97290796f,
+    0.972628891f, 0.972348511f, 0.9720667f, 0.971783578f, 0.971499085f, 0.971213222f, 0.970925987f, 0.970637381f,
+    0.970347464f, 0.970056117f, 0.969763458f, 0.969469428f, 0.969174027f, 0.968877316f, 0.968579233f, 0.968279779f,
+    0.967979014f, 0.967676878f, 0.967373371f, 0.967068553f, 0.966762364f, 0.966454864f, 0.966145992f, 0.96583581f,
+    0.965524256f, 0.965211391f, 0.964897156f, 0.964581609f, 0.96426475f, 0.963946521f, 0.963626981f, 0.963306129f,
+    0.962983906f, 0.962660372f, 0.962335527f, 0.96200937f, 0.961681843f, 0.961353064f, 0.961022913f, 0.960691452f,
+    0.960358679f, 0.960024595f, 0.95968914f, 0.959352434f, 0.959014416f, 0.958675086f, 0.958334446f, 0.957992494f,
+    0.957649231f, 0.957304657f, 0.95695883f, 0.956611633f, 0.956263185f, 0.955913424f, 0.955562353f, 0.95521003f,
+    0.954856396f, 0.95450145f, 0.954145193f, 0.953787684f, 0.953428924f, 0.953068793f, 0.952707469f, 0.952344775f,
+    0.951980889f, 0.951615632f, 0.951249182f, 0.950881422f, 0.95051235f, 0.950142086f, 0.94977051f, 0.949397624f,
+    0.949023485f, 0.948648155f, 0.948271453f, 0.94789356f, 0.947514415f, 0.947133958f, 0.94675225f, 0.94636935f,
+    0.945985138f, 0.945599675f, 0.94521296f, 0.944824994f, 0.944435835f, 0.944045365f, 0.943653643f, 0.943260729f,
+    0.942866564f, 0.942471147f, 0.942074478f, 0.941676557f, 0.941277444f, 0.94087708f, 0.940475464f, 0.940072656f,
+    0.939668596f, 0.939263344f, 0.93885684f, 0.938449144f, 0.938040197f, 0.937629998f, 0.937218666f, 0.936806023f,
+    0.936392248f, 0.935977221f, 0.935561001f, 0.93514353f, 0.934724927f, 0.934305072f, 0.933884025f, 0.933461785f,
+    0.933038294f, 0.932613671f, 0.932187796f, 0.931760788f, 0.931332529f, 0.930903137f, 0.930472493f, 0.930040717f,
+    0.929607689f, 0.929173529f, 0.928738177f, 0.928301692f, 0.927863955f, 0.927425086f, 0.926985025f, 0.926543832f,
+    0.926101446f, 0.925657868f, 0.925213099f, 0.924767256f, 0.924320161f, 0.923871934f, 0.923422575f, 0.922972023f,
+    0.922520339f, 0.922067523f, 0.921613514f, 0.921158373f, 0.9207021f, 0.920244694f, 0.919786096f, 0.919326365f,
+    0.918865502f, 0.918403506f, 0.917940378f, 0.917476118f, 0.917010725f, 0.916544199f, 0.916076541f, 0.91560781f,
+    0.915137887f, 0.914666831f, 0.914194703f, 0.913721442f, 0.913247049f, 0.912771583f, 0.912294984f, 0.911817253f,
+    0.911338449f, 0.910858512f, 0.910377502f, 0.90989536f, 0.909412146f, 0.908927798f, 0.908442378f, 0.907955825f,
+    0.907468259f, 0.906979561f, 0.90648973f, 0.905998886f, 0.905506909f, 0.905013859f, 0.904519737f, 0.904024541f,
+    0.903528273f, 0.903030932f, 0.902532518f, 0.902033031f, 0.901532531f, 0.901030898f, 0.900528193f, 0.900024474f,
+    0.899519682f, 0.899013817f, 0.89850688f, 0.897998929f, 0.897489905f, 0.896979868f, 0.896468759f, 0.895956635f,
+    0.895443439f, 0.894929171f, 0.894413948f, 0.893897653f, 0.893380284f, 0.892861903f, 0.892342508f, 0.8918221f,
+    0.891300678f, 0.890778184f, 0.890254676f, 0.889730215f, 0.889204681f, 0.888678133f, 0.888150573f, 0.887621999f,
+    0.887092471f, 0.886561871f, 0.886030316f, 0.885497749f, 0.884964168f, 0.884429574f, 0.883894026f, 0.883357465f,
+    0.882819891f, 0.882281363f, 0.881741822f, 0.881201327f, 0.880659878f, 0.880117416f, 0.879573941f, 0.879029572f,
+    0.87848419f, 0.877937794f, 0.877390504f, 0.876842201f, 0.876292944f, 0.875742733f, 0.875191569f, 0.874639452f,
+    0.87408632f, 0.873532295f, 0.872977316f, 0.872421384f, 0.871864498f, 0.871306717f, 0.870747924f, 0.870188236f,
+    0.869627595f, 0.86906606f, 0.868503571f, 0.867940128f, 0.867375731f, 0.866810501f, 0.866244256f, 0.865677178f,
+    0.865109086f, 0.86454016f, 0.86397028f, 0.863399506f, 0.862827837f, 0.862255216f, 0.8616817f, 0.861107349f,
+    0.860532045f, 0.859955847f, 0.859378755f, 0.858800769f, 0.858221889f, 0.857642114f, 0.857061446f, 0.856479943f,
+    0.855897546f, 0.855314255f, 0.85473007f, 0.85414505f, 0.853559136f, 0.852972329f, 0.852384686f, 0.85179615f,
+    0.851206779f, 0.850616574f, 0.850025475f, 0.849433541f, 0.848840714f, 0.848247051f, 0.847652555f, 0.847057223f,
+    0.846461058f, 0.845863998f, 0.845266163f, 0.844667435f, 0.844067931f, 0.843467534f, 0.842866361f, 0.842264354f,
+    0.841661513f, 0.841057837f, 0.840453327f, 0.839848042f, 0.839241922f, 0.838634968f, 0.838027239f, 0.837418675f,
+    0.836809337f, 0.836199164f, 0.835588217f, 0.834976494f, 0.834363937f, 0.833750606f, 0.833136439f, 0.832521498f,
+    0.831905842f, 0.831289351f, 0.830672026f, 0.830053985f, 0.82943517f, 0.828815579f, 0.828195214f, 0.827574074f,
+    0.826952159f, 0.82632947f, 0.825706065f, 0.825081885f, 0.82445693f, 0.823831201f, 0.823204756f, 0.822577536f,
+    0.821949601f, 0.821320891f, 0.820691466f, 0.820061326f, 0.819430411f, 0.818798721f, 0.818166375f, 0.817533255f,
+    0.816899419f, 0.816264868f, 0.815629542f, 0.81499356f, 0.814356863f, 0.813719392f, 0.813081264f, 0.812442422f,
+    0.811802804f, 0.811162531f, 0.810521603f, 0.809879899f, 0.80923754f, 0.808594465f, 0.807950675f, 0.80730623f,
+    0.806661129f, 0.806015253f, 0.805368781f, 0.804721594f, 0.804073691f, 0.803425193f, 0.802775919f, 0.80212605f,
+    0.801475525f, 0.800824285f, 0.800172389f, 0.799519837f, 0.79886663f, 0.798212767f, 0.797558248f, 0.796903133f,
+    0.796247303f, 0.795590818f, 0.794933736f, 0.794275999f, 0.793617606f, 0.792958617f, 0.792298973f, 0.791638672f,
+    0.790977776f, 0.790316224f, 0.789654076f, 0.788991272f, 0.788327873f, 0.787663877f, 0.786999285f, 0.786334038f,
+    0.785668194f, 0.785001755f, 0.78433466f, 0.783667028f, 0.782998741f, 0.782329917f, 0.781660438f, 0.780990422f,
+    0.78031981f, 0.779648602f, 0.778976798f, 0.778304458f, 0.777631462f, 0.776957929f, 0.77628386f, 0.775609195f,
+    0.774933934f, 0.774258137f, 0.773581743f, 0.772904813f, 0.772227347f, 0.771549284f, 0.770870686f, 0.77019155f,
+    0.769511878f, 0.768831611f, 0.768150806f, 0.767469525f, 0.766787648f, 0.766105235f, 0.765422285f, 0.764738858f,
+    0.764054835f, 0.763370335f, 0.762685299f, 0.761999726f, 0.761313617f, 0.760627031f, 0.759939909f, 0.75925231f,
+    0.758564174f, 0.757875562f, 0.757186413f, 0.756496787f, 0.755806625f, 0.755115986f, 0.75442487f, 0.753733277f,
+    0.753041148f, 0.752348542f, 0.751655459f, 0.750961959f, 0.750267923f, 0.74957341f, 0.748878419f, 0.748182952f,
+    0.747487068f, 0.746790648f, 0.74609381f, 0.745396495f, 0.744698763f, 0.744000494f, 0.743301868f, 0.742602706f,
+    0.741903126f, 0.741203129f, 0.740502656f, 0.739801764f, 0.739100456f, 0.738398671f, 0.737696469f, 0.73699379f,
+    0.736290753f, 0.735587239f, 0.734883368f, 0.73417902f, 0.733474255f, 0.732769072f, 0.732063532f, 0.731357515f,
+    0.73065114f, 0.729944289f, 0.72923708f, 0.728529513f, 0.727821469f, 0.727113068f, 0.726404309f, 0.725695133f,
+    0.72498554f, 0.724275589f, 0.723565221f, 0.722854495f, 0.722143412f, 0.721431971f, 0.720720112f, 0.720007896f,
+    0.719295323f, 0.718582332f, 0.717869043f, 0.717155337f, 0.716441333f, 0.715726912f, 0.715012193f, 0.714297116f,
+    0.713581681f, 0.712865889f, 0.712149739f, 0.711433291f, 0.710716486f, 0.709999323f, 0.709281862f, 0.708564043f,
+    0.707845867f, 0.707127452f, 0.70640862f, 0.705689549f, 0.704970121f, 0.704250395f, 0.703530312f, 0.70280993f,
+    0.70208925f, 0.701368272f, 0.700646996f, 0.699925423f, 0.699203551f, 0.698481381f, 0.697758913f, 0.697036147f,
+    0.696313083f, 0.695589721f, 0.694866121f, 0.694142222f, 0.693418026f, 0.692693532f, 0.691968799f, 0.691243827f,
+    0.690518498f, 0.689792991f, 0.689067185f, 0.688341081f, 0.687614739f, 0.686888158f, 0.686161339f, 0.685434222f,
+    0.684706867f, 0.683979332f, 0.683251441f, 0.68252337f, 0.681795061f, 0.681066513f, 0.680337727f, 0.679608703f,
+    0.67887944f, 0.678149939f, 0.677420259f, 0.67669034f, 0.675960183f, 0.675229788f, 0.674499214f, 0.673768401f,
+    0.67303741f, 0.67230618f, 0.671574712f, 0.670843124f, 0.670111299f, 0.669379234f, 0.668646991f, 0.667914569f,
+    0.667181969f, 0.666449189f, 0.665716171f, 0.664983034f, 0.664249659f, 0.663516104f, 0.662782371f, 0.662048519f,
+    0.661314428f, 0.660580218f, 0.659845829f, 0.659111261f, 0.658376515f, 0.65764159f, 0.656906545f, 0.656171381f,
+    0.655435979f, 0.654700458f, 0.653964818f, 0.653228998f, 0.65249306f, 0.651756942f, 0.651020706f, 0.65028435f,
+    0.649547875f, 0.648811221f, 0.648074448f, 0.647337556f, 0.646600544f, 0.645863354f, 0.645126104f, 0.644388735f,
+    0.643651247f, 0.64291358f, 0.642175853f, 0.641438067f, 0.640700102f, 0.639962077f, 0.639223874f, 0.63848567f,
+    0.637747288f, 0.637008846f, 0.636270344f, 0.635531664f, 0.634792984f, 0.634054184f, 0.633315265f, 0.632576346f,
+    0.631837249f, 0.631098151f, 0.630358934f, 0.629619658f, 0.628880322f, 0.628140926f, 0.627401471f, 0.626661897f,
+    0.625922322f, 0.625182629f, 0.624442935f, 0.623703182f, 0.622963369f, 0.622223496f, 0.621483564f, 0.620743632f,
+    0.620003581f, 0.61926353f, 0.618523479f, 0.617783368f, 0.617043197f, 0.616303027f, 0.615562797f, 0.614822567f,
+    0.614082277f, 0.613341987f, 0.612601697f, 0.611861348f, 0.611120999f, 0.61038065f, 0.6096403f, 0.608899891f,
+    0.608159542f, 0.607419133f, 0.606678724f, 0.605938315f, 0.605197966f, 0.604457557f, 0.603717208f, 0.602976799f,
+    0.60223645f, 0.6014961f, 0.600755751f, 0.600015461f, 0.599275172f, 0.598534882f, 0.597794592f, 0.597054362f,
+    0.596314192f, 0.595574021f, 0.594833851f, 0.5940938f, 0.593353689f, 0.592613697f, 0.591873705f, 0.591133773f,
+    0.590393841f, 0.589654028f, 0.588914216f, 0.588174462f, 0.587434769f, 0.586695135f, 0.58595556f, 0.585216045f,
+    0.58447659f, 0.583737195f, 0.582997859f, 0.582258582f, 0.581519425f, 0.580780268f, 0.58004123f, 0.579302311f,
+    0.578563392f, 0.577824593f, 0.577085853f, 0.576347232f, 0.57560873f, 0.574870229f, 0.574131906f, 0.573393643f,
+    0.572655439f, 0.571917355f, 0.57117939f, 0.570441544f, 0.569703758f, 0.568966091f, 0.568228543f, 0.567491114f,
+    0.566753745f, 0.566016555f, 0.565279424f, 0.564542472f, 0.56380558f, 0.563068867f, 0.562332273f, 0.561595798f,
+    0.560859382f, 0.560123205f, 0.559387088f, 0.558651149f, 0.55791533f, 0.55717963f, 0.556444108f, 0.555708706f,
+    0.554973423f, 0.554238319f, 0.553503394f, 0.552768588f, 0.552033901f, 0.551299393f, 0.550565064f, 0.549830914f,
+    0.549096882f, 0.54836303f, 0.547629297f, 0.546895802f, 0.546162426f, 0.54542923f, 0.544696212f, 0.543963373f,
+    0.543230712f, 0.542498231f, 0.541765928f, 0.541033804f, 0.540301859f, 0.539570093f, 0.538838506f, 0.538107157f,
+    0.537375987f, 0.536644995f, 0.535914183f, 0.535183609f, 0.534453213f, 0.533722997f, 0.532993019f, 0.532263219f,
+    0.531533659f, 0.530804276f, 0.530075133f, 0.529346168f, 0.528617442f, 0.527888894f, 0.527160645f, 0.526432514f,
+    0.525704682f, 0.524977088f, 0.524249673f, 0.523522496f, 0.522795558f, 0.522068799f, 0.521342337f, 0.520616114f,
+    0.51989007f, 0.519164324f, 0.518438756f, 0.517713487f, 0.516988456f, 0.516263664f, 0.51553911f, 0.514814794f,
+    0.514090776f, 0.513366938f, 0.512643397f, 0.511920154f, 0.51119709f, 0.510474324f, 0.509751856f, 0.509029627f,
+    0.508307636f, 0.507585943f, 0.506864488f, 0.506143332f, 0.505422413f, 0.504701853f, 0.503981471f, 0.503261447f,
+    0.502541661f, 0.501822174f, 0.501102924f, 0.500383973f, 0.49966535f, 0.498946995f, 0.498228937f, 0.497511178f,
+    0.496793687f, 0.496076494f, 0.495359629f, 0.494643033f, 0.493926734f, 0.493210763f, 0.49249509f, 0.491779715f,
+    0.491064638f, 0.490349889f, 0.489635438f, 0.488921285f, 0.488207459f, 0.487493962f, 0.486780763f, 0.486067921f,
+    0.485355347f, 0.484643131f, 0.483931243f, 0.483219653f, 0.482508421f, 0.481797487f, 0.48108691f, 0.480376631f,
+    0.47966671f, 0.478957117f, 0.478247881f, 0.477538973f, 0.476830393f, 0.476122171f, 0.475414276f, 0.474706739f,
+    0.47399953f, 0.473292708f, 0.472586215f, 0.471880049f, 0.47117427f, 0.470468819f, 0.469763756f, 0.46905902f,
+    0.468354672f, 0.467650652f, 0.466947019f, 0.466243744f, 0.465540826f, 0.464838266f, 0.464136094f, 0.463434309f,
+    0.462732852f, 0.462031811f, 0.461331129f, 0.460630804f, 0.459930867f, 0.459231317f, 0.458532155f, 0.45783335f,
+};
+
+#endif  // GOERTZEL_LUT_H
@@ -0,0 +1,103 @@
+// HPSS Implementation
+// Running per-bin time medians and per-frame frequency medians (see hpss.h)
+
+#include "hpss.h"
+#include <cstring>
+
+// ============================================================================
+// INTERNAL HELPERS
+// ============================================================================
+
+// Replace `outgoing` (present in the sorted window) by `incoming`, keeping it sorted
+static void sorted_replace(float* window, uint8_t count, float outgoing, float incoming) {
+	uint8_t pos = 0;
+	while (pos < count - 1 && window[pos] != outgoing) {
+		pos++;
+	}
+	// Slide toward the side incoming belongs to, then drop it in
+	while (pos > 0 && window[pos - 1] > incoming) {
+		window[pos] = window[pos - 1];
+		pos--;
+	}
+	while (pos < count - 1 && window[pos + 1] < incoming) {
+		window[pos] = window[pos + 1];
+		pos++;
+	}
+	window[pos] = incoming;
+}
+
+static void sorted_insert(float* window, uint8_t count, float incoming) {
+	uint8_t pos = count;
+	while (pos > 0 && window[pos - 1] > incoming) {
+		window[pos] = window[pos - 1];
+		pos--;
+	}
+	window[pos] = incoming;
+}
+
+// Median of a bin's window (mean of the middle pair while the count is even)
+static float window_median(const float* window, uint8_t count) {
+	if (count == 0) {
+		return 0.0f;
+	}
+	const uint8_t mid = count / 2;
+	return (count & 1) ? window[mid] : 0.5f * (window[mid - 1] + window[mid]);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void hpss_init(HpssState* state, uint16_t num_bins) {
+	memset(state, 0, sizeof(HpssState));
+	state->num_bins = (num_bins > HPSS_MAX_BINS) ? HPSS_MAX_BINS : num_bins;
+}
+
+void hpss_process(HpssState* state, const float* frame, float* percussive_mask,
+                  float* percussive_energy, float* harmonic_energy) {
+	const uint16_t n = state->num_bins;
+
+	// Running time medians: the oldest frame leaves once the window is full
+	float* row = state->history[state->head];
+	for (uint16_t i = 0; i < n; i++) {
+		if (state->count == HPSS_TIME_FRAMES) {
+			sorted_replace(state->sorted[i], HPSS_TIME_FRAMES, row[i], frame[i]);
+		}
+		else {
+			sorted_insert(state->sorted[i], state->count, frame[i]);
+		}
+		row[i] = frame[i];
+	}
+	state->head = (state->head + 1 == HPSS_TIME_FRAMES) ? 0 : state->head + 1;
+	if (state->count < HPSS_TIME_FRAMES) {
+		state->count++;
+	}
+
+	float percussive_sum = 0.0f;
+	float harmonic_sum = 0.0f;
+	for (uint16_t i = 0; i < n; i++) {
+		// Frequency median of the current frame (insertion sort of HPSS_FREQ_BINS values)
+		float neighbours[HPSS_FREQ_BINS];
+		for (int8_t k = 0; k < HPSS_FREQ_BINS; k++) {
+			int32_t j = (int32_t)i + k - HPSS_FREQ_BINS / 2;
+			j = (j < 0) ? 0 : (j >= n ? n - 1 : j);
+			sorted_insert(neighbours, k, frame[j]);
+		}
+		const float p = neighbours[HPSS_FREQ_BINS / 2];
+		const float h = window_median(state->sorted[i], state->count);
+
+		const float p2 = p * p;
+		const float total = p2 + h * h;
+		const float mask = (total > 1e-12f) ? p2 / total : 0.0f;
+		percussive_mask[i] = mask;
+		percussive_sum += frame[i] * mask;
+		harmonic_sum += frame[i] * (1.0f - mask);
+	}
+
+	*percussive_energy = (n > 0) ? percussive_sum / n : 0.0f;
+	*harmonic_energy = (n > 0) ? harmonic_sum / n : 0.0f;
+}
+
+float hpss_harmonic(const HpssState* state, uint16_t bin) {
+	return window_median(state->sorted[bin], state->count);
+}
@@ -0,0 +1,57 @@
+// HPSS - Harmonic/percussive split of the note spectrum
+//
+// Median-filter separation (Fitzgerald 2010) on the spectrogram history:
+//   - harmonic estimate H: per-bin median over the last HPSS_TIME_FRAMES
+//     frames (sustained partials survive, short bursts are rejected)
+//   - percussive estimate P: median over HPSS_FREQ_BINS neighbouring bins of
+//     the current frame (broadband hits survive, isolated partials are rejected)
+//   - soft mask: a bin's percussive share is P^2 / (H^2 + P^2)
+//
+// The time median is a running one: each bin keeps its window sorted, so a
+// frame costs one delete and one insert per bin (O(HPSS_TIME_FRAMES)) instead
+// of a sort. Until the window fills, the median covers the frames seen.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef HPSS_H
+#define HPSS_H
+
+#include <stdint.h>
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define HPSS_MAX_BINS 64
+#define HPSS_TIME_FRAMES 9        // Harmonic median length (odd; 180 ms at the 50 Hz novelty rate)
+#define HPSS_FREQ_BINS 5          // Percussive median length (odd; edges replicate)
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	float sorted[HPSS_MAX_BINS][HPSS_TIME_FRAMES];   // Per-bin window, ascending
+	float history[HPSS_TIME_FRAMES][HPSS_MAX_BINS];  // Frames in arrival order (what leaves next)
+	uint16_t num_bins;
+	uint8_t head;                                    // History row the next frame replaces
+	uint8_t count;                                   // Frames in the window
+} HpssState;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// Empty the window for num_bins bins (<= HPSS_MAX_BINS)
+void hpss_init(HpssState* state, uint16_t num_bins);
+
+// Add one frame (non-negative magnitudes) and split it: percussive_mask[i] is
+// bin i's percussive share (0..1); the energies are the mean percussive and
+// harmonic parts (frame * mask, frame * (1 - mask)) over the bins
+void hpss_process(HpssState* state, const float* frame, float* percussive_mask,
+                  float* percussive_energy, float* harmonic_energy);
+
+// Harmonic estimate of a bin (median over the window; 0 before any frame)
+float hpss_harmonic(const HpssState* state, uint16_t bin);
+
+#endif  // HPSS_H
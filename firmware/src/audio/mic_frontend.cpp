@@ -0,0 +1,75 @@
+// Microphone Front End Implementation
+// Integer conversion pass + one folded biquad pass (see mic_frontend.h)
+
+#include "mic_frontend.h"
+#include "../dsps_helpers.h"
+#include <cmath>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static inline float convert_word(uint32_t word) {
+	int32_t v = ((int32_t)word >> MIC_FRONTEND_SHIFT) + MIC_FRONTEND_DC_TRIM;
+	if (v < -MIC_FRONTEND_CLAMP) {
+		v = -MIC_FRONTEND_CLAMP;
+	} else if (v > MIC_FRONTEND_CLAMP) {
+		v = MIC_FRONTEND_CLAMP;
+	}
+	return (float)(v - MIC_FRONTEND_OUTPUT_BIAS);
+}
+
+// ============================================================================
+// API
+// ============================================================================
+
+void mic_frontend_init(MicFrontend* fe, float sample_rate_hz, float dc_cutoff_hz, float gain) {
+	fe->scale = gain * (float)(1.0 / MIC_FRONTEND_CLAMP);
+	fe->dc_block = (dc_cutoff_hz > 0.0f && sample_rate_hz > 0.0f);
+
+	// One-pole high-pass: zero at DC, pole at R just inside the unit circle
+	const float pole = fe->dc_block ? (float)exp(-2.0 * M_PI * dc_cutoff_hz / sample_rate_hz) : 0.0f;
+	fe->coef[0] = fe->scale;
+	fe->coef[1] = fe->dc_block ? -fe->scale : 0.0f;
+	fe->coef[2] = 0.0f;
+	fe->coef[3] = -pole;
+	fe->coef[4] = 0.0f;
+	mic_frontend_reset(fe);
+}
+
+void mic_frontend_reset(MicFrontend* fe) {
+	fe->w[0] = 0.0f;
+	fe->w[1] = 0.0f;
+}
+
+void mic_frontend_process(MicFrontend* fe, const uint32_t* words, float* out, uint32_t count) {
+	// Stage 1: each word is read before its own slot is written, so out may
+	// alias words
+	uint32_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const float s0 = convert_word(words[i + 0]);
+		const float s1 = convert_word(words[i + 1]);
+		const float s2 = convert_word(words[i + 2]);
+		const float s3 = convert_word(words[i + 3]);
+		out[i + 0] = s0;
+		out[i + 1] = s1;
+		out[i + 2] = s2;
+		out[i + 3] = s3;
+	}
+	for (; i < count; i++) {
+		out[i] = convert_word(words[i]);
+	}
+
+	// Stage 2: DC blocker + scale + gain in one pass
+	if (fe->dc_block) {
+		dsps_biquad_f32_inplace(out, (int)count, fe->coef, fe->w);
+	} else {
+		dsps_mulc_f32_inplace(out, (int)count, fe->scale);
+	}
+}
+
+uint32_t mic_frontend_encode_sample(float sample) {
+	sample = fminf(fmaxf(sample, -1.0f), 1.0f);  // Full scale; beyond it the shift would wrap
+	const int32_t value = (int32_t)lroundf(sample * MIC_FRONTEND_CLAMP) + MIC_FRONTEND_OUTPUT_BIAS - MIC_FRONTEND_DC_TRIM;
+	return (uint32_t)value << MIC_FRONTEND_SHIFT;
+}
@@ -0,0 +1,70 @@
+// Microphone Front End - Fused I2S word -> float sample conversion
+//
+// Turns raw SPH0645 slot words into the -1.0..1.0 samples the DSP consumes, in
+// two tight passes over the chunk instead of one pass per stage:
+//
+//   1. Integer stage (4-way unrolled): arithmetic shift to the 18-bit sample,
+//      fixed DC trim (+7000), clamp to +/-131072, output offset (-360),
+//      int -> float. Identical to the conversion acquire_sample_chunk() has
+//      always done.
+//   2. One biquad (ESP-DSP dsps_biquad_f32, scalar fallback in dsps_helpers.h)
+//      with the 1/131072 scale and input gain folded into its numerator, so
+//      the DC blocker, scale and gain cost a single filter pass:
+//          H(z) = k * (1 - z^-1) / (1 - R z^-1),   k = gain / 131072
+//      With the DC blocker disabled the pass is a plain multiply by k, which
+//      is bit-exact with the original conversion at unity gain.
+//
+// The fixed trim only cancels the typical SPH0645 offset; the one-pole
+// high-pass removes the per-unit residual so VU and novelty floors see no DC.
+//
+// Words and output may alias (in-place conversion of a DMA buffer).
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef MIC_FRONTEND_H
+#define MIC_FRONTEND_H
+
+#include <stdint.h>
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define MIC_FRONTEND_SHIFT        14        // 32-bit slot -> 18-bit sample
+#define MIC_FRONTEND_DC_TRIM      7000      // Fixed SPH0645 offset correction (counts)
+#define MIC_FRONTEND_CLAMP        131072    // 2^17, full scale of the 18-bit sample
+#define MIC_FRONTEND_OUTPUT_BIAS  360       // Post-clamp offset (counts)
+
+#define MIC_FRONTEND_DC_CUTOFF_HZ 3.0f      // Default DC blocker corner
+#define MIC_FRONTEND_GAIN         1.0f      // Default input gain
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	float coef[5];        // Biquad {b0, b1, b2, a1, a2}; scale and gain folded into b0/b1
+	float w[2];           // Direct form II state, carried across chunks
+	float scale;          // gain / 131072
+	bool dc_block;        // false: stage 2 is a plain multiply by scale
+} MicFrontend;
+
+// ============================================================================
+// API
+// ============================================================================
+
+// Configure for sample_rate_hz. dc_cutoff_hz <= 0 disables the DC blocker.
+// Clears the filter state.
+void mic_frontend_init(MicFrontend* fe, float sample_rate_hz, float dc_cutoff_hz, float gain);
+
+// Clear the DC blocker state (the next chunk settles from zero)
+void mic_frontend_reset(MicFrontend* fe);
+
+// Convert count raw slot words to samples; out may alias words
+void mic_frontend_process(MicFrontend* fe, const uint32_t* words, float* out, uint32_t count);
+
+// Slot word that the integer stage and a unity-gain scale turn back into
+// sample (to within one 18-bit step). For sources that synthesize I2S words
+// from PCM: WAV files, UDP, host tests. The DC blocker is not inverted.
+uint32_t mic_frontend_encode_sample(float sample);
+
+#endif  // MIC_FRONTEND_H
@@ -7,6 +7,28 @@
 #include <cstring>
 #include <cmath>
 
+#if MICROPHONE_DMA_CAPTURE
+#  include <freertos/FreeRTOS.h>
+#  include <freertos/task.h>
+#  if __has_include(<esp_idf_version.h>)
+#    include <esp_idf_version.h>
+#  endif
+// IDF 5.4 added event->dma_buf; earlier versions only have the secondary pointer
+#  define MICROPHONE_I2S_EVENT_HAS_DMA_BUF 0
+#  ifdef ESP_IDF_VERSION_VAL
+#    if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 4, 0)
+#      undef MICROPHONE_I2S_EVENT_HAS_DMA_BUF
+#      define MICROPHONE_I2S_EVENT_HAS_DMA_BUF 1
+#    endif
+#  endif
+#endif
+
+// Front-end conversion state (DC blocker carries across chunks)
+MicFrontend mic_frontend;
+#if AUDIO_CAPTURE_RESAMPLED
+PolyphaseDecimator mic_decimator;  // Capture rate -> analysis rate
+#endif
+
 // Synchronization flags for microphone I2S ISR coordination
 std::atomic<bool> waveform_locked{false};
 std::atomic<bool> waveform_sync_flag{false};
@@ -26,23 +48,139 @@ I2STimeoutState i2s_timeout_state = {
     .last_error_code = ERR_OK,
     .in_fallback_mode = false,
     .fallback_start_time_ms = 0,
+    .dma_overrun_count = 0,
 };
 
 const I2STimeoutState& get_i2s_timeout_state() {
     return i2s_timeout_state;
 }
 
+// ============================================================================
+// DMA CAPTURE (zero-copy handoff)
+// ============================================================================
+// on_recv runs in the I2S ISR each time a DMA descriptor fills. It queues the
+// descriptor's buffer pointer with its completion number and notifies the
+// capturing task. The driver keeps cycling the ring, so a queued buffer stays
+// intact only until MICROPHONE_DMA_DESC_NUM - 1 further completions; older
+// entries are skipped as overruns. A fresh buffer is converted in place and
+// copied into sample_history within microseconds of being dequeued, far
+// inside the one-chunk window before DMA could reach it again.
+#if MICROPHONE_DMA_CAPTURE
+
+struct DmaChunk {
+    uint32_t* words;
+    uint32_t completion;
+};
+
+static constexpr uint32_t DMA_QUEUE_SLOTS = 8;  // power of two > MICROPHONE_DMA_DESC_NUM
+static_assert((DMA_QUEUE_SLOTS & (DMA_QUEUE_SLOTS - 1)) == 0, "DMA_QUEUE_SLOTS must be a power of two");
+static_assert(DMA_QUEUE_SLOTS > MICROPHONE_DMA_DESC_NUM, "DMA queue must cover the descriptor ring");
+
+static DmaChunk s_dma_queue[DMA_QUEUE_SLOTS];
+static std::atomic<uint32_t> s_dma_head{0};         // Written by the ISR
+static std::atomic<uint32_t> s_dma_tail{0};         // Written by the capturing task
+static std::atomic<uint32_t> s_dma_completions{0};  // Descriptors completed so far
+static std::atomic<uint32_t> s_dma_dropped{0};      // Queue-full or wrong-size drops (ISR side)
+static std::atomic<TaskHandle_t> s_dma_waiter{nullptr};
+static bool s_dma_capture_active = false;
+
+static bool IRAM_ATTR on_i2s_recv(i2s_chan_handle_t handle, i2s_event_data_t* event, void* user_ctx) {
+    (void)handle;
+    (void)user_ctx;
+    const uint32_t completion = s_dma_completions.fetch_add(1, std::memory_order_relaxed) + 1;
+#if MICROPHONE_I2S_EVENT_HAS_DMA_BUF
+    uint32_t* words = static_cast<uint32_t*>(event->dma_buf);
+#else
+    uint32_t* words = *static_cast<uint32_t**>(event->data);  // Secondary pointer to the descriptor buffer
+#endif
+
+    const uint32_t head = s_dma_head.load(std::memory_order_relaxed);
+    if (event->size != AUDIO_CAPTURE_CHUNK_SIZE * sizeof(uint32_t) ||
+        head - s_dma_tail.load(std::memory_order_acquire) >= DMA_QUEUE_SLOTS) {
+        s_dma_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    s_dma_queue[head & (DMA_QUEUE_SLOTS - 1)] = {words, completion};
+    s_dma_head.store(head + 1, std::memory_order_release);
+
+    BaseType_t woken = pdFALSE;
+    TaskHandle_t waiter = s_dma_waiter.load(std::memory_order_acquire);
+    if (waiter != nullptr) {
+        vTaskNotifyGiveFromISR(waiter, &woken);
+    }
+    return woken == pdTRUE;
+}
+
+// Dequeue the oldest buffer DMA has not yet reused; ESP_ERR_TIMEOUT if none
+// arrives within timeout_ticks. Stale entries count as overruns.
+static esp_err_t dma_take_chunk(uint32_t** words, TickType_t timeout_ticks) {
+    s_dma_waiter.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+    i2s_timeout_state.dma_overrun_count += s_dma_dropped.exchange(0, std::memory_order_relaxed);
+    for (;;) {
+        uint32_t tail = s_dma_tail.load(std::memory_order_relaxed);
+        while (tail != s_dma_head.load(std::memory_order_acquire)) {
+            const DmaChunk chunk = s_dma_queue[tail & (DMA_QUEUE_SLOTS - 1)];
+            s_dma_tail.store(++tail, std::memory_order_release);
+            const uint32_t age = s_dma_completions.load(std::memory_order_relaxed) - chunk.completion;
+            if (age < MICROPHONE_DMA_DESC_NUM - 1) {
+                *words = chunk.words;
+                return ESP_OK;
+            }
+            i2s_timeout_state.dma_overrun_count++;
+        }
+        if (ulTaskNotifyTake(pdTRUE, timeout_ticks) == 0) {
+            return ESP_ERR_TIMEOUT;
+        }
+    }
+}
+
+// Discard queued buffers (audio reactivity disabled)
+static void dma_drain() {
+    s_dma_tail.store(s_dma_head.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+#endif  // MICROPHONE_DMA_CAPTURE
+
+bool microphone_dma_capture_active() {
+#if MICROPHONE_DMA_CAPTURE
+    return s_dma_capture_active;
+#else
+    return false;
+#endif
+}
+
+static void init_capture_chain() {
+    mic_frontend_init(&mic_frontend, AUDIO_CAPTURE_RATE_HZ, MIC_FRONTEND_DC_CUTOFF_HZ, MIC_FRONTEND_GAIN);
+#if AUDIO_CAPTURE_RESAMPLED
+    // Fails only for capture rates the prototype filter cannot split into phases
+    const bool decimator_ok = polyphase_decimator_init(&mic_decimator, AUDIO_CAPTURE_RATE_HZ,
+                                                       AUDIO_SAMPLE_RATE_HZ, AUDIO_CHUNK_SIZE);
+    if (!decimator_ok) {
+        LOG_ERROR(TAG_I2S, "[ERR_%d] No polyphase decimator for %u -> %u Hz",
+            ERR_I2S_CONFIG_INVALID, (unsigned)AUDIO_CAPTURE_RATE_HZ, (unsigned)AUDIO_SAMPLE_RATE_HZ);
+    }
+    ESP_ERROR_CHECK(decimator_ok ? ESP_OK : ESP_ERR_INVALID_ARG);
+#endif
+}
+
 #if MICROPHONE_USE_NEW_I2S
 
 // I2S RX channel handle (new ESP-IDF v5 API)
 i2s_chan_handle_t rx_handle = nullptr;
 
 void init_i2s_microphone() {
+    init_capture_chain();
+
     i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
+#if MICROPHONE_DMA_CAPTURE
+    // One descriptor per chunk: stereo 32-bit frames carry two slot words
+    chan_cfg.dma_desc_num = MICROPHONE_DMA_DESC_NUM;
+    chan_cfg.dma_frame_num = AUDIO_CAPTURE_CHUNK_SIZE / 2;
+#endif
     ESP_ERROR_CHECK(i2s_new_channel(&chan_cfg, NULL, &rx_handle));
 
     i2s_std_config_t std_cfg = {
-        .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(AUDIO_SAMPLE_RATE_HZ),
+        .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(AUDIO_CAPTURE_RATE_HZ),
         .slot_cfg = {
             .data_bit_width = I2S_DATA_BIT_WIDTH_32BIT,
             .slot_bit_width = I2S_SLOT_BIT_WIDTH_32BIT,
@@ -70,6 +208,16 @@ void init_i2s_microphone() {
     };
 
     ESP_ERROR_CHECK(i2s_channel_init_std_mode(rx_handle, &std_cfg));
+
+#if MICROPHONE_DMA_CAPTURE
+    i2s_event_callbacks_t callbacks = {};
+    callbacks.on_recv = on_i2s_recv;
+    s_dma_capture_active = (i2s_channel_register_event_callback(rx_handle, &callbacks, nullptr) == ESP_OK);
+    if (!s_dma_capture_active) {
+        LOG_WARN(TAG_I2S, "DMA receive callback unavailable, using blocking reads");
+    }
+#endif
+
     ESP_ERROR_CHECK(i2s_channel_enable(rx_handle));
 }
 
@@ -78,9 +226,11 @@ void init_i2s_microphone() {
 static constexpr i2s_port_t I2S_PORT = I2S_NUM_0;
 
 void init_i2s_microphone() {
+    init_capture_chain();
+
     i2s_config_t i2s_config = {};
     i2s_config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX);
-    i2s_config.sample_rate = AUDIO_SAMPLE_RATE_HZ;
+    i2s_config.sample_rate = AUDIO_CAPTURE_RATE_HZ;
     i2s_config.bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT;
     i2s_config.channel_format = I2S_CHANNEL_FMT_ONLY_RIGHT;
     #ifdef I2S_COMM_FORMAT_STAND_I2S
@@ -90,7 +240,7 @@ void init_i2s_microphone() {
     #endif
     i2s_config.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
     i2s_config.dma_buf_count = 8;
-    i2s_config.dma_buf_len = AUDIO_CHUNK_SIZE;
+    i2s_config.dma_buf_len = AUDIO_CAPTURE_CHUNK_SIZE;
     i2s_config.use_apll = false;
     i2s_config.tx_desc_auto_clear = false;
     i2s_config.fixed_mclk = 0;
@@ -106,15 +256,56 @@ void init_i2s_microphone() {
     pin_cfg.data_out_num = I2S_PIN_NO_CHANGE;
     pin_cfg.data_in_num = I2S_DIN_PIN;
     ESP_ERROR_CHECK(i2s_set_pin(I2S_PORT, &pin_cfg));
-    ESP_ERROR_CHECK(i2s_set_clk(I2S_PORT, AUDIO_SAMPLE_RATE_HZ, I2S_BITS_PER_SAMPLE_32BIT, I2S_CHANNEL_STEREO));
+    ESP_ERROR_CHECK(i2s_set_clk(I2S_PORT, AUDIO_CAPTURE_RATE_HZ, I2S_BITS_PER_SAMPLE_32BIT, I2S_CHANNEL_STEREO));
 }
 
 #endif  // MICROPHONE_USE_NEW_I2S
 
+// ============================================================================
+// AUDIO SOURCES (audio_source.h)
+// ============================================================================
+
+// DMA handoff when the receive callback is registered, blocking read otherwise
+static esp_err_t i2s_read_chunk(void* ctx, uint32_t* scratch, uint32_t** words, uint32_t timeout_ms) {
+    (void)ctx;
+#if MICROPHONE_DMA_CAPTURE
+    if (s_dma_capture_active) {
+        return dma_take_chunk(words, pdMS_TO_TICKS(timeout_ms));
+    }
+#endif
+    size_t bytes_read = 0;
+    *words = scratch;
+#if MICROPHONE_USE_NEW_I2S
+    return i2s_channel_read(rx_handle, scratch, AUDIO_CAPTURE_CHUNK_SIZE * sizeof(uint32_t),
+                            &bytes_read, pdMS_TO_TICKS(timeout_ms));
+#else
+    return i2s_read(I2S_PORT, scratch, AUDIO_CAPTURE_CHUNK_SIZE * sizeof(uint32_t),
+                    &bytes_read, pdMS_TO_TICKS(timeout_ms));
+#endif
+}
+
+const AudioSource audio_source_i2s = {"i2s", i2s_read_chunk, nullptr};
+static std::atomic<const AudioSource*> s_audio_source{&audio_source_i2s};
+
+void audio_source_select(const AudioSource* source) {
+    const AudioSource* next = source ? source : &audio_source_i2s;
+    const AudioSource* previous = s_audio_source.exchange(next, std::memory_order_acq_rel);
+    if (previous != next) {
+        LOG_INFO(TAG_I2S, "Audio source: %s", next->name);
+    }
+}
+
+const AudioSource* audio_source_active() {
+    return s_audio_source.load(std::memory_order_acquire);
+}
+
 void acquire_sample_chunk() {
     profile_function([&]() {
-        uint32_t new_samples_raw[AUDIO_CHUNK_SIZE];
-        float new_samples[AUDIO_CHUNK_SIZE];
+        // Blocking reads, host sources and silence land in s_chunk_words; DMA
+        // capture points chunk_words at the completed descriptor instead.
+        // Either way the words are converted to float samples in place below.
+        static uint32_t s_chunk_words[AUDIO_CAPTURE_CHUNK_SIZE];
+        uint32_t* chunk_words = s_chunk_words;
 
         // ====================================================================
         // PHASE 0: I2S TIMEOUT PROTECTION & RECOVERY
@@ -124,23 +315,16 @@ void acquire_sample_chunk() {
         g_audio_input_active.store(false, std::memory_order_relaxed);
 
         if (EMOTISCOPE_ACTIVE) {
-            size_t bytes_read = 0;
             esp_err_t i2s_result = ESP_FAIL;
             uint32_t i2s_start_us = micros();
 
-            // Bounded wait: max 100ms (pdMS_TO_TICKS is FreeRTOS-safe)
-#if MICROPHONE_USE_NEW_I2S
-            i2s_result = i2s_channel_read(rx_handle,
-                                          new_samples_raw,
-                                          AUDIO_CHUNK_SIZE * sizeof(uint32_t),
-                                          &bytes_read,
-                                          pdMS_TO_TICKS(100));  // CRITICAL: 100ms max
-#else
-            i2s_result = i2s_read(I2S_PORT,
-                                   new_samples_raw,
-                                   AUDIO_CHUNK_SIZE * sizeof(uint32_t),
-                                   &bytes_read,
-                                   pdMS_TO_TICKS(100));  // CRITICAL: 100ms max
+            // Bounded wait: max 100ms
+            const AudioSource* source = audio_source_active();
+            i2s_result = source->read_chunk(source->ctx, s_chunk_words, &chunk_words, 100);  // CRITICAL: 100ms max
+#if MICROPHONE_DMA_CAPTURE
+            // Microphone chunks completed meanwhile are not wanted; dropping
+            // them keeps a later switch back from counting them as overruns
+            if (s_dma_capture_active && source != &audio_source_i2s) dma_drain();
 #endif
             uint32_t i2s_block_us = micros() - i2s_start_us;
 
@@ -180,7 +364,8 @@ void acquire_sample_chunk() {
                 }
 
                 // Always use silence on error
-                memset(new_samples_raw, 0, sizeof(new_samples_raw));
+                chunk_words = s_chunk_words;
+                memset(s_chunk_words, 0, sizeof(s_chunk_words));
             } else {
                 // Success: reset failure counter and reset error code
                 // (Watchdog feed would happen here if task WDT were configured)
@@ -198,30 +383,31 @@ void acquire_sample_chunk() {
             }
         } else {
             // Audio reactivity disabled: use silence
-            memset(new_samples_raw, 0, sizeof(new_samples_raw));
+#if MICROPHONE_DMA_CAPTURE
+            if (s_dma_capture_active) dma_drain();
+#endif
+            memset(s_chunk_words, 0, sizeof(s_chunk_words));
             i2s_timeout_state.last_error_code = ERR_OK;
             g_audio_input_active.store(false, std::memory_order_relaxed);
         }
 
-        // Convert raw samples to float with silence fallback support
-        for (uint16_t i = 0; i < AUDIO_CHUNK_SIZE; i += 4) {
-            if (use_silence_fallback || i2s_timeout_state.in_fallback_mode) {
-                // FALLBACK: output silence (zeros)
-                new_samples[i + 0] = 0.0f;
-                new_samples[i + 1] = 0.0f;
-                new_samples[i + 2] = 0.0f;
-                new_samples[i + 3] = 0.0f;
-            } else {
-                // NORMAL: convert and clamp raw samples
-                new_samples[i + 0] = min(max((((int32_t)new_samples_raw[i + 0]) >> 14) + 7000, (int32_t)-131072), (int32_t)131072) - 360;
-                new_samples[i + 1] = min(max((((int32_t)new_samples_raw[i + 1]) >> 14) + 7000, (int32_t)-131072), (int32_t)131072) - 360;
-                new_samples[i + 2] = min(max((((int32_t)new_samples_raw[i + 2]) >> 14) + 7000, (int32_t)-131072), (int32_t)131072) - 360;
-                new_samples[i + 3] = min(max((((int32_t)new_samples_raw[i + 3]) >> 14) + 7000, (int32_t)-131072), (int32_t)131072) - 360;
-            }
+        // Convert raw samples to float in place (mic_frontend: shift, trim,
+        // clamp, DC blocker, scale, gain), with silence fallback support
+        static_assert(sizeof(float) == sizeof(uint32_t), "in-place conversion needs 32-bit floats");
+        float* new_samples = reinterpret_cast<float*>(chunk_words);
+        if (use_silence_fallback || i2s_timeout_state.in_fallback_mode) {
+            // FALLBACK: output silence (zeros); DC blocker state is held so
+            // the signal resumes without a settling transient
+            memset(new_samples, 0, AUDIO_CHUNK_SIZE * sizeof(float));
+        } else {
+            mic_frontend_process(&mic_frontend, chunk_words, new_samples, AUDIO_CAPTURE_CHUNK_SIZE);
+#if AUDIO_CAPTURE_RESAMPLED
+            // Band-limit and resample to the analysis rate; the first
+            // AUDIO_CHUNK_SIZE floats of the buffer now hold the chunk
+            polyphase_decimator_process(&mic_decimator, new_samples, new_samples);
+#endif
         }
 
-        dsps_mulc_f32(new_samples, new_samples, AUDIO_CHUNK_SIZE, recip_scale, 1, 1);
-
         // TRACE POINT 1: I2S Input Validation (gated by audio_trace_enabled)
         extern bool audio_trace_enabled;
         static uint32_t trace_counter_i2s = 0;
@@ -263,7 +449,8 @@ void acquire_sample_chunk() {
         audio_level = smooth_audio_level;
 
         waveform_locked = true;
-        shift_and_copy_arrays(sample_history, SAMPLE_HISTORY_LENGTH, new_samples, AUDIO_CHUNK_SIZE);
+        goertzel_ingest_samples(new_samples, AUDIO_CHUNK_SIZE);
+        sample_ring_write(&sample_history, new_samples, AUDIO_CHUNK_SIZE);
 
         waveform_locked = false;
         waveform_sync_flag = true;
@@ -38,6 +38,17 @@
 #  include <driver/periph_ctrl.h>
 #endif
 
+// DMA capture: the I2S receive callback hands each completed DMA descriptor to
+// the capturing task by pointer and acquire_sample_chunk() converts it in
+// place. Needs the v5 driver's event callbacks; legacy builds keep blocking reads.
+#ifndef MICROPHONE_DMA_CAPTURE
+#  define MICROPHONE_DMA_CAPTURE MICROPHONE_USE_NEW_I2S
+#endif
+#if MICROPHONE_DMA_CAPTURE && !MICROPHONE_USE_NEW_I2S
+#  error "MICROPHONE_DMA_CAPTURE requires the ESP-IDF v5 I2S std driver"
+#endif
+#define MICROPHONE_DMA_DESC_NUM 6   // DMA ring depth (chunks of slack before overwrite)
+
 #include "../logging/logger.h"
 #include <string.h>
 
@@ -55,9 +66,10 @@
 
 #define SAMPLE_HISTORY_LENGTH 4096
 
-// NOTE: sample_history is declared in goertzel.h - don't duplicate
-// float sample_history[SAMPLE_HISTORY_LENGTH];
-constexpr float recip_scale = 1.0 / 131072.0; // max 18 bit signed value
+// NOTE: sample_history (SampleRing) is declared in goertzel.h - don't duplicate
+#include "mic_frontend.h"
+#include "audio_source.h"
+#include "polyphase_decimator.h"
 
 // Synchronization flags for microphone I2S ISR coordination
 // Uses acquire/release ordering for ISR synchronization
@@ -74,28 +86,21 @@ typedef struct {
     uint8_t last_error_code;         // Most recent error code
     bool in_fallback_mode;           // Using silence fallback
     uint32_t fallback_start_time_ms; // When fallback mode began
+    uint32_t dma_overrun_count;      // DMA chunks lost to ring wrap (DMA capture only)
 } I2STimeoutState;
 
 // Globals (defined in microphone.cpp)
 extern std::atomic<bool> waveform_locked;
 extern std::atomic<bool> waveform_sync_flag;
 extern I2STimeoutState i2s_timeout_state;
+extern MicFrontend mic_frontend;
 #if MICROPHONE_USE_NEW_I2S
 extern i2s_chan_handle_t rx_handle;
 #endif
 
-// ============================================================================
-// UTILITY FUNCTIONS
-// ============================================================================
-
-// Shift array left and copy new data to the end
-inline void shift_and_copy_arrays(float* dest, int dest_len, float* src, int src_len) {
-    memmove(dest, dest + src_len, (dest_len - src_len) * sizeof(float));
-    memcpy(dest + (dest_len - src_len), src, src_len * sizeof(float));
-}
-
 // Public API
 void init_i2s_microphone();
 void acquire_sample_chunk();
 const I2STimeoutState& get_i2s_timeout_state();  // Read-only access to timeout stats
 bool audio_input_is_active();
+bool microphone_dma_capture_active();             // False when using blocking reads
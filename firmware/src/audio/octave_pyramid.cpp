@@ -0,0 +1,170 @@
+// Octave Pyramid Implementation
+// Half-band decimation cascade and per-level bin mapping (see octave_pyramid.h)
+
+#include "octave_pyramid.h"
+#include <cmath>
+#include <cstring>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+#define OCTAVE_PYRAMID_KAISER_BETA 7.0      // ~70 dB stopband, transition band 0.15-0.35 of the input rate
+#define OCTAVE_PYRAMID_PUSH_BLOCK 64        // Full-rate samples decimated per pass
+
+// Zeroth-order modified Bessel function (Kaiser window), power series
+static double bessel_i0(double x) {
+	double sum = 1.0;
+	double term = 1.0;
+	for (int k = 1; k < 32; k++) {
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+	}
+	return sum;
+}
+
+// Kaiser-windowed half-band: h[0] = 0.5, h[even] = 0, h[odd] from sin(pi n / 2) / (pi n),
+// odd taps rescaled so the DC gain is exactly 1
+static void design_halfband(float* taps) {
+	const int half = OCTAVE_PYRAMID_HALFBAND_TAPS / 2;
+	const double norm = bessel_i0(OCTAVE_PYRAMID_KAISER_BETA);
+	double h[OCTAVE_PYRAMID_HALFBAND_TAPS / 4 + 1];
+	double sum = 0.0;
+	for (int j = 0; 2 * j + 1 <= half; j++) {
+		const int n = 2 * j + 1;
+		const double r = (double)n / half;
+		const double kaiser = bessel_i0(OCTAVE_PYRAMID_KAISER_BETA * sqrt(1.0 - r * r)) / norm;
+		h[j] = sin(M_PI * n / 2.0) / (M_PI * n) * kaiser;
+		sum += 2.0 * h[j];
+	}
+	for (int j = 0; 2 * j + 1 <= half; j++) {
+		taps[j] = (float)(h[j] * 0.5 / sum);
+	}
+}
+
+// Low-pass and keep every second sample; returns the number of outputs
+static uint32_t halfband_decimate(OctavePyramidLevel* level, const float* taps,
+                                  const float* in, uint32_t count, float* out) {
+	const uint32_t length = OCTAVE_PYRAMID_HALFBAND_TAPS;
+	const uint32_t centre = length / 2;
+	uint32_t produced = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		level->input[level->input_pos] = in[i];
+		level->input[level->input_pos + length] = in[i];
+		level->input_pos = (uint32_t)level->input_pos + 1 < length ? level->input_pos + 1 : 0;
+		level->phase ^= 1;
+		if (level->phase) {
+			continue;
+		}
+
+		// The newest length inputs, oldest first
+		const float* x = level->input + level->input_pos;
+		float y = 0.5f * x[centre];
+		for (uint32_t j = 0; 2 * j + 1 <= centre; j++) {
+			y += taps[j] * (x[centre - (2 * j + 1)] + x[centre + (2 * j + 1)]);
+		}
+		out[produced++] = y;
+	}
+	return produced;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+bool octave_pyramid_init(OctavePyramid* pyramid, const GoertzelBlockBin* bins, uint16_t num_bins,
+                         float sample_rate_hz, uint8_t max_levels) {
+	if (num_bins > OCTAVE_PYRAMID_MAX_BINS || max_levels == 0 || max_levels > OCTAVE_PYRAMID_MAX_LEVELS) {
+		return false;
+	}
+	pyramid->num_levels = max_levels;
+	pyramid->num_bins = num_bins;
+	design_halfband(pyramid->halfband);
+
+	memset(pyramid->levels, 0, sizeof(pyramid->levels));
+	uint32_t offset = 0;
+	for (uint8_t l = 1; l < max_levels; l++) {
+		OctavePyramidLevel* level = &pyramid->levels[l];
+		sample_ring_init(&level->ring, pyramid->storage + offset, OCTAVE_PYRAMID_LEVEL1_CAPACITY >> (l - 1));
+		offset += level->ring.capacity;
+	}
+
+	for (uint16_t b = 0; b < num_bins; b++) {
+		const uint16_t block_size = bins[b].block_size;
+		if (block_size == 0) {
+			return false;
+		}
+		// Centre and bandwidth as the block engine resolves them: the centre
+		// from the coefficient, the bandwidth from the block size (N = fs / bandwidth)
+		const double omega = acos((double)bins[b].coeff / 2.0);
+		const double centre_hz = omega * sample_rate_hz / (2.0 * M_PI);
+		const double bandwidth_hz = (double)sample_rate_hz / block_size;
+
+		uint8_t l = 0;
+		while (l + 1 < max_levels &&
+		       centre_hz + bandwidth_hz <= OCTAVE_PYRAMID_PASSBAND * sample_rate_hz / (2u << l)) {
+			l++;
+		}
+		const uint16_t scaled_size = (uint16_t)((block_size + ((1u << l) >> 1)) >> l);
+		if (l > 0 && scaled_size > pyramid->levels[l].ring.capacity) {
+			return false;
+		}
+
+		pyramid->bin_level[b] = l;
+		pyramid->bins[b].block_size = scaled_size;
+		pyramid->bins[b].window_step = bins[b].window_step * block_size / scaled_size;
+		pyramid->bins[b].coeff = (float)(2.0 * cos(omega * (1u << l)));
+	}
+	return true;
+}
+
+void octave_pyramid_push(OctavePyramid* pyramid, const float* samples, uint32_t count) {
+	float buffers[2][OCTAVE_PYRAMID_PUSH_BLOCK];
+	while (count > 0) {
+		const uint32_t block = count < OCTAVE_PYRAMID_PUSH_BLOCK ? count : OCTAVE_PYRAMID_PUSH_BLOCK;
+		const float* in = samples;
+		uint32_t in_count = block;
+		for (uint8_t l = 1; l < pyramid->num_levels && in_count > 0; l++) {
+			OctavePyramidLevel* level = &pyramid->levels[l];
+			float* out = buffers[l & 1];
+			const uint32_t out_count = halfband_decimate(level, pyramid->halfband, in, in_count, out);
+			sample_ring_write(&level->ring, out, out_count);
+			in = out;
+			in_count = out_count;
+		}
+		samples += block;
+		count -= block;
+	}
+}
+
+const SampleRing* octave_pyramid_level(const OctavePyramid* pyramid, uint8_t level) {
+	if (level == 0 || level >= pyramid->num_levels) {
+		return nullptr;
+	}
+	return &pyramid->levels[level].ring;
+}
+
+float octave_pyramid_magnitude(const OctavePyramid* pyramid, const SampleRing* full_rate,
+                               const float* window, uint16_t bin) {
+	const uint8_t l = pyramid->bin_level[bin];
+	if (l == 0) {
+		return goertzel_block_magnitude(full_rate, 1, window, &pyramid->bins[bin]);
+	}
+	return goertzel_block_magnitude(&pyramid->levels[l].ring, 0, window, &pyramid->bins[bin]);
+}
+
+void octave_pyramid_magnitudes(const OctavePyramid* pyramid, const SampleRing* full_rate,
+                               const float* window, uint16_t lanes, float* magnitudes) {
+	uint16_t first = 0;
+	while (first < pyramid->num_bins) {
+		const uint8_t l = pyramid->bin_level[first];
+		uint16_t end = first + 1;
+		while (end < pyramid->num_bins && pyramid->bin_level[end] == l) {
+			end++;
+		}
+		const SampleRing* ring = l == 0 ? full_rate : &pyramid->levels[l].ring;
+		goertzel_block_magnitudes(ring, l == 0 ? 1 : 0, window, pyramid->bins + first, end - first, lanes,
+		                          magnitudes + first);
+		first = end;
+	}
+}
@@ -0,0 +1,90 @@
+// Octave Pyramid - Decimated sample streams for the low note bins
+//
+// A note bin's block spans a fixed number of cycles, so the bottom octave's
+// blocks are the longest (~1400 samples at 12.8 kHz) and dominate the block
+// engine's cost. Those bins do not need the full rate: each pyramid level
+// halves the rate of the one above with a half-band low-pass, and every bin
+// runs on the coarsest level whose alias-free band still covers it, with its
+// block (and cost) shrunk by the same factor. Every octave then costs about
+// the same, instead of each lower octave costing twice as much.
+//
+// Level 0 is the caller's full-rate history (sample_history); levels 1..n-1
+// are owned here and fed by octave_pyramid_push() with the same chunks.
+// Rescaled bins keep their centre frequency exactly and their window shape;
+// magnitudes are still |X| / (N / 2), so they read like the full-rate block
+// engine (goertzel_block.h). Each level adds the half-band's group delay
+// (OCTAVE_PYRAMID_HALFBAND_TAPS / 2 samples at the level's input rate, ~340
+// full-rate samples at the deepest level), so the filter is kept short and
+// each level is only used up to OCTAVE_PYRAMID_PASSBAND of its rate.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef OCTAVE_PYRAMID_H
+#define OCTAVE_PYRAMID_H
+
+#include <stdint.h>
+#include "sample_ring.h"
+#include "goertzel_block.h"
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define OCTAVE_PYRAMID_MAX_LEVELS 6         // Full rate + 5 halvings (12.8 kHz -> 400 Hz)
+#define OCTAVE_PYRAMID_MAX_BINS 64
+#define OCTAVE_PYRAMID_HALFBAND_TAPS 23     // Half-band FIR length (4k + 3)
+#define OCTAVE_PYRAMID_LEVEL1_CAPACITY 2048 // Level l ring holds 2048 >> (l - 1) samples
+
+// A bin may move to a level while centre + bandwidth (fs / N) stays below this
+// fraction of the level's rate; the half-band's transition band sits above it
+#define OCTAVE_PYRAMID_PASSBAND 0.3f
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	SampleRing ring;                                    // Decimated stream at rate / 2^level
+	float input[OCTAVE_PYRAMID_HALFBAND_TAPS * 2];      // Half-band input, mirrored for contiguous reads
+	uint16_t input_pos;                                 // Next write position in input[0 .. TAPS)
+	uint8_t phase;                                      // Emit an output every second input
+} OctavePyramidLevel;
+
+typedef struct {
+	OctavePyramidLevel levels[OCTAVE_PYRAMID_MAX_LEVELS];   // levels[0] unused (caller's history)
+	uint8_t num_levels;
+	float halfband[OCTAVE_PYRAMID_HALFBAND_TAPS / 4 + 1];   // Odd-offset taps h[1], h[3], ... (h[0] = 0.5)
+	GoertzelBlockBin bins[OCTAVE_PYRAMID_MAX_BINS];         // Bins rescaled to their level
+	uint8_t bin_level[OCTAVE_PYRAMID_MAX_BINS];
+	uint16_t num_bins;
+	float storage[OCTAVE_PYRAMID_LEVEL1_CAPACITY * 2];      // Ring storage for levels 1 .. n-1
+} OctavePyramid;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// Design the half-band, clear the levels and map num_bins full-rate bins
+// (sample_rate_hz) to their levels, using at most max_levels levels (1 keeps
+// every bin at full rate). Returns false if a level's ring cannot hold its
+// longest rescaled block or the arguments are out of range.
+bool octave_pyramid_init(OctavePyramid* pyramid, const GoertzelBlockBin* bins, uint16_t num_bins,
+                         float sample_rate_hz, uint8_t max_levels);
+
+// Feed the same full-rate samples that go to the caller's history
+void octave_pyramid_push(OctavePyramid* pyramid, const float* samples, uint32_t count);
+
+// Samples of level 1 .. n-1 (nullptr for level 0, which is the caller's history)
+const SampleRing* octave_pyramid_level(const OctavePyramid* pyramid, uint8_t level);
+
+// One bin; full_rate is the caller's history, read one sample before its newest
+// as the block engine does. Decimated levels are read up to their newest sample.
+float octave_pyramid_magnitude(const OctavePyramid* pyramid, const SampleRing* full_rate,
+                               const float* window, uint16_t bin);
+
+// Every bin into magnitudes[num_bins], each level's run of bins lanes (1, 4
+// or 8) at a time (goertzel_block_magnitudes())
+void octave_pyramid_magnitudes(const OctavePyramid* pyramid, const SampleRing* full_rate,
+                               const float* window, uint16_t lanes, float* magnitudes);
+
+#endif  // OCTAVE_PYRAMID_H
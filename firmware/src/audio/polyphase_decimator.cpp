@@ -0,0 +1,113 @@
+// Polyphase Decimator Implementation
+// Kaiser-windowed sinc prototype split into `up` phases (see polyphase_decimator.h)
+
+#include "polyphase_decimator.h"
+#include "../dsps_helpers.h"
+#include <cmath>
+#include <cstring>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static uint32_t gcd_u32(uint32_t a, uint32_t b) {
+	while (b != 0) {
+		uint32_t t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+// Zeroth-order modified Bessel function of the first kind (series)
+static double bessel_i0(double x) {
+	double sum = 1.0;
+	double term = 1.0;
+	const double half_x_sq = 0.25 * x * x;
+	for (int k = 1; k < 32; k++) {
+		term *= half_x_sq / ((double)k * k);
+		sum += term;
+		if (term < sum * 1e-12) {
+			break;
+		}
+	}
+	return sum;
+}
+
+// ============================================================================
+// API
+// ============================================================================
+
+bool polyphase_decimator_init(PolyphaseDecimator* dec, uint32_t in_rate_hz, uint32_t out_rate_hz,
+                              uint16_t out_chunk) {
+	if (!dec || in_rate_hz == 0 || out_rate_hz == 0 || out_rate_hz >= in_rate_hz || out_chunk == 0) {
+		return false;
+	}
+	const uint32_t g = gcd_u32(in_rate_hz, out_rate_hz);
+	const uint32_t up = out_rate_hz / g;
+	const uint32_t down = in_rate_hz / g;
+	if (POLYPHASE_TOTAL_TAPS % up != 0 || ((uint32_t)out_chunk * down) % up != 0) {
+		return false;
+	}
+	const uint32_t in_chunk = (uint32_t)out_chunk * down / up;
+	if (in_chunk > POLYPHASE_MAX_IN_CHUNK) {
+		return false;
+	}
+
+	dec->up = (uint16_t)up;
+	dec->down = (uint16_t)down;
+	dec->taps_per_phase = (uint16_t)(POLYPHASE_TOTAL_TAPS / up);
+	dec->in_chunk = (uint16_t)in_chunk;
+	dec->out_chunk = out_chunk;
+
+	// Prototype low-pass at the zero-stuffed rate, cutoff midway between the
+	// passband edge and the output Nyquist
+	const double proto_rate = (double)in_rate_hz * up;
+	const double out_nyquist = 0.5 * out_rate_hz;
+	const double cutoff = 0.5 * (POLYPHASE_PASSBAND_RATIO * out_nyquist + out_nyquist);
+	const double fc = cutoff / proto_rate;  // cycles per prototype sample
+	const double center = 0.5 * (POLYPHASE_TOTAL_TAPS - 1);
+	const double i0_beta = bessel_i0(POLYPHASE_KAISER_BETA);
+
+	double h[POLYPHASE_TOTAL_TAPS];
+	double sum = 0.0;
+	for (uint16_t n = 0; n < POLYPHASE_TOTAL_TAPS; n++) {
+		const double x = n - center;
+		const double sinc = (x == 0.0) ? 2.0 * fc : sin(2.0 * M_PI * fc * x) / (M_PI * x);
+		const double r = x / center;
+		const double window = bessel_i0(POLYPHASE_KAISER_BETA * sqrt(fmax(0.0, 1.0 - r * r))) / i0_beta;
+		h[n] = sinc * window;
+		sum += h[n];
+	}
+
+	// Unity DC gain through the zero-stuffed path: each phase sums to ~1
+	const uint16_t taps = dec->taps_per_phase;
+	for (uint16_t p = 0; p < up; p++) {
+		for (uint16_t i = 0; i < taps; i++) {
+			dec->coeffs[p * taps + i] = (float)(up * h[p + (taps - 1 - i) * up] / sum);
+		}
+	}
+
+	polyphase_decimator_reset(dec);
+	return true;
+}
+
+void polyphase_decimator_reset(PolyphaseDecimator* dec) {
+	memset(dec->buffer, 0, sizeof(dec->buffer));
+}
+
+void polyphase_decimator_process(PolyphaseDecimator* dec, const float* in, float* out) {
+	const uint16_t taps = dec->taps_per_phase;
+	const uint16_t history = taps - 1;
+	memcpy(dec->buffer + history, in, sizeof(float) * dec->in_chunk);
+
+	// Output n sits at prototype time n * down: input index t / up, phase t % up
+	uint32_t t = 0;
+	for (uint16_t n = 0; n < dec->out_chunk; n++, t += dec->down) {
+		const uint32_t k = t / dec->up;
+		const uint32_t phase = t - k * dec->up;
+		out[n] = dsps_dotprod_f32_sum(dec->coeffs + phase * taps, dec->buffer + k, taps);
+	}
+
+	memmove(dec->buffer, dec->buffer + dec->in_chunk, sizeof(float) * history);
+}
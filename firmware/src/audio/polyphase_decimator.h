@@ -0,0 +1,69 @@
+// Polyphase Decimator - Rational-rate FIR resampler (capture rate -> analysis rate)
+// https://en.wikipedia.org/wiki/Sample-rate_conversion#Rational_factors
+//
+// Converts by up/down = analysis_rate / capture_rate (16 kHz -> 12.8 kHz is
+// 4/5, 32 kHz -> 12.8 kHz is 2/5). Conceptually the input is zero-stuffed by
+// `up`, low-pass filtered at the analysis Nyquist, and every `down`-th sample
+// kept; the polyphase form only evaluates the taps that land on real input
+// samples and only for samples that are kept, so each output costs
+// taps / up multiply-adds (one ESP-DSP dot product).
+//
+// The prototype low-pass is a Kaiser-windowed sinc of POLYPHASE_TOTAL_TAPS at
+// rate up * capture_rate: flat to 0.625 x the analysis Nyquist (4 kHz at
+// 12.8 kHz, well above the top Goertzel bin) and >= 60 dB down from the
+// analysis Nyquist, so nothing the decimator keeps can alias into notes[].
+//
+// Chunked: each call consumes in_chunk samples and produces exactly out_chunk,
+// carrying taps_per_phase - 1 samples of history across calls.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef POLYPHASE_DECIMATOR_H
+#define POLYPHASE_DECIMATOR_H
+
+#include <stdint.h>
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define POLYPHASE_TOTAL_TAPS      96        // Prototype filter length (all phases)
+#define POLYPHASE_MAX_IN_CHUNK    256       // Largest input chunk (samples)
+#define POLYPHASE_PASSBAND_RATIO  0.625f    // Passband edge / output Nyquist
+#define POLYPHASE_KAISER_BETA     5.65f     // ~60 dB stopband
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	uint16_t up;                  // Interpolation factor L
+	uint16_t down;                // Decimation factor M
+	uint16_t taps_per_phase;      // POLYPHASE_TOTAL_TAPS / up
+	uint16_t in_chunk;            // Input samples per call
+	uint16_t out_chunk;           // Output samples per call
+	// Phase-major, time-reversed so each output is one contiguous dot product:
+	// coeffs[p * taps_per_phase + i] = up * h[p + (taps_per_phase - 1 - i) * up]
+	float coeffs[POLYPHASE_TOTAL_TAPS];
+	// [0, taps_per_phase - 1): history; then the current input chunk
+	float buffer[POLYPHASE_TOTAL_TAPS + POLYPHASE_MAX_IN_CHUNK];
+} PolyphaseDecimator;
+
+// ============================================================================
+// API
+// ============================================================================
+
+// Configure for in_rate_hz -> out_rate_hz with out_chunk outputs per call.
+// Returns false unless out_rate < in_rate, the reduced ratio divides
+// POLYPHASE_TOTAL_TAPS and out_chunk maps to a whole input chunk that fits.
+bool polyphase_decimator_init(PolyphaseDecimator* dec, uint32_t in_rate_hz, uint32_t out_rate_hz,
+                              uint16_t out_chunk);
+
+// Zero the history
+void polyphase_decimator_reset(PolyphaseDecimator* dec);
+
+// Consume dec->in_chunk samples from in, write dec->out_chunk samples to out.
+// out may alias in (the input is staged into the history buffer first).
+void polyphase_decimator_process(PolyphaseDecimator* dec, const float* in, float* out);
+
+#endif  // POLYPHASE_DECIMATOR_H
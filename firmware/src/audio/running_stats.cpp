@@ -0,0 +1,109 @@
+// Running Statistics Implementation
+// Ring-buffer sums and monotonic-deque extrema (see running_stats.h)
+
+#include "running_stats.h"
+#include <cmath>
+#include <cstring>
+
+// ============================================================================
+// RUNNING SUM
+// ============================================================================
+
+void running_sum_init(RunningSum* rs, float* rows, float* sums, uint16_t capacity, uint16_t width) {
+	rs->rows = rows;
+	rs->sums = sums;
+	rs->capacity = capacity;
+	rs->width = width;
+	rs->head = 0;
+	memset(rows, 0, sizeof(float) * capacity * width);
+	memset(sums, 0, sizeof(float) * width);
+}
+
+void running_sum_push(RunningSum* rs, const float* row) {
+	rs->head++;
+	if (rs->head >= rs->capacity) {
+		rs->head = 0;
+	}
+
+	float* slot = rs->rows + (uint32_t)rs->head * rs->width;
+	for (uint16_t i = 0; i < rs->width; i++) {
+		rs->sums[i] += row[i] - slot[i];
+		slot[i] = row[i];
+	}
+
+	// Once per lap, drop the accumulated rounding error
+	if (rs->head == 0) {
+		running_sum_resync(rs);
+	}
+}
+
+void running_sum_resync(RunningSum* rs) {
+	for (uint16_t i = 0; i < rs->width; i++) {
+		float sum = 0.0f;
+		for (uint16_t r = 0; r < rs->capacity; r++) {
+			sum += rs->rows[(uint32_t)r * rs->width + i];
+		}
+		rs->sums[i] = sum;
+	}
+}
+
+void running_sum_means(const RunningSum* rs, float* means) {
+	const float count = (float)rs->capacity;
+	for (uint16_t i = 0; i < rs->width; i++) {
+		means[i] = rs->sums[i] / count;
+	}
+}
+
+// ============================================================================
+// RUNNING EXTREMUM
+// ============================================================================
+
+void running_extremum_init(RunningExtremum* re, float* values, uint16_t* stamps, uint16_t window,
+                           bool track_max) {
+	re->values = values;
+	re->stamps = stamps;
+	re->window = window;
+	re->front = 0;
+	re->size = 0;
+	re->pushes = 0;
+	re->track_max = track_max;
+}
+
+void running_extremum_push(RunningExtremum* re, float value) {
+	const uint16_t stamp = re->pushes++;
+
+	// The front leaves once it is `window` pushes old
+	if (re->size > 0 && (uint16_t)(stamp - re->stamps[re->front]) >= re->window) {
+		re->front = (re->front + 1 == re->window) ? 0 : re->front + 1;
+		re->size--;
+	}
+
+	// Entries the new value dominates can never be the extremum again
+	while (re->size > 0) {
+		uint16_t back = re->front + re->size - 1;
+		if (back >= re->window) {
+			back -= re->window;
+		}
+		const float v = re->values[back];
+		if (re->track_max ? (v > value) : (v < value)) {
+			break;
+		}
+		re->size--;
+	}
+
+	uint16_t tail = re->front + re->size;
+	if (tail >= re->window) {
+		tail -= re->window;
+	}
+	re->values[tail] = value;
+	re->stamps[tail] = stamp;
+	re->size++;
+}
+
+void running_extremum_rescale(RunningExtremum* re, float gain, float floor) {
+	uint16_t idx = re->front;
+	for (uint16_t n = 0; n < re->size; n++) {
+		re->values[idx] = fmaxf(re->values[idx] * gain, floor);
+		idx = (idx + 1 == re->window) ? 0 : idx + 1;
+	}
+}
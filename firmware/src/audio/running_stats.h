@@ -0,0 +1,84 @@
+// Running Statistics - O(1) sliding-window sums and extrema
+//
+// RunningSum keeps per-column sums over the last `capacity` rows of `width`
+// floats: a push adds the new row and subtracts the row it overwrites, so the
+// window mean costs O(width) per push instead of O(capacity * width). The sums
+// are rebuilt from the stored rows each time the ring wraps, in row order, so
+// float drift is bounded to one lap and a resynced sum matches a plain re-sum
+// bit for bit. Rows live in caller storage and stay readable as a ring
+// (rows + head * width is the newest), so existing [capacity][width] arrays
+// can be wrapped in place.
+//
+// RunningExtremum tracks the max (or min) of the last `window` pushed values
+// with a monotonic deque: every value enters and leaves the deque once, so a
+// push is amortised O(1) and the extremum is read in O(1). Rescaling every
+// value in the window by a positive gain with a floor, fmaxf(v * gain, floor),
+// preserves the deque order, so it is applied to the deque entries in place.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef RUNNING_STATS_H
+#define RUNNING_STATS_H
+
+#include <stdint.h>
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	float* rows;              // capacity * width floats, caller-owned
+	float* sums;              // width floats, caller-owned
+	uint16_t capacity;        // Rows in the window
+	uint16_t width;           // Columns per row
+	uint16_t head;            // Row written by the last push
+} RunningSum;
+
+typedef struct {
+	float* values;            // Deque ring (window entries), caller-owned
+	uint16_t* stamps;         // Push number of each deque entry (window entries), caller-owned
+	uint16_t window;          // Values covered (<= 32768)
+	uint16_t front;           // Ring index of the extremum
+	uint16_t size;            // Live deque entries
+	uint16_t pushes;          // Push counter (wraps; only differences are used)
+	bool track_max;           // Max (true) or min (false)
+} RunningExtremum;
+
+// ============================================================================
+// RUNNING SUM API
+// ============================================================================
+
+// Bind storage and clear rows and sums. head starts at 0, so the first push
+// writes row 1 (the index-then-write convention of a plain ring buffer).
+void running_sum_init(RunningSum* rs, float* rows, float* sums, uint16_t capacity, uint16_t width);
+
+// Replace the oldest row with row[0..width) and update the sums
+void running_sum_push(RunningSum* rs, const float* row);
+
+// Rebuild the sums from the stored rows (after editing rows directly)
+void running_sum_resync(RunningSum* rs);
+
+// Column means over the full window (rows not yet pushed count as zero)
+void running_sum_means(const RunningSum* rs, float* means);
+
+// ============================================================================
+// RUNNING EXTREMUM API
+// ============================================================================
+
+// Bind deque storage (window entries each) and empty the window
+void running_extremum_init(RunningExtremum* re, float* values, uint16_t* stamps, uint16_t window,
+                           bool track_max);
+
+// Add a value; the value pushed `window` pushes ago leaves the window
+void running_extremum_push(RunningExtremum* re, float value);
+
+// Max (or min) of the values in the window, or fallback when none were pushed
+inline float running_extremum_value(const RunningExtremum* re, float fallback) {
+	return re->size > 0 ? re->values[re->front] : fallback;
+}
+
+// Mirror of replacing every value in the window by fmaxf(v * gain, floor);
+// gain must be positive
+void running_extremum_rescale(RunningExtremum* re, float gain, float floor);
+
+#endif  // RUNNING_STATS_H
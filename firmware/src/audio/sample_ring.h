@@ -0,0 +1,143 @@
+// Sample Ring - Power-of-two audio history with zero-copy windowed reads
+//
+// Replaces the flat shift-left sample_history[] layout: a new chunk is written
+// at the head (at most two memcpy calls) instead of memmoving the whole 16 KB
+// history every chunk. Consumers read a window as a SampleSpan, which is either
+// one contiguous run or two runs (tail of the storage, then its start).
+//
+// Indexing convention: "age" 0 is the newest sample, age 1 the one before, etc.
+// Windows are returned oldest-first, matching the old flat array order.
+//
+// Header-only and dependency-free so it can be unit tested on host.
+
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <stdint.h>
+#include <cstring>
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+// Read-only view of a window: first[0..first_length) then second[0..second_length)
+typedef struct {
+	const float* first;
+	uint32_t first_length;
+	const float* second;      // nullptr when the window is contiguous
+	uint32_t second_length;
+} SampleSpan;
+
+typedef struct {
+	float* data;              // Backing storage (capacity floats)
+	uint32_t capacity;        // Power of two
+	uint32_t mask;            // capacity - 1
+	uint32_t head;            // Total samples written (wraps safely: capacity divides 2^32)
+} SampleRing;
+
+// ============================================================================
+// RING API
+// ============================================================================
+
+// Bind storage and clear it. Returns false if capacity is not a power of two.
+inline bool sample_ring_init(SampleRing* ring, float* storage, uint32_t capacity) {
+	if (!ring || !storage || capacity == 0 || (capacity & (capacity - 1)) != 0) {
+		return false;
+	}
+	ring->data = storage;
+	ring->capacity = capacity;
+	ring->mask = capacity - 1;
+	ring->head = 0;
+	std::memset(storage, 0, sizeof(float) * capacity);
+	return true;
+}
+
+// Zero the history (reads return silence until new samples arrive)
+inline void sample_ring_clear(SampleRing* ring) {
+	std::memset(ring->data, 0, sizeof(float) * ring->capacity);
+}
+
+// Append count samples at the head
+inline void sample_ring_write(SampleRing* ring, const float* src, uint32_t count) {
+	if (count > ring->capacity) {
+		// Only the newest capacity samples survive
+		src += count - ring->capacity;
+		ring->head += count - ring->capacity;
+		count = ring->capacity;
+	}
+
+	uint32_t start = ring->head & ring->mask;
+	uint32_t first = ring->capacity - start;
+	if (first > count) {
+		first = count;
+	}
+	std::memcpy(ring->data + start, src, sizeof(float) * first);
+	if (count > first) {
+		std::memcpy(ring->data, src + first, sizeof(float) * (count - first));
+	}
+	ring->head += count;
+}
+
+// Sample by absolute write index (index i is the i-th sample ever written)
+inline float sample_ring_at_index(const SampleRing* ring, uint32_t index) {
+	return ring->data[index & ring->mask];
+}
+
+// Sample by age (0 = newest); ages >= capacity wrap
+inline float sample_ring_at(const SampleRing* ring, uint32_t age) {
+	return ring->data[(ring->head - 1 - age) & ring->mask];
+}
+
+// Window of length samples, oldest-first, whose newest sample has the given age.
+// length is clamped to capacity - age.
+inline SampleSpan sample_ring_window(const SampleRing* ring, uint32_t length, uint32_t age = 0) {
+	if (age >= ring->capacity) {
+		age = ring->capacity - 1;
+	}
+	if (length > ring->capacity - age) {
+		length = ring->capacity - age;
+	}
+
+	uint32_t start = (ring->head - age - length) & ring->mask;
+	uint32_t first = ring->capacity - start;
+
+	SampleSpan span;
+	span.first = ring->data + start;
+	if (first >= length) {
+		span.first_length = length;
+		span.second = nullptr;
+		span.second_length = 0;
+	} else {
+		span.first_length = first;
+		span.second = ring->data;
+		span.second_length = length - first;
+	}
+	return span;
+}
+
+// ============================================================================
+// SPAN HELPERS
+// ============================================================================
+
+inline uint32_t sample_span_length(const SampleSpan& span) {
+	return span.first_length + span.second_length;
+}
+
+inline bool sample_span_is_contiguous(const SampleSpan& span) {
+	return span.second_length == 0;
+}
+
+// Element i of the window (oldest = 0); prefer iterating the two runs in hot loops
+inline float sample_span_at(const SampleSpan& span, uint32_t i) {
+	return (i < span.first_length) ? span.first[i] : span.second[i - span.first_length];
+}
+
+// Linearize a window into dest (for consumers that need a flat array)
+inline void sample_span_copy(const SampleSpan& span, float* dest) {
+	std::memcpy(dest, span.first, sizeof(float) * span.first_length);
+	if (span.second_length > 0) {
+		std::memcpy(dest + span.first_length, span.second, sizeof(float) * span.second_length);
+	}
+}
+
+#endif  // SAMPLE_RING_H
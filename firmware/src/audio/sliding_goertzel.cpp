@@ -0,0 +1,224 @@
+// Sliding Goertzel Implementation
+// Incremental comb + resonator DFT bank with windowing in the frequency domain
+
+#include "sliding_goertzel.h"
+#include <cmath>
+#include <cstring>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static void configure_term(SlidingGoertzelBin* bin, uint8_t term, float k, float gain) {
+	double w = (2.0 * M_PI * k) / bin->block_size;
+	bin->cosine[term] = (float)cos(w);
+	bin->sine[term] = (float)sin(w);
+	bin->coeff[term] = (float)(2.0 * cos(w));
+	bin->gain[term] = gain;
+	bin->s1[term] = 0.0f;
+	bin->s2[term] = 0.0f;
+}
+
+// Plain Goertzel pass over count samples, continuing from (q1, q2)
+static inline void goertzel_run(float coeff, const float* samples, uint32_t count, float* q1, float* q2) {
+	float s1 = *q1;
+	float s2 = *q2;
+	for (uint32_t i = 0; i < count; i++) {
+		float s0 = coeff * s1 - s2 + samples[i];
+		s2 = s1;
+		s1 = s0;
+	}
+	*q1 = s1;
+	*q2 = s2;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void sliding_goertzel_reset(SlidingGoertzelBank* bank, SlidingGoertzelBin* bins, uint16_t num_bins,
+                            const float* window, uint32_t window_length) {
+	memset(bank, 0, sizeof(SlidingGoertzelBank));
+	memset(bins, 0, sizeof(SlidingGoertzelBin) * num_bins);
+	bank->bins = bins;
+	bank->num_bins = num_bins;
+
+	// Least-squares cosine-sum fit: project the window onto {1, cos(2*pi*h*i/L)}
+	double sum_dc = 0.0;
+	double sum_harmonic = 0.0;
+	for (uint32_t i = 0; i < window_length; i++) {
+		double phase = (2.0 * M_PI * SLIDING_GOERTZEL_WINDOW_HARMONIC * i) / window_length;
+		sum_dc += window[i];
+		sum_harmonic += window[i] * cos(phase);
+	}
+	bank->window_a0 = (float)(sum_dc / window_length);
+	bank->window_ah = (float)(2.0 * sum_harmonic / window_length);
+}
+
+void sliding_goertzel_configure_bin(SlidingGoertzelBank* bank, uint16_t bin,
+                                    uint16_t block_size, float k) {
+	if (bin >= bank->num_bins || block_size == 0) {
+		return;
+	}
+
+	SlidingGoertzelBin* b = &bank->bins[bin];
+	b->block_size = block_size;
+
+	const float h = SLIDING_GOERTZEL_WINDOW_HARMONIC;
+	if (k - h >= 1.0f) {
+		configure_term(b, 0, k, bank->window_a0);
+		configure_term(b, 1, k - h, bank->window_ah * 0.5f);
+		configure_term(b, 2, k + h, bank->window_ah * 0.5f);
+	}
+	else {
+		// Too few cycles per block for the side terms: fall back to a scaled
+		// rectangular window rather than running a DC resonator
+		configure_term(b, 0, k, bank->window_a0);
+		configure_term(b, 1, k, 0.0f);
+		configure_term(b, 2, k, 0.0f);
+	}
+}
+
+void sliding_goertzel_ingest(SlidingGoertzelBank* bank, const SampleRing* history,
+                             const float* new_samples, uint16_t count) {
+	const float* ring = history->data;
+	const uint32_t mask = history->mask;
+
+	for (uint16_t bin = 0; bin < bank->num_bins; bin++) {
+		SlidingGoertzelBin* b = &bank->bins[bin];
+		const int32_t block_size = b->block_size;
+
+		// Keep resonator state in registers for the whole chunk
+		const float c0 = b->coeff[0], c1 = b->coeff[1], c2 = b->coeff[2];
+		float a1 = b->s1[0], a2 = b->s2[0];
+		float b1 = b->s1[1], b2 = b->s2[1];
+		float d1 = b->s1[2], d2 = b->s2[2];
+
+		// Absolute ring index of the sample leaving the window for new sample 0
+		const uint32_t departing = history->head - (uint32_t)block_size;
+
+		for (uint16_t i = 0; i < count; i++) {
+			// Sample leaving the window: inside this chunk or still in history
+			int32_t old_index = (int32_t)i - block_size;
+			float x_old = (old_index >= 0) ? new_samples[old_index]
+			                               : ring[(departing + i) & mask];
+			float comb = new_samples[i] - x_old;
+
+			float a0 = c0 * a1 - a2 + comb;
+			a2 = a1;
+			a1 = a0;
+
+			float b0 = c1 * b1 - b2 + comb;
+			b2 = b1;
+			b1 = b0;
+
+			float d0 = c2 * d1 - d2 + comb;
+			d2 = d1;
+			d1 = d0;
+		}
+
+		b->s1[0] = a1; b->s2[0] = a2;
+		b->s1[1] = b1; b->s2[1] = b2;
+		b->s1[2] = d1; b->s2[2] = d2;
+	}
+}
+
+void sliding_goertzel_update_bin(SlidingGoertzelBank* bank, uint16_t bin,
+                                 float entering, float departing) {
+	SlidingGoertzelBin* b = &bank->bins[bin];
+	const float comb = entering - departing;
+	for (uint8_t t = 0; t < SLIDING_GOERTZEL_TERMS; t++) {
+		float y0 = b->coeff[t] * b->s1[t] - b->s2[t] + comb;
+		b->s2[t] = b->s1[t];
+		b->s1[t] = y0;
+	}
+}
+
+// A plain Goertzel pass over exactly N samples leaves the same state the
+// comb-fed resonator would have in exact arithmetic (h[N - 1] = 0 for integer k)
+void sliding_goertzel_resync_bin(SlidingGoertzelBank* bank, uint16_t bin,
+                                 const SampleRing* history) {
+	if (bin >= bank->num_bins) {
+		return;
+	}
+
+	SlidingGoertzelBin* b = &bank->bins[bin];
+	SampleSpan window = sample_ring_window(history, b->block_size);
+
+	for (uint8_t t = 0; t < SLIDING_GOERTZEL_TERMS; t++) {
+		float q1 = 0.0f;
+		float q2 = 0.0f;
+		goertzel_run(b->coeff[t], window.first, window.first_length, &q1, &q2);
+		goertzel_run(b->coeff[t], window.second, window.second_length, &q1, &q2);
+		b->s1[t] = q1;
+		b->s2[t] = q2;
+	}
+}
+
+void sliding_goertzel_resync_bin_flat(SlidingGoertzelBank* bank, uint16_t bin,
+                                      const float* window) {
+	if (bin >= bank->num_bins) {
+		return;
+	}
+
+	SlidingGoertzelBin* b = &bank->bins[bin];
+	for (uint8_t t = 0; t < SLIDING_GOERTZEL_TERMS; t++) {
+		float q1 = 0.0f;
+		float q2 = 0.0f;
+		goertzel_run(b->coeff[t], window, b->block_size, &q1, &q2);
+		b->s1[t] = q1;
+		b->s2[t] = q2;
+	}
+}
+
+void sliding_goertzel_resync_next(SlidingGoertzelBank* bank, const SampleRing* history) {
+	if (bank->num_bins == 0) {
+		return;
+	}
+
+	sliding_goertzel_resync_bin(bank, bank->resync_cursor, history);
+
+	bank->resync_cursor++;
+	if (bank->resync_cursor >= bank->num_bins) {
+		bank->resync_cursor = 0;
+	}
+}
+
+void sliding_goertzel_scale(SlidingGoertzelBank* bank, float factor) {
+	for (uint16_t bin = 0; bin < bank->num_bins; bin++) {
+		SlidingGoertzelBin* b = &bank->bins[bin];
+		for (uint8_t t = 0; t < SLIDING_GOERTZEL_TERMS; t++) {
+			b->s1[t] *= factor;
+			b->s2[t] *= factor;
+		}
+	}
+}
+
+void sliding_goertzel_dft(const SlidingGoertzelBank* bank, uint16_t bin, float* real, float* imag) {
+	float re = 0.0f;
+	float im = 0.0f;
+	if (bin < bank->num_bins) {
+		const SlidingGoertzelBin* b = &bank->bins[bin];
+
+		// DFT of the last N samples: X = e^(jw) * y[n] - y[n - 1]
+		for (uint8_t t = 0; t < SLIDING_GOERTZEL_TERMS; t++) {
+			re += b->gain[t] * (b->cosine[t] * b->s1[t] - b->s2[t]);
+			im += b->gain[t] * (b->sine[t] * b->s1[t]);
+		}
+	}
+	*real = re;
+	*imag = im;
+}
+
+float sliding_goertzel_magnitude(const SlidingGoertzelBank* bank, uint16_t bin) {
+	if (bin >= bank->num_bins || bank->bins[bin].block_size == 0) {
+		return 0.0f;
+	}
+
+	float real;
+	float imag;
+	sliding_goertzel_dft(bank, bin, &real, &imag);
+
+	float magnitude = sqrtf((real * real) + (imag * imag));
+	return magnitude / (bank->bins[bin].block_size / 2.0f);
+}
@@ -0,0 +1,109 @@
+// Sliding Goertzel - Incremental per-sample spectral engine
+// https://en.wikipedia.org/wiki/Goertzel_algorithm#Sliding_DFT
+//
+// Each bin keeps the state of a second-order Goertzel resonator fed by a comb
+// (x[n] - x[n-N]), so its output always equals the DFT of the most recent N
+// samples. A new 64-sample chunk costs 64 resonator steps per bin instead of a
+// full re-run over the bin's block (up to ~1400 samples plus a window gather).
+//
+// Windowing: the Gaussian window_lookup[] cannot be applied per sample once the
+// sum is recursive, so it is approximated by a cosine-sum window
+//     w[p] ~= a0 + ah * cos(2*pi*h*p / N)
+// which becomes a 3-term convolution in the frequency domain:
+//     X_w[k] = a0 * X[k] + (ah / 2) * (X[k - h] + X[k + h])
+// Every bin therefore runs three resonators (k - h, k, k + h).
+//
+// Drift: resonator poles sit on the unit circle, so float rounding in the comb
+// cancellation slowly accumulates. sliding_goertzel_resync_next() rebuilds one
+// bin per call from the raw history, bounding drift to one full sweep.
+//
+// The bank is sample-format agnostic: the spectrogram feeds it 64-sample chunks
+// from the sample ring, the tempo tracker feeds it one novelty value per tick.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef SLIDING_GOERTZEL_H
+#define SLIDING_GOERTZEL_H
+
+#include <stdint.h>
+#include "sample_ring.h"
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define SLIDING_GOERTZEL_TERMS 3            // Resonators per bin: k, k - h, k + h
+
+// Harmonic of the window approximation (window_lookup[] is two Gaussian humps
+// across the block, so its dominant cosine term has two cycles per window)
+#define SLIDING_GOERTZEL_WINDOW_HARMONIC 2
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+// Resonator bank state for a single frequency bin
+typedef struct {
+	uint16_t block_size;                        // Sliding window length N (samples)
+	float coeff[SLIDING_GOERTZEL_TERMS];        // 2*cos(w) per resonator
+	float cosine[SLIDING_GOERTZEL_TERMS];       // cos(w) per resonator
+	float sine[SLIDING_GOERTZEL_TERMS];         // sin(w) per resonator
+	float gain[SLIDING_GOERTZEL_TERMS];         // Window weight per resonator (a0, ah/2, ah/2)
+	float s1[SLIDING_GOERTZEL_TERMS];           // Resonator output y[n]
+	float s2[SLIDING_GOERTZEL_TERMS];           // Resonator output y[n - 1]
+} SlidingGoertzelBin;
+
+typedef struct {
+	SlidingGoertzelBin* bins;                   // Caller-owned storage (num_bins entries)
+	uint16_t num_bins;
+	uint16_t resync_cursor;                     // Next bin rebuilt by sliding_goertzel_resync_next()
+	float window_a0;                            // Cosine-sum fit of the block window (DC term)
+	float window_ah;                            // Cosine-sum fit of the block window (harmonic term)
+} SlidingGoertzelBank;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// Bind bin storage, clear all bins and fit the cosine-sum approximation to a
+// block window (window is sampled over one full block, e.g. window_lookup[4096])
+void sliding_goertzel_reset(SlidingGoertzelBank* bank, SlidingGoertzelBin* bins, uint16_t num_bins,
+                            const float* window, uint32_t window_length);
+
+// Configure one bin for an integer DFT index k over a block of block_size samples
+// (matches the k = round(N * f / fs) quantization used by init_goertzel())
+void sliding_goertzel_configure_bin(SlidingGoertzelBank* bank, uint16_t bin,
+                                    uint16_t block_size, float k);
+
+// Advance every bin by count new samples.
+// history must be the ring BEFORE new_samples are written to it, and its
+// capacity must be >= the largest block size.
+void sliding_goertzel_ingest(SlidingGoertzelBank* bank, const SampleRing* history,
+                             const float* new_samples, uint16_t count);
+
+// Advance a single bin by one sample: entering joins the window, departing
+// (the sample block_size positions older) leaves it
+void sliding_goertzel_update_bin(SlidingGoertzelBank* bank, uint16_t bin,
+                                 float entering, float departing);
+
+// Rebuild one bin's resonator state from the newest block_size samples of history
+void sliding_goertzel_resync_bin(SlidingGoertzelBank* bank, uint16_t bin,
+                                 const SampleRing* history);
+
+// Rebuild one bin's resonator state from a flat window (block_size samples, oldest first)
+void sliding_goertzel_resync_bin_flat(SlidingGoertzelBank* bank, uint16_t bin,
+                                      const float* window);
+
+// Rebuild the next bin in round-robin order (call once per audio frame)
+void sliding_goertzel_resync_next(SlidingGoertzelBank* bank, const SampleRing* history);
+
+// Scale every resonator (the bank is linear, so this matches scaling the history)
+void sliding_goertzel_scale(SlidingGoertzelBank* bank, float factor);
+
+// Windowed DFT of a bin's current window, phase-referenced to its oldest sample
+void sliding_goertzel_dft(const SlidingGoertzelBank* bank, uint16_t bin, float* real, float* imag);
+
+// Windowed magnitude of a bin, normalized by N/2 like goertzel_block_magnitude()
+float sliding_goertzel_magnitude(const SlidingGoertzelBank* bank, uint16_t bin);
+
+#endif  // SLIDING_GOERTZEL_H
@@ -0,0 +1,117 @@
+// Spectrogram History - Shared 8-bit ring of recent spectrum frames
+//
+// The audio task pushes one spectrum frame (0.0-1.0 per bin) per audio frame,
+// quantised to a byte per bin, so the whole ring is 64 bins x 128 frames =
+// 8 KB by default (the debug env builds a 16-frame, 1 KB ring). Patterns read it from the render core without locks or copies of
+// their own: a frame is addressed by its sequence number, which the audio
+// payload carries (history_frame), so a pattern indexes history relative to
+// the exact spectrum it is drawing.
+//
+// Exactly ONE writer. Any number of readers; the writer never waits for them.
+// A row can be overwritten while a reader is on it, so frames older than
+// SPECTROGRAM_HISTORY_DEPTH are refused and spectrogram_history_read()
+// re-checks the sequence after copying (the oldest rows are the only ones at
+// risk, and the guard keeps them SPECTROGRAM_HISTORY_GUARD frames away).
+//
+// Indexing convention: "age" 0 is the given frame, age 1 the one before, etc.
+//
+// Header-only and dependency-free so it can be unit tested on host.
+
+#ifndef SPECTROGRAM_HISTORY_H
+#define SPECTROGRAM_HISTORY_H
+
+#include <stdint.h>
+#include <atomic>
+#include <cstring>
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define SPECTROGRAM_HISTORY_BINS 64
+#ifndef SPECTROGRAM_HISTORY_FRAMES
+#define SPECTROGRAM_HISTORY_FRAMES 128     // Power of two (640 ms at 200 fps)
+#endif
+#define SPECTROGRAM_HISTORY_GUARD 8        // Rows kept clear of the writer (40 ms)
+#define SPECTROGRAM_HISTORY_DEPTH (SPECTROGRAM_HISTORY_FRAMES - SPECTROGRAM_HISTORY_GUARD)
+
+static_assert((SPECTROGRAM_HISTORY_FRAMES & (SPECTROGRAM_HISTORY_FRAMES - 1)) == 0,
+              "SPECTROGRAM_HISTORY_FRAMES must be a power of two");
+static_assert(SPECTROGRAM_HISTORY_FRAMES > SPECTROGRAM_HISTORY_GUARD,
+              "SPECTROGRAM_HISTORY_FRAMES must exceed SPECTROGRAM_HISTORY_GUARD");
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	uint8_t rows[SPECTROGRAM_HISTORY_FRAMES][SPECTROGRAM_HISTORY_BINS];
+	std::atomic<uint32_t> written;          // Frames pushed; frame n lives in rows[n % FRAMES]
+} SpectrogramHistory;
+
+// ============================================================================
+// API
+// ============================================================================
+
+inline void spectrogram_history_init(SpectrogramHistory* history) {
+	std::memset(history->rows, 0, sizeof(history->rows));
+	history->written.store(0, std::memory_order_relaxed);
+}
+
+// Writer: quantise and append one frame (values clamp to 0.0-1.0).
+// Returns the new frame count, i.e. the sequence number of this frame + 1.
+inline uint32_t spectrogram_history_push(SpectrogramHistory* history, const float* spectrum) {
+	const uint32_t frame = history->written.load(std::memory_order_relaxed);
+	uint8_t* row = history->rows[frame & (SPECTROGRAM_HISTORY_FRAMES - 1)];
+	for (uint16_t i = 0; i < SPECTROGRAM_HISTORY_BINS; i++) {
+		const float v = spectrum[i];
+		row[i] = (v <= 0.0f) ? 0 : (v >= 1.0f) ? 255 : (uint8_t)(v * 255.0f + 0.5f);
+	}
+	// Release: the row is complete before the count that exposes it
+	history->written.store(frame + 1, std::memory_order_release);
+	return frame + 1;
+}
+
+// Frames pushed so far (the newest frame is count - 1)
+inline uint32_t spectrogram_history_count(const SpectrogramHistory* history) {
+	return history->written.load(std::memory_order_acquire);
+}
+
+// True while frame `newest - age` has been pushed and is not near the writer
+inline bool spectrogram_history_valid(const SpectrogramHistory* history, uint32_t newest, uint16_t age) {
+	const uint32_t written = history->written.load(std::memory_order_acquire);
+	if (age > newest || newest >= written) {
+		return false;
+	}
+	// How far the frame asked for is behind the newest pushed frame
+	return (written - 1 - newest) + age < SPECTROGRAM_HISTORY_DEPTH;
+}
+
+// Copy frame `newest - age` into out[SPECTROGRAM_HISTORY_BINS].
+// Returns false (out zeroed) if the frame is not available or was
+// overwritten during the copy.
+inline bool spectrogram_history_read(const SpectrogramHistory* history, uint32_t newest,
+                                     uint16_t age, uint8_t* out) {
+	if (spectrogram_history_valid(history, newest, age)) {
+		std::memcpy(out, history->rows[(newest - age) & (SPECTROGRAM_HISTORY_FRAMES - 1)],
+		            SPECTROGRAM_HISTORY_BINS);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (spectrogram_history_valid(history, newest, age)) {
+			return true;
+		}
+	}
+	std::memset(out, 0, SPECTROGRAM_HISTORY_BINS);
+	return false;
+}
+
+// One bin of frame `newest - age` as 0.0-1.0 (0.0 if the frame is not available).
+// A single byte never tears, so no re-check is needed.
+inline float spectrogram_history_value(const SpectrogramHistory* history, uint32_t newest,
+                                       uint16_t age, uint16_t bin) {
+	if (bin >= SPECTROGRAM_HISTORY_BINS || !spectrogram_history_valid(history, newest, age)) {
+		return 0.0f;
+	}
+	return history->rows[(newest - age) & (SPECTROGRAM_HISTORY_FRAMES - 1)][bin] * (1.0f / 255.0f);
+}
+
+#endif  // SPECTROGRAM_HISTORY_H
@@ -9,6 +9,12 @@
 #include "validation/tempo_validation.h"
 #include "logging/logger.h"
 #include "../dsps_helpers.h"
+#include "running_stats.h"
+#include "hpss.h"
+#include "beat_tracker.h"
+#if TEMPO_SLIDING_ENABLED
+#include "tempo_bank.h"
+#endif
 
 static const char* TAG = "TEMPO";
 
@@ -30,6 +36,52 @@ float tempi_power_sum = 0.0f;
 
 bool silence_detected = true;
 float silence_level = 1.0f;
+float percussive_energy = 0.0f;
+float harmonic_energy = 0.0f;
+
+// Scale applied by the last normalize_novelty_curve() (novelty_curve -> normalized)
+static float novelty_auto_scale = 1.0f;
+
+// Decaying novelty peak behind novelty_auto_scale (warm-started from flash)
+static float novelty_ceiling = 0.00001f;
+
+// Harmonic/percussive split of spectrogram_smooth at the novelty rate
+static HpssState novelty_hpss;
+
+// Phase-locked loops on the strongest tempo bins (fed onsets by update_novelty())
+static BeatTracker beat_tracker;
+
+// Bins below this share of the strongest tempi_smooth[] bin are dead: their
+// phase is not advanced between novelty ticks (tempo_phase[] of a bin that
+// quiet is not visible, and the next Goertzel pass re-anchors it anyway)
+#define TEMPO_PHASE_LIVE_FRACTION 0.05f
+
+// Warm-start tempo prior: seeds tempi_smooth[] on the first active frame
+// (the silence -> active transition clears the bins before that)
+static float tempo_prior[NUM_TEMPI];
+static bool tempo_prior_pending = false;
+
+// Running extrema of the raw novelty curve, kept in step by log_novelty() and
+// reduce_tempo_history() so normalize_novelty_curve() and check_silence() do
+// not rescan it every frame:
+//   - peak: the whole curve
+//   - silence max/min: the SILENCE_WINDOW_LENGTH values before the newest
+#define SILENCE_WINDOW_LENGTH 128
+static float novelty_peak_values[NOVELTY_HISTORY_LENGTH];
+static uint16_t novelty_peak_stamps[NOVELTY_HISTORY_LENGTH];
+static RunningExtremum novelty_peak_window;
+static float silence_max_values[SILENCE_WINDOW_LENGTH];
+static uint16_t silence_max_stamps[SILENCE_WINDOW_LENGTH];
+static RunningExtremum silence_max_window;
+static float silence_min_values[SILENCE_WINDOW_LENGTH];
+static uint16_t silence_min_stamps[SILENCE_WINDOW_LENGTH];
+static RunningExtremum silence_min_window;
+
+#if TEMPO_SLIDING_ENABLED
+static_assert(NUM_TEMPI <= TEMPO_BANK_MAX_BINS, "TempoBank too small for NUM_TEMPI");
+static TempoBank tempo_bank;
+static uint32_t tempo_bank_ticks_consumed = 0;  // tempo_bank.ticks at the last full refresh
+#endif
 
 // ============================================================================ 
 // HELPERS
@@ -78,6 +130,24 @@ uint16_t find_closest_tempo_bin(float target_bpm) {
     return smallest_difference_index;
 }
 
+// Rebuild the running extrema from the current novelty curve
+static void reset_novelty_windows() {
+    running_extremum_init(&novelty_peak_window, novelty_peak_values, novelty_peak_stamps,
+                          NOVELTY_HISTORY_LENGTH, true);
+    running_extremum_init(&silence_max_window, silence_max_values, silence_max_stamps,
+                          SILENCE_WINDOW_LENGTH, true);
+    running_extremum_init(&silence_min_window, silence_min_values, silence_min_stamps,
+                          SILENCE_WINDOW_LENGTH, false);
+
+    for (uint16_t i = 0; i < NOVELTY_HISTORY_LENGTH; i++) {
+        running_extremum_push(&novelty_peak_window, novelty_curve[i]);
+    }
+    for (uint16_t i = NOVELTY_HISTORY_LENGTH - 1 - SILENCE_WINDOW_LENGTH; i < NOVELTY_HISTORY_LENGTH - 1; i++) {
+        running_extremum_push(&silence_max_window, novelty_curve[i]);
+        running_extremum_push(&silence_min_window, novelty_curve[i]);
+    }
+}
+
 void init_tempo_goertzel_constants() {
     // Validate array bounds and initialization
     if (!tempi_bpm_values_hz) {
@@ -100,6 +170,14 @@ void init_tempo_goertzel_constants() {
         tempi_bpm_values_hz[i] = tempo / 60.0f;
     }
 
+#if TEMPO_SLIDING_ENABLED
+    tempo_bank_reset(&tempo_bank, NUM_TEMPI, window_lookup, 4096);
+    tempo_bank_ticks_consumed = 0;
+#endif
+    reset_novelty_windows();
+    hpss_init(&novelty_hpss, NUM_FREQS);
+    beat_tracker_init(&beat_tracker);
+
     for (uint16_t i = 0; i < NUM_TEMPI; i++) {
         tempi[i].target_tempo_hz = tempi_bpm_values_hz[i];
 
@@ -146,11 +224,13 @@ void init_tempo_goertzel_constants() {
         tempi[i].sine = sinf(w);
         tempi[i].coeff = 2.0f * tempi[i].cosine;
         tempi[i].window_step = 4096.0f / tempi[i].block_size;
+#if TEMPO_SLIDING_ENABLED
+        tempo_bank_configure_bin(&tempo_bank, i, tempi[i].block_size, k);
+#endif
         tempi[i].phase = 0.0f;
         tempi[i].phase_target = 0.0f;
         tempi[i].phase_inverted = false;
         tempi[i].phase_radians_per_reference_frame = ((2.0f * static_cast<float>(M_PI) * tempi[i].target_tempo_hz) / REFERENCE_FPS);
-        tempi[i].beat = 0.0f;
         tempi[i].magnitude = 0.0f;
         tempi[i].magnitude_full_scale = 0.0f;
         tempi[i].magnitude_smooth = 0.0f;
@@ -171,6 +251,23 @@ static float calculate_magnitude_of_tempo(uint16_t tempo_bin) {
     profile_function([&]() {
         uint32_t block_size = tempi[tempo_bin].block_size;
 
+#if TEMPO_SLIDING_ENABLED
+        // Only reached from the full ascending refresh, so a neighbour sharing
+        // this bin's slot has already been computed with identical output
+        if (tempo_bin > 0 && tempo_bank_same_slot(&tempo_bank, tempo_bin, tempo_bin - 1)) {
+            tempi[tempo_bin].phase = tempi[tempo_bin - 1].phase;
+            normalized_magnitude = tempi[tempo_bin - 1].magnitude_full_scale;
+            tempi[tempo_bin].magnitude_full_scale = normalized_magnitude;
+            return;
+        }
+
+        // Bank runs on raw novelty; the Goertzel is linear, so the normalization
+        // scale can be applied to its output instead of to the whole curve
+        float real;
+        float imag;
+        tempo_bank_goertzel_output(&tempo_bank, tempo_bin, novelty_auto_scale, &real, &imag);
+        float magnitude_squared = (real * real) + (imag * imag);
+#else
         float q1 = 0.0f;
         float q2 = 0.0f;
         float window_pos = 0.0f;
@@ -188,9 +285,11 @@ static float calculate_magnitude_of_tempo(uint16_t tempo_bin) {
         float real = (q1 - q2 * tempi[tempo_bin].cosine);
         float imag = (q2 * tempi[tempo_bin].sine);
 
+        float magnitude_squared = (q1 * q1) + (q2 * q2) - q1 * q2 * tempi[tempo_bin].coeff;
+#endif
+
         tempi[tempo_bin].phase = unwrap_phase(atan2f(imag, real) + (static_cast<float>(M_PI) * BEAT_SHIFT_PERCENT));
 
-        float magnitude_squared = (q1 * q1) + (q2 * q2) - q1 * q2 * tempi[tempo_bin].coeff;
         float magnitude = sqrtf(fmaxf(magnitude_squared, 0.0f));
         normalized_magnitude = magnitude / (block_size / 2.0f);
         tempi[tempo_bin].magnitude_full_scale = normalized_magnitude;
@@ -240,20 +339,15 @@ static void calculate_tempi_magnitudes(int16_t single_bin = -1) {
 
 static void normalize_novelty_curve() {
     profile_function([&]() {
-        static float max_val = 0.00001f;
         static float max_val_smooth = 0.1f;
+        float& max_val = novelty_ceiling;
 
         max_val *= 0.99f;
-        for (uint16_t i = 0; i < NOVELTY_HISTORY_LENGTH; i += 4) {
-            max_val = fmaxf(max_val, novelty_curve[i + 0]);
-            max_val = fmaxf(max_val, novelty_curve[i + 1]);
-            max_val = fmaxf(max_val, novelty_curve[i + 2]);
-            max_val = fmaxf(max_val, novelty_curve[i + 3]);
-        }
+        max_val = fmaxf(max_val, running_extremum_value(&novelty_peak_window, 0.0f));
         max_val_smooth = fmaxf(0.1f, max_val_smooth * 0.95f + max_val * 0.05f);  // Increased from 1% to 5% per frame for faster adaptation (0.4s vs 2s)
 
-        float auto_scale = 1.0f / fmaxf(max_val, 0.00001f);
-        dsps_mulc_f32(novelty_curve, novelty_curve_normalized, NOVELTY_HISTORY_LENGTH, auto_scale, 1, 1);
+        novelty_auto_scale = 1.0f / fmaxf(max_val, 0.00001f);
+        dsps_mulc_f32(novelty_curve, novelty_curve_normalized, NOVELTY_HISTORY_LENGTH, novelty_auto_scale, 1, 1);
     }, __func__);
 }
 
@@ -264,6 +358,15 @@ void update_tempo() {
 
         normalize_novelty_curve();
 
+#if TEMPO_SLIDING_ENABLED
+        // Every bin is current after each novelty tick: refresh the whole
+        // tempogram once per tick. Between ticks the window has not moved, and
+        // sync_beat_phase() keeps advancing the phases on its own.
+        if (tempo_bank.ticks != tempo_bank_ticks_consumed) {
+            tempo_bank_ticks_consumed = tempo_bank.ticks;
+            calculate_tempi_magnitudes();
+        }
+#else
         static uint16_t calc_bin = 0;
         uint16_t max_bin = (NUM_TEMPI - 1) * MAX_TEMPO_RANGE;
 
@@ -278,6 +381,7 @@ void update_tempo() {
         if (calc_bin >= max_bin) {
             calc_bin = 0;
         }
+#endif
 
         // DEBUG: Print every 3.3 seconds (330 frames @ 100 FPS) - Gated by 't' keystroke
         extern bool tempo_debug_enabled;
@@ -313,6 +417,15 @@ void update_tempo() {
 }
 
 static void log_novelty(float input) {
+#if TEMPO_SLIDING_ENABLED
+    // Bank reads the departing samples, so it must run before the shift
+    tempo_bank_push(&tempo_bank, novelty_curve, NOVELTY_HISTORY_LENGTH);
+#endif
+    // The outgoing newest value becomes the newest one check_silence() reads
+    running_extremum_push(&silence_max_window, novelty_curve[NOVELTY_HISTORY_LENGTH - 1]);
+    running_extremum_push(&silence_min_window, novelty_curve[NOVELTY_HISTORY_LENGTH - 1]);
+    running_extremum_push(&novelty_peak_window, input);
+
     shift_array_left(novelty_curve, NOVELTY_HISTORY_LENGTH, 1);
     novelty_curve[NOVELTY_HISTORY_LENGTH - 1] = input;
 }
@@ -329,19 +442,22 @@ static void reduce_tempo_history(float reduction_amount) {
         novelty_curve[i] = fmaxf(novelty_curve[i] * reduction_amount_inv, 0.00001f);
         vu_curve[i] = fmaxf(vu_curve[i] * reduction_amount_inv, 0.00001f);
     }
+    running_extremum_rescale(&novelty_peak_window, reduction_amount_inv, 0.00001f);
+    running_extremum_rescale(&silence_max_window, reduction_amount_inv, 0.00001f);
+    running_extremum_rescale(&silence_min_window, reduction_amount_inv, 0.00001f);
+
+#if TEMPO_SLIDING_ENABLED
+    tempo_bank_scale(&tempo_bank, reduction_amount_inv);
+#endif
 }
 
 void check_silence(float current_novelty) {
-    float min_val = 1.0f;
-    float max_val = 0.0f;
-    for (uint16_t i = 0; i < 128; i++) {
-        float recent_novelty = novelty_curve_normalized[(NOVELTY_HISTORY_LENGTH - 1 - 128) + i];
-        recent_novelty = fminf(0.5f, recent_novelty) * 2.0f;
-
-        float scaled_value = sqrtf(recent_novelty);
-        max_val = fmaxf(max_val, scaled_value);
-        min_val = fminf(min_val, scaled_value);
-    }
+    // sqrt(min(0.5, x) * 2) is monotonic, so the extremes of the mapped window
+    // are the mapped extremes of the raw window (normalized = raw * auto scale)
+    float max_val = running_extremum_value(&silence_max_window, 0.0f) * novelty_auto_scale;
+    float min_val = running_extremum_value(&silence_min_window, 0.0f) * novelty_auto_scale;
+    max_val = sqrtf(fminf(0.5f, max_val) * 2.0f);
+    min_val = sqrtf(fminf(0.5f, min_val) * 2.0f);
     float novelty_contrast = fabsf(max_val - min_val);
     float silence_level_raw = 1.0f - novelty_contrast;
 
@@ -367,9 +483,18 @@ void update_novelty() {
     if (t_now_us >= next_update) {
         next_update += update_interval_us;
 
+        // Flux of the percussive part only: sustained partials would otherwise
+        // add onsets of their own every time they swell or waver
+        float percussive_mask[NUM_FREQS];
+        hpss_process(&novelty_hpss, spectrogram_smooth, percussive_mask, &percussive_energy, &harmonic_energy);
+
         float current_novelty = 0.0f;
         for (uint16_t i = 0; i < NUM_FREQS; i++) {
+#if NOVELTY_PERCUSSIVE_ENABLED
+            float new_mag = spectrogram_smooth[i] * percussive_mask[i];
+#else
             float new_mag = spectrogram_smooth[i];
+#endif
             float novelty = fmaxf(0.0f, new_mag - frequencies_musical[i].magnitude_last);
             frequencies_musical[i].novelty = novelty;
             frequencies_musical[i].magnitude_last = new_mag;
@@ -379,7 +504,9 @@ void update_novelty() {
 
         check_silence(current_novelty);
 
-        log_novelty(logf(1.0f + current_novelty));
+        const float log_novelty_value = logf(1.0f + current_novelty);
+        log_novelty(log_novelty_value);
+        beat_tracker_novelty(&beat_tracker, log_novelty_value, 1.0f / NOVELTY_LOG_HZ);
         log_vu(vu_max);
         vu_max = 0.000001f;
     }
@@ -394,12 +521,16 @@ static void sync_beat_phase(uint16_t tempo_bin, float delta) {
     } else if (tempi[tempo_bin].phase < -static_cast<float>(M_PI)) {
         tempi[tempo_bin].phase += (2.0f * static_cast<float>(M_PI));
     }
-
-    tempi[tempo_bin].beat = sinf(tempi[tempo_bin].phase);
 }
 
 void update_tempi_phase(float delta) {
+    if (tempo_prior_pending) {
+        memcpy(tempi_smooth, tempo_prior, sizeof(float) * NUM_TEMPI);
+        tempo_prior_pending = false;
+    }
+
     tempi_power_sum = 0.00000001f;
+    float max_smooth = 0.0f;
 
     // ========================================================================
     // EMOTISCOPE VERBATIM: Simple smoothing + max contribution confidence
@@ -411,22 +542,31 @@ void update_tempi_phase(float delta) {
         // Fixed smoothing alpha (Emotiscope: 0.025)
         tempi_smooth[tempo_bin] = tempi_smooth[tempo_bin] * 0.975f + tempi_magnitude * 0.025f;
         tempi_power_sum += tempi_smooth[tempo_bin];
+        max_smooth = fmaxf(max_smooth, tempi_smooth[tempo_bin]);
+    }
+
+    // Free-running phase for the live bins only
+    const float live_floor = max_smooth * TEMPO_PHASE_LIVE_FRACTION;
+    for (uint16_t tempo_bin = 0; tempo_bin < NUM_TEMPI; tempo_bin++) {
+        if (tempi_smooth[tempo_bin] >= live_floor) {
+            sync_beat_phase(tempo_bin, delta);
+        }
+    }
 
-        sync_beat_phase(tempo_bin, delta);
+    // The loops follow the strongest bins
+    float bin_phase[NUM_TEMPI];
+    for (uint16_t tempo_bin = 0; tempo_bin < NUM_TEMPI; tempo_bin++) {
+        bin_phase[tempo_bin] = tempi[tempo_bin].phase;
     }
+    beat_tracker_advance(&beat_tracker, delta / REFERENCE_FPS);
+    beat_tracker_select(&beat_tracker, tempi_smooth, tempi_bpm_values_hz, bin_phase, NUM_TEMPI);
 
     // ========================================================================
     // EMOTISCOPE BASELINE: Simple max contribution confidence
     // ========================================================================
 
-    // Calculate confidence as max contribution (Emotiscope algorithm)
-    float max_contribution = 0.000001f;
-    for (uint16_t tempo_bin = 0; tempo_bin < NUM_TEMPI; tempo_bin++) {
-        max_contribution = fmaxf(
-            tempi_smooth[tempo_bin] / tempi_power_sum,
-            max_contribution
-        );
-    }
+    // Max contribution (Emotiscope algorithm): the largest bin's share of the sum
+    float max_contribution = fmaxf(max_smooth / tempi_power_sum, 0.000001f);
 
     // ========================================================================
     // PHASE 1: ENTROPY LAYER - Ambiguity detection
@@ -457,3 +597,24 @@ void update_tempi_phase(float delta) {
     float alpha = calculate_adaptive_alpha(filtered_magnitude, tempi_smooth[tempo_bin], tempo_confidence_metrics.combined);
     */
 }
+
+float get_novelty_ceiling() {
+    return novelty_ceiling;
+}
+
+void set_novelty_ceiling(float ceiling) {
+    novelty_ceiling = fmaxf(ceiling, 0.00001f);
+}
+
+const BeatTracker* get_beat_tracker() {
+    return &beat_tracker;
+}
+
+void reset_beat_tracker() {
+    beat_tracker_clear(&beat_tracker);
+}
+
+void set_tempo_prior(const float* prior) {
+    memcpy(tempo_prior, prior, sizeof(float) * NUM_TEMPI);
+    tempo_prior_pending = true;
+}
@@ -32,6 +32,18 @@
 #define BEAT_SHIFT_PERCENT (0.08)
 #define REFERENCE_FPS (100.0f)
 
+// Incremental tempo bank: every bin is advanced per novelty tick and all bins
+// are refreshed each tick. Set to 0 for the round-robin block Goertzel.
+#ifndef TEMPO_SLIDING_ENABLED
+#define TEMPO_SLIDING_ENABLED 1
+#endif
+
+// Novelty is the spectral flux of the percussive part of spectrogram_smooth
+// (hpss.h). Set to 0 for the flux of the whole spectrum.
+#ifndef NOVELTY_PERCUSSIVE_ENABLED
+#define NOVELTY_PERCUSSIVE_ENABLED 1
+#endif
+
 // Runtime tuning knob: minimum VU to allow tempo updates/beat emission
 #ifndef VU_LOCK_GATE
 #define VU_LOCK_GATE (0.08f)
@@ -55,6 +67,10 @@ extern float tempi_power_sum;                                  // Sum of tempo m
 // Silence detection
 extern bool silence_detected;
 extern float silence_level;
+
+// Harmonic/percussive split of the spectrum, refreshed at NOVELTY_LOG_HZ
+extern float percussive_energy;                    // Mean percussive part of spectrogram_smooth
+extern float harmonic_energy;                      // Mean harmonic part
 extern uint32_t t_now_us;
 extern uint32_t t_now_ms;
 
@@ -77,6 +93,27 @@ void update_novelty();
 void update_tempi_phase(float delta);
 void check_silence(float current_novelty);
 
+// ============================================================================
+// PUBLIC API - BEAT TRACKER (beat_tracker.h)
+// ============================================================================
+
+// Loops on the strongest tempo bins, refreshed by update_tempi_phase()
+const BeatTracker* get_beat_tracker();
+
+// Drop the tracked hypotheses (silence: the tempo bins are cleared too)
+void reset_beat_tracker();
+
+// ============================================================================
+// PUBLIC API - WARM START (audio_warm_start.h)
+// ============================================================================
+
+// Novelty normalisation peak (decays 1% per frame toward the curve's maximum)
+float get_novelty_ceiling();
+void set_novelty_ceiling(float ceiling);
+
+// Seed tempi_smooth[] with prior[NUM_TEMPI] on the next update_tempi_phase()
+void set_tempo_prior(const float* prior);
+
 // ============================================================================
 // PUBLIC API - UTILITY FUNCTIONS
 // ============================================================================
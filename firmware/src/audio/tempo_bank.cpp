@@ -0,0 +1,93 @@
+// Tempo Bank Implementation
+// Sliding Goertzel slots over the flat novelty curve, shared by equivalent bins
+
+#include "tempo_bank.h"
+#include <cstring>
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void tempo_bank_reset(TempoBank* tb, uint16_t num_bins, const float* window, uint32_t window_length) {
+	if (num_bins > TEMPO_BANK_MAX_BINS) {
+		num_bins = TEMPO_BANK_MAX_BINS;
+	}
+	sliding_goertzel_reset(&tb->bank, tb->slots, TEMPO_BANK_MAX_BINS, window, window_length);
+	memset(tb->slot_k, 0, sizeof(tb->slot_k));
+	memset(tb->bin_slot, 0, sizeof(tb->bin_slot));
+	tb->num_bins = num_bins;
+	tb->num_slots = 0;
+	tb->resync_cursor = 0;
+	tb->ticks = 0;
+}
+
+void tempo_bank_configure_bin(TempoBank* tb, uint16_t bin, uint16_t block_size, float k) {
+	if (bin >= tb->num_bins) {
+		return;
+	}
+
+	for (uint16_t slot = 0; slot < tb->num_slots; slot++) {
+		if (tb->slots[slot].block_size == block_size && tb->slot_k[slot] == k) {
+			tb->bin_slot[bin] = (uint8_t)slot;
+			return;
+		}
+	}
+
+	uint16_t slot = tb->num_slots++;
+	sliding_goertzel_configure_bin(&tb->bank, slot, block_size, k);
+	tb->slot_k[slot] = k;
+	tb->bin_slot[bin] = (uint8_t)slot;
+}
+
+void tempo_bank_push(TempoBank* tb, const float* history, uint32_t history_length) {
+	SlidingGoertzelBank* bank = &tb->bank;
+
+	// The window ends one sample before the newest, so the previous newest
+	// value enters and the one block_size before it leaves
+	const float entering = history[history_length - 1];
+	for (uint16_t slot = 0; slot < tb->num_slots; slot++) {
+		const uint32_t block_size = tb->slots[slot].block_size;
+		sliding_goertzel_update_bin(bank, slot, entering, history[(history_length - 1) - block_size]);
+	}
+
+	tb->ticks++;
+	if ((tb->ticks % TEMPO_BANK_RESYNC_INTERVAL_TICKS) == 0 && tb->num_slots > 0) {
+		uint16_t slot = tb->resync_cursor;
+		const uint32_t block_size = tb->slots[slot].block_size;
+
+		// Post-push window is history[L - N .. L - 1] (before the caller's shift)
+		sliding_goertzel_resync_bin_flat(bank, slot, history + (history_length - block_size));
+
+		tb->resync_cursor++;
+		if (tb->resync_cursor >= tb->num_slots) {
+			tb->resync_cursor = 0;
+		}
+	}
+}
+
+void tempo_bank_scale(TempoBank* tb, float factor) {
+	sliding_goertzel_scale(&tb->bank, factor);
+}
+
+void tempo_bank_goertzel_output(const TempoBank* tb, uint16_t bin, float input_scale,
+                                float* real, float* imag) {
+	if (bin >= tb->num_bins) {
+		*real = 0.0f;
+		*imag = 0.0f;
+		return;
+	}
+
+	const uint16_t slot = tb->bin_slot[bin];
+	float dft_real;
+	float dft_imag;
+	sliding_goertzel_dft(&tb->bank, slot, &dft_real, &dft_imag);
+	dft_real *= input_scale;
+	dft_imag *= input_scale;
+
+	// Goertzel output q1 - q2 * e^(-jw) equals the DFT rotated by e^(-jw)
+	const SlidingGoertzelBin* b = &tb->slots[slot];
+	const float c = b->cosine[0];
+	const float s = b->sine[0];
+	*real = dft_real * c + dft_imag * s;
+	*imag = dft_imag * c - dft_real * s;
+}
@@ -0,0 +1,84 @@
+// Tempo Bank - Incremental tempogram over the novelty curve
+//
+// Every tempo bin is a sliding Goertzel (see sliding_goertzel.h) fed one
+// novelty sample per tick, so all bins are current after every log_novelty()
+// instead of one full 1023-sample windowed Goertzel per audio frame.
+//
+// Neighbouring tempo bins quantize to the same block size and DFT index (192
+// bins map onto ~35 distinct (N, k) pairs), so bins share resonator slots.
+//
+// Cost per tick: 3 resonator steps per slot (~105), plus one slot rebuilt from
+// the raw curve every TEMPO_BANK_RESYNC_INTERVAL_TICKS ticks to bound float
+// drift. The old round-robin path spent ~1023 windowed steps per frame and
+// needed ~192 frames for one full tempogram.
+//
+// Window convention matches calculate_magnitude_of_tempo(): each bin covers
+// the block_size samples ending one sample before the newest novelty value.
+//
+// Pure C++ (no FreeRTOS/Arduino dependencies) so it can be unit tested on host.
+
+#ifndef TEMPO_BANK_H
+#define TEMPO_BANK_H
+
+#include <stdint.h>
+#include "sliding_goertzel.h"
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define TEMPO_BANK_MAX_BINS 192             // >= NUM_TEMPI
+
+// One slot is rebuilt from the novelty curve every N ticks
+// (~35 slots * 16 ticks / 50 Hz = full sweep every ~11 seconds)
+#ifndef TEMPO_BANK_RESYNC_INTERVAL_TICKS
+#define TEMPO_BANK_RESYNC_INTERVAL_TICKS 16
+#endif
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+	SlidingGoertzelBin slots[TEMPO_BANK_MAX_BINS];
+	SlidingGoertzelBank bank;                   // One sliding bin per distinct (N, k)
+	float slot_k[TEMPO_BANK_MAX_BINS];          // DFT index of each slot
+	uint8_t bin_slot[TEMPO_BANK_MAX_BINS];      // Tempo bin -> slot
+	uint16_t num_bins;
+	uint16_t num_slots;
+	uint16_t resync_cursor;                     // Next slot rebuilt by tempo_bank_push()
+	uint32_t ticks;                             // Samples pushed since reset
+} TempoBank;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// Clear the bank and fit the block window (e.g. window_lookup[4096])
+void tempo_bank_reset(TempoBank* tb, uint16_t num_bins, const float* window, uint32_t window_length);
+
+// Configure one bin (block_size must be < the history length passed to push);
+// bins with an identical (block_size, k) share a slot
+void tempo_bank_configure_bin(TempoBank* tb, uint16_t bin, uint16_t block_size, float k);
+
+// Advance every bin by one tick. history is the flat novelty curve (oldest
+// first) BEFORE the new value is shifted in; its newest sample enters the
+// window. Also rebuilds one slot every TEMPO_BANK_RESYNC_INTERVAL_TICKS.
+void tempo_bank_push(TempoBank* tb, const float* history, uint32_t history_length);
+
+// Scale every bin (mirror of scaling the whole novelty history; the floor that
+// reduce_tempo_history() applies is left to the periodic resync)
+void tempo_bank_scale(TempoBank* tb, float factor);
+
+// True when two bins share a slot (and therefore produce identical output)
+inline bool tempo_bank_same_slot(const TempoBank* tb, uint16_t bin_a, uint16_t bin_b) {
+	return tb->bin_slot[bin_a] == tb->bin_slot[bin_b];
+}
+
+// Windowed DFT of a bin scaled by input_scale, in the Goertzel output
+// convention used by calculate_magnitude_of_tempo():
+//   real = q1 - q2 * cos(w), imag = q2 * sin(w)
+void tempo_bank_goertzel_output(const TempoBank* tb, uint16_t bin, float input_scale,
+                                float* real, float* imag);
+
+#endif  // TEMPO_BANK_H
@@ -37,11 +37,16 @@ void init_vu() {
 void run_vu() {
     profile_function([&]() {
         static float max_amplitude_cap = 0.0000001f;
-        float* samples = &sample_history[(SAMPLE_HISTORY_LENGTH - 1) - AUDIO_CHUNK_SIZE];
+        // Latest chunk (legacy offset: ends one sample before the newest)
+        SampleSpan samples = sample_ring_window(&sample_history, AUDIO_CHUNK_SIZE, 1);
 
         float max_amplitude_now = 0.000001f;
-        for (uint16_t i = 0; i < AUDIO_CHUNK_SIZE; i++) {
-            float sample_abs = std::fabs(samples[i]);
+        for (uint32_t i = 0; i < samples.first_length; i++) {
+            float sample_abs = std::fabs(samples.first[i]);
+            max_amplitude_now = fmaxf(max_amplitude_now, sample_abs * sample_abs);
+        }
+        for (uint32_t i = 0; i < samples.second_length; i++) {
+            float sample_abs = std::fabs(samples.second[i]);
             max_amplitude_now = fmaxf(max_amplitude_now, sample_abs * sample_abs);
         }
         max_amplitude_now = clip_float(max_amplitude_now);
@@ -3,6 +3,7 @@
 #include "color_pipeline.h"
 #include <math.h>
 #include "audio/tempo.h"  // for REFERENCE_FPS
+#include "color_pipeline_fused.h"
 
 namespace {
 
@@ -93,7 +94,35 @@ static inline void apply_tonemap_internal() {
     }
 }
 
+#if COLOR_PIPELINE_FUSED_ENABLED
+// One pass over leds[]: LPF + LUT curves + remap + dither, written to fastled_leds[]
+static void apply_color_pipeline_fused(const PatternParameters& params) {
+    static ColorLut s_lut;
+    static CRGBF s_prev[NUM_LEDS];
+    static bool s_inited = false;
+    if (!s_inited) { for (uint16_t i = 0; i < NUM_LEDS; ++i) s_prev[i] = leds[i]; s_inited = true; }
+
+    color_lut_update(&s_lut, params.warmth, params.brightness);
+
+    ColorPipelineFrame frame;
+    frame.lut = &s_lut;
+    frame.frame = leds;
+    frame.lpf_state = s_prev;
+    frame.lpf_alpha = color_pipeline_lpf_alpha(params.softness, REFERENCE_FPS);
+    frame.dither_error = dither_error;
+    frame.out = reinterpret_cast<uint8_t*>(fastled_leds);
+    frame.num_leds = NUM_LEDS;
+    frame.offset_px = static_cast<int16_t>(lroundf(params.led_offset));
+    frame.output_scale = fmaxf(0.0f, fminf(1.0f, global_brightness)) * 255.0f;
+    frame.dithering = (params.dithering >= 0.5f);
+    color_pipeline_fused(&frame);
+}
+#endif
+
 void apply_color_pipeline(const PatternParameters& params) {
+#if COLOR_PIPELINE_FUSED_ENABLED
+    apply_color_pipeline_fused(params);
+#else
     // Legacy order: LPF -> tone-map -> warmth -> white balance -> gamma
     apply_image_lpf_internal(params.softness);
     apply_tonemap_internal();
@@ -107,4 +136,5 @@ void apply_color_pipeline(const PatternParameters& params) {
         leds[i].b *= master;
     }
     apply_gamma_internal(2.0f);
+#endif
 }
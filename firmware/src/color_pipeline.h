@@ -7,6 +7,13 @@
 #include "parameters.h"
 #include "led_driver.h"  // leds[], NUM_LEDS
 
+// Fused single-pass pipeline (color_pipeline_fused.h): apply_color_pipeline()
+// also remaps, dithers and quantizes straight into fastled_leds[], and
+// transmit_leds() only sends. Set to 0 for the multi-pass path.
+#ifndef COLOR_PIPELINE_FUSED_ENABLED
+#define COLOR_PIPELINE_FUSED_ENABLED 1
+#endif
+
 // Applies warmth (incandescent blend), white balance and gamma correction to leds[]
 // Call immediately before quantization/transmit.
 void apply_color_pipeline(const PatternParameters& params);
@@ -0,0 +1,130 @@
+// Fused color pipeline implementation: one pass, LUT-based curves
+
+#include "color_pipeline_fused.h"
+#include <math.h>
+
+namespace {
+
+// Legacy-derived constants (mirrors color_pipeline.cpp)
+const float kWhiteBalance[3] = {1.0f, 0.9375f, 0.84f};
+const float kIncandescent[3] = {1.0f, 0.4452f, 0.1562f};
+
+static inline float clamp01(float v) {
+    if (v < 0.0f) return 0.0f;
+    if (v > 1.0f) return 1.0f;
+    return v;
+}
+
+static inline float soft_clip_hdr(float v) {
+    if (v < 0.75f) return v;
+    float t = (v - 0.75f) * 4.0f;
+    return 0.75f + 0.25f * tanhf(t);
+}
+
+// Linear interpolation into one channel's table
+static inline float lut_eval(const float* table, float x) {
+    const float scale = COLOR_LUT_ENTRIES / COLOR_LUT_INPUT_MAX;
+    if (x <= 0.0f) return table[0];
+    float pos = x * scale;
+    if (pos >= (float)COLOR_LUT_ENTRIES) return table[COLOR_LUT_ENTRIES];
+    uint32_t idx = (uint32_t)pos;
+    float frac = pos - (float)idx;
+    return table[idx] + (table[idx + 1] - table[idx]) * frac;
+}
+
+// Truncating quantizer with thresholded error accumulation (legacy transmit_leds)
+static inline uint8_t quantize_dither(float dec, float* error) {
+    uint8_t out = (uint8_t)dec;
+    float new_err = dec - (float)out;
+    if (new_err >= COLOR_DITHER_THRESHOLD) *error += new_err;
+    if (*error >= 1.0f) { out += 1; *error -= 1.0f; }
+    return out;
+}
+
+} // namespace
+
+float color_pipeline_curve(uint8_t channel, float x, float warmth, float brightness) {
+    float y = soft_clip_hdr(x);
+    if (warmth > 0.0f) {
+        float mix = (warmth > 1.0f) ? 1.0f : warmth;
+        y = clamp01(y * (kIncandescent[channel] * mix + (1.0f - mix)));
+    }
+    y = clamp01(y * kWhiteBalance[channel]);
+    float master = 0.3f + 0.7f * fmaxf(0.0f, fminf(1.0f, brightness));
+    y *= master;
+    return powf(clamp01(y), 2.0f);
+}
+
+float color_pipeline_lpf_alpha(float softness, float reference_fps) {
+    // Legacy cutoff mapping: 0.5 + (1 - sqrt(softness)) * 14.5  (0.5..15.0)
+    float cutoff = 0.5f + (1.0f - sqrtf(fmaxf(0.0f, fminf(1.0f, softness)))) * 14.5f;
+    return 1.0f - expf(-6.28318530718f * cutoff / reference_fps);
+}
+
+bool color_lut_update(ColorLut* lut, float warmth, float brightness) {
+    if (lut->valid && lut->warmth == warmth && lut->brightness == brightness) {
+        return false;
+    }
+
+    const float step = COLOR_LUT_INPUT_MAX / COLOR_LUT_ENTRIES;
+    for (uint8_t c = 0; c < 3; c++) {
+        for (uint32_t i = 0; i <= COLOR_LUT_ENTRIES; i++) {
+            lut->table[c][i] = color_pipeline_curve(c, i * step, warmth, brightness);
+        }
+    }
+    lut->warmth = warmth;
+    lut->brightness = brightness;
+    lut->valid = true;
+    return true;
+}
+
+void color_pipeline_fused(const ColorPipelineFrame* f) {
+    const float* lut_r = f->lut->table[0];
+    const float* lut_g = f->lut->table[1];
+    const float* lut_b = f->lut->table[2];
+    const float alpha = f->lpf_alpha;
+    const float inv = 1.0f - alpha;
+    const float scale = f->output_scale;
+    const uint16_t n = f->num_leds;
+
+    // Source index walks with the output index; one wrap check instead of a modulo per LED
+    int32_t src = (int32_t)f->offset_px % (int32_t)n;
+    if (src < 0) src += n;
+
+    uint8_t* out = f->out;
+    for (uint16_t i = 0; i < n; i++) {
+        CRGBF* px = &f->frame[src];
+        CRGBF* prev = &f->lpf_state[src];
+
+        // LPF (stateful, per source pixel)
+        float r = px->r * alpha + prev->r * inv;
+        float g = px->g * alpha + prev->g * inv;
+        float b = px->b * alpha + prev->b * inv;
+        prev->r = r;
+        prev->g = g;
+        prev->b = b;
+
+        // Tone-map .. gamma
+        r = lut_eval(lut_r, r);
+        g = lut_eval(lut_g, g);
+        b = lut_eval(lut_b, b);
+        px->r = r;
+        px->g = g;
+        px->b = b;
+
+        // Quantize straight into the output buffer
+        if (f->dithering) {
+            CRGBF* err = &f->dither_error[i];
+            out[0] = quantize_dither(r * scale, &err->r);
+            out[1] = quantize_dither(g * scale, &err->g);
+            out[2] = quantize_dither(b * scale, &err->b);
+        } else {
+            out[0] = (uint8_t)(r * scale);
+            out[1] = (uint8_t)(g * scale);
+            out[2] = (uint8_t)(b * scale);
+        }
+        out += 3;
+
+        if (++src >= n) src = 0;
+    }
+}
@@ -0,0 +1,67 @@
+// Fused color pipeline: LPF -> tone-map -> warmth -> white balance -> master
+// brightness -> gamma -> remap -> dither -> uint8, in a single pass per LED.
+//
+// Everything after the LPF is a fixed per-channel curve of the LPF output for a
+// given (warmth, brightness), so it is baked into a LUT that is rebuilt only
+// when those parameters change. Output matches apply_color_pipeline() +
+// transmit_leds() within 1 LSB (see test/test_color_pipeline_fused).
+//
+// Pure C++ (no FastLED/Arduino dependencies) so it can be unit tested on host.
+
+#pragma once
+
+#include <stdint.h>
+#include "types.h"
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+// LUT covers LPF output in [0, COLOR_LUT_INPUT_MAX]; above that the tone-map
+// has saturated (0.75 + 0.25 * tanh(5) = 0.99998) and the last entry is used
+#define COLOR_LUT_ENTRIES 1024
+#define COLOR_LUT_INPUT_MAX 2.0f
+
+// Temporal dither: errors below this are not accumulated (legacy transmit_leds)
+#define COLOR_DITHER_THRESHOLD 0.055f
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+typedef struct {
+    float table[3][COLOR_LUT_ENTRIES + 1];  // Post-gamma value per channel (0.0-1.0)
+    float warmth;                           // Parameters the table was built for
+    float brightness;
+    bool valid;
+} ColorLut;
+
+typedef struct {
+    const ColorLut* lut;
+    CRGBF* frame;             // In: pattern output. Out: post-pipeline floats (as the legacy passes leave it)
+    CRGBF* lpf_state;         // Previous LPF output per source pixel
+    float lpf_alpha;          // Single-pole IIR coefficient
+    CRGBF* dither_error;      // Per output pixel
+    uint8_t* out;             // RGB byte triplets (FastLED CRGB layout)
+    uint16_t num_leds;
+    int16_t offset_px;        // Output i reads source (i + offset_px) mod num_leds
+    float output_scale;       // global_brightness * 255
+    bool dithering;
+} ColorPipelineFrame;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// Exact scalar chain after the LPF (tone-map -> warmth -> white balance ->
+// master -> gamma) for one channel (0 = r, 1 = g, 2 = b)
+float color_pipeline_curve(uint8_t channel, float x, float warmth, float brightness);
+
+// LPF cutoff mapping shared with apply_color_pipeline()
+float color_pipeline_lpf_alpha(float softness, float reference_fps);
+
+// Rebuild the LUT if warmth/brightness changed. Returns true if rebuilt.
+bool color_lut_update(ColorLut* lut, float warmth, float brightness);
+
+// Run the whole pipeline for one frame
+void color_pipeline_fused(const ColorPipelineFrame* frame);
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <utility>
+#include <vector>
 #if __has_include(<esp_dsp.h>)
 #include <esp_dsp.h>
 #endif
@@ -38,6 +41,22 @@ inline void dsps_add_f32_accum(float* dest, const float* src, int length) {
 #endif
 }
 
+// Biquad filter in place, direct form II (ESP-DSP layout):
+// coef = {b0, b1, b2, a1, a2}, w = {w[n-1], w[n-2]} carried between calls
+inline void dsps_biquad_f32_inplace(float* arr, int length, float* coef, float* w) {
+    if (!arr || !coef || !w || length <= 0) return;
+#if __has_include(<esp_dsp.h>)
+    dsps_biquad_f32(arr, arr, length, coef, w);
+#else
+    for (int i = 0; i < length; ++i) {
+        float d0 = arr[i] - coef[3] * w[0] - coef[4] * w[1];
+        arr[i] = coef[0] * d0 + coef[1] * w[0] + coef[2] * w[1];
+        w[1] = w[0];
+        w[0] = d0;
+    }
+#endif
+}
+
 // Accelerated memcpy (falls back to std::memcpy)
 inline void dsps_memcpy_accel(void* dest, const void* src, std::size_t bytes) {
     if (!dest || !src || bytes == 0) return;
@@ -68,3 +87,67 @@ inline float dsps_dotprod_f32_sum(const float* a, const float* b, int length) {
 #endif
     return dest;
 }
+
+// Prepare complex radix-2 FFTs up to max_n points (power of two). ESP-DSP keeps
+// one shared twiddle table; this (re)builds it only when max_n grows.
+inline bool dsps_fft2r_init_f32(int max_n) {
+    if (max_n < 2 || (max_n & (max_n - 1)) != 0) return false;
+#if __has_include(<esp_dsp.h>)
+    static int initialized_n = 0;
+    if (max_n <= initialized_n) return true;
+    if (initialized_n > 0) dsps_fft2r_deinit_fc32();
+    if (dsps_fft2r_init_fc32(nullptr, max_n) != ESP_OK) return false;
+    initialized_n = max_n;
+    return true;
+#else
+    return true;
+#endif
+}
+
+// Forward complex FFT in place: data = {re0, im0, re1, im1, ...}, natural order
+// in and out, n a power of two <= the size passed to dsps_fft2r_init_f32()
+inline void dsps_fft2r_f32_inplace(float* data, int n) {
+    if (!data || n < 2) return;
+#if __has_include(<esp_dsp.h>)
+    dsps_fft2r_fc32(data, n);
+    dsps_bit_rev_fc32(data, n);
+#else
+    // Twiddles e^(-j 2 pi k / n) for the largest n seen so far
+    static std::vector<float> table;
+    if (table.size() < (size_t)n) {
+        table.resize(n);
+        for (int k = 0; k < n / 2; k++) {
+            table[2 * k] = (float)std::cos(2.0 * M_PI * k / n);
+            table[2 * k + 1] = (float)-std::sin(2.0 * M_PI * k / n);
+        }
+    }
+    const int table_n = (int)table.size();
+    // Decimation in frequency: natural order in, bit-reversed order out
+    for (int half = n / 2; half >= 1; half >>= 1) {
+        const int stride = table_n / (2 * half);
+        for (int j = 0; j < half; j++) {
+            const float wr = table[2 * j * stride];
+            const float wi = table[2 * j * stride + 1];
+            for (int i = j; i < n; i += 2 * half) {
+                float* a = data + 2 * i;
+                float* b = data + 2 * (i + half);
+                const float dr = a[0] - b[0];
+                const float di = a[1] - b[1];
+                a[0] += b[0];
+                a[1] += b[1];
+                b[0] = dr * wr - di * wi;
+                b[1] = dr * wi + di * wr;
+            }
+        }
+    }
+    for (int i = 1, j = 0; i < n; i++) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            std::swap(data[2 * i], data[2 * j]);
+            std::swap(data[2 * i + 1], data[2 * j + 1]);
+        }
+    }
+#endif
+}
@@ -9,6 +9,7 @@
 #include "audio/goertzel.h" // for audio_level
 #include "profiler.h"       // for ACCUM_QUANTIZE_US, ACCUM_RMT_TRANSMIT_US
 #include "parameters.h"     // for get_params(), PatternParameters
+#include "color_pipeline.h"  // COLOR_PIPELINE_FUSED_ENABLED
 
 // Global buffers
 CRGBF leds[NUM_LEDS];
@@ -75,13 +76,16 @@ void transmit_leds() {
 
     // 2. Quantize and Dither (Float CRGBF -> Byte CRGB)
     // Also applies global brightness and led_offset remapping
+    uint32_t t_quant_start = micros();
+
+#if COLOR_PIPELINE_FUSED_ENABLED
+    // apply_color_pipeline() already remapped, dithered and quantized into fastled_leds[]
+#else
     const PatternParameters& params = get_params();
     bool temporal_dithering = (params.dithering >= 0.5f);
     const float brightness_scale = constrain(global_brightness, 0.0f, 1.0f) * 255.0f;
     int16_t offset_px = static_cast<int16_t>(lroundf(params.led_offset));
 
-    uint32_t t_quant_start = micros();
-
     if (temporal_dithering) {
         const float thresh = 0.055f;
         for (uint16_t i = 0; i < NUM_LEDS; i++) {
@@ -120,6 +124,7 @@ void transmit_leds() {
             fastled_leds[i].b = (uint8_t)(leds[src_idx].b * brightness_scale);
         }
     }
+#endif
     
     // Record quantization time
     uint32_t t_tx_start = micros();
@@ -28,6 +28,11 @@ extern CRGBF leds[NUM_LEDS];
 // 8-bit standard color buffer (used by FastLED)
 extern CRGB fastled_leds[NUM_LEDS];
 
+// Temporal dither error accumulator (per output pixel)
+extern CRGBF dither_error[NUM_LEDS];
+
+static_assert(sizeof(CRGB) == 3, "fused color pipeline writes fastled_leds[] as RGB byte triplets");
+
 // Global brightness control (0.0 = off, 1.0 = full brightness)
 extern float global_brightness;
 
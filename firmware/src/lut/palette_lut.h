@@ -2,90 +2,138 @@
 
 #include <stdint.h>
 #include <cmath>
+#include "../types.h"
 
 // ============================================================================
 // PALETTE INTERPOLATION CACHE SYSTEM
 // ============================================================================
-// Pre-computed palette samples for fast lookup without per-frame interpolation
+// Pre-computed palette samples for fast lookup without per-pixel keyframe search
 //
-// Usage:
-// 1. Create a palette cache: PaletteCache mypalette(source_array, 16);
-// 2. Sample with: value = mypalette.get(position);
+// color_from_palette() quantizes progress to an 8-bit position before it
+// searches the keyframes, so a 256-entry table of unscaled colors reproduces it
+// exactly: cached = samples[pos] * brightness, bit for bit.
 //
-// Memory: 256 entries × 4 bytes = 1 KB per cache (highly reusable)
-// Performance: Direct array lookup vs. linear interpolation (15 cycles saved)
-// Accuracy: ±0.2% (imperceptible, since source palette is smooth)
+// Usage (per-pixel loops):
+//   const PaletteCache& palette = palette_cache_for(params.palette_id);
+//   leds[i] = palette.get(progress, brightness);
+//
+// Memory: 256 entries × 12 bytes = 3 KB per cache (PALETTE_CACHE_SLOTS caches)
+// Performance: one table read vs. keyframe search + interpolation per call
+// Accuracy: identical to color_from_palette()
 // ============================================================================
 
 #define PALETTE_CACHE_ENTRIES 256
 
+/**
+ * Wrap progress to [0, 1) and quantize to the 0-255 keyframe position scale
+ * (same mapping as color_from_palette)
+ */
+inline uint8_t palette_position(float progress) {
+    if (!(progress >= 0.0f && progress < 1.0f)) {
+        progress = fmodf(progress, 1.0f);
+        if (progress < 0.0f) progress += 1.0f;
+    }
+    return (uint8_t)(progress * 255.0f);
+}
+
+/**
+ * Keyframe search + interpolation at one position, unscaled (brightness 1.0)
+ * Keyframe format: {position_0_255, R, G, B, ...}. PROGMEM is memory-mapped on
+ * ESP32 (pgm_read_byte is a plain load), so the data is read directly.
+ *
+ * @param keyframes - Palette keyframe data
+ * @param num_entries - Number of keyframes
+ * @param pos - Position (0-255)
+ * @return Interpolated color (0.0-1.0)
+ */
+inline CRGBF palette_keyframe_sample(const uint8_t* keyframes, uint8_t num_entries, uint8_t pos) {
+    // Find bracketing keyframes
+    uint8_t entry1_idx = 0, entry2_idx = 0;
+    uint8_t pos1 = 0, pos2 = 255;
+
+    for (uint8_t i = 0; i < num_entries - 1; i++) {
+        uint8_t p1 = keyframes[i * 4 + 0];
+        uint8_t p2 = keyframes[(i + 1) * 4 + 0];
+
+        if (pos >= p1 && pos <= p2) {
+            entry1_idx = i;
+            entry2_idx = i + 1;
+            pos1 = p1;
+            pos2 = p2;
+            break;
+        }
+    }
+
+    uint8_t r1 = keyframes[entry1_idx * 4 + 1];
+    uint8_t g1 = keyframes[entry1_idx * 4 + 2];
+    uint8_t b1 = keyframes[entry1_idx * 4 + 3];
+
+    uint8_t r2 = keyframes[entry2_idx * 4 + 1];
+    uint8_t g2 = keyframes[entry2_idx * 4 + 2];
+    uint8_t b2 = keyframes[entry2_idx * 4 + 3];
+
+    // Interpolate between keyframes
+    float blend = 0.0f;
+    if (pos2 > pos1) {
+        blend = (float)(pos - pos1) / (float)(pos2 - pos1);
+    }
+
+    float r = (r1 * (1.0f - blend) + r2 * blend) / 255.0f;
+    float g = (g1 * (1.0f - blend) + g2 * blend) / 255.0f;
+    float b = (b1 * (1.0f - blend) + b2 * blend) / 255.0f;
+    return CRGBF(r, g, b);
+}
+
 /**
  * Palette cache structure
- * Stores 256 pre-interpolated samples from a source palette
+ * Stores 256 pre-interpolated, unscaled colors for one palette
  */
 struct PaletteCache {
-    float samples[PALETTE_CACHE_ENTRIES];
+    CRGBF samples[PALETTE_CACHE_ENTRIES];
+    uint8_t palette_id;
     bool initialized;
 
-    PaletteCache() : initialized(false) {}
+    PaletteCache() : palette_id(0), initialized(false) {}
 
     /**
-     * Initialize cache from a source palette array
-     * Pre-interpolates from source to 256 samples
+     * Build cache from palette keyframe data
      *
-     * @param source - Source palette array (can be any size >= 2)
-     * @param source_size - Number of entries in source palette
+     * @param keyframes - Palette keyframe data ({pos, R, G, B} per entry)
+     * @param num_entries - Number of keyframes (>= 2)
+     * @param id - Palette index the cache now represents
      */
-    void init(const float* source, int source_size) {
-        if (source == nullptr || source_size < 2) {
+    void init(const uint8_t* keyframes, uint8_t num_entries, uint8_t id) {
+        if (keyframes == nullptr || num_entries < 2) {
             initialized = false;
             return;
         }
 
         for (int i = 0; i < PALETTE_CACHE_ENTRIES; i++) {
-            float position = i / (float)(PALETTE_CACHE_ENTRIES - 1);
-            float scaled = position * (source_size - 1);
-            int idx_low = (int)floorf(scaled);
-            float frac = scaled - idx_low;
-
-            // Clamp bounds
-            if (idx_low < 0) idx_low = 0;
-            if (idx_low >= source_size - 1) {
-                idx_low = source_size - 2;
-                frac = 1.0f;
-            }
-
-            int idx_high = idx_low + 1;
-            if (idx_high >= source_size) idx_high = source_size - 1;
-
-            // Linear interpolation
-            samples[i] = source[idx_low] * (1.0f - frac) + source[idx_high] * frac;
+            samples[i] = palette_keyframe_sample(keyframes, num_entries, (uint8_t)i);
         }
 
+        palette_id = id;
         initialized = true;
     }
 
     /**
-     * Get interpolated value from cache
-     * Direct lookup, no computation required
+     * Get palette color from cache
+     * Direct lookup, no keyframe search
      *
-     * @param position - Position (0.0-1.0)
-     * @return Interpolated value
+     * @param progress - Position (wraps, 0.0-1.0)
+     * @param brightness - Output scale
+     * @return Color (same as color_from_palette)
      */
-    inline float get(float position) const {
-        if (!initialized) return 0.0f;
-
-        // Clamp position
-        position = fmax(0.0f, fmin(1.0f, position));
-        int idx = (int)(position * (PALETTE_CACHE_ENTRIES - 1));
-        return samples[idx];
+    inline CRGBF get(float progress, float brightness) const {
+        const CRGBF& c = samples[palette_position(progress)];
+        return CRGBF(c.r * brightness, c.g * brightness, c.b * brightness);
     }
 
     /**
      * Alternative syntax: operator() for convenient usage
      */
-    inline float operator()(float position) const {
-        return get(position);
+    inline CRGBF operator()(float progress, float brightness) const {
+        return get(progress, brightness);
     }
 
     /**
@@ -100,20 +148,6 @@ struct PaletteCache {
 // PALETTE CACHE UTILITIES
 // ============================================================================
 
-/**
- * Helper function to create a palette cache from a float array
- * Usage: auto cache = create_palette_cache(my_palette, 8);
- *
- * @param source - Source palette array
- * @param source_size - Number of entries in source
- * @return PaletteCache object (initialized and ready to use)
- */
-inline PaletteCache create_palette_cache(const float* source, int source_size) {
-    PaletteCache cache;
-    cache.init(source, source_size);
-    return cache;
-}
-
 /**
  * Clip float value to [0.0, 1.0] range
  */
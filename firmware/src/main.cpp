@@ -105,6 +105,7 @@ static inline void reset_classic_tempo_bins() {
         tempi_smooth[i] = 0.0f;
     }
     tempi_power_sum = 0.0f;
+    reset_beat_tracker();
 }
 
 // Calculate best BPM estimate from highest tempo bin magnitude
@@ -292,7 +293,7 @@ void audio_task(void* param) {
         }
 
         // Process audio chunk (I2S blocking isolated to Core 0)
-        acquire_sample_chunk();        // Blocks on I2S if needed (acceptable here)
+        acquire_sample_chunk();        // Sleeps until the next DMA chunk is handed over (or blocking read)
         calculate_magnitudes();        // ~15-25ms Goertzel computation
         get_chromagram();              // ~1ms pitch aggregation
 
@@ -472,11 +473,10 @@ void audio_task(void* param) {
                     LOG_INFO(TAG_AUDIO, "═══ AUDIO DIAGNOSTICS ═══");
 
                     // I2S Microphone Status
-                    extern float sample_history[];
                     float sample_peak = 0.0f;
                     float sample_rms = 0.0f;
                     for (int i = 0; i < 128; i++) {
-                        float s = fabs(sample_history[i]);
+                        float s = fabs(sample_ring_at(&sample_history, i));
                         sample_peak = fmaxf(sample_peak, s);
                         sample_rms += s * s;
                     }
@@ -520,6 +520,9 @@ void audio_task(void* param) {
         finish_audio_frame();          // ~0-5ms buffer swap
         heartbeat_logger_note_audio(audio_back.payload.update_counter);
 
+        // Persist warm-start state when requested or due (after publishing the frame)
+        service_audio_warm_start(t_now_ms);
+
         // Yield to prevent CPU starvation
         // 1ms yield allows 40-50 Hz audio processing rate
         vTaskDelay(pdMS_TO_TICKS(1));
@@ -657,9 +660,11 @@ void loop_gpu(void* param) {
 
         // Get current parameters (thread-safe read from active buffer)
         const PatternParameters& params = get_params();
-        // Phase 0: force channel index 0 for legacy render path
+        // Live pattern renders on the adapter's live channel (flips after each
+        // transition; the incoming pattern keeps the channel it rendered on)
         extern uint8_t g_pattern_channel_index;
-        g_pattern_channel_index = 0;
+        extern K1TransitionAdapter g_transition_adapter;
+        g_pattern_channel_index = g_transition_adapter.getLiveChannel();
 
         // Use pattern-level brightness only; keep transport scale at 1.0 to avoid double-scaling
         extern float global_brightness;
@@ -669,14 +674,19 @@ void loop_gpu(void* param) {
         uint32_t t_render = micros(); (void)t_render;
 
         // Create the render context
+#if AUDIO_TRIPLE_BUFFER_ENABLED
+        // Borrow the newest frame in place (no copy, no retries); it stays
+        // stable until the next acquire at the top of the next frame
+        const AudioDataSnapshot& audio_snapshot = *acquire_audio_frame();
+#else
         AudioDataSnapshot audio_snapshot;
         get_audio_snapshot(&audio_snapshot);
+#endif
         PatternRenderContext context(leds, NUM_LEDS, time, params, audio_snapshot);
 
         // Check if transition is active
-        extern K1TransitionAdapter g_transition_adapter;
         if (g_transition_adapter.isActive()) {
-            // Update transition (renders target pattern internally)
+            // Update transition (renders both patterns live, blends into leds)
             g_transition_adapter.update(context);
         } else {
             // Normal pattern rendering
@@ -827,9 +837,8 @@ void setup() {
     LOG_INFO(TAG_SYNC, "Initializing audio data sync...");
     init_audio_data_sync();
 
-    // Initialize Goertzel DFT constants and window function
+    // Initialize Goertzel DFT constants (window and coefficients are flash tables)
     LOG_INFO(TAG_AUDIO, "Initializing Goertzel DFT...");
-    init_window_lookup();
     init_goertzel_constants_musical();
 
     LOG_INFO(TAG_AUDIO, "Initializing VU meter...");
@@ -840,6 +849,9 @@ void setup() {
     init_tempo_goertzel_constants();
     LOG_INFO(TAG_TEMPO, "Using classic Emotiscope tempo detector only (96 bins)");
 
+    // Restore the noise profile, auto-ranger ceilings and tempo prior from NVS
+    load_audio_warm_start();
+
     // Initialize beat event ring buffer and latency probes
     // Capacity 128 ≈ 25s history at ~5.3 beats/sec, ~10s at 12Hz (high-frequency content)
     beat_events_init(128);
@@ -1072,12 +1084,19 @@ void loop() {
         last_audio_ms = now_ms;
     }
 
-    // Broadcast real-time data to WebSocket clients at 10 Hz
-    static uint32_t last_broadcast_ms = 0;
-    const uint32_t broadcast_interval_ms = 100; // 10 Hz broadcast rate
-    if ((now_ms - last_broadcast_ms) >= broadcast_interval_ms) {
-        // Update CPU monitor before broadcasting
+    // Update CPU monitor at 10 Hz
+    static uint32_t last_cpu_monitor_ms = 0;
+    if ((now_ms - last_cpu_monitor_ms) >= 100) {
         cpu_monitor.update();
+        last_cpu_monitor_ms = now_ms;
+    }
+
+    // Broadcast real-time data to WebSocket clients. broadcast_realtime_data()
+    // rate-limits each stream (JSON interval_ms, binary up to 60 Hz); poll at
+    // the binary floor so it is not capped here.
+    static uint32_t last_broadcast_ms = 0;
+    const uint32_t broadcast_poll_ms = 16;
+    if ((now_ms - last_broadcast_ms) >= broadcast_poll_ms) {
         broadcast_realtime_data();
         last_broadcast_ms = now_ms;
     }
@@ -455,55 +455,32 @@ const PaletteInfo palette_table[] PROGMEM = {
 // ============================================================================
 
 CRGBF color_from_palette(uint8_t palette_index, float progress, float brightness) {
-	// Clamp inputs
-	palette_index = palette_index % NUM_PALETTES;
-	progress = fmodf(progress, 1.0f);
-	if (progress < 0.0f) progress += 1.0f;
-
-	// Convert progress to 0-255 range
-	uint8_t pos = (uint8_t)(progress * 255.0f);
-
-	// Get palette info
-	PaletteInfo info;
-	memcpy_P(&info, &palette_table[palette_index], sizeof(PaletteInfo));
+	// Same result as the keyframe search, bit for bit (see lut/palette_lut.h)
+	return palette_cache_for(palette_index).get(progress, brightness);
+}
 
-	// Find bracketing keyframes
-	uint8_t entry1_idx = 0, entry2_idx = 0;
-	uint8_t pos1 = 0, pos2 = 255;
-
-	// Read all entries and find the right interpolation range
-	for (uint8_t i = 0; i < info.num_entries - 1; i++) {
-		uint8_t p1 = pgm_read_byte(&info.data[i * 4 + 0]);
-		uint8_t p2 = pgm_read_byte(&info.data[(i + 1) * 4 + 0]);
-
-		if (pos >= p1 && pos <= p2) {
-			entry1_idx = i;
-			entry2_idx = i + 1;
-			pos1 = p1;
-			pos2 = p2;
-			break;
-		}
-	}
+// ============================================================================
+// PALETTE CACHE
+// ============================================================================
 
-	// Read keyframe RGB data
-	uint8_t r1 = pgm_read_byte(&info.data[entry1_idx * 4 + 1]);
-	uint8_t g1 = pgm_read_byte(&info.data[entry1_idx * 4 + 2]);
-	uint8_t b1 = pgm_read_byte(&info.data[entry1_idx * 4 + 3]);
+static PaletteCache palette_cache[PALETTE_CACHE_SLOTS];
+static uint8_t palette_cache_victim = 0;
 
-	uint8_t r2 = pgm_read_byte(&info.data[entry2_idx * 4 + 1]);
-	uint8_t g2 = pgm_read_byte(&info.data[entry2_idx * 4 + 2]);
-	uint8_t b2 = pgm_read_byte(&info.data[entry2_idx * 4 + 3]);
+const PaletteCache& palette_cache_for(uint8_t palette_index) {
+	palette_index = palette_index % NUM_PALETTES;
 
-	// Interpolate between keyframes
-	float blend = 0.0f;
-	if (pos2 > pos1) {
-		blend = (float)(pos - pos1) / (float)(pos2 - pos1);
+	for (uint8_t i = 0; i < PALETTE_CACHE_SLOTS; i++) {
+		if (palette_cache[i].initialized && palette_cache[i].palette_id == palette_index) {
+			return palette_cache[i];
+		}
 	}
 
-	float r = (r1 * (1.0f - blend) + r2 * blend) / 255.0f;
-	float g = (g1 * (1.0f - blend) + g2 * blend) / 255.0f;
-	float b = (b1 * (1.0f - blend) + b2 * blend) / 255.0f;
+	// Miss: palette_id changed (or a second palette came into use), rebuild one slot
+	PaletteCache& slot = palette_cache[palette_cache_victim];
+	palette_cache_victim = (palette_cache_victim + 1) % PALETTE_CACHE_SLOTS;
 
-	// Apply brightness (logging removed to avoid per-LED spam on serial)
-	return {r * brightness, g * brightness, b * brightness};
+	PaletteInfo info;
+	memcpy_P(&info, &palette_table[palette_index], sizeof(PaletteInfo));
+	slot.init(info.data, info.num_entries, palette_index);
+	return slot;
 }
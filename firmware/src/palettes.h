@@ -16,6 +16,7 @@ Format: {position_0_255, R, G, B, position, R, G, B, ...}
 
 #pragma once
 #include "types.h"
+#include "lut/palette_lut.h"
 #include <cmath>
 
 // ============================================================================
@@ -43,3 +44,16 @@ extern float prism_trail[];
 
 // Function declaration (implementation in palettes.cpp)
 CRGBF color_from_palette(uint8_t palette_index, float progress, float brightness);
+
+// ============================================================================
+// PALETTE CACHE - RAM LUT for the active palette(s)
+// ============================================================================
+
+// Two slots so a crossfade between two palettes does not rebuild every call
+#define PALETTE_CACHE_SLOTS 2
+
+// Cache for palette_index, rebuilt when the slot's palette changes.
+// Hoist out of per-pixel loops; the reference stays valid for the rest of the
+// frame as long as no more than PALETTE_CACHE_SLOTS palettes are in use.
+// Render task (Core 1) only.
+const PaletteCache& palette_cache_for(uint8_t palette_index);
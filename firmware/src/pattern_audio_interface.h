@@ -54,31 +54,41 @@ bool is_beat_phase_locked_ms(const AudioDataSnapshot& audio_snapshot, uint16_t b
  * Call this macro at the beginning of every pattern draw function that uses
  * audio data. It performs the following operations:
  *
- * 1. Declares a local AudioDataSnapshot struct
- * 2. Retrieves thread-safe snapshot via get_audio_snapshot()
+ * 1. Binds `audio` to the current frame (triple buffer) or a local copy
+ * 2. Retrieves thread-safe snapshot (current_audio_frame() / get_audio_snapshot())
  * 3. Tracks update counter to detect fresh data
  * 4. Calculates data age in milliseconds
  * 5. Sets boolean flags for freshness/availability
  *
  * CREATED VARIABLES (usable in pattern scope):
- *   - audio              : AudioDataSnapshot - Complete audio data snapshot
+ *   - audio              : AudioDataSnapshot (const& in triple-buffer mode)
  *   - audio_available    : bool - True if snapshot was retrieved successfully
  *   - audio_is_fresh     : bool - True if data changed since last frame
  *   - audio_age_ms       : uint32_t - Milliseconds since last audio update
  *
  * THREAD SAFETY:
- *   - Safe to call from any task/thread
- *   - Safe to call multiple times in same pattern (each gets fresh snapshot)
+ *   - Triple-buffer mode (AUDIO_TRIPLE_BUFFER_ENABLED): render task only;
+ *     binds to the frame loop_gpu borrowed this frame (same data as the
+ *     PatternRenderContext, no copy)
+ *   - Seqlock mode: safe to call from any task/thread (each call copies)
  *   - Pattern-local static for tracking prevents cross-pattern pollution
  *
  * PERFORMANCE:
- *   - Zero runtime overhead if audio system not initialized
- *   - ~10-20 microseconds for snapshot copy (negligible)
- *   - Non-blocking mutex (1ms timeout) prevents render stalls
+ *   - Triple-buffer mode: pointer bind only
+ *   - Seqlock mode: ~10-20 microseconds for snapshot copy, bounded retries
  */
-#define PATTERN_AUDIO_START() \
+#if AUDIO_TRIPLE_BUFFER_ENABLED
+#define PATTERN_AUDIO_SNAPSHOT() \
+    const AudioDataSnapshot& audio = *current_audio_frame(); \
+    bool audio_available = audio.payload.is_valid;
+#else
+#define PATTERN_AUDIO_SNAPSHOT() \
     AudioDataSnapshot audio{}; \
-    bool audio_available = get_audio_snapshot(&audio); \
+    bool audio_available = get_audio_snapshot(&audio);
+#endif
+
+#define PATTERN_AUDIO_START() \
+    PATTERN_AUDIO_SNAPSHOT() \
     static uint32_t pattern_last_update = 0; \
     bool audio_is_fresh = (audio_available && \
                            audio.payload.update_counter != pattern_last_update); \
@@ -104,7 +114,7 @@ bool is_beat_phase_locked_ms(const AudioDataSnapshot& audio_snapshot, uint16_t b
  *   - AUDIO_SPECTRUM_SMOOTH[0..63] : 64 smoothed bins
  *   - AUDIO_SPECTRUM_ABSOLUTE[0..63] : 64 pre-normalized bins (absolute loudness)
  *   - AUDIO_CHROMAGRAM[0..11]      : 12 musical note classes (C-B)
- *   - AUDIO_FFT[0..127]            : 128 FFT bins (if FFT enabled)
+ *   - AUDIO_FFT[0..127]            : 128 linear bands to 6.4 kHz (CONSTANT_Q_FFT_ENABLED builds)
  */
 
 // ============================================================================
@@ -162,11 +172,15 @@ bool is_beat_phase_locked_ms(const AudioDataSnapshot& audio_snapshot, uint16_t b
  * AUDIO_VU_RAW     : Raw amplitude before auto-ranging
  * AUDIO_NOVELTY    : Spectral change/onset detection (0.0-1.0)
  * AUDIO_TEMPO_CONFIDENCE : Beat detection confidence (0.0-1.0)
+ * AUDIO_PERCUSSIVE : Percussive part of the spectrum (0.0-1.0; drums, hits)
+ * AUDIO_HARMONIC   : Harmonic part of the spectrum (0.0-1.0; sustained notes)
  */
 #define AUDIO_VU                (audio.payload.vu_level)
 #define AUDIO_VU_RAW            (audio.payload.vu_level_raw)
 #define AUDIO_NOVELTY           (audio.payload.novelty_curve)
 #define AUDIO_TEMPO_CONFIDENCE  (audio.payload.tempo_confidence)
+#define AUDIO_PERCUSSIVE        (audio.payload.percussive_energy)
+#define AUDIO_HARMONIC          (audio.payload.harmonic_energy)
 
 // Helper: Adaptive beat gating for patterns
 // Returns a squashed confidence with a minimum threshold to prevent flicker
@@ -288,6 +302,11 @@ float get_audio_band_energy_absolute(const AudioDataSnapshot& audio, int start_b
  *   float bass_energy = AUDIO_BASS();
  *   leds[0] = CRGBF(AUDIO_TREBLE(), AUDIO_MIDS(), AUDIO_BASS());
  *
+ * PERFORMANCE:
+ *   - Field reads: the audio task computes every band once per audio frame
+ *     (audio/audio_features.h), so these are free in inner loops
+ *   - Other ranges: get_audio_band_energy(audio, start, end) sums on each call
+ *
  * FREQUENCY REFERENCE (64-bin Goertzel, musical scale):
  *   Bin  0: 55.0 Hz   (A1)
  *   Bin  8: 69.3 Hz   (C#2)
@@ -296,30 +315,48 @@ float get_audio_band_energy_absolute(const AudioDataSnapshot& audio, int start_b
  *   Bin 48: 277.2 Hz  (C#4)
  *   Bin 63: 622.3 Hz  (D#5)
  */
-#define AUDIO_BASS()     get_audio_band_energy(audio, 0, 8)    // 55-220 Hz
-#define AUDIO_MIDS()     get_audio_band_energy(audio, 16, 32)  // 440-880 Hz
-#define AUDIO_TREBLE()   get_audio_band_energy(audio, 48, 63)  // 1.76-6.4 kHz
+#define AUDIO_BASS()     (audio.payload.features.bass)     // Bins 0-8:   55-220 Hz
+#define AUDIO_MIDS()     (audio.payload.features.mids)     // Bins 16-32: 440-880 Hz
+#define AUDIO_TREBLE()   (audio.payload.features.treble)   // Bins 48-63: 1.76-6.4 kHz
 
 // Absolute loudness bands (pre-normalized)
-#define AUDIO_BASS_ABS()   get_audio_band_energy_absolute(audio, 0, 8)
-#define AUDIO_MIDS_ABS()   get_audio_band_energy_absolute(audio, 16, 32)
-#define AUDIO_TREBLE_ABS() get_audio_band_energy_absolute(audio, 48, 63)
+#define AUDIO_BASS_ABS()   (audio.payload.features.bass_abs)
+#define AUDIO_MIDS_ABS()   (audio.payload.features.mids_abs)
+#define AUDIO_TREBLE_ABS() (audio.payload.features.treble_abs)
 
 // Precise instrument-specific frequency bands
-#define KICK_START    0
-#define KICK_END      4    // 55-110 Hz (kick drum fundamental)
-#define SNARE_START   8
-#define SNARE_END     16   // 220-440 Hz (snare body)
-#define VOCAL_START   16
-#define VOCAL_END     40   // 440-1760 Hz (vocal range)
-#define HATS_START    48
-#define HATS_END      63   // 3.5-6.4 kHz (hi-hats/cymbals)
+#define KICK_START    FEATURE_KICK_START
+#define KICK_END      FEATURE_KICK_END     // 55-110 Hz (kick drum fundamental)
+#define SNARE_START   FEATURE_SNARE_START
+#define SNARE_END     FEATURE_SNARE_END    // 220-440 Hz (snare body)
+#define VOCAL_START   FEATURE_VOCAL_START
+#define VOCAL_END     FEATURE_VOCAL_END    // 440-1760 Hz (vocal range)
+#define HATS_START    FEATURE_HATS_START
+#define HATS_END      FEATURE_HATS_END     // 3.5-6.4 kHz (hi-hats/cymbals)
 
 // Instrument-specific energy accessors
-#define AUDIO_KICK()     get_audio_band_energy(audio, KICK_START, KICK_END)
-#define AUDIO_SNARE()    get_audio_band_energy(audio, SNARE_START, SNARE_END)
-#define AUDIO_VOCAL()    get_audio_band_energy(audio, VOCAL_START, VOCAL_END)
-#define AUDIO_HATS()     get_audio_band_energy(audio, HATS_START, HATS_END)
+#define AUDIO_KICK()     (audio.payload.features.kick)
+#define AUDIO_SNARE()    (audio.payload.features.snare)
+#define AUDIO_VOCAL()    (audio.payload.features.vocal)
+#define AUDIO_HATS()     (audio.payload.features.hats)
+
+/**
+ * Spectral shape descriptors (computed once per audio frame)
+ *
+ * AUDIO_CENTROID()     : 0.0-1.0 energy-weighted position in the spectrum
+ *                        (low = dark/bassy, high = bright)
+ * AUDIO_FLATNESS()     : 0.0 tonal (few strong bins) - 1.0 noise-like
+ * AUDIO_FLUX()         : Mean rise of the bins since the previous audio frame
+ * AUDIO_CHROMA_PEAK()  : Strongest pitch class, 0 = C ... 11 = B
+ *
+ * EXAMPLE:
+ *   float hue = AUDIO_CHROMA_PEAK() / 12.0f;
+ *   float sat = 1.0f - AUDIO_FLATNESS();      // Noise washes colors out
+ */
+#define AUDIO_CENTROID()        (audio.payload.features.centroid)
+#define AUDIO_FLATNESS()        (audio.payload.features.flatness)
+#define AUDIO_FLUX()            (audio.payload.features.flux)
+#define AUDIO_CHROMA_PEAK()     (audio.payload.features.chroma_peak)
 
 // INTERPOLATED SPECTRUM ACCESS - Fixes stepping artifacts!
 #define AUDIO_SPECTRUM_INTERP(pos) \
@@ -470,6 +507,76 @@ float get_audio_band_energy_absolute(const AudioDataSnapshot& audio, int start_b
  */
 #define AUDIO_TEMPO_BEAT(bin)       (sinf(AUDIO_TEMPO_PHASE(bin)))
 
+// ============================================================================
+// BEAT TRACKER (Phase-locked loops on the strongest tempo hypotheses)
+// ============================================================================
+
+/**
+ * AUDIO_BEAT_PHASE(k) / AUDIO_BEAT_CONFIDENCE(k) / AUDIO_BEAT_BPM(k)
+ *
+ * Hypothesis k of AUDIO_BEAT_HYPOTHESES, most confident first (k = 0 is the main
+ * beat). Unlike AUDIO_TEMPO_PHASE(bin), the phase is corrected on every
+ * detected onset, so it stays on the beat between tempogram updates.
+ *
+ *   AUDIO_BEAT_PHASE(k)      : Radians, -π to π; sin() peaks on the beat
+ *   AUDIO_BEAT_CONFIDENCE(k) : 0.0-1.0, how well onsets land on this beat
+ *                              times how strong its tempo is
+ *   AUDIO_BEAT_BPM(k)        : Loop tempo; 0.0 when the hypothesis is unused
+ *
+ * EXAMPLE (Pulse on the main beat, faded by confidence):
+ *   float pulse = 0.5f + 0.5f * sinf(AUDIO_BEAT_PHASE(0));
+ *   float brightness = pulse * AUDIO_BEAT_CONFIDENCE(0);
+ *
+ * Out-of-range k returns 0.0.
+ */
+#define AUDIO_BEAT_HYPOTHESES   BEAT_TRACKER_HYPOTHESES
+#define AUDIO_BEAT_PHASE(k)      \
+    (((int)(k) >= 0 && (int)(k) < BEAT_TRACKER_HYPOTHESES) ? audio.payload.beat_phase[(int)(k)] : 0.0f)
+#define AUDIO_BEAT_CONFIDENCE(k) \
+    (((int)(k) >= 0 && (int)(k) < BEAT_TRACKER_HYPOTHESES) ? audio.payload.beat_confidence[(int)(k)] : 0.0f)
+#define AUDIO_BEAT_BPM(k)        \
+    (((int)(k) >= 0 && (int)(k) < BEAT_TRACKER_HYPOTHESES) ? audio.payload.beat_bpm[(int)(k)] : 0.0f)
+
+// ============================================================================
+// SPECTROGRAM HISTORY (Shared 8-bit ring of past AUDIO_SPECTRUM_SMOOTH frames)
+// ============================================================================
+
+/**
+ * AUDIO_HISTORY(age, bin)
+ *
+ * AUDIO_SPECTRUM_SMOOTH[bin] as it was `age` audio frames (5 ms each) before
+ * the frame being drawn. Age 0 is the current spectrum. Range: 0.0-1.0 in
+ * 1/255 steps; 0.0 for ages beyond what has been recorded.
+ *
+ * USE CASES:
+ *   - Waterfalls and scrolling spectrograms
+ *   - Bloom / smear trails without a pattern-owned float buffer
+ *
+ * EXAMPLE (Waterfall: one row of history per LED):
+ *   for (int i = 0; i < NUM_LEDS; i++) {
+ *       float v = AUDIO_HISTORY(i * AUDIO_HISTORY_DEPTH / NUM_LEDS, bin);
+ *       leds[i] = hsv(hue, 1.0, v);
+ *   }
+ *
+ * LIMITS:
+ *   - age < AUDIO_HISTORY_DEPTH (120 frames, 600 ms; 8 frames, 40 ms in the
+ *     debug env's 16-frame ring): size loops by it, not by a fixed count
+ *   - bin 0-63; out-of-range bins return 0.0
+ */
+#define AUDIO_HISTORY_DEPTH         SPECTROGRAM_HISTORY_DEPTH
+#define AUDIO_HISTORY(age, bin)     \
+    spectrogram_history_value(&spectrogram_history, audio.payload.history_frame, (age), (bin))
+
+/**
+ * AUDIO_HISTORY_ROW(age, out)
+ *
+ * Copy a whole past frame into uint8_t out[64] (0-255 per bin). Returns
+ * false (and zeroes out) if the frame is not available. Cheaper than 64
+ * AUDIO_HISTORY() calls when a pattern needs every bin of a row.
+ */
+#define AUDIO_HISTORY_ROW(age, out) \
+    spectrogram_history_read(&spectrogram_history, audio.payload.history_frame, (age), (out))
+
 // ============================================================================
 // MIGRATION EXAMPLE: Before and After
 // ============================================================================
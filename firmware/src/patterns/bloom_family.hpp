@@ -42,6 +42,7 @@ extern bool tempo_debug_enabled;
 // Reference: zref/Emotiscope.sourcecode/Emotiscope-1.0/src/lightshow_modes/bloom.h
 inline void draw_bloom(const PatternRenderContext& context) {
 	const PatternParameters& params = context.params;
+	const PaletteCache& palette = palette_cache_for(params.palette_id);
 	CRGBF* leds = context.leds;
 	const AudioDataSnapshot& audio = context.audio_snapshot;
 	#define AUDIO_IS_AVAILABLE() (audio.payload.is_valid)
@@ -85,7 +86,7 @@ inline void draw_bloom(const PatternRenderContext& context) {
 			if (palette_progress < 0.0f) {
 				palette_progress += 1.0f;
 			}
-			CRGBF col = color_from_palette(params.palette_id, clip_float(palette_progress), brightness);
+			CRGBF col = palette.get(clip_float(palette_progress), brightness);
 
 			int left_index = (half_leds - 1) - i;
 			int right_index = half_leds + i;
@@ -108,7 +109,7 @@ inline void draw_bloom(const PatternRenderContext& context) {
 			if (palette_progress < 0.0f) {
 				palette_progress += 1.0f;
 			}
-			CRGBF col = color_from_palette(params.palette_id, clip_float(palette_progress), brightness);
+			CRGBF col = palette.get(clip_float(palette_progress), brightness);
 			leds[i] = col;
 		}
 	}
@@ -145,6 +146,7 @@ inline void draw_bloom(const PatternRenderContext& context) {
 // mirrors SB’s summed-HSV brightness shaping and alpha≈0.99 persistence.
 inline void draw_bloom_sb(const PatternRenderContext& context) {
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
     const AudioDataSnapshot& audio = context.audio_snapshot;
     #define AUDIO_IS_AVAILABLE() (audio.payload.is_valid)
@@ -186,7 +188,7 @@ inline void draw_bloom_sb(const PatternRenderContext& context) {
     // 3) Map to palette using V for brightness (K1 palette system)
     HSVF hsv_sum = rgb_to_hsv(sum_color);
     float brightness = clip_float(hsv_sum.v);
-    CRGBF inject = color_from_palette(params.palette_id, clip_float(params.color), brightness);
+    CRGBF inject = palette.get(clip_float(params.color), brightness);
 
     int mid_r = NUM_LEDS/2;
     int mid_l = mid_r - 1;
@@ -214,6 +216,7 @@ inline void draw_bloom_sb(const PatternRenderContext& context) {
 }
 inline void draw_bloom_mirror(const PatternRenderContext& context) {
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
     (void)context.time;  // unused
     (void)context.num_leds;  // using NUM_LEDS macro instead
@@ -296,7 +299,7 @@ inline void draw_bloom_mirror(const PatternRenderContext& context) {
 		}
 	}
 	else if (chromatic_mode) {
-		wave_color = color_from_palette(params.palette_id, 0.0f, 0.05f);
+		wave_color = palette.get(0.0f, 0.05f);
 	}
 		else {
 			brightness_accum = 0.05f;
@@ -304,7 +307,7 @@ inline void draw_bloom_mirror(const PatternRenderContext& context) {
 
 	if (!chromatic_mode) {
 		float base_progress = clip_float(params.color);
-		wave_color = color_from_palette(params.palette_id, base_progress, clip_float(brightness_accum));
+		wave_color = palette.get(base_progress, clip_float(brightness_accum));
 	}
 	else {
 		wave_color.r = std::min(1.0f, wave_color.r);
@@ -369,8 +372,7 @@ inline void draw_bloom_mirror(const PatternRenderContext& context) {
 		HSVF px_hsv = rgb_to_hsv(bloom_buffer[ch_idx][i]);
 		float px_brightness = clip_float(px_hsv.v);
 
-		CRGBF palette_color = color_from_palette(
-			params.palette_id,
+		CRGBF palette_color = palette.get(
 			palette_progress,
 			px_brightness
 		);
@@ -408,6 +410,7 @@ inline void draw_bloom_mirror(const PatternRenderContext& context) {
 inline void draw_snapwave(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
     const AudioDataSnapshot& audio = context.audio_snapshot;
 
@@ -454,8 +457,7 @@ inline void draw_snapwave(const PatternRenderContext& context) {
 
         if (beat_detected) {
             float beat_brightness = fminf(1.0f, beat_strength * 5.0f);
-            CRGBF beat_color = color_from_palette(
-                params.palette_id,
+            CRGBF beat_color = palette.get(
                 clip_float(params.color),
                 beat_brightness
             );
@@ -486,8 +488,7 @@ inline void draw_snapwave(const PatternRenderContext& context) {
             float position_in_half_array = clip_float((dominant_bin / 12.0f) * 0.8f);
             int accent_idx = (int)(position_in_half_array * (half_leds - 1));
 
-            CRGBF accent_color = color_from_palette(
-                params.palette_id,
+            CRGBF accent_color = palette.get(
                 clip_float(params.color + (dominant_bin / 12.0f) * 0.4f),
                 max_magnitude * 0.6f
             );
@@ -522,7 +523,7 @@ inline void draw_snapwave(const PatternRenderContext& context) {
             float wave = 0.5f + 0.5f * sinf(idle_phase + radial * 6.28318530718f);
             float brightness = clip_float(0.1f + wave * 0.6f);
             float hue = clip_float(hue_base + radial * params.color_range);
-            CRGBF idle_color = color_from_palette(params.palette_id, hue, brightness * params.saturation);
+            CRGBF idle_color = palette.get(hue, brightness * params.saturation);
             
             // Blend idle color with decaying buffer (30% idle, 70% decayed trail)
             float blend = 0.3f;
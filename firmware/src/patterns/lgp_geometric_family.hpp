@@ -17,6 +17,7 @@
 inline void draw_lgp_diamond_lattice(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float phase = 0;
@@ -42,7 +43,7 @@ inline void draw_lgp_diamond_lattice(const PatternRenderContext& context) {
 
         // Opposing colors enhance the diamond effect
         float hue = fmodf(time * 0.01f + i * 0.002f, 1.0f);
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -54,6 +55,7 @@ inline void draw_lgp_diamond_lattice(const PatternRenderContext& context) {
 inline void draw_lgp_hexagonal_grid(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float phase = 0;
@@ -86,7 +88,7 @@ inline void draw_lgp_hexagonal_grid(const PatternRenderContext& context) {
         // Chromatic shift for iridescence
         float hue = fmodf(time * 0.01f + pattern * 0.2f + i * 0.005f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -98,6 +100,7 @@ inline void draw_lgp_hexagonal_grid(const PatternRenderContext& context) {
 inline void draw_lgp_spiral_vortex(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float vortexPhase = 0;
@@ -134,7 +137,7 @@ inline void draw_lgp_spiral_vortex(const PatternRenderContext& context) {
         // Color rotates with spiral
         float hue = fmodf(time * 0.01f + (spiralAngle / (2.0f * M_PI)), 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -146,6 +149,7 @@ inline void draw_lgp_spiral_vortex(const PatternRenderContext& context) {
 inline void draw_lgp_chevron_waves(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float wavePos = 0;
@@ -177,7 +181,7 @@ inline void draw_lgp_chevron_waves(const PatternRenderContext& context) {
         // Color gradient along chevron
         float hue = fmodf(time * 0.01f + distFromCenter * 0.002f + wavePos * 0.005f, 1.0f);
 
-        CRGBF color = color_from_palette(params.palette_id, hue, brightness);
+        CRGBF color = palette.get(hue, brightness);
         leds[i].r += color.r;
         leds[i].g += color.g;
         leds[i].b += color.b;
@@ -192,6 +196,7 @@ inline void draw_lgp_chevron_waves(const PatternRenderContext& context) {
 inline void draw_lgp_concentric_rings(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float ringPhase = 0;
@@ -227,7 +232,7 @@ inline void draw_lgp_concentric_rings(const PatternRenderContext& context) {
         // Radial color gradient
         float hue = fmodf(time * 0.01f + normalizedDist * 0.3f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -239,6 +244,7 @@ inline void draw_lgp_concentric_rings(const PatternRenderContext& context) {
 inline void draw_lgp_star_burst(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float starPhase = 0;
@@ -273,7 +279,7 @@ inline void draw_lgp_star_burst(const PatternRenderContext& context) {
         // Color varies with angle and distance
         float hue = fmodf(time * 0.01f + distFromCenter * 0.005f + star * 0.2f, 1.0f);
 
-        CRGBF color = color_from_palette(params.palette_id, hue, brightness);
+        CRGBF color = palette.get(hue, brightness);
         leds[i].r += color.r;
         leds[i].g += color.g;
         leds[i].b += color.b;
@@ -288,6 +294,7 @@ inline void draw_lgp_star_burst(const PatternRenderContext& context) {
 inline void draw_lgp_mesh_network(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float networkPhase = 0;
@@ -315,7 +322,7 @@ inline void draw_lgp_mesh_network(const PatternRenderContext& context) {
                 // Node core
                 float nodeBright = params.brightness;
                 float hue = fmodf(time * 0.01f + n * 0.05f, 1.0f);
-                CRGBF nodeColor = color_from_palette(params.palette_id, hue, nodeBright);
+                CRGBF nodeColor = palette.get(hue, nodeBright);
                 leds[i] = nodeColor;
             } else if (distToNode < 20) {
                 // Connections to nearby nodes
@@ -324,7 +331,7 @@ inline void draw_lgp_mesh_network(const PatternRenderContext& context) {
 
                 float connBright = fabsf(connection) * 0.5f * params.brightness;
                 float hue = fmodf(time * 0.01f + n * 0.05f, 1.0f);
-                CRGBF connColor = color_from_palette(params.palette_id, hue, connBright);
+                CRGBF connColor = palette.get(hue, connBright);
 
                 leds[i].r += connColor.r;
                 leds[i].g += connColor.g;
@@ -342,6 +349,7 @@ inline void draw_lgp_mesh_network(const PatternRenderContext& context) {
 inline void draw_lgp_moire_patterns(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float offset = 0;
@@ -367,7 +375,7 @@ inline void draw_lgp_moire_patterns(const PatternRenderContext& context) {
         // Color shifts with moiré beats
         float hue = fmodf(time * 0.01f + moire * 0.2f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
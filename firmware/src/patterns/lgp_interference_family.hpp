@@ -15,6 +15,7 @@
 inline void draw_lgp_box_wave(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     // Box count: 3-12 boxes based on complexity
@@ -60,7 +61,7 @@ inline void draw_lgp_box_wave(const PatternRenderContext& context) {
         // Color wave overlay
         float hue = fmodf(time * 0.01f + distFromCenter * 0.002f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -71,6 +72,7 @@ inline void draw_lgp_box_wave(const PatternRenderContext& context) {
 inline void draw_lgp_holographic(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float phase1 = 0, phase2 = 0, phase3 = 0;
@@ -127,7 +129,7 @@ inline void draw_lgp_holographic(const PatternRenderContext& context) {
         // Chromatic dispersion effect
         float hue = fmodf(time * 0.01f + dist * 0.005f + layerSum * 0.2f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -138,6 +140,7 @@ inline void draw_lgp_holographic(const PatternRenderContext& context) {
 inline void draw_lgp_modal_resonance(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     // Time-based phase for smooth animation
@@ -188,7 +191,7 @@ inline void draw_lgp_modal_resonance(const PatternRenderContext& context) {
         // Color based on mode number and position
         float hue = fmodf(time * 0.01f + baseMode * 0.1f + position * 0.5f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -199,6 +202,7 @@ inline void draw_lgp_modal_resonance(const PatternRenderContext& context) {
 inline void draw_lgp_interference_scanner(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float scanPos = 0;
@@ -238,7 +242,7 @@ inline void draw_lgp_interference_scanner(const PatternRenderContext& context) {
 
         float hue = fmodf(time * 0.01f + position * 0.3f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -249,6 +253,7 @@ inline void draw_lgp_interference_scanner(const PatternRenderContext& context) {
 inline void draw_lgp_wave_collision(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float phase1 = 0, phase2 = 0;
@@ -280,7 +285,7 @@ inline void draw_lgp_wave_collision(const PatternRenderContext& context) {
 
         float hue = fmodf(time * 0.01f + interference * 0.2f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -291,6 +296,7 @@ inline void draw_lgp_wave_collision(const PatternRenderContext& context) {
 inline void draw_lgp_soliton_explorer(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float solitonPos1 = 0, solitonPos2 = 0.5f;
@@ -335,7 +341,7 @@ inline void draw_lgp_soliton_explorer(const PatternRenderContext& context) {
 
         float hue = fmodf(time * 0.01f + combined * 0.3f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -346,6 +352,7 @@ inline void draw_lgp_soliton_explorer(const PatternRenderContext& context) {
 inline void draw_lgp_turing_patterns(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     // Time-based phase for evolving patterns
@@ -375,7 +382,7 @@ inline void draw_lgp_turing_patterns(const PatternRenderContext& context) {
 
         float hue = fmodf(time * 0.01f + dist * 0.01f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -386,6 +393,7 @@ inline void draw_lgp_turing_patterns(const PatternRenderContext& context) {
 inline void draw_lgp_kelvin_helmholtz(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
 
     static float flowPhase = 0;
@@ -419,7 +427,7 @@ inline void draw_lgp_kelvin_helmholtz(const PatternRenderContext& context) {
 
         float hue = fmodf(time * 0.01f + vortexStrength * 0.3f, 1.0f);
 
-        leds[i] = color_from_palette(params.palette_id, hue, brightness);
+        leds[i] = palette.get(hue, brightness);
     }
 
     apply_background_overlay(context);
@@ -44,18 +44,8 @@ inline float get_dominant_chroma_hue(const AudioDataSnapshot& audio) {
 		return 0.0f;  // Default to C if no audio available
 	}
 
-	float max_chroma = 0.0f;
-	uint16_t max_index = 0;
-
-	for (uint16_t i = 0; i < 12; i++) {
-		if (audio.payload.chromagram[i] > max_chroma) {
-			max_chroma = audio.payload.chromagram[i];
-			max_index = i;
-		}
-	}
-
 	// Map chromagram index (0-11) to hue (0.0-1.0)
-	return (float)max_index / 12.0f;
+	return (float)audio.payload.features.chroma_peak / 12.0f;
 }
 
 inline void draw_pulse(const PatternRenderContext& context) {
@@ -68,7 +58,7 @@ inline void draw_pulse(const PatternRenderContext& context) {
     #define AUDIO_AGE_MS() ((uint32_t)((esp_timer_get_time() - audio.payload.timestamp_us) / 1000))
     #define AUDIO_VU (audio.payload.vu_level)
     #define AUDIO_NOVELTY (audio.payload.novelty_curve)
-    #define AUDIO_KICK() get_audio_band_energy(audio, KICK_START, KICK_END)
+    #define AUDIO_KICK() (audio.payload.features.kick)
 
     // Frame-rate independent delta time
     static float last_time_pulse = 0.0f;
@@ -32,6 +32,7 @@ extern bool tempo_debug_enabled;
 
 inline void draw_spectrum(const PatternRenderContext& context) {
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
     (void)context.time;  // unused
     (void)context.num_leds;  // using NUM_LEDS macro instead
@@ -51,8 +52,7 @@ inline void draw_spectrum(const PatternRenderContext& context) {
 
 	// Fallback to ambient if no audio
 	if (!AUDIO_IS_AVAILABLE()) {
-        CRGBF ambient_color = color_from_palette(
-            params.palette_id,
+        CRGBF ambient_color = palette.get(
             clip_float(params.color),
             clip_float(params.background) * 0.25f
         );
@@ -99,7 +99,7 @@ inline void draw_spectrum(const PatternRenderContext& context) {
 		magnitude = response_sqrt(magnitude) * age_factor;
 
 		// Get color from palette using progress and magnitude
-		CRGBF color = color_from_palette(params.palette_id, progress, magnitude);
+		CRGBF color = palette.get(progress, magnitude);
 
 		// Mirror from center (centre-origin architecture)
 		int left_index = wrap_idx(((NUM_LEDS / 2) - 1 - i) + SPECTRUM_CENTER_OFFSET);
@@ -119,6 +119,7 @@ inline void draw_spectrum(const PatternRenderContext& context) {
 inline void draw_octave(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
     (void)context.num_leds;  // using NUM_LEDS macro instead
     const AudioDataSnapshot& audio = context.audio_snapshot;
@@ -133,8 +134,7 @@ inline void draw_octave(const PatternRenderContext& context) {
         float phase = fmodf(time * params.speed * 0.5f, 1.0f);
         for (int i = 0; i < NUM_LEDS; i++) {
             float position = fmodf(phase + (float)i / NUM_LEDS, 1.0f);
-            leds[i] = color_from_palette(
-                params.palette_id,
+            leds[i] = palette.get(
                 position,
                 clip_float(params.background) * 0.25f
             );
@@ -173,7 +173,7 @@ inline void draw_octave(const PatternRenderContext& context) {
 		magnitude = fmaxf(0.0f, fminf(1.0f, magnitude));
 
 		// Get color from palette
-		CRGBF color = color_from_palette(params.palette_id, progress, magnitude);
+		CRGBF color = palette.get(progress, magnitude);
 
 		// Mirror from center
 		int left_index = (NUM_LEDS / 2) - 1 - i;
@@ -194,6 +194,7 @@ inline void draw_octave(const PatternRenderContext& context) {
 inline void draw_waveform_spectrum(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
     (void)context.num_leds;  // using NUM_LEDS macro instead
     const AudioDataSnapshot& audio = context.audio_snapshot;
@@ -224,14 +225,12 @@ inline void draw_waveform_spectrum(const PatternRenderContext& context) {
         // --- Phase 2: Calculate Waveform Envelope using REAL samples ---
         // Emotiscope pulled actual waveform slices; using memset here previously
         // destroyed the entire visual. Sample from sample_history tail for parity.
-        extern float sample_history[SAMPLE_HISTORY_LENGTH];
-        const int history_tail = SAMPLE_HISTORY_LENGTH - 1;
         const int samples_per_slot = fmax(1, SAMPLE_HISTORY_LENGTH / half_leds);
 
         for (int i = 0; i < half_leds; i++) {
-            int sample_idx = history_tail - i * samples_per_slot;
-            if (sample_idx < 0) sample_idx = 0;
-            float waveform_brightness = fabsf(sample_history[sample_idx]);
+            int sample_age = i * samples_per_slot;
+            if (sample_age > SAMPLE_HISTORY_LENGTH - 1) sample_age = SAMPLE_HISTORY_LENGTH - 1;
+            float waveform_brightness = fabsf(sample_ring_at(&sample_history, sample_age));
             waveform_brightness = clip_float(waveform_brightness * 2.0f); // legacy scale
             waveform_brightness = waveform_brightness * waveform_brightness;
 
@@ -270,8 +269,7 @@ inline void draw_waveform_spectrum(const PatternRenderContext& context) {
 
             // Map frequency to palette color with modulation
             float palette_progress = clip_float(dominant_chroma_hue + (freq_progress * 0.5f));
-            CRGBF freq_color = color_from_palette(
-                params.palette_id,
+            CRGBF freq_color = palette.get(
                 palette_progress,
                 blended_brightness  // Brightness = chromagram × waveform envelope
             );
@@ -297,8 +295,7 @@ inline void draw_waveform_spectrum(const PatternRenderContext& context) {
         float breath = 0.3f + 0.2f * sinf(breath_phase);
         for (int i = 0; i < half_leds; i++) {
             float progress = (float)i / (float)half_leds;
-            CRGBF idle_color = color_from_palette(
-                params.palette_id,
+            CRGBF idle_color = palette.get(
                 progress,
                 breath * waveform_history[i]  // Use decayed waveform history as brightness
             );
@@ -41,6 +41,7 @@ static float tunnel_glow_last_time = 0.0f;
 inline void draw_beat_tunnel(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
     (void)context.num_leds;  // using NUM_LEDS macro instead
     const AudioDataSnapshot& audio = context.audio_snapshot;
@@ -82,7 +83,7 @@ inline void draw_beat_tunnel(const PatternRenderContext& context) {
 			float led_pos = LED_PROGRESS(i);
 			float distance = fabsf(led_pos - (position * 0.5f + 0.5f));
 			float brightness = expf(-(distance * distance) / (2.0f * 0.08f * 0.08f));
-			CRGBF color = color_from_palette(params.palette_id, led_pos, brightness);
+			CRGBF color = palette.get(led_pos, brightness);
 			beat_tunnel_image[ch_idx][i].r += color.r * brightness;
 			beat_tunnel_image[ch_idx][i].g += color.g * brightness;
 			beat_tunnel_image[ch_idx][i].b += color.b * brightness;
@@ -108,7 +109,7 @@ inline void draw_beat_tunnel(const PatternRenderContext& context) {
                 float dist = (float)dx / (float)half_leds;
                 float gauss = expf(-(dist * dist) / (2.0f * sigma * sigma));
                 float b = clip_float(strength * gauss);
-                CRGBF c = color_from_palette(params.palette_id, p_led, b);
+                CRGBF c = palette.get(p_led, b);
                 int left_index = (half_leds - 1) - i_local;
                 int right_index = half_leds + i_local;
                 beat_tunnel_image[ch_idx][left_index].r += c.r * b;
@@ -127,7 +128,7 @@ inline void draw_beat_tunnel(const PatternRenderContext& context) {
                 float led_pos = LED_PROGRESS(i);
                 float distance = fabsf(led_pos - (position * 0.5f + 0.5f));
                 float brightness = vu * expf(-(distance * distance) / (2.0f * 0.06f * 0.06f));
-                CRGBF color = color_from_palette(params.palette_id, led_pos, brightness);
+                CRGBF color = palette.get(led_pos, brightness);
                 beat_tunnel_image[ch_idx][i].r += color.r * brightness;
                 beat_tunnel_image[ch_idx][i].g += color.g * brightness;
                 beat_tunnel_image[ch_idx][i].b += color.b * brightness;
@@ -165,6 +166,7 @@ inline void draw_beat_tunnel(const PatternRenderContext& context) {
 inline void draw_beat_tunnel_variant(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
     (void)context.num_leds;  // using NUM_LEDS macro instead
     const AudioDataSnapshot& audio = context.audio_snapshot;
@@ -199,7 +201,7 @@ inline void draw_beat_tunnel_variant(const PatternRenderContext& context) {
 			float brightness = expf(-(distance * distance) / (2.0f * 0.08f * 0.08f));
 			brightness = fmaxf(0.0f, fminf(1.0f, brightness));
 
-			CRGBF color = color_from_palette(params.palette_id, led_pos, brightness * 0.5f);
+			CRGBF color = palette.get(led_pos, brightness * 0.5f);
 
             beat_tunnel_variant_image[ch_idx][i].r += color.r * brightness;
             beat_tunnel_variant_image[ch_idx][i].g += color.g * brightness;
@@ -226,7 +228,7 @@ inline void draw_beat_tunnel_variant(const PatternRenderContext& context) {
                 float dist = (float)dx / (float)half_leds;
                 float gauss = expf(-(dist * dist) / (2.0f * sigma * sigma));
                 float b = clip_float(strength * gauss);
-                CRGBF c = color_from_palette(params.palette_id, p_led, b);
+                CRGBF c = palette.get(p_led, b);
                 int left_index = (half_leds - 1) - i_local;
                 int right_index = half_leds + i_local;
                 beat_tunnel_variant_image[ch_idx][left_index].r += c.r * b;
@@ -245,7 +247,7 @@ inline void draw_beat_tunnel_variant(const PatternRenderContext& context) {
                 float led_pos = LED_PROGRESS(i);
                 float distance = fabsf(led_pos - position);
                 float brightness = vu * expf(-(distance * distance) / (2.0f * 0.06f * 0.06f));
-                CRGBF color = color_from_palette(params.palette_id, led_pos, brightness * 0.5f);
+                CRGBF color = palette.get(led_pos, brightness * 0.5f);
                 beat_tunnel_variant_image[ch_idx][i].r += color.r * brightness;
                 beat_tunnel_variant_image[ch_idx][i].g += color.g * brightness;
                 beat_tunnel_variant_image[ch_idx][i].b += color.b * brightness;
@@ -285,6 +287,7 @@ inline void draw_beat_tunnel_variant(const PatternRenderContext& context) {
 inline void draw_tunnel_glow(const PatternRenderContext& context) {
     const float time = context.time;
     const PatternParameters& params = context.params;
+    const PaletteCache& palette = palette_cache_for(params.palette_id);
     CRGBF* leds = context.leds;
     (void)context.num_leds;  // using NUM_LEDS macro instead
     const AudioDataSnapshot& audio = context.audio_snapshot;
@@ -317,7 +320,7 @@ inline void draw_tunnel_glow(const PatternRenderContext& context) {
             float dist = fabsf(led_pos - position);
             float brightness = expf(-dist * dist / (2.0f * width * width));
 
-            CRGBF color = color_from_palette(params.palette_id, led_pos, brightness);
+            CRGBF color = palette.get(led_pos, brightness);
             tunnel_glow_image[i] = tunnel_glow_image_prev[i] + color * vu;
         }
     } else {
@@ -328,7 +331,7 @@ inline void draw_tunnel_glow(const PatternRenderContext& context) {
             float dist = fabsf(led_pos - position);
             float brightness = expf(-dist * dist / (2.0f * width * width));
 
-            CRGBF color = color_from_palette(params.palette_id, led_pos, brightness);
+            CRGBF color = palette.get(led_pos, brightness);
             tunnel_glow_image[i] = tunnel_glow_image_prev[i] + color * 0.5f;
         }
     }
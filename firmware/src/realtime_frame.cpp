@@ -0,0 +1,265 @@
+// Binary realtime telemetry codec (see realtime_frame.h for the wire format)
+
+#include "realtime_frame.h"
+#include <math.h>
+#include <string.h>
+
+namespace {
+
+// State record layout (byte offsets)
+enum : uint16_t {
+    OFF_FPS = 0,                // u16, 0.1 fps
+    OFF_FRAME_TIME_US = 2,      // u16, us (saturating)
+    OFF_RENDER_US = 4,          // u16, us
+    OFF_QUANTIZE_US = 6,        // u16, us
+    OFF_RMT_WAIT_US = 8,        // u16, us
+    OFF_RMT_TX_US = 10,         // u16, us
+    OFF_CPU = 12,               // u8, 0.5 %
+    OFF_MEMORY = 13,            // u8, 0.5 %
+    OFF_MEMORY_FREE_KB = 14,    // u16, KB
+    OFF_VU = 16,                // u8 unit
+    OFF_VU_RAW = 17,            // u8 unit
+    OFF_TEMPO_CONFIDENCE = 18,  // u8 unit
+    OFF_LOCKED_BPM = 19,        // u16, 0.1 BPM
+    OFF_LOCK_STATE = 21,        // u8
+    OFF_SPECTRUM = 22,          // u8 unit x 64
+    OFF_CHROMA = OFF_SPECTRUM + REALTIME_FRAME_SPECTRUM_BINS,  // u8 unit x 12
+    OFF_PARAMS = OFF_CHROMA + REALTIME_FRAME_CHROMA_BINS,      // u8 unit x 9, palette u8, u8 unit x 3
+    OFF_CURRENT_PATTERN = OFF_PARAMS + 13,                     // u8
+    STATE_END = OFF_CURRENT_PATTERN + 1,
+};
+
+static_assert(STATE_END == REALTIME_FRAME_STATE_BYTES, "state record layout out of sync");
+static_assert(REALTIME_FRAME_STATE_BYTES % 8 == 0, "bitmap assumes whole bytes");
+
+static inline uint8_t q_unit(float v) {
+    if (!(v > 0.0f)) return 0;
+    if (v >= 1.0f) return 255;
+    return (uint8_t)lroundf(v * 255.0f);
+}
+
+static inline uint8_t q_u8(float v, float scale) {
+    float s = v * scale;
+    if (!(s > 0.0f)) return 0;
+    if (s >= 255.0f) return 255;
+    return (uint8_t)lroundf(s);
+}
+
+static inline uint16_t q_u16(float v, float scale) {
+    float s = v * scale;
+    if (!(s > 0.0f)) return 0;
+    if (s >= 65535.0f) return 65535;
+    return (uint16_t)lroundf(s);
+}
+
+static inline void put_u16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static inline uint16_t get_u16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline void put_u32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)((v >> 8) & 0xFF);
+    p[2] = (uint8_t)((v >> 16) & 0xFF);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static inline uint32_t get_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline float dq_unit(uint8_t v) { return v / 255.0f; }
+
+static void write_header(uint8_t* out, uint8_t flags, uint16_t seq, uint16_t base_seq, uint32_t timestamp_ms) {
+    out[0] = REALTIME_FRAME_MAGIC0;
+    out[1] = REALTIME_FRAME_MAGIC1;
+    out[2] = REALTIME_FRAME_VERSION;
+    out[3] = flags;
+    put_u16(out + 4, seq);
+    put_u16(out + 6, base_seq);
+    put_u32(out + 8, timestamp_ms);
+}
+
+} // namespace
+
+void realtime_frame_quantize(const RealtimeFrameData* d, uint8_t* s) {
+    put_u16(s + OFF_FPS, q_u16(d->fps, 10.0f));
+    put_u16(s + OFF_FRAME_TIME_US, d->frame_time_us > 65535u ? 65535 : (uint16_t)d->frame_time_us);
+    put_u16(s + OFF_RENDER_US, q_u16(d->render_avg_us, 1.0f));
+    put_u16(s + OFF_QUANTIZE_US, q_u16(d->quantize_avg_us, 1.0f));
+    put_u16(s + OFF_RMT_WAIT_US, q_u16(d->rmt_wait_avg_us, 1.0f));
+    put_u16(s + OFF_RMT_TX_US, q_u16(d->rmt_tx_avg_us, 1.0f));
+    s[OFF_CPU] = q_u8(d->cpu_percent, 2.0f);
+    s[OFF_MEMORY] = q_u8(d->memory_percent, 2.0f);
+    put_u16(s + OFF_MEMORY_FREE_KB, d->memory_free_kb > 65535u ? 65535 : (uint16_t)d->memory_free_kb);
+
+    s[OFF_VU] = q_unit(d->vu_level);
+    s[OFF_VU_RAW] = q_unit(d->vu_level_raw);
+    s[OFF_TEMPO_CONFIDENCE] = q_unit(d->tempo_confidence);
+    put_u16(s + OFF_LOCKED_BPM, q_u16(d->locked_tempo_bpm, 10.0f));
+    s[OFF_LOCK_STATE] = d->tempo_lock_state;
+    for (uint16_t i = 0; i < REALTIME_FRAME_SPECTRUM_BINS; i++) {
+        s[OFF_SPECTRUM + i] = q_unit(d->spectrum[i]);
+    }
+    for (uint16_t i = 0; i < REALTIME_FRAME_CHROMA_BINS; i++) {
+        s[OFF_CHROMA + i] = q_unit(d->chromagram[i]);
+    }
+
+    uint8_t* p = s + OFF_PARAMS;
+    p[0] = q_unit(d->brightness);
+    p[1] = q_unit(d->softness);
+    p[2] = q_unit(d->color);
+    p[3] = q_unit(d->color_range);
+    p[4] = q_unit(d->saturation);
+    p[5] = q_unit(d->warmth);
+    p[6] = q_unit(d->background);
+    p[7] = q_unit(d->dithering);
+    p[8] = q_unit(d->speed);
+    p[9] = d->palette_id;
+    p[10] = q_unit(d->custom_param_1);
+    p[11] = q_unit(d->custom_param_2);
+    p[12] = q_unit(d->custom_param_3);
+    s[OFF_CURRENT_PATTERN] = d->current_pattern;
+}
+
+void realtime_frame_dequantize(const uint8_t* s, RealtimeFrameData* d) {
+    d->fps = get_u16(s + OFF_FPS) / 10.0f;
+    d->frame_time_us = get_u16(s + OFF_FRAME_TIME_US);
+    d->render_avg_us = get_u16(s + OFF_RENDER_US);
+    d->quantize_avg_us = get_u16(s + OFF_QUANTIZE_US);
+    d->rmt_wait_avg_us = get_u16(s + OFF_RMT_WAIT_US);
+    d->rmt_tx_avg_us = get_u16(s + OFF_RMT_TX_US);
+    d->cpu_percent = s[OFF_CPU] / 2.0f;
+    d->memory_percent = s[OFF_MEMORY] / 2.0f;
+    d->memory_free_kb = get_u16(s + OFF_MEMORY_FREE_KB);
+
+    d->vu_level = dq_unit(s[OFF_VU]);
+    d->vu_level_raw = dq_unit(s[OFF_VU_RAW]);
+    d->tempo_confidence = dq_unit(s[OFF_TEMPO_CONFIDENCE]);
+    d->locked_tempo_bpm = get_u16(s + OFF_LOCKED_BPM) / 10.0f;
+    d->tempo_lock_state = s[OFF_LOCK_STATE];
+    for (uint16_t i = 0; i < REALTIME_FRAME_SPECTRUM_BINS; i++) {
+        d->spectrum[i] = dq_unit(s[OFF_SPECTRUM + i]);
+    }
+    for (uint16_t i = 0; i < REALTIME_FRAME_CHROMA_BINS; i++) {
+        d->chromagram[i] = dq_unit(s[OFF_CHROMA + i]);
+    }
+
+    const uint8_t* p = s + OFF_PARAMS;
+    d->brightness = dq_unit(p[0]);
+    d->softness = dq_unit(p[1]);
+    d->color = dq_unit(p[2]);
+    d->color_range = dq_unit(p[3]);
+    d->saturation = dq_unit(p[4]);
+    d->warmth = dq_unit(p[5]);
+    d->background = dq_unit(p[6]);
+    d->dithering = dq_unit(p[7]);
+    d->speed = dq_unit(p[8]);
+    d->palette_id = p[9];
+    d->custom_param_1 = dq_unit(p[10]);
+    d->custom_param_2 = dq_unit(p[11]);
+    d->custom_param_3 = dq_unit(p[12]);
+    d->current_pattern = s[OFF_CURRENT_PATTERN];
+}
+
+void realtime_frame_encoder_reset(RealtimeFrameEncoder* enc) {
+    enc->has_state = false;
+    enc->frames_since_keyframe = 0;
+}
+
+size_t realtime_frame_encode(RealtimeFrameEncoder* enc, const RealtimeFrameData* data,
+                             uint32_t timestamp_ms, uint8_t* out, size_t cap) {
+    if (cap < REALTIME_FRAME_MAX_BYTES) return 0;
+
+    uint8_t state[REALTIME_FRAME_STATE_BYTES];
+    realtime_frame_quantize(data, state);
+
+    const uint16_t base_seq = enc->seq;
+    const uint16_t seq = (uint16_t)(enc->seq + 1);
+    uint8_t* body = out + REALTIME_FRAME_HEADER_BYTES;
+
+    bool keyframe = !enc->has_state || enc->frames_since_keyframe >= REALTIME_FRAME_KEYFRAME_INTERVAL;
+    size_t body_len = REALTIME_FRAME_STATE_BYTES;
+    if (!keyframe) {
+        // Delta: bitmap + changed bytes; fall back to a keyframe if that is not smaller
+        uint8_t* bitmap = body;
+        uint8_t* changed = body + REALTIME_FRAME_BITMAP_BYTES;
+        size_t n_changed = 0;
+        memset(bitmap, 0, REALTIME_FRAME_BITMAP_BYTES);
+        for (uint16_t i = 0; i < REALTIME_FRAME_STATE_BYTES; i++) {
+            if (state[i] != enc->state[i]) {
+                bitmap[i >> 3] |= (uint8_t)(1u << (i & 7));
+                if (REALTIME_FRAME_BITMAP_BYTES + n_changed < REALTIME_FRAME_STATE_BYTES) {
+                    changed[n_changed] = state[i];
+                }
+                n_changed++;
+            }
+        }
+        body_len = REALTIME_FRAME_BITMAP_BYTES + n_changed;
+        if (body_len >= REALTIME_FRAME_STATE_BYTES) keyframe = true;
+    }
+
+    if (keyframe) {
+        memcpy(body, state, REALTIME_FRAME_STATE_BYTES);
+        body_len = REALTIME_FRAME_STATE_BYTES;
+        write_header(out, REALTIME_FRAME_FLAG_KEYFRAME, seq, seq, timestamp_ms);
+        enc->frames_since_keyframe = 0;
+    } else {
+        write_header(out, 0, seq, base_seq, timestamp_ms);
+        enc->frames_since_keyframe++;
+    }
+
+    memcpy(enc->state, state, REALTIME_FRAME_STATE_BYTES);
+    enc->seq = seq;
+    enc->has_state = true;
+    return REALTIME_FRAME_HEADER_BYTES + body_len;
+}
+
+void realtime_frame_decoder_reset(RealtimeFrameDecoder* dec) {
+    dec->seq = 0;
+    dec->has_state = false;
+}
+
+RealtimeDecodeResult realtime_frame_decode(RealtimeFrameDecoder* dec, const uint8_t* in, size_t len,
+                                           RealtimeFrameData* data, uint32_t* timestamp_ms) {
+    if (len < REALTIME_FRAME_HEADER_BYTES) return REALTIME_DECODE_TRUNCATED;
+    if (in[0] != REALTIME_FRAME_MAGIC0 || in[1] != REALTIME_FRAME_MAGIC1) return REALTIME_DECODE_BAD_MAGIC;
+    if (in[2] != REALTIME_FRAME_VERSION) return REALTIME_DECODE_BAD_VERSION;
+
+    const uint8_t flags = in[3];
+    const uint16_t seq = get_u16(in + 4);
+    const uint16_t base_seq = get_u16(in + 6);
+    const uint8_t* body = in + REALTIME_FRAME_HEADER_BYTES;
+    const size_t body_len = len - REALTIME_FRAME_HEADER_BYTES;
+
+    uint8_t state[REALTIME_FRAME_STATE_BYTES];
+    if (flags & REALTIME_FRAME_FLAG_KEYFRAME) {
+        if (body_len < REALTIME_FRAME_STATE_BYTES) return REALTIME_DECODE_TRUNCATED;
+        memcpy(state, body, REALTIME_FRAME_STATE_BYTES);
+    } else {
+        if (!dec->has_state || base_seq != dec->seq) return REALTIME_DECODE_NEED_KEYFRAME;
+        if (body_len < REALTIME_FRAME_BITMAP_BYTES) return REALTIME_DECODE_TRUNCATED;
+        const uint8_t* bitmap = body;
+        const uint8_t* changed = body + REALTIME_FRAME_BITMAP_BYTES;
+        const size_t n_available = body_len - REALTIME_FRAME_BITMAP_BYTES;
+        size_t n_used = 0;
+        memcpy(state, dec->state, REALTIME_FRAME_STATE_BYTES);
+        for (uint16_t i = 0; i < REALTIME_FRAME_STATE_BYTES; i++) {
+            if (bitmap[i >> 3] & (1u << (i & 7))) {
+                if (n_used >= n_available) return REALTIME_DECODE_TRUNCATED;
+                state[i] = changed[n_used++];
+            }
+        }
+    }
+
+    memcpy(dec->state, state, REALTIME_FRAME_STATE_BYTES);
+    dec->seq = seq;
+    dec->has_state = true;
+    realtime_frame_dequantize(state, data);
+    if (timestamp_ms) *timestamp_ms = get_u32(in + 8);
+    return REALTIME_DECODE_OK;
+}
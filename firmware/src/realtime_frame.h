@@ -0,0 +1,135 @@
+// Binary realtime telemetry frames for the /ws WebSocket.
+//
+// Carries the same fields as the JSON "realtime" message (plus the spectrum
+// and chromagram) in a fixed, versioned layout. Every value is quantized into
+// a 112-byte state record; a frame is either a keyframe (the whole record) or a
+// delta against the previous frame (changed-byte bitmap + changed bytes).
+//
+// Wire format (little-endian):
+//   header   [0..1]  magic 'K' '1'
+//            [2]     version (REALTIME_FRAME_VERSION)
+//            [3]     flags (REALTIME_FRAME_FLAG_*)
+//            [4..5]  seq       frame sequence number
+//            [6..7]  base_seq  delta: seq this frame applies to (keyframe: = seq)
+//            [8..11] timestamp_ms
+//   keyframe body    state record (REALTIME_FRAME_STATE_BYTES)
+//   delta body       bitmap (REALTIME_FRAME_BITMAP_BYTES, bit i = byte i changed)
+//                    followed by the changed bytes in record order
+//
+// Pure C++ (no Arduino dependencies) so the codec can be unit tested on host;
+// tools/mock-device-server/realtime_frame.js mirrors it for the browser side.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// CONFIGURATION & CONSTANTS
+// ============================================================================
+
+#define REALTIME_FRAME_MAGIC0 'K'
+#define REALTIME_FRAME_MAGIC1 '1'
+#define REALTIME_FRAME_VERSION 1
+
+#define REALTIME_FRAME_FLAG_KEYFRAME 0x01
+
+#define REALTIME_FRAME_SPECTRUM_BINS 64
+#define REALTIME_FRAME_CHROMA_BINS 12
+
+#define REALTIME_FRAME_HEADER_BYTES 12
+#define REALTIME_FRAME_STATE_BYTES 112
+#define REALTIME_FRAME_BITMAP_BYTES (REALTIME_FRAME_STATE_BYTES / 8)
+#define REALTIME_FRAME_MAX_BYTES (REALTIME_FRAME_HEADER_BYTES + REALTIME_FRAME_STATE_BYTES)
+
+// Force a keyframe at least this often so a client that missed a frame (send
+// queue overflow) or joined late resynchronizes within ~1 s at 30 Hz
+#define REALTIME_FRAME_KEYFRAME_INTERVAL 30
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+// Unquantized telemetry (units match the JSON "realtime" message)
+typedef struct {
+    // Performance
+    float fps;
+    uint32_t frame_time_us;
+    float render_avg_us;
+    float quantize_avg_us;
+    float rmt_wait_avg_us;
+    float rmt_tx_avg_us;
+    float cpu_percent;          // 0-100
+    float memory_percent;       // 0-100
+    uint32_t memory_free_kb;
+
+    // Audio
+    float vu_level;             // 0.0-1.0
+    float vu_level_raw;         // 0.0-1.0
+    float tempo_confidence;     // 0.0-1.0
+    float locked_tempo_bpm;
+    uint8_t tempo_lock_state;   // TempoLockState
+    float spectrum[REALTIME_FRAME_SPECTRUM_BINS];   // 0.0-1.0
+    float chromagram[REALTIME_FRAME_CHROMA_BINS];   // 0.0-1.0
+
+    // Parameters (0.0-1.0 unless noted)
+    float brightness;
+    float softness;
+    float color;
+    float color_range;
+    float saturation;
+    float warmth;
+    float background;
+    float dithering;
+    float speed;
+    uint8_t palette_id;
+    float custom_param_1;
+    float custom_param_2;
+    float custom_param_3;
+
+    uint8_t current_pattern;
+} RealtimeFrameData;
+
+typedef struct {
+    uint8_t state[REALTIME_FRAME_STATE_BYTES];  // Last record sent
+    uint16_t seq;
+    uint16_t frames_since_keyframe;
+    bool has_state;                             // false: next frame is a keyframe
+} RealtimeFrameEncoder;
+
+typedef struct {
+    uint8_t state[REALTIME_FRAME_STATE_BYTES];  // Last record applied
+    uint16_t seq;
+    bool has_state;
+} RealtimeFrameDecoder;
+
+typedef enum {
+    REALTIME_DECODE_OK = 0,
+    REALTIME_DECODE_BAD_MAGIC,
+    REALTIME_DECODE_BAD_VERSION,
+    REALTIME_DECODE_TRUNCATED,
+    REALTIME_DECODE_NEED_KEYFRAME,   // Delta against a frame this decoder has not seen
+} RealtimeDecodeResult;
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// Quantize telemetry into a state record / expand a record back
+void realtime_frame_quantize(const RealtimeFrameData* data, uint8_t* state);
+void realtime_frame_dequantize(const uint8_t* state, RealtimeFrameData* data);
+
+// Forget the previous record; the next encoded frame is a keyframe
+void realtime_frame_encoder_reset(RealtimeFrameEncoder* enc);
+
+// Encode one frame into out (cap >= REALTIME_FRAME_MAX_BYTES). Emits a delta
+// when it is smaller than a keyframe. Returns bytes written, 0 if cap is short.
+size_t realtime_frame_encode(RealtimeFrameEncoder* enc, const RealtimeFrameData* data,
+                             uint32_t timestamp_ms, uint8_t* out, size_t cap);
+
+void realtime_frame_decoder_reset(RealtimeFrameDecoder* dec);
+
+// Apply one frame. On REALTIME_DECODE_OK, data (and timestamp_ms if non-null)
+// hold the decoded telemetry; on any error the decoder state is unchanged.
+RealtimeDecodeResult realtime_frame_decode(RealtimeFrameDecoder* dec, const uint8_t* in, size_t len,
+                                           RealtimeFrameData* data, uint32_t* timestamp_ms);
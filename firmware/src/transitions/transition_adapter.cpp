@@ -1,5 +1,7 @@
 #include "transition_adapter.hpp"
 #include "../pattern_registry.h"
+#include "../pattern_channel.h"
+#include "../shared_pattern_buffers.h"
 
 // Global transition adapter instance
 K1TransitionAdapter g_transition_adapter;
@@ -24,15 +26,19 @@ bool K1TransitionAdapter::beginTransition(
         return false;
     }
 
-    // Skip if transitions disabled
-    if (!transitions_enabled) {
-        // Just do instant switch
+    // Skip if transitions disabled, or instant switch if no render buffers are free
+    if (!transitions_enabled || !acquire_simple_buffer()) {
         g_current_pattern_index = to_pattern;
         return true;
     }
+    from_buffer = shared_pattern_buffers.shared_simple_buffer;
+    to_buffer = shared_pattern_buffers.shared_simple_buffer_prev;
 
-    // Capture current LED state as source
-    memcpy(source, leds, sizeof(source));
+    // Outgoing pattern continues from the current frame; incoming starts black
+    memcpy(from_buffer, leds, NUM_LEDS * sizeof(CRGBF));
+    for (uint16_t i = 0; i < NUM_LEDS; i++) {
+        to_buffer[i] = CRGBF(0.0f, 0.0f, 0.0f);
+    }
 
     // Store transition parameters
     from_pattern_index = g_current_pattern_index;
@@ -46,8 +52,8 @@ bool K1TransitionAdapter::beginTransition(
         duration_ms = default_duration_ms;
     }
 
-    // Start transition
-    engine.startTransition(source, target, output, type, duration_ms, default_curve);
+    // Start transition (blends straight into the main LED buffer)
+    engine.startTransition(from_buffer, to_buffer, leds, type, duration_ms, default_curve);
     active = true;
 
     return true;
@@ -58,44 +64,34 @@ bool K1TransitionAdapter::update(PatternRenderContext& context) {
         return false;
     }
 
-    // Render target pattern to target buffer
-    // Save current leds[] state
-    CRGBF temp_leds[NUM_LEDS];
-    memcpy(temp_leds, leds, sizeof(temp_leds));
-
-    // Clear leds[] buffer for target pattern rendering
-    for (uint16_t i = 0; i < NUM_LEDS; i++) {
-        leds[i] = CRGBF(0.0f, 0.0f, 0.0f);
-    }
-
-    // Render target pattern (writes to leds[])
-    const PatternInfo& pattern = g_pattern_registry[to_pattern_index];
-    pattern.draw_fn(context);
+    // Render both patterns live, each on its own pattern channel
+    const uint8_t to_channel = live_channel ^ 1;
 
-    // Copy rendered target pattern to target buffer
-    memcpy(target, leds, sizeof(target));
+    PatternRenderContext from_context(from_buffer, NUM_LEDS, context.time, context.params, context.audio_snapshot);
+    g_pattern_channel_index = live_channel;
+    g_pattern_registry[from_pattern_index].draw_fn(from_context);
 
-    // Restore original leds[] state
-    memcpy(leds, temp_leds, sizeof(leds));
+    PatternRenderContext to_context(to_buffer, NUM_LEDS, context.time, context.params, context.audio_snapshot);
+    g_pattern_channel_index = to_channel;
+    g_pattern_registry[to_pattern_index].draw_fn(to_context);
 
-    // Update transition engine
+    // Blend into leds[] (on completion the engine copies the incoming frame)
     bool stillActive = engine.update();
+    g_pattern_channel_index = live_channel;
 
     if (!stillActive) {
-        // Transition complete
+        // Transition complete: switch to target pattern on the channel it used
         active = false;
-
-        // Copy final output to main LED buffer
-        memcpy(leds, output, sizeof(output));
-
-        // Switch to target pattern
         g_current_pattern_index = to_pattern_index;
+        live_channel = to_channel;
+        g_pattern_channel_index = live_channel;
+
+        from_buffer = nullptr;
+        to_buffer = nullptr;
+        release_simple_buffer();
 
         return false;
     }
 
-    // Copy transition output to main LED buffer
-    memcpy(leds, output, sizeof(output));
-
     return true;
 }
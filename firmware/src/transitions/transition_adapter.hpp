@@ -8,20 +8,21 @@
  * K1.node1 Transition Adapter
  *
  * Manages transitions between patterns for K1.node1:
- * - Captures source pattern state before transition
- * - Renders target pattern during transition
- * - Blends source → target using TransitionEngine
- * - Writes final output to main LED buffer
+ * - Renders both the outgoing and incoming patterns live every frame
+ * - Each renders into a buffer borrowed from the shared pattern buffer pool,
+ *   on its own pattern channel (dual-channel static buffers never collide)
+ * - TransitionEngine blends the two straight into the main LED buffer
  *
- * Memory footprint: ~3 KB RAM (triple buffer + engine state)
+ * Cost per transition frame: one extra pattern render plus one blend pass.
+ * Memory footprint: engine state only; the two render buffers are the
+ * pool's simple buffer pair, held for the duration of the transition.
  */
 
 class K1TransitionAdapter {
 private:
-    // Triple buffer for transitions
-    CRGBF source[NUM_LEDS];    // Captured source pattern state
-    CRGBF target[NUM_LEDS];    // Rendered target pattern
-    CRGBF output[NUM_LEDS];    // Blended transition output
+    // Live render targets (outgoing, incoming) from the shared buffer pool
+    CRGBF* from_buffer = nullptr;
+    CRGBF* to_buffer = nullptr;
 
     // Transition engine instance
     TransitionEngine engine;
@@ -29,6 +30,10 @@ private:
     // Transition state
     bool active = false;
 
+    // Pattern channel of the live pattern; the incoming pattern renders on the
+    // other channel and keeps it once the transition completes
+    uint8_t live_channel = 0;
+
 public:
     // Public for REST API access
     uint8_t from_pattern_index = 0;
@@ -39,14 +44,7 @@ public:
     uint32_t default_duration_ms = 1000;
     EasingCurve default_curve = EASE_IN_OUT_QUAD;
     bool transitions_enabled = true;
-    K1TransitionAdapter() : engine(NUM_LEDS) {
-        // Initialize buffers to black
-        for (uint16_t i = 0; i < NUM_LEDS; i++) {
-            source[i] = CRGBF(0.0f, 0.0f, 0.0f);
-            target[i] = CRGBF(0.0f, 0.0f, 0.0f);
-            output[i] = CRGBF(0.0f, 0.0f, 0.0f);
-        }
-    }
+    K1TransitionAdapter() : engine(NUM_LEDS) {}
 
     /**
      * Start a transition to a new pattern
@@ -65,7 +63,7 @@ public:
     /**
      * Update transition state (call every frame)
      *
-     * @param context Pattern render context for target pattern
+     * @param context Pattern render context (time, params, audio) for both patterns
      * @return true if transition is active, false if completed
      */
     bool update(PatternRenderContext& context);  // Defined in .cpp file
@@ -75,6 +73,7 @@ public:
     float getProgress() const { return engine.getProgress(); }
     uint8_t getFromPattern() const { return from_pattern_index; }
     uint8_t getToPattern() const { return to_pattern_index; }
+    uint8_t getLiveChannel() const { return live_channel; }
     TransitionType getCurrentType() const { return engine.getCurrentType(); }
     uint32_t getCurrentDuration() const { return engine.getDuration(); }
 
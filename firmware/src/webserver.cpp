@@ -32,6 +32,7 @@
 #include "led_driver.h"                    // Access LED frame buffer
 #include "frame_metrics.h"                // Frame-level profiling history
 #include "transitions/transition_adapter.hpp"  // Transition control
+#include "realtime_frame.h"                // Binary realtime telemetry frames
 
 // Debug telemetry defaults (compile-time overrides)
 #ifndef REALTIME_WS_ENABLED_DEFAULT
@@ -40,6 +41,13 @@
 #ifndef REALTIME_WS_DEFAULT_INTERVAL_MS
 #define REALTIME_WS_DEFAULT_INTERVAL_MS 250
 #endif
+// Binary stream default (~30 Hz) and floor (~60 Hz); JSON keeps interval_ms
+#ifndef REALTIME_WS_BINARY_DEFAULT_INTERVAL_MS
+#define REALTIME_WS_BINARY_DEFAULT_INTERVAL_MS 33
+#endif
+#define REALTIME_WS_BINARY_MIN_INTERVAL_MS 16
+// Connected clients tracked for per-client format negotiation
+#define REALTIME_WS_MAX_TRACKED_CLIENTS 16
 
 // Forward declaration: WebSocket event handler
 static void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len);
@@ -611,6 +619,11 @@ public:
             }
         }
 
+        // Gain and floor survive reboots (written by the audio task, warm-start record)
+        if (json.containsKey("microphone_gain") || json.containsKey("vu_floor_pct")) {
+            save_config();
+        }
+
         StaticJsonDocument<128> response_doc;
         response_doc["microphone_gain"] = configuration.microphone_gain;
         response_doc["active"] = EMOTISCOPE_ACTIVE;
@@ -691,6 +704,63 @@ public:
     }
 };
 
+// Analysis profiles with their measured cost (GET/POST /api/audio/profile)
+static String build_audio_profile_json() {
+    StaticJsonDocument<1024> doc;
+    const uint8_t active = get_analysis_profile();
+    doc["active"] = ANALYSIS_PROFILES[active].name;
+    doc["cpu_mhz"] = ANALYSIS_CPU_MHZ;
+    JsonArray profiles = doc.createNestedArray("profiles");
+    for (uint8_t i = 0; i < ANALYSIS_PROFILE_COUNT; i++) {
+        const AnalysisProfile& profile = ANALYSIS_PROFILES[i];
+        const AnalysisProfileStats stats = get_analysis_profile_stats(i);
+        JsonObject entry = profiles.createNestedObject();
+        entry["name"] = profile.name;
+        entry["description"] = profile.description;
+        entry["bins"] = analysis_profile_num_bins(&profile, NUM_FREQS);
+        entry["block_scale"] = profile.block_scale;
+        entry["hop_chunks"] = profile.hop_chunks;
+        entry["frames_measured"] = stats.frames;
+        entry["cycles_per_frame"] = (uint32_t)stats.cycles_per_frame;
+        entry["peak_cycles"] = stats.peak_cycles;
+        entry["us_per_frame"] = stats.cycles_per_frame / ANALYSIS_CPU_MHZ;
+    }
+    String output;
+    serializeJson(doc, output);
+    return output;
+}
+
+// GET /api/audio/profile - Analysis profiles and their measured cost
+class GetAudioProfileHandler : public K1RequestHandler {
+public:
+    GetAudioProfileHandler() : K1RequestHandler(ROUTE_AUDIO_PROFILE, ROUTE_GET) {}
+    void handle(RequestContext& ctx) override {
+        ctx.sendJson(200, build_audio_profile_json());
+    }
+};
+
+// POST /api/audio/profile - Switch analysis profile by name ({"profile":"low_latency"})
+class PostAudioProfileHandler : public K1RequestHandler {
+public:
+    PostAudioProfileHandler() : K1RequestHandler(ROUTE_AUDIO_PROFILE, ROUTE_POST) {}
+    void handle(RequestContext& ctx) override {
+        if (!ctx.hasJson()) {
+            ctx.sendError(400, "invalid_json", "Request body contains invalid JSON");
+            return;
+        }
+
+        JsonObjectConst json = ctx.getJson();
+        const int index = analysis_profile_find(json["profile"].as<const char*>());
+        if (index < 0) {
+            ctx.sendError(400, "invalid_value", "Unknown profile (see GET /api/audio/profile)");
+            return;
+        }
+        set_analysis_profile((uint8_t)index);
+        LOG_INFO(TAG_AUDIO, "Analysis profile requested: %s", ANALYSIS_PROFILES[index].name);
+        ctx.sendJson(200, build_audio_profile_json());
+    }
+};
+
 // GET /api/config/backup - Export current configuration as JSON
 class GetConfigBackupHandler : public K1RequestHandler {
 public:
@@ -1732,6 +1802,7 @@ public:
 // Forward declarations for realtime WebSocket config (defined later in file)
 extern bool s_realtime_ws_enabled;
 extern uint32_t s_realtime_ws_interval_ms;
+extern uint32_t s_realtime_ws_binary_interval_ms;
 
 class PostRealtimePresetHandler : public K1RequestHandler {
 public:
@@ -1897,6 +1968,7 @@ public:
 // GET /api/realtime/config - WebSocket realtime telemetry configuration
 bool s_realtime_ws_enabled = (REALTIME_WS_ENABLED_DEFAULT != 0);
 uint32_t s_realtime_ws_interval_ms = REALTIME_WS_DEFAULT_INTERVAL_MS;
+uint32_t s_realtime_ws_binary_interval_ms = REALTIME_WS_BINARY_DEFAULT_INTERVAL_MS;
 // NVS persistence for realtime websocket config
 static void load_realtime_ws_config_from_nvs() {
     Preferences prefs;
@@ -1905,11 +1977,15 @@ static void load_realtime_ws_config_from_nvs() {
     }
     bool enabled = prefs.getBool("enabled", s_realtime_ws_enabled);
     uint32_t interval = prefs.getUInt("interval_ms", s_realtime_ws_interval_ms);
+    uint32_t binary_interval = prefs.getUInt("bin_interval", s_realtime_ws_binary_interval_ms);
     prefs.end();
     s_realtime_ws_enabled = enabled;
     if (interval < 100) interval = 100;
     if (interval > 5000) interval = 5000;
     s_realtime_ws_interval_ms = interval;
+    if (binary_interval < REALTIME_WS_BINARY_MIN_INTERVAL_MS) binary_interval = REALTIME_WS_BINARY_MIN_INTERVAL_MS;
+    if (binary_interval > 5000) binary_interval = 5000;
+    s_realtime_ws_binary_interval_ms = binary_interval;
 }
 
 static void save_realtime_ws_config_to_nvs() {
@@ -1919,6 +1995,7 @@ static void save_realtime_ws_config_to_nvs() {
     }
     prefs.putBool("enabled", s_realtime_ws_enabled);
     prefs.putUInt("interval_ms", s_realtime_ws_interval_ms);
+    prefs.putUInt("bin_interval", s_realtime_ws_binary_interval_ms);
     prefs.end();
 }
 class GetRealtimeConfigHandler : public K1RequestHandler {
@@ -1928,6 +2005,8 @@ public:
         StaticJsonDocument<192> resp;
         resp["enabled"] = s_realtime_ws_enabled;
         resp["interval_ms"] = s_realtime_ws_interval_ms;
+        resp["binary_interval_ms"] = s_realtime_ws_binary_interval_ms;
+        resp["binary_version"] = REALTIME_FRAME_VERSION;
         String output;
         serializeJson(resp, output);
         ctx.sendJson(200, output);
@@ -1971,8 +2050,23 @@ public:
             updated = true;
         }
 
+        // Validate and apply 'binary_interval_ms' (optional, clamp 16..5000)
+        if (body.containsKey("binary_interval_ms")) {
+            if (!body["binary_interval_ms"].is<uint32_t>()) {
+                ctx.sendError(400, "invalid_param", "binary_interval_ms must be integer");
+                return;
+            }
+            uint32_t v = body["binary_interval_ms"].as<uint32_t>();
+            if (v < REALTIME_WS_BINARY_MIN_INTERVAL_MS || v > 5000) {
+                ctx.sendError(400, "invalid_param", "binary_interval_ms must be between 16 and 5000");
+                return;
+            }
+            s_realtime_ws_binary_interval_ms = v;
+            updated = true;
+        }
+
         if (!updated) {
-            ctx.sendError(400, "no_fields", "Provide enabled and/or interval_ms");
+            ctx.sendError(400, "no_fields", "Provide enabled, interval_ms and/or binary_interval_ms");
             return;
         }
 
@@ -1981,6 +2075,8 @@ public:
         StaticJsonDocument<192> resp;
         resp["enabled"] = s_realtime_ws_enabled;
         resp["interval_ms"] = s_realtime_ws_interval_ms;
+        resp["binary_interval_ms"] = s_realtime_ws_binary_interval_ms;
+        resp["binary_version"] = REALTIME_FRAME_VERSION;
         String output;
         serializeJson(resp, output);
         ctx.sendJson(200, output);
@@ -2172,6 +2268,7 @@ void init_webserver() {
     registerPostHandler(server, ROUTE_CONFIG_RESTORE, new PostConfigRestoreHandler());
     registerPostHandler(server, ROUTE_DIAG, new PostDiagHandler());
     registerPostHandler(server, ROUTE_AUDIO_NOISE_CAL, new PostAudioNoiseCalHandler());
+    registerPostHandler(server, ROUTE_AUDIO_PROFILE, new PostAudioProfileHandler());
 
     // Register GET handlers for diagnostics
     registerGetHandler(server, ROUTE_DIAG, new GetDiagHandler());
@@ -2184,6 +2281,7 @@ void init_webserver() {
     registerGetHandler(server, ROUTE_RMT, new GetRmtDiagHandler());
     registerGetHandler(server, ROUTE_AUDIO_TEMPO, new GetAudioTempoHandler());
     registerGetHandler(server, ROUTE_AUDIO_SNAPSHOT, new GetAudioSnapshotHandler());
+    registerGetHandler(server, ROUTE_AUDIO_PROFILE, new GetAudioProfileHandler());
     registerGetHandler(server, ROUTE_WIFI_STATUS, new GetWifiStatusHandler());
     registerGetHandler(server, "/api/wifi/scan/results", new GetWifiScanResultsHandler());
     registerGetHandler(server, ROUTE_PATTERN_CURRENT, new GetPatternCurrentHandler());
@@ -2421,17 +2519,141 @@ void handle_webserver() {
     }
 }
 
+// ============================================================================
+// REALTIME CLIENT FORMAT NEGOTIATION
+// ============================================================================
+// Clients start on JSON text frames. Sending {"type":"subscribe","format":"binary"}
+// switches a client to binary delta frames (realtime_frame.h);
+// {"type":"keyframe"} asks for a full frame after a decode gap.
+
+enum RealtimeClientFormat : uint8_t {
+    REALTIME_FORMAT_JSON = 0,
+    REALTIME_FORMAT_BINARY = 1,
+};
+
+struct RealtimeClientSlot {
+    uint32_t id;             // 0 = free
+    RealtimeClientFormat format;
+};
+
+// Written by the AsyncTCP task (connect, disconnect, subscribe), read by loop();
+// every access holds s_realtime_clients_lock. Never send while holding it.
+static RealtimeClientSlot s_realtime_clients[REALTIME_WS_MAX_TRACKED_CLIENTS];
+static portMUX_TYPE s_realtime_clients_lock = portMUX_INITIALIZER_UNLOCKED;
+static RealtimeFrameEncoder s_realtime_encoder;          // Owned by the loop() broadcaster
+static std::atomic<bool> s_realtime_keyframe_requested{false};  // Set from the AsyncTCP task
+
+// Caller holds s_realtime_clients_lock
+static RealtimeClientSlot* find_realtime_client(uint32_t id) {
+    for (uint8_t i = 0; i < REALTIME_WS_MAX_TRACKED_CLIENTS; i++) {
+        if (s_realtime_clients[i].id == id) return &s_realtime_clients[i];
+    }
+    return nullptr;
+}
+
+// Returns false when the table is full; the caller refuses the client, so
+// every connected client has a slot and frames never need a broadcast fallback
+static bool track_realtime_client(uint32_t id) {
+    portENTER_CRITICAL(&s_realtime_clients_lock);
+    RealtimeClientSlot* slot = find_realtime_client(0);
+    if (slot) {
+        slot->id = id;
+        slot->format = REALTIME_FORMAT_JSON;
+    }
+    portEXIT_CRITICAL(&s_realtime_clients_lock);
+    return slot != nullptr;
+}
+
+static void untrack_realtime_client(uint32_t id) {
+    portENTER_CRITICAL(&s_realtime_clients_lock);
+    RealtimeClientSlot* slot = find_realtime_client(id);
+    if (slot) slot->id = 0;
+    portEXIT_CRITICAL(&s_realtime_clients_lock);
+}
+
+// Copy the ids of the clients on one format, so frames go out without the lock held
+static uint8_t collect_realtime_clients(RealtimeClientFormat format, uint32_t* ids) {
+    uint8_t n = 0;
+    portENTER_CRITICAL(&s_realtime_clients_lock);
+    for (uint8_t i = 0; i < REALTIME_WS_MAX_TRACKED_CLIENTS; i++) {
+        if (s_realtime_clients[i].id != 0 && s_realtime_clients[i].format == format) {
+            ids[n++] = s_realtime_clients[i].id;
+        }
+    }
+    portEXIT_CRITICAL(&s_realtime_clients_lock);
+    return n;
+}
+
+static uint8_t count_realtime_clients(RealtimeClientFormat format, uint8_t* tracked_total) {
+    uint8_t n = 0, total = 0;
+    portENTER_CRITICAL(&s_realtime_clients_lock);
+    for (uint8_t i = 0; i < REALTIME_WS_MAX_TRACKED_CLIENTS; i++) {
+        if (s_realtime_clients[i].id == 0) continue;
+        total++;
+        if (s_realtime_clients[i].format == format) n++;
+    }
+    portEXIT_CRITICAL(&s_realtime_clients_lock);
+    if (tracked_total) *tracked_total = total;
+    return n;
+}
+
+// Handle {"type":"subscribe"|"keyframe"}; returns false for other messages
+static bool handle_realtime_control(AsyncWebSocketClient *client, const char* text) {
+    StaticJsonDocument<128> msg;
+    if (deserializeJson(msg, text) != DeserializationError::Ok) return false;
+    const char* type = msg["type"] | "";
+
+    if (strcmp(type, "subscribe") == 0) {
+        const char* format = msg["format"] | "json";
+        const bool want_binary = (strcmp(format, "binary") == 0);
+        portENTER_CRITICAL(&s_realtime_clients_lock);
+        RealtimeClientSlot* slot = find_realtime_client(client->id());
+        const bool binary = want_binary && slot != nullptr;
+        if (slot) slot->format = binary ? REALTIME_FORMAT_BINARY : REALTIME_FORMAT_JSON;
+        portEXIT_CRITICAL(&s_realtime_clients_lock);
+        // New binary subscriber needs a keyframe; resync everyone on the stream
+        if (binary) s_realtime_keyframe_requested.store(true, std::memory_order_relaxed);
+
+        StaticJsonDocument<128> resp;
+        resp["type"] = "subscribed";
+        resp["format"] = binary ? "binary" : "json";
+        if (binary) {
+            resp["version"] = REALTIME_FRAME_VERSION;
+            resp["interval_ms"] = s_realtime_ws_binary_interval_ms;
+        }
+        String out;
+        serializeJson(resp, out);
+        client->text(out);
+        return true;
+    }
+
+    if (strcmp(type, "keyframe") == 0) {
+        s_realtime_keyframe_requested.store(true, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
 // WebSocket event handler for real-time updates
 static void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
     switch (type) {
         case WS_EVT_CONNECT:
             LOG_DEBUG(TAG_WEB, "WebSocket client #%u connected from %s", client->id(), client->remoteIP().toString().c_str());
+            if (!track_realtime_client(client->id())) {
+                LOG_WARN(TAG_WEB, "WebSocket client #%u refused (%u clients max)", client->id(), REALTIME_WS_MAX_TRACKED_CLIENTS);
+                client->close(1013, "too many clients");  // 1013 = try again later
+                break;
+            }
             // Send initial state to new client
             {
                 StaticJsonDocument<512> doc;
                 doc["type"] = "welcome";
                 doc["client_id"] = client->id();
                 doc["timestamp"] = millis();
+                JsonArray formats = doc.createNestedArray("formats");
+                formats.add("json");
+                formats.add("binary");
+                doc["binary_version"] = REALTIME_FRAME_VERSION;
                 
                 String message;
                 serializeJson(doc, message);
@@ -2441,6 +2663,7 @@ static void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *clien
 
         case WS_EVT_DISCONNECT:
             LOG_DEBUG(TAG_WEB, "WebSocket client #%u disconnected", client->id());
+            untrack_realtime_client(client->id());
             break;
             
         case WS_EVT_DATA:
@@ -2450,6 +2673,10 @@ static void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *clien
                     // Handle incoming WebSocket message (for future bidirectional communication)
                     data[len] = 0; // Null terminate
                     LOG_DEBUG(TAG_WEB, "WebSocket message from client #%u: %s", client->id(), (char*)data);
+
+                    if (handle_realtime_control(client, (const char*)data)) {
+                        break;
+                    }
                     
                     // Echo back for now (can be extended for commands)
                     StaticJsonDocument<256> response;
@@ -2471,24 +2698,74 @@ static void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *clien
     }
 }
 
-// Broadcast real-time data to all connected WebSocket clients
-void broadcast_realtime_data() {
-    if (!s_realtime_ws_enabled || ws.count() == 0) return; // Disabled or no clients
+// Same fields as the JSON message, plus spectrum and chromagram
+static void fill_realtime_frame(RealtimeFrameData* f) {
+    float frames = FRAMES_COUNTED.load(std::memory_order_relaxed) > 0
+                     ? static_cast<float>(FRAMES_COUNTED.load(std::memory_order_relaxed))
+                     : 1.0f;
+    f->fps = FPS_CPU;
+    f->frame_time_us = (ACCUM_RENDER_US + ACCUM_QUANTIZE_US +
+                        ACCUM_RMT_WAIT_US + ACCUM_RMT_TRANSMIT_US) / frames;
+    f->render_avg_us = static_cast<float>(ACCUM_RENDER_US.load(std::memory_order_relaxed)) / frames;
+    f->quantize_avg_us = static_cast<float>(ACCUM_QUANTIZE_US.load(std::memory_order_relaxed)) / frames;
+    f->rmt_wait_avg_us = static_cast<float>(ACCUM_RMT_WAIT_US.load(std::memory_order_relaxed)) / frames;
+    f->rmt_tx_avg_us = static_cast<float>(ACCUM_RMT_TRANSMIT_US.load(std::memory_order_relaxed)) / frames;
+    f->cpu_percent = cpu_monitor.getAverageCPUUsage();
+    f->memory_percent = (float)(ESP.getHeapSize() - ESP.getFreeHeap()) / ESP.getHeapSize() * 100.0f;
+    f->memory_free_kb = ESP.getFreeHeap() / 1024;
+
+    // Seqlock copy of the published frame; audio_back is the audio task's write
+    // buffer. Static: loop() is the only caller and its stack has no room for it.
+    static AudioDataSnapshot audio;
+    if (!get_audio_snapshot(&audio)) {
+        memset(&audio.payload, 0, sizeof(audio.payload));
+    }
+    f->vu_level = audio.payload.vu_level;
+    f->vu_level_raw = audio.payload.vu_level_raw;
+    f->tempo_confidence = audio.payload.tempo_confidence;
+    f->locked_tempo_bpm = audio.payload.locked_tempo_bpm;
+    f->tempo_lock_state = (uint8_t)audio.payload.tempo_lock_state;
+    for (uint16_t i = 0; i < REALTIME_FRAME_SPECTRUM_BINS && i < NUM_FREQS; i++) {
+        f->spectrum[i] = audio.payload.spectrogram_smooth[i];
+    }
+    for (uint16_t i = 0; i < REALTIME_FRAME_CHROMA_BINS; i++) {
+        f->chromagram[i] = audio.payload.chromagram[i];
+    }
 
-    // Lightweight rate limiting based on current WiFi link options
-    // Interval: compile-time default (e.g. 250ms). If forced b/g-only or HT20,
-    // apply a minimum floor of 200ms to avoid congesting narrow-band links.
-    static uint32_t last_broadcast_ms = 0;
-    WifiLinkOptions opts;
-    wifi_monitor_get_link_options(opts);
-    const uint32_t floor_wifi_ms = (opts.force_bg_only || opts.force_ht20) ? 200u : s_realtime_ws_interval_ms;
-    const uint32_t interval_ms = floor_wifi_ms > s_realtime_ws_interval_ms ? floor_wifi_ms : s_realtime_ws_interval_ms;
-    uint32_t now = millis();
-    if (now - last_broadcast_ms < interval_ms) {
-        return;
+    const PatternParameters& params = get_params();
+    f->brightness = params.brightness;
+    f->softness = params.softness;
+    f->color = params.color;
+    f->color_range = params.color_range;
+    f->saturation = params.saturation;
+    f->warmth = params.warmth;
+    f->background = params.background;
+    f->dithering = params.dithering;
+    f->speed = params.speed;
+    f->palette_id = params.palette_id;
+    f->custom_param_1 = params.custom_param_1;
+    f->custom_param_2 = params.custom_param_2;
+    f->custom_param_3 = params.custom_param_3;
+    f->current_pattern = g_current_pattern_index;
+}
+
+static void broadcast_realtime_binary(uint32_t now) {
+    RealtimeFrameData frame;
+    fill_realtime_frame(&frame);
+    if (s_realtime_keyframe_requested.exchange(false, std::memory_order_relaxed)) {
+        realtime_frame_encoder_reset(&s_realtime_encoder);
     }
-    last_broadcast_ms = now;
-    
+    uint8_t buf[REALTIME_FRAME_MAX_BYTES];
+    size_t len = realtime_frame_encode(&s_realtime_encoder, &frame, now, buf, sizeof(buf));
+    if (len == 0) return;
+    uint32_t ids[REALTIME_WS_MAX_TRACKED_CLIENTS];
+    const uint8_t n = collect_realtime_clients(REALTIME_FORMAT_BINARY, ids);
+    for (uint8_t i = 0; i < n; i++) {
+        ws.binary(ids[i], buf, len);
+    }
+}
+
+static void broadcast_realtime_json(uint8_t binary_clients) {
     StaticJsonDocument<1024> doc;
     doc["type"] = "realtime";
     doc["timestamp"] = millis();
@@ -2544,5 +2821,47 @@ void broadcast_realtime_data() {
     
     String message;
     serializeJson(doc, message);
-    ws.textAll(message);
+    if (binary_clients == 0) {
+        // Every client is on JSON: one shared text frame
+        ws.textAll(message);
+        return;
+    }
+    uint32_t ids[REALTIME_WS_MAX_TRACKED_CLIENTS];
+    const uint8_t n = collect_realtime_clients(REALTIME_FORMAT_JSON, ids);
+    for (uint8_t i = 0; i < n; i++) {
+        ws.text(ids[i], message);
+    }
+}
+
+// Broadcast real-time data to all connected WebSocket clients
+// JSON clients get a text frame every interval_ms; binary subscribers get a
+// delta frame every binary_interval_ms (up to ~60 Hz), so call this often.
+void broadcast_realtime_data() {
+    if (!s_realtime_ws_enabled || ws.count() == 0) return; // Disabled or no clients
+
+    // Lightweight rate limiting based on current WiFi link options
+    // Interval: compile-time default (e.g. 250ms). If forced b/g-only or HT20,
+    // apply a minimum floor of 200ms to avoid congesting narrow-band links.
+    static uint32_t last_json_ms = 0;
+    static uint32_t last_binary_ms = 0;
+    WifiLinkOptions opts;
+    wifi_monitor_get_link_options(opts);
+    const bool narrow_link = opts.force_bg_only || opts.force_ht20;
+    const uint32_t json_interval_ms = (narrow_link && s_realtime_ws_interval_ms < 200u) ? 200u : s_realtime_ws_interval_ms;
+    // Binary frames are ~10x smaller; halve the narrow-link floor for them
+    const uint32_t binary_interval_ms = (narrow_link && s_realtime_ws_binary_interval_ms < 100u) ? 100u : s_realtime_ws_binary_interval_ms;
+
+    uint8_t tracked = 0;
+    const uint8_t binary_clients = count_realtime_clients(REALTIME_FORMAT_BINARY, &tracked);
+    const bool json_clients = tracked > binary_clients;
+    uint32_t now = millis();
+
+    if (binary_clients > 0 && now - last_binary_ms >= binary_interval_ms) {
+        last_binary_ms = now;
+        broadcast_realtime_binary(now);
+    }
+    if (json_clients && now - last_json_ms >= json_interval_ms) {
+        last_json_ms = now;
+        broadcast_realtime_json(binary_clients);
+    }
 }
@@ -53,6 +53,7 @@ static const char* ROUTE_AUDIO_SNAPSHOT = "/api/audio/snapshot";
 static const char* ROUTE_AUDIO_ARRAYS = "/api/audio/arrays";
 static const char* ROUTE_AUDIO_METRICS = "/api/audio/metrics";
 static const char* ROUTE_AUDIO_NOISE_CAL = "/api/audio/noise-calibrate";
+static const char* ROUTE_AUDIO_PROFILE = "/api/audio/profile";
 static const char* ROUTE_WIFI_STATUS = "/api/wifi/status";
 static const char* ROUTE_WIFI_CREDENTIALS = "/api/wifi/credentials";
 static const char* ROUTE_WIFI_SCAN = "/api/wifi/scan";
@@ -131,6 +132,8 @@ static RouteWindow control_windows[] = {
     {ROUTE_WIFI_CREDENTIALS, ROUTE_POST, 1500, 0},
     {ROUTE_WIFI_SCAN, ROUTE_POST, 5000, 0},  // WiFi scanning takes time; 5 second rate limit
     {ROUTE_AUDIO_NOISE_CAL, ROUTE_POST, 1000, 0},
+    {ROUTE_AUDIO_PROFILE, ROUTE_POST, 1000, 0},   // Each switch rebuilds the analysis bins
+    {ROUTE_AUDIO_PROFILE, ROUTE_GET, 200, 0},
     // Aliased and additional routes
     {ROUTE_DEVICE_INFO_ALIAS, ROUTE_GET, 1000, 0},
     {ROUTE_DEVICE_PERFORMANCE_ALIAS, ROUTE_GET, 500, 0},
@@ -0,0 +1,177 @@
+// Analysis profile tests
+// Profile lookup, the bins each profile derives from the standard bins
+// (goertzel_lut.h), slot interpolation, the cycles-per-frame stats, and that
+// the derived banks peak at the right note for a tone on each of their bins.
+
+#include <unity.h>
+#include <cmath>
+#include <stdint.h>
+#include "../../src/audio/analysis_profile.h"
+#include "../../src/audio/goertzel_lut.h"
+
+#define TEST_RATE 12800.0f
+#define TEST_SLOTS 64
+#define TEST_HISTORY 4096
+#define TEST_MAX_BLOCK (TEST_HISTORY - 4)
+
+static float storage[TEST_HISTORY];
+
+static GoertzelBlockBin standard_bin(uint16_t slot) {
+  const GoertzelBinConstants& c = GOERTZEL_BIN_LUT[slot];
+  const GoertzelBlockBin bin = {c.block_size, c.window_step, c.coeff};
+  return bin;
+}
+
+static GoertzelBlockBin profile_bin(const AnalysisProfile* profile, uint16_t slot, uint16_t max_block,
+                                    float* k) {
+  const GoertzelBlockBin base = standard_bin(slot);
+  const GoertzelBinConstants& c = GOERTZEL_BIN_LUT[slot];
+  return analysis_profile_bin(profile, &base, c.k, c.target_freq, TEST_RATE, max_block, k);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_profiles_are_found_by_name(void) {
+  TEST_ASSERT_EQUAL_INT(ANALYSIS_PROFILE_LOW_LATENCY, analysis_profile_find("low_latency"));
+  TEST_ASSERT_EQUAL_INT(ANALYSIS_PROFILE_STANDARD, analysis_profile_find("standard"));
+  TEST_ASSERT_EQUAL_INT(ANALYSIS_PROFILE_HIGH_RES, analysis_profile_find("high_res"));
+  TEST_ASSERT_EQUAL_INT(-1, analysis_profile_find("ultra"));
+  TEST_ASSERT_EQUAL_INT(-1, analysis_profile_find(nullptr));
+
+  TEST_ASSERT_EQUAL_UINT16(32, analysis_profile_num_bins(&ANALYSIS_PROFILES[ANALYSIS_PROFILE_LOW_LATENCY], 64));
+  TEST_ASSERT_EQUAL_UINT16(33, analysis_profile_num_bins(&ANALYSIS_PROFILES[ANALYSIS_PROFILE_LOW_LATENCY], 65));
+  TEST_ASSERT_EQUAL_UINT16(64, analysis_profile_num_bins(&ANALYSIS_PROFILES[ANALYSIS_PROFILE_STANDARD], 64));
+}
+
+void test_standard_profile_keeps_standard_bins(void) {
+  const AnalysisProfile* profile = &ANALYSIS_PROFILES[ANALYSIS_PROFILE_STANDARD];
+  for (uint16_t slot = 0; slot < TEST_SLOTS; slot++) {
+    float k = -1.0f;
+    const GoertzelBlockBin bin = profile_bin(profile, slot, TEST_MAX_BLOCK, &k);
+    TEST_ASSERT_EQUAL_UINT16(GOERTZEL_BIN_LUT[slot].block_size, bin.block_size);
+    TEST_ASSERT_EQUAL_FLOAT(GOERTZEL_BIN_LUT[slot].window_step, bin.window_step);
+    TEST_ASSERT_EQUAL_FLOAT(GOERTZEL_BIN_LUT[slot].coeff, bin.coeff);
+    TEST_ASSERT_EQUAL_FLOAT(GOERTZEL_BIN_LUT[slot].k, k);
+  }
+}
+
+// Scaled blocks: a multiple of 4, about block_scale times the standard block,
+// a whole number of cycles, and the centre no further from the note than the
+// multiple-of-4 rounding allows
+void test_scaled_bins_stay_on_their_notes(void) {
+  const uint8_t scaled[] = {ANALYSIS_PROFILE_LOW_LATENCY, ANALYSIS_PROFILE_HIGH_RES};
+  for (uint8_t p : scaled) {
+    const AnalysisProfile* profile = &ANALYSIS_PROFILES[p];
+    for (uint16_t slot = 0; slot < TEST_SLOTS; slot++) {
+      float k;
+      const GoertzelBlockBin bin = profile_bin(profile, slot, TEST_MAX_BLOCK, &k);
+      const float f = GOERTZEL_BIN_LUT[slot].target_freq;
+      const float expected = GOERTZEL_BIN_LUT[slot].block_size * profile->block_scale;
+
+      TEST_ASSERT_EQUAL_UINT32(0, bin.block_size % 4);
+      TEST_ASSERT_TRUE(bin.block_size <= TEST_MAX_BLOCK);
+      TEST_ASSERT_FLOAT_WITHIN(TEST_RATE / f, expected, (float)bin.block_size);
+      TEST_ASSERT_EQUAL_FLOAT(floorf(k), k);
+      TEST_ASSERT_FLOAT_WITHIN(2.0f * TEST_RATE / bin.block_size, f, k * TEST_RATE / bin.block_size);
+      TEST_ASSERT_FLOAT_WITHIN(1e-5f, (float)(2.0 * cos(2.0 * M_PI * k / bin.block_size)), bin.coeff);
+      TEST_ASSERT_EQUAL_FLOAT(4096.0f / bin.block_size, bin.window_step);
+    }
+  }
+}
+
+void test_capped_blocks_requantize_the_note(void) {
+  const AnalysisProfile* profile = &ANALYSIS_PROFILES[ANALYSIS_PROFILE_HIGH_RES];
+  const uint16_t cap = 2048;
+  uint16_t capped = 0;
+  for (uint16_t slot = 0; slot < TEST_SLOTS; slot++) {
+    float k;
+    const GoertzelBlockBin bin = profile_bin(profile, slot, cap, &k);
+    const float f = GOERTZEL_BIN_LUT[slot].target_freq;
+    TEST_ASSERT_TRUE(bin.block_size <= cap);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f * TEST_RATE / bin.block_size + 0.01f, f, k * TEST_RATE / bin.block_size);
+    if (bin.block_size == cap) {
+      capped++;
+    }
+  }
+  TEST_ASSERT_TRUE(capped > 0);
+
+  // The standard bins are not exempt from a cap either
+  float k;
+  const GoertzelBlockBin bin = profile_bin(&ANALYSIS_PROFILES[ANALYSIS_PROFILE_STANDARD], 0, 1024, &k);
+  TEST_ASSERT_EQUAL_UINT16(1024, bin.block_size);
+}
+
+void test_expand_interpolates_skipped_slots(void) {
+  const float bins[4] = {1.0f, 3.0f, 5.0f, 2.0f};
+  float slots[8];
+  analysis_profile_expand(&ANALYSIS_PROFILES[ANALYSIS_PROFILE_LOW_LATENCY], bins, 8, slots);
+  const float expected[8] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 3.5f, 2.0f, 2.0f};
+  TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, slots, 8);
+
+  analysis_profile_expand(&ANALYSIS_PROFILES[ANALYSIS_PROFILE_STANDARD], bins, 4, slots);
+  TEST_ASSERT_EQUAL_FLOAT_ARRAY(bins, slots, 4);
+}
+
+void test_stats_average_and_peak(void) {
+  AnalysisProfileStats stats = {0.0f, 0, 0};
+  analysis_profile_record(&stats, 1000);
+  TEST_ASSERT_EQUAL_FLOAT(1000.0f, stats.cycles_per_frame);
+  analysis_profile_record(&stats, 5000);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 1000.0f + 4000.0f / ANALYSIS_PROFILE_STATS_SMOOTHING, stats.cycles_per_frame);
+  for (int i = 0; i < 20 * ANALYSIS_PROFILE_STATS_SMOOTHING; i++) {
+    analysis_profile_record(&stats, 2000);
+  }
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 2000.0f, stats.cycles_per_frame);
+  TEST_ASSERT_EQUAL_UINT32(5000, stats.peak_cycles);
+  TEST_ASSERT_EQUAL_UINT32(2 + 20 * ANALYSIS_PROFILE_STATS_SMOOTHING, stats.frames);
+}
+
+// A tone on each analysed note peaks at that note's bin. Only the derived
+// profiles: the standard bins keep the legacy layout (k rounded for a fixed
+// block, so centres sit up to a half step off) and test_goertzel_lut pins them.
+void test_scaled_profiles_resolve_their_notes(void) {
+  const uint8_t scaled[] = {ANALYSIS_PROFILE_LOW_LATENCY, ANALYSIS_PROFILE_HIGH_RES};
+  for (uint8_t p : scaled) {
+    const AnalysisProfile* profile = &ANALYSIS_PROFILES[p];
+    const uint16_t num_bins = analysis_profile_num_bins(profile, TEST_SLOTS);
+    GoertzelBlockBin bins[TEST_SLOTS];
+    for (uint16_t b = 0; b < num_bins; b++) {
+      float k;
+      bins[b] = profile_bin(profile, b * profile->bin_stride, TEST_MAX_BLOCK, &k);
+    }
+
+    for (uint16_t b = 0; b < num_bins; b++) {
+      const float f = GOERTZEL_BIN_LUT[b * profile->bin_stride].target_freq;
+      SampleRing ring;
+      sample_ring_init(&ring, storage, TEST_HISTORY);
+      float chunk[64];
+      for (uint32_t n = 0; n < TEST_HISTORY; n += 64) {
+        for (int i = 0; i < 64; i++) {
+          chunk[i] = 0.5f * (float)sin(2.0 * M_PI * f * (n + i) / TEST_RATE);
+        }
+        sample_ring_write(&ring, chunk, 64);
+      }
+
+      float magnitudes[TEST_SLOTS];
+      goertzel_block_magnitudes(&ring, 1, window_lookup, bins, num_bins, 4, magnitudes);
+      uint16_t peak = 0;
+      for (uint16_t i = 1; i < num_bins; i++) {
+        if (magnitudes[i] > magnitudes[peak]) peak = i;
+      }
+      TEST_ASSERT_EQUAL_UINT16_MESSAGE(b, peak, profile->name);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_profiles_are_found_by_name);
+  RUN_TEST(test_standard_profile_keeps_standard_bins);
+  RUN_TEST(test_scaled_bins_stay_on_their_notes);
+  RUN_TEST(test_capped_blocks_requantize_the_note);
+  RUN_TEST(test_expand_interpolates_skipped_slots);
+  RUN_TEST(test_stats_average_and_peak);
+  RUN_TEST(test_scaled_profiles_resolve_their_notes);
+  return UNITY_END();
+}
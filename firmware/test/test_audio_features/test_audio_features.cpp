@@ -0,0 +1,141 @@
+// Audio feature vector tests
+// Band energies must equal what the per-call band macros returned (the
+// reference below is the old get_audio_band_energy() loop), plus centroid,
+// flatness, flux and chroma peak on spectra with known answers.
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include "../../src/audio/audio_features.h"
+
+#define TEST_BINS 64
+
+static AudioFeatureState state;
+static AudioFeatures features;
+static float absolute[TEST_BINS];
+static float chroma[AUDIO_FEATURES_CHROMA_BINS];
+
+static uint32_t rng_state = 7;
+
+// Uniform in [0, 1)
+static float rng_uniform() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return (rng_state >> 8) * (1.0f / 16777216.0f);
+}
+
+// get_audio_band_energy() as the band macros called it per use
+static float legacy_band_energy(const float* spectrum, int start_bin, int end_bin) {
+  if (start_bin < 0 || start_bin >= TEST_BINS ||
+      end_bin < 0 || end_bin >= TEST_BINS ||
+      start_bin > end_bin) {
+    return 0.0f;
+  }
+  float sum = 0.0f;
+  for (int i = start_bin; i <= end_bin; i++) {
+    sum += spectrum[i];
+  }
+  int num_bins = end_bin - start_bin + 1;
+  return sum / (float)num_bins;
+}
+
+void setUp(void) {
+  audio_features_init(&state, TEST_BINS);
+  memset(absolute, 0, sizeof(absolute));
+  memset(chroma, 0, sizeof(chroma));
+}
+void tearDown(void) {}
+
+void test_bands_match_per_call_macros(void) {
+  for (int frame = 0; frame < 200; frame++) {
+    float spectrum[TEST_BINS];
+    for (int i = 0; i < TEST_BINS; i++) {
+      spectrum[i] = rng_uniform();
+      absolute[i] = 3.0f * rng_uniform();
+    }
+    audio_features_compute(&state, spectrum, absolute, chroma, &features);
+
+    // Bit-exact: patterns see the same values as before
+    TEST_ASSERT_TRUE(features.bass == legacy_band_energy(spectrum, 0, 8));
+    TEST_ASSERT_TRUE(features.mids == legacy_band_energy(spectrum, 16, 32));
+    TEST_ASSERT_TRUE(features.treble == legacy_band_energy(spectrum, 48, 63));
+    TEST_ASSERT_TRUE(features.kick == legacy_band_energy(spectrum, 0, 4));
+    TEST_ASSERT_TRUE(features.snare == legacy_band_energy(spectrum, 8, 16));
+    TEST_ASSERT_TRUE(features.vocal == legacy_band_energy(spectrum, 16, 40));
+    TEST_ASSERT_TRUE(features.hats == legacy_band_energy(spectrum, 48, 63));
+    TEST_ASSERT_TRUE(features.bass_abs == legacy_band_energy(absolute, 0, 8));
+    TEST_ASSERT_TRUE(features.mids_abs == legacy_band_energy(absolute, 16, 32));
+    TEST_ASSERT_TRUE(features.treble_abs == legacy_band_energy(absolute, 48, 63));
+  }
+  float spectrum[TEST_BINS] = {0};
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, audio_band_mean(spectrum, TEST_BINS, 10, 5));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, audio_band_mean(spectrum, TEST_BINS, 0, TEST_BINS));
+}
+
+void test_centroid_and_flatness(void) {
+  float spectrum[TEST_BINS] = {0};
+
+  // A single bin: centroid at that bin, flatness near zero
+  spectrum[16] = 0.8f;
+  audio_features_compute(&state, spectrum, absolute, chroma, &features);
+  TEST_ASSERT_FLOAT_WITHIN(1e-6f, 16.0f / (TEST_BINS - 1), features.centroid);
+  TEST_ASSERT_LESS_THAN_FLOAT(0.01f, features.flatness);
+
+  // Flat spectrum: centroid in the middle, flatness 1
+  for (int i = 0; i < TEST_BINS; i++) spectrum[i] = 0.3f;
+  audio_features_compute(&state, spectrum, absolute, chroma, &features);
+  TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.5f, features.centroid);
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 1.0f, features.flatness);
+
+  // Noise sits between the two
+  for (int i = 0; i < TEST_BINS; i++) spectrum[i] = 0.05f + rng_uniform();
+  audio_features_compute(&state, spectrum, absolute, chroma, &features);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.5f, features.flatness);
+  TEST_ASSERT_LESS_THAN_FLOAT(1.0f, features.flatness);
+
+  // Silence reports zeros rather than NaN
+  memset(spectrum, 0, sizeof(spectrum));
+  audio_features_compute(&state, spectrum, absolute, chroma, &features);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, features.centroid);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, features.flatness);
+}
+
+void test_flux_counts_rises_only(void) {
+  float spectrum[TEST_BINS] = {0};
+  spectrum[3] = 0.64f;
+  audio_features_compute(&state, spectrum, absolute, chroma, &features);
+  TEST_ASSERT_FLOAT_WITHIN(1e-7f, 0.64f / TEST_BINS, features.flux);
+
+  // Unchanged frame: no flux
+  audio_features_compute(&state, spectrum, absolute, chroma, &features);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, features.flux);
+
+  // A fall is ignored, a rise elsewhere counts
+  spectrum[3] = 0.0f;
+  spectrum[40] = 0.32f;
+  audio_features_compute(&state, spectrum, absolute, chroma, &features);
+  TEST_ASSERT_FLOAT_WITHIN(1e-7f, 0.32f / TEST_BINS, features.flux);
+}
+
+void test_chroma_peak_picks_first_maximum(void) {
+  float spectrum[TEST_BINS] = {0};
+  audio_features_compute(&state, spectrum, absolute, chroma, &features);
+  TEST_ASSERT_EQUAL_UINT8(0, features.chroma_peak);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, features.chroma_peak_value);
+
+  chroma[4] = 0.7f;
+  chroma[9] = 0.7f;
+  chroma[2] = 0.3f;
+  audio_features_compute(&state, spectrum, absolute, chroma, &features);
+  TEST_ASSERT_EQUAL_UINT8(4, features.chroma_peak);
+  TEST_ASSERT_EQUAL_FLOAT(0.7f, features.chroma_peak_value);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bands_match_per_call_macros);
+  RUN_TEST(test_centroid_and_flatness);
+  RUN_TEST(test_flux_counts_rises_only);
+  RUN_TEST(test_chroma_peak_picks_first_maximum);
+  return UNITY_END();
+}
@@ -0,0 +1,217 @@
+// Audio source tests (env:native)
+// acquire_sample_chunk() reading from the host stand-ins for the microphone:
+// a WAV file (exact samples, end-of-file padding, looping) and localhost UDP
+// PCM (ordering, send timestamps, sequence gaps, malformed packets, timeout).
+// The DC blocker is bypassed so samples reach sample_history unchanged.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <Arduino.h>
+#include "host_runtime.h"
+#include "host_audio_sources.h"
+#include "../../src/audio/goertzel.h"
+#include "../../src/audio/microphone.h"
+
+#define TEST_WAV_PATH "test_audio_source.wav"
+#define TEST_WAV_CHUNKS 3
+
+static WavFileSource wav;
+static UdpPcmSource udp;
+
+// 16-bit PCM survives the 18-bit slot word round trip exactly
+static int16_t test_pcm(size_t i) {
+  return (int16_t)((int32_t)(i * 97 % 4001) - 2000);
+}
+
+static void write_test_wav(const char* path, size_t samples) {
+  std::vector<uint8_t> file(44 + 2 * samples);
+  auto put32 = [&](size_t at, uint32_t v) { for (int b = 0; b < 4; b++) file[at + b] = (uint8_t)(v >> (8 * b)); };
+  auto put16 = [&](size_t at, uint16_t v) { file[at] = (uint8_t)v; file[at + 1] = (uint8_t)(v >> 8); };
+  memcpy(&file[0], "RIFF", 4);
+  put32(4, (uint32_t)(36 + 2 * samples));
+  memcpy(&file[8], "WAVEfmt ", 8);
+  put32(16, 16);
+  put16(20, 1);                                 // PCM
+  put16(22, 1);                                 // Mono
+  put32(24, AUDIO_CAPTURE_RATE_HZ);
+  put32(28, AUDIO_CAPTURE_RATE_HZ * 2);
+  put16(32, 2);
+  put16(34, 16);
+  memcpy(&file[36], "data", 4);
+  put32(40, (uint32_t)(2 * samples));
+  for (size_t i = 0; i < samples; i++) put16(44 + 2 * i, (uint16_t)test_pcm(i));
+  FILE* f = fopen(path, "wb");
+  TEST_ASSERT_NOT_NULL(f);
+  fwrite(file.data(), 1, file.size(), f);
+  fclose(f);
+}
+
+// The newest chunk in sample_history is pcm[first .. first + AUDIO_CHUNK_SIZE)
+static void assert_newest_chunk(const std::vector<int16_t>& pcm, size_t first) {
+  for (uint32_t i = 0; i < AUDIO_CHUNK_SIZE; i++) {
+    const float expected = pcm[first + i] / 32768.0f;
+    TEST_ASSERT_EQUAL_FLOAT(expected, sample_ring_at(&sample_history, AUDIO_CHUNK_SIZE - 1 - i));
+  }
+}
+
+static void assert_newest_chunk_silent() {
+  for (uint32_t age = 0; age < AUDIO_CHUNK_SIZE; age++) {
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, sample_ring_at(&sample_history, age));
+  }
+}
+
+static void send_packet(uint32_t seq, uint64_t sent_us, uint32_t rate, const int16_t* samples, uint16_t count) {
+  uint8_t packet[UDP_PCM_HEADER_BYTES + 2 * UDP_PCM_MAX_SAMPLES] = {};
+  memcpy(packet, UDP_PCM_MAGIC, 4);
+  memcpy(packet + 4, &seq, 4);       // Little-endian host
+  memcpy(packet + 8, &sent_us, 8);
+  memcpy(packet + 16, &rate, 4);
+  memcpy(packet + 20, &count, 2);
+  memcpy(packet + UDP_PCM_HEADER_BYTES, samples, 2 * count);
+
+  const int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(udp.port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  TEST_ASSERT_EQUAL(UDP_PCM_HEADER_BYTES + 2 * count,
+                    sendto(fd, packet, UDP_PCM_HEADER_BYTES + 2 * count, 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)));
+  close(fd);
+}
+
+void setUp(void) {
+  mic_frontend_init(&mic_frontend, AUDIO_CAPTURE_RATE_HZ, 0.0f, 1.0f);
+}
+
+void tearDown(void) {
+  audio_source_select(nullptr);
+}
+
+void test_i2s_is_the_default_source(void) {
+  TEST_ASSERT_EQUAL_PTR(&audio_source_i2s, audio_source_active());
+  audio_source_select(&audio_source_i2s);
+  audio_source_select(nullptr);
+  TEST_ASSERT_EQUAL_PTR(&audio_source_i2s, audio_source_active());
+}
+
+void test_wav_source_feeds_sample_history(void) {
+#if AUDIO_CAPTURE_RESAMPLED
+  TEST_IGNORE_MESSAGE("exact samples need capture rate == analysis rate");
+#endif
+  const size_t samples = TEST_WAV_CHUNKS * AUDIO_CAPTURE_CHUNK_SIZE;
+  write_test_wav(TEST_WAV_PATH, samples);
+  std::string err;
+  TEST_ASSERT_TRUE_MESSAGE(wav_file_source_open(&wav, TEST_WAV_PATH, false, &err), err.c_str());
+  remove(TEST_WAV_PATH);
+  TEST_ASSERT_EQUAL_UINT32(AUDIO_CAPTURE_RATE_HZ, wav.file_rate_hz);
+  TEST_ASSERT_EQUAL(TEST_WAV_CHUNKS, wav_file_source_chunks(&wav));
+
+  std::vector<int16_t> pcm(samples);
+  for (size_t i = 0; i < samples; i++) pcm[i] = test_pcm(i);
+
+  audio_source_select(&wav.source);
+  TEST_ASSERT_EQUAL_STRING("wav", audio_source_active()->name);
+  for (size_t chunk = 0; chunk < TEST_WAV_CHUNKS; chunk++) {
+    TEST_ASSERT_FALSE(wav_file_source_finished(&wav));
+    acquire_sample_chunk();
+    assert_newest_chunk(pcm, chunk * AUDIO_CHUNK_SIZE);
+  }
+  TEST_ASSERT_TRUE(wav_file_source_finished(&wav));
+
+  // Past the end: silence, still a successful read
+  const uint32_t timeouts = get_i2s_timeout_state().timeout_count;
+  acquire_sample_chunk();
+  assert_newest_chunk_silent();
+  TEST_ASSERT_EQUAL_UINT32(timeouts, get_i2s_timeout_state().timeout_count);
+}
+
+void test_wav_source_loops(void) {
+#if AUDIO_CAPTURE_RESAMPLED
+  TEST_IGNORE_MESSAGE("exact samples need capture rate == analysis rate");
+#endif
+  const size_t samples = TEST_WAV_CHUNKS * AUDIO_CAPTURE_CHUNK_SIZE;
+  write_test_wav(TEST_WAV_PATH, samples);
+  TEST_ASSERT_TRUE(wav_file_source_open(&wav, TEST_WAV_PATH, true, nullptr));
+  remove(TEST_WAV_PATH);
+
+  std::vector<int16_t> pcm(samples);
+  for (size_t i = 0; i < samples; i++) pcm[i] = test_pcm(i);
+
+  audio_source_select(&wav.source);
+  for (size_t chunk = 0; chunk <= TEST_WAV_CHUNKS; chunk++) acquire_sample_chunk();
+  TEST_ASSERT_FALSE(wav_file_source_finished(&wav));
+  assert_newest_chunk(pcm, 0);
+}
+
+void test_wav_source_rejects_missing_file(void) {
+  std::string err;
+  TEST_ASSERT_FALSE(wav_file_source_open(&wav, "does_not_exist.wav", false, &err));
+  TEST_ASSERT_TRUE(err.find("cannot open") != std::string::npos);
+}
+
+void test_udp_source_delivers_packets_in_order(void) {
+#if AUDIO_CAPTURE_RESAMPLED
+  TEST_IGNORE_MESSAGE("exact samples need capture rate == analysis rate");
+#endif
+  std::string err;
+  TEST_ASSERT_TRUE_MESSAGE(udp_pcm_source_open(&udp, 0, &err), err.c_str());
+  TEST_ASSERT_NOT_EQUAL(0, udp.port);
+  audio_source_select(&udp.source);
+
+  // One chunk split across two packets, then half of the next
+  const uint16_t half = AUDIO_CAPTURE_CHUNK_SIZE / 2;
+  std::vector<int16_t> pcm(3 * half);
+  for (size_t i = 0; i < pcm.size(); i++) pcm[i] = test_pcm(i + 11);
+  send_packet(7, 1000, AUDIO_CAPTURE_RATE_HZ, &pcm[0], half);
+  send_packet(8, 2000, AUDIO_CAPTURE_RATE_HZ, &pcm[half], half);
+  send_packet(12, 3000, AUDIO_CAPTURE_RATE_HZ, &pcm[2 * half], half);   // 9..11 lost
+
+  acquire_sample_chunk();
+  assert_newest_chunk(pcm, 0);
+  TEST_ASSERT_EQUAL_INT64(2000, udp.chunk_sent_us);   // Packet holding the newest sample
+  TEST_ASSERT_EQUAL_UINT64(3, udp.packets);
+  TEST_ASSERT_EQUAL_UINT64(3, udp.lost_packets);
+  TEST_ASSERT_EQUAL(half, udp.count);
+
+  udp_pcm_source_close(&udp);
+}
+
+void test_udp_source_times_out_to_silence(void) {
+  TEST_ASSERT_TRUE(udp_pcm_source_open(&udp, 0, nullptr));
+  audio_source_select(&udp.source);
+
+  // Wrong sample rate: dropped, so nothing arrives within the 100 ms bound
+  std::vector<int16_t> pcm(AUDIO_CAPTURE_CHUNK_SIZE, 1000);
+  send_packet(0, 1000, AUDIO_CAPTURE_RATE_HZ * 2, pcm.data(), AUDIO_CAPTURE_CHUNK_SIZE);
+
+  const uint32_t timeouts = get_i2s_timeout_state().timeout_count;
+  const int64_t start_us = host_monotonic_us();
+  acquire_sample_chunk();
+  const int64_t waited_us = host_monotonic_us() - start_us;
+  TEST_ASSERT_EQUAL_UINT32(timeouts + 1, get_i2s_timeout_state().timeout_count);
+  TEST_ASSERT_EQUAL_UINT64(1, udp.bad_packets);
+  TEST_ASSERT_EQUAL_UINT64(0, udp.packets);
+  TEST_ASSERT_TRUE(waited_us >= 95000 && waited_us < 1000000);
+  assert_newest_chunk_silent();
+
+  udp_pcm_source_close(&udp);
+}
+
+int main(int argc, char** argv) {
+  host_runtime_init();
+  UNITY_BEGIN();
+  RUN_TEST(test_i2s_is_the_default_source);
+  RUN_TEST(test_wav_source_feeds_sample_history);
+  RUN_TEST(test_wav_source_loops);
+  RUN_TEST(test_wav_source_rejects_missing_file);
+  RUN_TEST(test_udp_source_delivers_packets_in_order);
+  RUN_TEST(test_udp_source_times_out_to_silence);
+  return UNITY_END();
+}
@@ -0,0 +1,201 @@
+// Audio warm-start record tests
+// Round trip through a byte-array store, and rejection of every kind of bad
+// blob (missing, foreign, old layout, truncated, corrupted, implausible) so a
+// boot never restores garbage. Also the 8-bit tempo prior quantisation.
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include "../../src/audio/audio_warm_start.h"
+
+// Byte-array store standing in for NVS
+struct MemoryStore {
+  uint8_t data[1024];
+  size_t length;
+  bool fail_writes;
+  uint32_t writes;
+};
+
+static size_t memory_read(void* context, uint8_t* buffer, size_t capacity) {
+  MemoryStore* m = static_cast<MemoryStore*>(context);
+  if (m->length <= capacity) {
+    memcpy(buffer, m->data, m->length);
+  }
+  return m->length;
+}
+
+static bool memory_write(void* context, const uint8_t* data, size_t length) {
+  MemoryStore* m = static_cast<MemoryStore*>(context);
+  if (m->fail_writes || length > sizeof(m->data)) {
+    return false;
+  }
+  memcpy(m->data, data, length);
+  m->length = length;
+  m->writes++;
+  return true;
+}
+
+static MemoryStore memory;
+static const AudioWarmStartStore store = {&memory, memory_read, memory_write};
+
+static AudioWarmStart sample_record() {
+  AudioWarmStart record;
+  memset(&record, 0, sizeof(record));
+  for (int i = 0; i < AUDIO_WARM_START_NOISE_BINS; i++) {
+    record.noise_spectrum[i] = 0.001f * (i + 1);
+  }
+  record.microphone_gain = 1.25f;
+  record.vu_floor_pct = 0.7f;
+  record.autoranger_ceiling = 0.042f;
+  record.novelty_ceiling = 0.31f;
+  float tempi[AUDIO_WARM_START_TEMPO_BINS];
+  for (int i = 0; i < AUDIO_WARM_START_TEMPO_BINS; i++) {
+    tempi[i] = 0.01f + 0.5f * expf(-0.05f * (i - 100) * (i - 100));
+  }
+  audio_warm_start_pack_tempo(&record, tempi, AUDIO_WARM_START_TEMPO_BINS);
+  record.flags = AUDIO_WARM_START_FLAG_NOISE_PROFILE;
+  return record;
+}
+
+// Re-encode with a valid header around a tampered payload
+static void store_with_valid_crc(const AudioWarmStart* record) {
+  memory.length = audio_warm_start_encode(record, memory.data);
+}
+
+void setUp(void) {
+  memset(&memory, 0, sizeof(memory));
+}
+void tearDown(void) {}
+
+void test_crc32_matches_reference(void) {
+  const char* check = "123456789";
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926u, audio_warm_start_crc32((const uint8_t*)check, 9));
+  TEST_ASSERT_EQUAL_HEX32(0x00000000u, audio_warm_start_crc32(nullptr, 0));
+}
+
+void test_round_trip(void) {
+  const AudioWarmStart saved = sample_record();
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_OK, audio_warm_start_save(&store, &saved));
+  TEST_ASSERT_EQUAL_UINT32(AUDIO_WARM_START_BLOB_SIZE, memory.length);
+
+  AudioWarmStart loaded;
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_OK, audio_warm_start_load(&store, &loaded));
+  TEST_ASSERT_EQUAL_MEMORY(&saved, &loaded, sizeof(saved));
+}
+
+void test_empty_store_is_reported(void) {
+  AudioWarmStart loaded;
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_EMPTY, audio_warm_start_load(&store, &loaded));
+}
+
+void test_bad_blobs_are_rejected_untouched(void) {
+  const AudioWarmStart saved = sample_record();
+  AudioWarmStart loaded;
+  memset(&loaded, 0xA5, sizeof(loaded));
+  AudioWarmStart untouched = loaded;
+
+  // Foreign blob
+  audio_warm_start_save(&store, &saved);
+  memory.data[0] ^= 0xFF;
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_MAGIC, audio_warm_start_load(&store, &loaded));
+
+  // Layout from another firmware version
+  audio_warm_start_save(&store, &saved);
+  AudioWarmStartHeader header;
+  memcpy(&header, memory.data, sizeof(header));
+  header.version = AUDIO_WARM_START_VERSION + 1;
+  memcpy(memory.data, &header, sizeof(header));
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_VERSION, audio_warm_start_load(&store, &loaded));
+
+  // Truncated write, and a stray header-only fragment
+  audio_warm_start_save(&store, &saved);
+  memory.length -= 1;
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_LENGTH, audio_warm_start_load(&store, &loaded));
+  memory.length = 3;
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_LENGTH, audio_warm_start_load(&store, &loaded));
+
+  // Longer than any valid blob
+  memory.length = AUDIO_WARM_START_BLOB_SIZE + 16;
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_LENGTH, audio_warm_start_load(&store, &loaded));
+
+  // Every single-byte corruption of the payload fails the checksum
+  for (size_t i = sizeof(AudioWarmStartHeader); i < AUDIO_WARM_START_BLOB_SIZE; i += 7) {
+    audio_warm_start_save(&store, &saved);
+    memory.data[i] ^= 0x10;
+    TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_CHECKSUM, audio_warm_start_load(&store, &loaded));
+  }
+
+  TEST_ASSERT_EQUAL_MEMORY(&untouched, &loaded, sizeof(loaded));
+}
+
+void test_implausible_values_are_rejected(void) {
+  AudioWarmStart loaded;
+
+  AudioWarmStart record = sample_record();
+  record.noise_spectrum[10] = NAN;
+  store_with_valid_crc(&record);
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_VALUES, audio_warm_start_load(&store, &loaded));
+
+  record = sample_record();
+  record.microphone_gain = 4.0f;
+  store_with_valid_crc(&record);
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_VALUES, audio_warm_start_load(&store, &loaded));
+
+  record = sample_record();
+  record.autoranger_ceiling = -1.0f;
+  store_with_valid_crc(&record);
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_VALUES, audio_warm_start_load(&store, &loaded));
+
+  record = sample_record();
+  record.tempo_prior_peak = INFINITY;
+  store_with_valid_crc(&record);
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_BAD_VALUES, audio_warm_start_load(&store, &loaded));
+}
+
+void test_write_failure_is_reported(void) {
+  const AudioWarmStart saved = sample_record();
+  memory.fail_writes = true;
+  TEST_ASSERT_EQUAL_INT(AUDIO_WARM_START_WRITE_FAILED, audio_warm_start_save(&store, &saved));
+  TEST_ASSERT_EQUAL_UINT32(0, memory.writes);
+  TEST_ASSERT_EQUAL_STRING("write_failed", audio_warm_start_status_name(AUDIO_WARM_START_WRITE_FAILED));
+}
+
+// 8-bit quantisation keeps every bin within half a step of its peak share,
+// and the strongest bin exact
+void test_tempo_prior_quantisation(void) {
+  float tempi[AUDIO_WARM_START_TEMPO_BINS];
+  for (int i = 0; i < AUDIO_WARM_START_TEMPO_BINS; i++) {
+    tempi[i] = 0.2f * (1.0f + sinf(i * 0.3f)) + (i == 77 ? 3.0f : 0.0f);
+  }
+  AudioWarmStart record;
+  memset(&record, 0, sizeof(record));
+  audio_warm_start_pack_tempo(&record, tempi, AUDIO_WARM_START_TEMPO_BINS);
+  TEST_ASSERT_EQUAL_UINT8(255, record.tempo_prior[77]);
+
+  float restored[AUDIO_WARM_START_TEMPO_BINS];
+  TEST_ASSERT_TRUE(audio_warm_start_unpack_tempo(&record, restored, AUDIO_WARM_START_TEMPO_BINS));
+  const float peak = record.tempo_prior_peak;
+  for (int i = 0; i < AUDIO_WARM_START_TEMPO_BINS; i++) {
+    TEST_ASSERT_FLOAT_WITHIN(0.5f * peak / 255.0f + 1e-6f, tempi[i], restored[i]);
+  }
+  TEST_ASSERT_EQUAL_FLOAT(tempi[77], restored[77]);
+
+  // A silent tempogram carries no prior
+  memset(tempi, 0, sizeof(tempi));
+  audio_warm_start_pack_tempo(&record, tempi, AUDIO_WARM_START_TEMPO_BINS);
+  TEST_ASSERT_FALSE(audio_warm_start_unpack_tempo(&record, restored, AUDIO_WARM_START_TEMPO_BINS));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, restored[0]);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_crc32_matches_reference);
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_empty_store_is_reported);
+  RUN_TEST(test_bad_blobs_are_rejected_untouched);
+  RUN_TEST(test_implausible_values_are_rejected);
+  RUN_TEST(test_write_failure_is_reported);
+  RUN_TEST(test_tempo_prior_quantisation);
+  return UNITY_END();
+}
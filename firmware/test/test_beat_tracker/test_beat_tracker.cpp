@@ -0,0 +1,378 @@
+// Beat tracker tests (env:native)
+// The loops on their own (synthetic novelty impulses: phase lock, frequency
+// pull, half-tempo rejection, hypothesis selection) and the whole audio path
+// on a small generated WAV corpus of kick patterns, measuring lock time and
+// beat jitter of the strongest hypothesis.
+
+#include <unity.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include "host_runtime.h"
+#include "host_audio_sources.h"
+#include "../../src/audio/goertzel.h"
+#include "../../src/audio/tempo.h"
+#include "../../src/audio/beat_tracker.h"
+
+#define TEST_TICK_S 0.02f                // NOVELTY_LOG_HZ
+#define TEST_TWO_PI 6.28318530718f
+#define TEST_BEAT_PHASE 1.57079632679f
+#define TEST_WAV_PATH "test_beat_tracker.wav"
+#define TEST_CORPUS_SECONDS 24.0f
+#define TEST_LOCK_TOLERANCE 0.02f        // BPM within 2%
+#define TEST_LOCK_CONFIDENCE 0.5f
+#define TEST_LOCK_HOLD_S 2.0f            // Lock must hold this long to count
+#define TEST_GAP_SECONDS 3.0f            // Silence after each track
+#define TEST_MAX_LOCK_S 12.0f            // Tempogram needs several seconds to settle first
+#define TEST_MAX_JITTER_MS 15.0f         // Three audio frames
+
+static BeatTracker tracker;
+
+static float wrap(float phase) {
+  while (phase > 3.14159265f) phase -= TEST_TWO_PI;
+  while (phase < -3.14159265f) phase += TEST_TWO_PI;
+  return phase;
+}
+
+// One hypothesis following a single tempogram bin at center_hz
+static void start_single(float center_hz, float phase) {
+  float magnitude[5] = {0.0f, 0.2f, 1.0f, 0.2f, 0.0f};
+  float bin_hz[5] = {center_hz * 0.9f, center_hz * 0.95f, center_hz, center_hz * 1.05f, center_hz * 1.1f};
+  float bin_phase[5] = {0.0f, 0.0f, phase, 0.0f, 0.0f};
+  beat_tracker_select(&tracker, magnitude, bin_hz, bin_phase, 5);
+}
+
+// Impulse train on the novelty tick nearest each beat of beat_hz, starting at
+// t = 0; the loops are advanced to the tick time before each sample
+static void feed_impulses(float beat_hz, int ticks, int* tick_counter) {
+  for (int i = 0; i < ticks; i++, (*tick_counter)++) {
+    const float t = *tick_counter * TEST_TICK_S;
+    const float beats = t * beat_hz;
+    const float nearest = roundf(beats);
+    const bool on_beat = fabsf(beats - nearest) * (1.0f / beat_hz) < TEST_TICK_S * 0.5f;
+    beat_tracker_advance(&tracker, TEST_TICK_S);
+    beat_tracker_novelty(&tracker, on_beat ? 1.0f : 0.0f, TEST_TICK_S);
+  }
+}
+
+// Phase the loop would have had at t (beats land on TEST_BEAT_PHASE)
+static float phase_error_now(const BeatHypothesis* h, float beat_hz, int tick_counter) {
+  const float t = (tick_counter - 1) * TEST_TICK_S;
+  const float expected = TEST_BEAT_PHASE + TEST_TWO_PI * beat_hz * t;
+  return wrap(h->phase - expected);
+}
+
+void setUp(void) {
+  beat_tracker_init(&tracker);
+}
+void tearDown(void) {}
+
+// ============================================================================
+// LOOPS ON SYNTHETIC NOVELTY
+// ============================================================================
+
+void test_loop_locks_phase_to_onsets(void) {
+  // Start a radian away from the beat
+  start_single(2.0f, TEST_BEAT_PHASE - 1.0f);
+  int ticks = 0;
+  feed_impulses(2.0f, 1000, &ticks);    // 20 s, 40 beats
+
+  const BeatHypothesis* h = &tracker.hypotheses[0];
+  TEST_ASSERT_TRUE(h->active);
+  TEST_ASSERT_FLOAT_WITHIN(0.1f, 0.0f, phase_error_now(h, 2.0f, ticks));
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.9f, h->lock);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.9f, h->confidence);
+  TEST_ASSERT_EQUAL_UINT32(40, tracker.onsets);
+}
+
+void test_loop_pulls_frequency_within_range(void) {
+  // Beats 2% faster than the bin: the loop frequency follows
+  start_single(2.0f, TEST_BEAT_PHASE);
+  int ticks = 0;
+  feed_impulses(2.04f, 3000, &ticks);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 2.04f, tracker.hypotheses[0].tempo_hz);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.8f, tracker.hypotheses[0].lock);
+
+  // 10% faster is outside the bin's range: clamped, and lock falls away
+  beat_tracker_init(&tracker);
+  start_single(2.0f, TEST_BEAT_PHASE);
+  ticks = 0;
+  feed_impulses(2.2f, 3000, &ticks);
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, 2.0f * (1.0f + BEAT_TRACKER_FREQ_RANGE), tracker.hypotheses[0].tempo_hz);
+  TEST_ASSERT_LESS_THAN_FLOAT(0.6f, tracker.hypotheses[0].lock);
+}
+
+void test_half_tempo_scores_below_true_tempo(void) {
+  // Equal tempogram peaks at 1 Hz and 2 Hz; onsets at 2 Hz
+  float magnitude[9] = {0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f};
+  float bin_hz[9];
+  float bin_phase[9];
+  for (int i = 0; i < 9; i++) {
+    bin_hz[i] = 0.75f + 0.25f * i;
+    bin_phase[i] = TEST_BEAT_PHASE;
+  }
+  beat_tracker_select(&tracker, magnitude, bin_hz, bin_phase, 9);
+  TEST_ASSERT_TRUE(tracker.hypotheses[0].active);
+  TEST_ASSERT_TRUE(tracker.hypotheses[1].active);
+
+  int ticks = 0;
+  feed_impulses(2.0f, 1000, &ticks);
+  const BeatHypothesis* full = (tracker.hypotheses[0].bin == 5) ? &tracker.hypotheses[0] : &tracker.hypotheses[1];
+  const BeatHypothesis* half = (tracker.hypotheses[0].bin == 5) ? &tracker.hypotheses[1] : &tracker.hypotheses[0];
+  TEST_ASSERT_EQUAL_UINT16(5, full->bin);
+  TEST_ASSERT_EQUAL_UINT16(1, half->bin);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.9f, full->confidence);
+  TEST_ASSERT_LESS_THAN_FLOAT(0.6f, half->confidence);
+}
+
+void test_selection_skips_dead_bins_and_keeps_loops(void) {
+  const int bins = 40;
+  float magnitude[40] = {0};
+  float bin_hz[40];
+  float bin_phase[40];
+  for (int i = 0; i < bins; i++) {
+    bin_hz[i] = 1.0f + 0.05f * i;
+    bin_phase[i] = 0.1f * i;
+  }
+  magnitude[5] = 1.0f;
+  magnitude[20] = 0.5f;
+  magnitude[30] = 0.1f;   // Below the dead fraction
+  magnitude[31] = 0.05f;  // Not a peak, and dead
+  beat_tracker_select(&tracker, magnitude, bin_hz, bin_phase, bins);
+
+  TEST_ASSERT_TRUE(tracker.hypotheses[0].active);
+  TEST_ASSERT_TRUE(tracker.hypotheses[1].active);
+  TEST_ASSERT_FALSE(tracker.hypotheses[2].active);
+  TEST_ASSERT_EQUAL_UINT16(5, tracker.hypotheses[0].bin);
+  TEST_ASSERT_EQUAL_UINT16(20, tracker.hypotheses[1].bin);
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, tracker.hypotheses[0].salience);
+  TEST_ASSERT_EQUAL_FLOAT(0.5f, tracker.hypotheses[1].salience);
+  TEST_ASSERT_EQUAL_FLOAT(bin_phase[5], tracker.hypotheses[0].phase);
+
+  // The weaker peak moves a bin and overtakes: both loops keep their state,
+  // and the better locked one comes first
+  tracker.hypotheses[0].lock = 0.2f;
+  tracker.hypotheses[1].lock = 0.9f;
+  tracker.hypotheses[1].phase = -2.0f;
+  magnitude[20] = 0.0f;
+  magnitude[21] = 2.0f;
+  beat_tracker_select(&tracker, magnitude, bin_hz, bin_phase, bins);
+  TEST_ASSERT_EQUAL_UINT16(21, tracker.hypotheses[0].bin);
+  TEST_ASSERT_EQUAL_FLOAT(0.9f, tracker.hypotheses[0].lock);
+  TEST_ASSERT_EQUAL_FLOAT(-2.0f, tracker.hypotheses[0].phase);
+  TEST_ASSERT_EQUAL_FLOAT(bin_hz[21], tracker.hypotheses[0].center_hz);
+  TEST_ASSERT_EQUAL_FLOAT(0.9f, tracker.hypotheses[0].confidence);
+  TEST_ASSERT_EQUAL_UINT16(5, tracker.hypotheses[1].bin);
+  TEST_ASSERT_EQUAL_FLOAT(0.2f, tracker.hypotheses[1].lock);
+  TEST_ASSERT_EQUAL_FLOAT(0.2f * 0.5f, tracker.hypotheses[1].confidence);
+
+  // A new peak has no lock yet: it ranks after the running loops
+  magnitude[35] = 1.5f;
+  beat_tracker_select(&tracker, magnitude, bin_hz, bin_phase, bins);
+  TEST_ASSERT_EQUAL_UINT16(35, tracker.hypotheses[2].bin);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, tracker.hypotheses[2].confidence);
+  TEST_ASSERT_EQUAL_FLOAT(bin_phase[35], tracker.hypotheses[2].phase);
+
+  // A silent tempogram drops every loop
+  memset(magnitude, 0, sizeof(magnitude));
+  beat_tracker_select(&tracker, magnitude, bin_hz, bin_phase, bins);
+  for (int k = 0; k < BEAT_TRACKER_HYPOTHESES; k++) {
+    TEST_ASSERT_FALSE(tracker.hypotheses[k].active);
+  }
+}
+
+// ============================================================================
+// GENERATED WAV CORPUS THROUGH THE AUDIO PATH
+// ============================================================================
+
+struct CorpusTrack {
+  const char* name;
+  float bpm_start;
+  float bpm_end;          // Linear tempo ramp over the track
+  bool offbeat_hats;      // Quieter hi-hat between the kicks
+};
+
+struct TrackResult {
+  float lock_s;           // First time the lock held TEST_LOCK_HOLD_S; < 0 if never
+  float jitter_ms;        // Std of predicted - true beat time after lock
+  int beats_scored;
+};
+
+static uint32_t noise_state = 12345;
+
+static float noise() {
+  noise_state = noise_state * 1664525u + 1013904223u;
+  return (float)(int32_t)noise_state / 2147483648.0f;
+}
+
+// Beat times of a linear ramp from bpm_start to bpm_end over `seconds`
+static std::vector<double> beat_times(const CorpusTrack& track, double seconds) {
+  std::vector<double> beats;
+  double t = 0.5;
+  while (t < seconds) {
+    beats.push_back(t);
+    const double bpm = track.bpm_start + (track.bpm_end - track.bpm_start) * (t / seconds);
+    t += 60.0 / bpm;
+  }
+  return beats;
+}
+
+// Kick (decaying 55 Hz sine with a click) on every beat, optional hat between
+static void write_track_wav(const char* path, const CorpusTrack& track, const std::vector<double>& beats) {
+  const size_t samples = (size_t)(TEST_CORPUS_SECONDS * AUDIO_CAPTURE_RATE_HZ);
+  std::vector<float> pcm(samples, 0.0f);
+  for (size_t i = 0; i < samples; i++) pcm[i] = 0.01f * noise();
+  for (size_t b = 0; b < beats.size(); b++) {
+    const size_t start = (size_t)(beats[b] * AUDIO_CAPTURE_RATE_HZ);
+    for (size_t i = 0; i < AUDIO_CAPTURE_RATE_HZ / 5 && start + i < samples; i++) {
+      const float t = (float)i / AUDIO_CAPTURE_RATE_HZ;
+      const float body = sinf(TEST_TWO_PI * (55.0f + 60.0f * expf(-t * 40.0f)) * t) * expf(-t * 12.0f);
+      const float click = noise() * expf(-t * 300.0f);
+      pcm[start + i] += 0.5f * body + 0.2f * click;
+    }
+    if (track.offbeat_hats && b + 1 < beats.size()) {
+      const size_t hat = (size_t)(0.5 * (beats[b] + beats[b + 1]) * AUDIO_CAPTURE_RATE_HZ);
+      for (size_t i = 0; i < AUDIO_CAPTURE_RATE_HZ / 20 && hat + i < samples; i++) {
+        const float t = (float)i / AUDIO_CAPTURE_RATE_HZ;
+        pcm[hat + i] += 0.08f * noise() * expf(-t * 80.0f);
+      }
+    }
+  }
+
+  std::vector<uint8_t> file(44 + 2 * samples);
+  auto put32 = [&](size_t at, uint32_t v) { for (int b = 0; b < 4; b++) file[at + b] = (uint8_t)(v >> (8 * b)); };
+  auto put16 = [&](size_t at, uint16_t v) { file[at] = (uint8_t)v; file[at + 1] = (uint8_t)(v >> 8); };
+  memcpy(&file[0], "RIFF", 4);
+  put32(4, (uint32_t)(36 + 2 * samples));
+  memcpy(&file[8], "WAVEfmt ", 8);
+  put32(16, 16);
+  put16(20, 1);                                 // PCM
+  put16(22, 1);                                 // Mono
+  put32(24, AUDIO_CAPTURE_RATE_HZ);
+  put32(28, AUDIO_CAPTURE_RATE_HZ * 2);
+  put16(32, 2);
+  put16(34, 16);
+  memcpy(&file[36], "data", 4);
+  put32(40, (uint32_t)(2 * samples));
+  for (size_t i = 0; i < samples; i++) {
+    const float clamped = fmaxf(-1.0f, fminf(1.0f, pcm[i]));
+    put16(44 + 2 * i, (uint16_t)(int16_t)lrintf(clamped * 32767.0f));
+  }
+  FILE* f = fopen(path, "wb");
+  TEST_ASSERT_NOT_NULL(f);
+  fwrite(file.data(), 1, file.size(), f);
+  fclose(f);
+}
+
+static TrackResult play_track(const CorpusTrack& track) {
+  const std::vector<double> beats = beat_times(track, TEST_CORPUS_SECONDS);
+  write_track_wav(TEST_WAV_PATH, track, beats);
+  WavFileSource wav;
+  std::string err;
+  TEST_ASSERT_TRUE_MESSAGE(wav_file_source_open(&wav, TEST_WAV_PATH, false, &err), err.c_str());
+  remove(TEST_WAV_PATH);
+  audio_source_select(&wav.source);
+
+  const int64_t chunk_us = (int64_t)AUDIO_CHUNK_SIZE * 1000000 / AUDIO_SAMPLE_RATE_HZ;
+  const double frame_s = (double)chunk_us / 1e6;
+  const size_t frames = wav_file_source_chunks(&wav);
+
+  TrackResult result = {-1.0f, 0.0f, 0};
+  double lock_start = -1.0;
+  float last_phase = 0.0f;
+  std::vector<double> errors;
+  for (size_t frame = 0; frame < frames; frame++) {
+    hal_advance_time_us(chunk_us);
+    host_audio_step();
+    const double t = (frame + 1) * frame_s;   // Audio time at the end of this chunk
+
+    const BeatHypothesis* h = &get_beat_tracker()->hypotheses[0];
+    const double true_bpm = track.bpm_start + (track.bpm_end - track.bpm_start) * (t / TEST_CORPUS_SECONDS);
+    const bool locked = h->active && h->confidence >= TEST_LOCK_CONFIDENCE &&
+                        fabs(h->tempo_hz * 60.0 - true_bpm) <= true_bpm * TEST_LOCK_TOLERANCE;
+
+    // The published payload is the tracker's hypothesis 0
+    TEST_ASSERT_EQUAL_FLOAT(h->active ? h->tempo_hz * 60.0f : 0.0f, audio_back.payload.beat_bpm[0]);
+    TEST_ASSERT_EQUAL_FLOAT(h->active ? h->phase : 0.0f, audio_back.payload.beat_phase[0]);
+
+    if (result.lock_s < 0.0f) {
+      if (!locked) {
+        lock_start = -1.0;
+      }
+      else if (lock_start < 0.0) {
+        lock_start = t;
+      }
+      else if (t - lock_start >= TEST_LOCK_HOLD_S) {
+        result.lock_s = (float)lock_start;
+      }
+    }
+    else if (h->active && last_phase < TEST_BEAT_PHASE && h->phase >= TEST_BEAT_PHASE &&
+             h->phase - last_phase < 3.14159265f) {
+      // Predicted beat: interpolate the pi/2 crossing, score against the nearest true beat
+      const double fraction = (TEST_BEAT_PHASE - last_phase) / (h->phase - last_phase);
+      const double predicted = t - frame_s + fraction * frame_s;
+      double nearest = beats[0];
+      for (double b : beats) {
+        if (fabs(b - predicted) < fabs(nearest - predicted)) nearest = b;
+      }
+      errors.push_back(predicted - nearest);
+    }
+    last_phase = h->active ? h->phase : 0.0f;
+  }
+
+  // Past the end the source plays silence: the hypotheses are dropped
+  const size_t gap_frames = (size_t)(TEST_GAP_SECONDS / frame_s);
+  for (size_t frame = 0; frame < gap_frames; frame++) {
+    hal_advance_time_us(chunk_us);
+    host_audio_step();
+  }
+  TEST_ASSERT_FALSE(get_beat_tracker()->hypotheses[0].active);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, audio_back.payload.beat_confidence[0]);
+  audio_source_select(nullptr);
+
+  if (errors.size() > 1) {
+    double mean = 0.0;
+    for (double e : errors) mean += e;
+    mean /= errors.size();
+    double variance = 0.0;
+    for (double e : errors) variance += (e - mean) * (e - mean);
+    result.jitter_ms = (float)(1000.0 * sqrt(variance / (errors.size() - 1)));
+  }
+  result.beats_scored = (int)errors.size();
+  printf("  %-14s lock %.2f s, jitter %.1f ms over %d beats\n",
+         track.name, result.lock_s, result.jitter_ms, result.beats_scored);
+  return result;
+}
+
+void test_corpus_lock_time_and_jitter(void) {
+  static const CorpusTrack corpus[] = {
+    {"kick_90",        90.0f,  90.0f, false},
+    {"kick_120",      120.0f, 120.0f, false},
+    {"kick_140",      140.0f, 140.0f, false},
+    {"kick_hats_120", 120.0f, 120.0f, true},
+    {"kick_ramp",     116.0f, 124.0f, false},
+  };
+  for (const CorpusTrack& track : corpus) {
+    const TrackResult result = play_track(track);
+    TEST_ASSERT_TRUE_MESSAGE(result.lock_s >= 0.0f, track.name);
+    TEST_ASSERT_LESS_THAN_FLOAT_MESSAGE(TEST_MAX_LOCK_S, result.lock_s, track.name);
+    TEST_ASSERT_GREATER_THAN_INT_MESSAGE(10, result.beats_scored, track.name);
+    TEST_ASSERT_LESS_THAN_FLOAT_MESSAGE(TEST_MAX_JITTER_MS, result.jitter_ms, track.name);
+  }
+}
+
+int main(int argc, char** argv) {
+  hal_set_time_us(1000000);
+  host_runtime_init();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_loop_locks_phase_to_onsets);
+  RUN_TEST(test_loop_pulls_frequency_within_range);
+  RUN_TEST(test_half_tempo_scores_below_true_tempo);
+  RUN_TEST(test_selection_skips_dead_bins_and_keeps_loops);
+  RUN_TEST(test_corpus_lock_time_and_jitter);
+  return UNITY_END();
+}
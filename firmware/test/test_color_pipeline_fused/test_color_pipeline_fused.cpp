@@ -0,0 +1,231 @@
+// Fused color pipeline vs multi-pass parity tests
+// Runs random HDR frames through the legacy apply_color_pipeline() passes plus
+// the transmit_leds() quantizer, and through color_pipeline_fused(), and checks
+// every output byte agrees within 1 LSB.
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <stdint.h>
+#include "../../src/color_pipeline_fused.h"
+
+#define TEST_NUM_LEDS 160
+#define TEST_REFERENCE_FPS 100.0f
+#define TEST_FRAMES 400
+
+// Multi-pass reference state
+static CRGBF ref_leds[TEST_NUM_LEDS];
+static CRGBF ref_prev[TEST_NUM_LEDS];
+static CRGBF ref_dither[TEST_NUM_LEDS];
+static uint8_t ref_out[TEST_NUM_LEDS * 3];
+
+// Fused state
+static CRGBF fused_leds[TEST_NUM_LEDS];
+static CRGBF fused_prev[TEST_NUM_LEDS];
+static CRGBF fused_dither[TEST_NUM_LEDS];
+static uint8_t fused_out[TEST_NUM_LEDS * 3];
+static ColorLut lut;
+
+static uint32_t rng_state = 2463534242u;
+
+static float next_unit() {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return (rng_state >> 8) / 16777216.0f;
+}
+
+static float clamp01(float v) { return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v); }
+
+// Mirrors color_pipeline.cpp (LPF -> tone-map -> warmth -> white balance -> master -> gamma)
+static float soft_clip_hdr(float v) {
+  if (v < 0.75f) return v;
+  return 0.75f + 0.25f * tanhf((v - 0.75f) * 4.0f);
+}
+
+static void reference_pipeline(float softness, float warmth, float brightness) {
+  float cutoff = 0.5f + (1.0f - sqrtf(fmaxf(0.0f, fminf(1.0f, softness)))) * 14.5f;
+  float alpha = 1.0f - expf(-6.28318530718f * cutoff / TEST_REFERENCE_FPS);
+  float inv = 1.0f - alpha;
+  for (int i = 0; i < TEST_NUM_LEDS; i++) {
+    CRGBF out(ref_leds[i].r * alpha + ref_prev[i].r * inv,
+              ref_leds[i].g * alpha + ref_prev[i].g * inv,
+              ref_leds[i].b * alpha + ref_prev[i].b * inv);
+    ref_leds[i] = out;
+    ref_prev[i] = out;
+  }
+  for (int i = 0; i < TEST_NUM_LEDS; i++) {
+    ref_leds[i].r = soft_clip_hdr(ref_leds[i].r);
+    ref_leds[i].g = soft_clip_hdr(ref_leds[i].g);
+    ref_leds[i].b = soft_clip_hdr(ref_leds[i].b);
+  }
+  if (warmth > 0.0f) {
+    float mix = warmth > 1.0f ? 1.0f : warmth;
+    float m = 1.0f - mix;
+    for (int i = 0; i < TEST_NUM_LEDS; i++) {
+      ref_leds[i].r = clamp01(ref_leds[i].r * (1.0f * mix + m));
+      ref_leds[i].g = clamp01(ref_leds[i].g * (0.4452f * mix + m));
+      ref_leds[i].b = clamp01(ref_leds[i].b * (0.1562f * mix + m));
+    }
+  }
+  for (int i = 0; i < TEST_NUM_LEDS; i++) {
+    ref_leds[i].r = clamp01(ref_leds[i].r * 1.0f);
+    ref_leds[i].g = clamp01(ref_leds[i].g * 0.9375f);
+    ref_leds[i].b = clamp01(ref_leds[i].b * 0.84f);
+  }
+  float master = 0.3f + 0.7f * fmaxf(0.0f, fminf(1.0f, brightness));
+  for (int i = 0; i < TEST_NUM_LEDS; i++) {
+    ref_leds[i].r *= master;
+    ref_leds[i].g *= master;
+    ref_leds[i].b *= master;
+  }
+  for (int i = 0; i < TEST_NUM_LEDS; i++) {
+    ref_leds[i].r = powf(clamp01(ref_leds[i].r), 2.0f);
+    ref_leds[i].g = powf(clamp01(ref_leds[i].g), 2.0f);
+    ref_leds[i].b = powf(clamp01(ref_leds[i].b), 2.0f);
+  }
+}
+
+// Mirrors the quantize loop of transmit_leds()
+static uint8_t reference_dither(float dec, float* err) {
+  uint8_t out = (uint8_t)dec;
+  float new_err = dec - (float)out;
+  if (new_err >= 0.055f) *err += new_err;
+  if (*err >= 1.0f) { out += 1; *err -= 1.0f; }
+  return out;
+}
+
+static void reference_quantize(float global_brightness, int16_t offset_px, bool dithering) {
+  const float scale = clamp01(global_brightness) * 255.0f;
+  for (int i = 0; i < TEST_NUM_LEDS; i++) {
+    int32_t src = (i + offset_px) % TEST_NUM_LEDS;
+    if (src < 0) src += TEST_NUM_LEDS;
+    if (dithering) {
+      ref_out[i * 3 + 0] = reference_dither(ref_leds[src].r * scale, &ref_dither[i].r);
+      ref_out[i * 3 + 1] = reference_dither(ref_leds[src].g * scale, &ref_dither[i].g);
+      ref_out[i * 3 + 2] = reference_dither(ref_leds[src].b * scale, &ref_dither[i].b);
+    } else {
+      ref_out[i * 3 + 0] = (uint8_t)(ref_leds[src].r * scale);
+      ref_out[i * 3 + 1] = (uint8_t)(ref_leds[src].g * scale);
+      ref_out[i * 3 + 2] = (uint8_t)(ref_leds[src].b * scale);
+    }
+  }
+}
+
+static void fused_frame(float softness, float warmth, float brightness,
+                        float global_brightness, int16_t offset_px, bool dithering) {
+  color_lut_update(&lut, warmth, brightness);
+  ColorPipelineFrame f;
+  f.lut = &lut;
+  f.frame = fused_leds;
+  f.lpf_state = fused_prev;
+  f.lpf_alpha = color_pipeline_lpf_alpha(softness, TEST_REFERENCE_FPS);
+  f.dither_error = fused_dither;
+  f.out = fused_out;
+  f.num_leds = TEST_NUM_LEDS;
+  f.offset_px = offset_px;
+  f.output_scale = clamp01(global_brightness) * 255.0f;
+  f.dithering = dithering;
+  color_pipeline_fused(&f);
+}
+
+// Random pattern frame: mostly [0, 1], some HDR overshoot and negative values
+static void render_pattern() {
+  for (int i = 0; i < TEST_NUM_LEDS; i++) {
+    float v[3];
+    for (int c = 0; c < 3; c++) {
+      float u = next_unit();
+      if (u < 0.05f) v[c] = -0.2f * next_unit();
+      else if (u < 0.25f) v[c] = 1.0f + 3.0f * next_unit();
+      else v[c] = next_unit();
+    }
+    ref_leds[i] = CRGBF(v[0], v[1], v[2]);
+    fused_leds[i] = ref_leds[i];
+  }
+}
+
+static int max_byte_diff() {
+  int worst = 0;
+  for (int i = 0; i < TEST_NUM_LEDS * 3; i++) {
+    int d = abs((int)ref_out[i] - (int)fused_out[i]);
+    if (d > worst) worst = d;
+  }
+  return worst;
+}
+
+static int run_sequence(float softness, float warmth, float brightness,
+                        float global_brightness, int16_t offset_px, bool dithering) {
+  int worst = 0;
+  for (int frame = 0; frame < TEST_FRAMES; frame++) {
+    render_pattern();
+    reference_pipeline(softness, warmth, brightness);
+    reference_quantize(global_brightness, offset_px, dithering);
+    fused_frame(softness, warmth, brightness, global_brightness, offset_px, dithering);
+    int d = max_byte_diff();
+    if (d > worst) worst = d;
+  }
+  return worst;
+}
+
+void setUp(void) {
+  for (int i = 0; i < TEST_NUM_LEDS; i++) {
+    ref_prev[i] = CRGBF();
+    ref_dither[i] = CRGBF();
+    fused_prev[i] = CRGBF();
+    fused_dither[i] = CRGBF();
+  }
+  memset(&lut, 0, sizeof(lut));
+  rng_state = 2463534242u;
+}
+
+void tearDown(void) {}
+
+void test_curve_matches_reference_chain(void) {
+  for (int i = -10; i <= 400; i++) {
+    float x = i * 0.01f;
+    float r = color_pipeline_curve(0, x, 0.6f, 0.8f);
+    float expect = powf(clamp01(clamp01(clamp01(soft_clip_hdr(x) * (0.6f + 0.4f)) * 1.0f) * (0.3f + 0.7f * 0.8f)), 2.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, expect, r);
+  }
+}
+
+void test_no_dither_within_one_lsb(void) {
+  TEST_ASSERT_LESS_OR_EQUAL(1, run_sequence(0.3f, 0.0f, 1.0f, 1.0f, 0, false));
+}
+
+void test_dither_within_one_lsb(void) {
+  TEST_ASSERT_LESS_OR_EQUAL(1, run_sequence(0.3f, 0.0f, 1.0f, 1.0f, 0, true));
+}
+
+void test_warmth_brightness_offset_within_one_lsb(void) {
+  TEST_ASSERT_LESS_OR_EQUAL(1, run_sequence(0.8f, 0.7f, 0.4f, 0.6f, 37, true));
+  TEST_ASSERT_LESS_OR_EQUAL(1, run_sequence(0.0f, 1.5f, 0.0f, 1.0f, -5, false));
+}
+
+void test_post_pipeline_floats_match(void) {
+  run_sequence(0.5f, 0.3f, 0.9f, 1.0f, 12, true);
+  for (int i = 0; i < TEST_NUM_LEDS; i++) {
+    TEST_ASSERT_FLOAT_WITHIN(1.0f / 255.0f, ref_leds[i].r, fused_leds[i].r);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f / 255.0f, ref_leds[i].g, fused_leds[i].g);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f / 255.0f, ref_leds[i].b, fused_leds[i].b);
+  }
+}
+
+void test_lut_rebuilds_only_on_parameter_change(void) {
+  TEST_ASSERT_TRUE(color_lut_update(&lut, 0.2f, 0.5f));
+  TEST_ASSERT_FALSE(color_lut_update(&lut, 0.2f, 0.5f));
+  TEST_ASSERT_TRUE(color_lut_update(&lut, 0.2f, 0.6f));
+  TEST_ASSERT_TRUE(color_lut_update(&lut, 0.3f, 0.6f));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_curve_matches_reference_chain);
+  RUN_TEST(test_no_dither_within_one_lsb);
+  RUN_TEST(test_dither_within_one_lsb);
+  RUN_TEST(test_warmth_brightness_offset_within_one_lsb);
+  RUN_TEST(test_post_pipeline_floats_match);
+  RUN_TEST(test_lut_rebuilds_only_on_parameter_change);
+  return UNITY_END();
+}
@@ -0,0 +1,163 @@
+// Constant-Q FFT engine tests
+// The packed real FFT against a direct DFT, the note bins against the Goertzel
+// block engine (tones at bin centres and a tone sweep over the real bin
+// layout), the linear bands and their smoothing, and the per-frame cost of
+// both engines.
+
+#include <unity.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <stdint.h>
+#include "../../src/audio/constant_q.h"
+#include "../test_utils/goertzel_fixture.h"
+
+#define TEST_RATE FIXTURE_SAMPLE_RATE
+#define TEST_BINS FIXTURE_NOTE_BINS
+#define TEST_HISTORY 4096
+
+static float storage[TEST_HISTORY];
+static SampleRing ring;
+static GoertzelBlockBin bins[TEST_BINS];
+static ConstantQ cq;
+static float magnitudes[TEST_BINS];
+static float reference[TEST_BINS];
+static float bands[CONSTANT_Q_FFT_BANDS];
+
+// Sine (plus optional LCG noise), written so the ring head lands at head_offset
+static void fill_history(double hz, double amplitude, float noise, uint32_t head_offset) {
+  FixtureTone tone = fixture_tone(hz, amplitude, noise);
+  fixture_fill_ring(&ring, storage, TEST_HISTORY, &tone, 1, TEST_HISTORY + head_offset);
+}
+
+static void block_engine(float* out) {
+  for (uint16_t i = 0; i < TEST_BINS; i++) {
+    out[i] = goertzel_block_magnitude(&ring, 1, window_lookup, &bins[i]);
+  }
+}
+
+void setUp(void) {
+  fixture_note_bins(bins, TEST_BINS);
+  TEST_ASSERT_TRUE(constant_q_init(&cq, bins, TEST_BINS, window_lookup, CONSTANT_Q_DEFAULT_THRESHOLD));
+}
+
+void tearDown(void) {}
+
+void test_real_fft_matches_direct_dft(void) {
+  fill_history(440.0, 0.5, 0.2f, 320);   // Frame straddles the ring wrap
+  constant_q_analyze(&cq, &ring, 1, magnitudes, nullptr);
+  const SampleSpan span = sample_ring_window(&ring, CONSTANT_Q_FFT_SIZE, 1);
+  const uint32_t probes[] = {0, 1, 70, 71, 511, 512, 513, 1000, CONSTANT_Q_FFT_SIZE / 2};
+  for (uint32_t f : probes) {
+    double re = 0.0, im = 0.0;
+    for (uint32_t m = 0; m < CONSTANT_Q_FFT_SIZE; m++) {
+      const double x = sample_span_at(span, m);
+      re += x * cos(2.0 * M_PI * f * m / CONSTANT_Q_FFT_SIZE);
+      im -= x * sin(2.0 * M_PI * f * m / CONSTANT_Q_FFT_SIZE);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, (float)re, cq.frame[2 * f]);
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, (float)im, cq.frame[2 * f + 1]);
+  }
+}
+
+void test_tone_at_bin_centre_reads_as_block_engine(void) {
+  for (uint16_t bin = 0; bin < TEST_BINS; bin += 3) {
+    fill_history(fixture_bin_centre_hz(bins[bin]), 0.5, 0.0f, 0);
+    constant_q_analyze(&cq, &ring, 1, magnitudes, nullptr);
+    const float expected = goertzel_block_magnitude(&ring, 1, window_lookup, &bins[bin]);
+    TEST_ASSERT_FLOAT_WITHIN(0.03f * expected, expected, magnitudes[bin]);
+  }
+}
+
+void test_tone_sweep_tracks_block_engine(void) {
+  double squared_error = 0.0;
+  uint32_t count = 0;
+  uint32_t peak_misses = 0;
+  uint32_t tones = 0;
+  for (double hz = fixture_bin_centre_hz(bins[0]); hz < fixture_bin_centre_hz(bins[TEST_BINS - 1]); hz *= pow(2.0, 1.0 / 24.0)) {
+    fill_history(hz, 0.5, 0.0f, 0);
+    constant_q_analyze(&cq, &ring, 1, magnitudes, nullptr);
+    block_engine(reference);
+    uint16_t cq_peak = 0, block_peak = 0;
+    for (uint16_t i = 1; i < TEST_BINS; i++) {
+      if (magnitudes[i] > magnitudes[cq_peak]) cq_peak = i;
+      if (reference[i] > reference[block_peak]) block_peak = i;
+    }
+    for (uint16_t i = 0; i < TEST_BINS; i++) {
+      const double error = (magnitudes[i] - reference[i]) / reference[block_peak];
+      squared_error += error * error;
+      count++;
+    }
+    // Where neighbours nearly tie (bins sharing one DFT index) the engines may
+    // pick different peaks, but never one the block engine reads 5% weaker
+    TEST_ASSERT_TRUE(reference[cq_peak] >= 0.95f * reference[block_peak]);
+    peak_misses += cq_peak != block_peak;
+    tones++;
+  }
+  const double rms = sqrt(squared_error / count);
+  printf("  sweep: %u tones, RMS error %.4f of peak, %u near-tie peak bins differ\n",
+         (unsigned)tones, rms, (unsigned)peak_misses);
+  TEST_ASSERT_TRUE(rms < 0.03);
+  TEST_ASSERT_TRUE(peak_misses * 10 < tones);
+}
+
+void test_bands_place_a_sine_by_frequency(void) {
+  fill_history(1025.0, 0.5, 0.0f, 0);   // Band 20 spans 1000-1050 Hz
+  constant_q_analyze(&cq, &ring, 1, magnitudes, bands);
+  TEST_ASSERT_FLOAT_WITHIN(0.03f, 0.5f, bands[20]);
+  for (uint16_t k = 0; k < CONSTANT_Q_FFT_BANDS; k++) {
+    if (k < 19 || k > 21) TEST_ASSERT_TRUE(bands[k] < 0.01f);
+  }
+}
+
+void test_smooth_bands_auto_range(void) {
+  static float smooth[CONSTANT_Q_FFT_BANDS];
+  for (uint16_t k = 0; k < CONSTANT_Q_FFT_BANDS; k++) smooth[k] = 0.0f;
+  fill_history(3210.0, 0.05, 0.0f, 0);   // Quiet: band 64
+  constant_q_analyze(&cq, &ring, 1, magnitudes, bands);
+  for (int frame = 0; frame < 2000; frame++) {
+    constant_q_smooth_bands(&cq, bands, smooth);
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, 1.0f, smooth[64]);
+  for (uint16_t k = 0; k < CONSTANT_Q_FFT_BANDS; k++) {
+    TEST_ASSERT_TRUE(smooth[k] >= 0.0f && smooth[k] <= 1.0f);
+    if (k < 63 || k > 65) TEST_ASSERT_TRUE(smooth[k] < 0.05f);
+  }
+}
+
+void test_init_rejects_what_does_not_fit(void) {
+  static ConstantQ scratch;
+  GoertzelBlockBin too_long = bins[0];
+  too_long.block_size = CONSTANT_Q_FFT_SIZE + 4;
+  TEST_ASSERT_FALSE(constant_q_init(&scratch, &too_long, 1, window_lookup, CONSTANT_Q_DEFAULT_THRESHOLD));
+  // Keeping every coefficient of every bin overflows the kernel store
+  TEST_ASSERT_FALSE(constant_q_init(&scratch, bins, TEST_BINS, window_lookup, 0.0f));
+  TEST_ASSERT_TRUE(cq.kernel_used > 0 && cq.kernel_used <= CONSTANT_Q_KERNEL_CAPACITY);
+}
+
+void test_frame_cost(void) {
+  fill_history(440.0, 0.5, 0.2f, 320);
+  const int frames = 400;
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) constant_q_analyze(&cq, &ring, 1, magnitudes, bands);
+  const double cq_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+  start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) goertzel_block_magnitudes(&ring, 1, window_lookup, bins, TEST_BINS, 4, reference);
+  const double block_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+  printf("  constant-Q FFT %.1f us/frame (%u kernel coefficients), block Goertzel x4 %.1f us/frame\n",
+         cq_us, (unsigned)cq.kernel_used, block_us);
+  // One audio chunk is 5 ms; the whole analysis must fit well inside it on host
+  TEST_ASSERT_TRUE(cq_us < 2500.0);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_real_fft_matches_direct_dft);
+  RUN_TEST(test_tone_at_bin_centre_reads_as_block_engine);
+  RUN_TEST(test_tone_sweep_tracks_block_engine);
+  RUN_TEST(test_bands_place_a_sine_by_frequency);
+  RUN_TEST(test_smooth_bands_auto_range);
+  RUN_TEST(test_init_rejects_what_does_not_fit);
+  RUN_TEST(test_frame_cost);
+  return UNITY_END();
+}
@@ -21,7 +21,6 @@
 
 // External I2S handle for testing
 extern i2s_chan_handle_t rx_handle;
-extern float sample_history[SAMPLE_HISTORY_LENGTH];
 
 // ============================================================================
 // TEST SETUP / TEARDOWN
@@ -31,7 +30,6 @@ void setUp(void) {
     // Initialize I2S and audio system
     init_i2s_microphone();
     init_audio_data_sync();
-    init_window_lookup();
     init_goertzel_constants_musical();
 }
 
@@ -111,7 +109,7 @@ void test_silence_fallback() {
     Serial.println("\n=== TEST: Silence Buffer Fallback ===");
 
     // Clear sample history
-    memset(sample_history, 0, sizeof(float) * SAMPLE_HISTORY_LENGTH);
+    sample_ring_clear(&sample_history);
 
     // Perform acquisition (may timeout, should fill with silence)
     acquire_sample_chunk();
@@ -119,7 +117,7 @@ void test_silence_fallback() {
     // Verify sample history contains valid data (zeros if timeout)
     bool all_finite = true;
     for (int i = 0; i < SAMPLE_HISTORY_LENGTH; i++) {
-        if (!isfinite(sample_history[i])) {
+        if (!isfinite(sample_ring_at(&sample_history, i))) {
             all_finite = false;
             break;
         }
@@ -14,7 +14,6 @@ TaskHandle_t audio_task_handle = NULL;
 
 void setUp(void) {
     init_audio_data_sync();
-    init_window_lookup();
     init_goertzel_constants_musical();
 }
 
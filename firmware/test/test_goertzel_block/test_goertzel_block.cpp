@@ -0,0 +1,113 @@
+// Goertzel block kernel tests
+// The 4- and 8-lane interleaved sweeps against the one-bin kernel, bin for
+// bin, over the spectrogram's real bin layout (block sizes 36..1380 samples),
+// with the history window contiguous and straddling the ring wrap; plus the
+// sweep cost per lane count.
+
+#include <unity.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <stdint.h>
+#include "../../src/audio/goertzel_block.h"
+#include "../test_utils/goertzel_fixture.h"
+
+#define TEST_BINS FIXTURE_NOTE_BINS
+#define TEST_HISTORY 4096
+
+static float storage[TEST_HISTORY];
+static SampleRing ring;
+static GoertzelBlockBin bins[TEST_BINS];
+static float reference[TEST_BINS];
+static float interleaved[TEST_BINS];
+
+// Two tones plus LCG noise, written so the ring head lands at head_offset
+static void fill_history(uint32_t head_offset) {
+  FixtureTone tones[2] = {fixture_tone(220.0, 0.4, 0.1f), fixture_tone(1244.5, 0.2)};
+  fixture_fill_ring(&ring, storage, TEST_HISTORY, tones, 2, TEST_HISTORY * 2 + head_offset);
+}
+
+static void assert_matches_reference(uint16_t count, uint16_t lanes) {
+  for (uint16_t i = 0; i < count; i++) {
+    reference[i] = goertzel_block_magnitude(&ring, 1, window_lookup, &bins[i]);
+  }
+  goertzel_block_magnitudes(&ring, 1, window_lookup, bins, count, lanes, interleaved);
+  for (uint16_t i = 0; i < count; i++) {
+    TEST_ASSERT_EQUAL_FLOAT(reference[i], interleaved[i]);
+  }
+}
+
+void setUp(void) {
+  fixture_note_bins(bins, TEST_BINS);
+}
+
+void tearDown(void) {}
+
+void test_bin_layout_spans_short_and_long_blocks(void) {
+  TEST_ASSERT_TRUE(bins[0].block_size > 1000 && bins[0].block_size < TEST_HISTORY);
+  TEST_ASSERT_TRUE(bins[TEST_BINS - 1].block_size < 100);
+}
+
+void test_four_lanes_match_scalar(void) {
+  fill_history(0);   // Window ends at the storage end: contiguous
+  assert_matches_reference(TEST_BINS, 4);
+}
+
+void test_eight_lanes_match_scalar(void) {
+  fill_history(0);
+  assert_matches_reference(TEST_BINS, 8);
+}
+
+void test_lanes_match_scalar_across_ring_wrap(void) {
+  // Head 320 samples past the wrap: long blocks straddle it, short ones do not,
+  // and some groups split their shared tail across the two runs
+  fill_history(320);
+  assert_matches_reference(TEST_BINS, 4);
+  assert_matches_reference(TEST_BINS, 8);
+}
+
+void test_partial_groups_fall_back_to_scalar(void) {
+  fill_history(128);
+  assert_matches_reference(10, 8);   // 8 interleaved + 2 single
+  assert_matches_reference(10, 4);   // 4 + 4 + 2
+  assert_matches_reference(3, 4);    // All single
+}
+
+void test_tone_peaks_in_its_bin(void) {
+  fill_history(0);
+  goertzel_block_magnitudes(&ring, 1, window_lookup, bins, TEST_BINS, 4, interleaved);
+  uint16_t peak = 0;
+  for (uint16_t i = 1; i < 40; i++) {
+    if (interleaved[i] > interleaved[peak]) peak = i;
+  }
+  // The strongest bin below 1 kHz resonates within a half step of the 220 Hz tone
+  TEST_ASSERT_FLOAT_WITHIN(1.0 / 24.0, 0.0, log2(fixture_bin_centre_hz(bins[peak]) / 220.0));
+}
+
+void test_sweep_cost(void) {
+  fill_history(320);
+  const uint16_t lane_counts[] = {1, 4, 8};
+  const int sweeps = 400;
+  for (uint16_t lanes : lane_counts) {
+    auto start = std::chrono::steady_clock::now();
+    for (int s = 0; s < sweeps; s++) {
+      goertzel_block_magnitudes(&ring, 1, window_lookup, bins, TEST_BINS, lanes, interleaved);
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    printf("  %u lane(s): %.1f us per 64-bin sweep\n", (unsigned)lanes, (double)ns / sweeps / 1000.0);
+    // One audio chunk is 5 ms; the whole sweep must fit well inside it on host
+    TEST_ASSERT_TRUE((double)ns / sweeps < 2500000.0);
+  }
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bin_layout_spans_short_and_long_blocks);
+  RUN_TEST(test_four_lanes_match_scalar);
+  RUN_TEST(test_eight_lanes_match_scalar);
+  RUN_TEST(test_lanes_match_scalar_across_ring_wrap);
+  RUN_TEST(test_partial_groups_fall_back_to_scalar);
+  RUN_TEST(test_tone_peaks_in_its_bin);
+  RUN_TEST(test_sweep_cost);
+  return UNITY_END();
+}
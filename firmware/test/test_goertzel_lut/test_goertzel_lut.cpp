@@ -0,0 +1,137 @@
+// Goertzel lookup table tests
+// The generated flash tables (goertzel_lut.h) against the values the boot-time
+// code computed into RAM before they were generated: init_window_lookup() for
+// the Gaussian window and init_goertzel_constants_musical() / init_goertzel()
+// for the note bins. The runtime computations are kept here verbatim.
+
+#include <unity.h>
+#include <cmath>
+#include <stdint.h>
+#include "../../src/audio/audio_config.h"
+#include "../../src/audio/goertzel_lut.h"
+
+#define TEST_NUM_FREQS 64
+#define TEST_BOTTOM_NOTE 12
+#define TEST_NOTE_STEP 2
+#define TEST_HISTORY_LENGTH 4096
+#define TEST_PI 3.1415926535897932384626433832795   // Arduino PI
+
+static float runtime_window[4096];
+
+typedef struct {
+  float target_freq;
+  uint32_t block_size;
+  float window_step;
+  float k;
+  float coeff;
+} RuntimeBin;
+
+static RuntimeBin runtime_bins[TEST_NUM_FREQS];
+
+// init_window_lookup()
+static void runtime_window_lookup() {
+  float sigma = 0.8;
+  for (uint16_t i = 0; i < 2048; i++) {
+    float n_minus_halfN = i - 2048 / 2;
+    float gaussian_weighing_factor = exp(-0.5 * pow((n_minus_halfN / (sigma * 2048 / 2)), 2));
+    runtime_window[i] = gaussian_weighing_factor;
+    runtime_window[4095 - i] = gaussian_weighing_factor;
+  }
+}
+
+// init_goertzel()
+static void runtime_goertzel(uint16_t slot, float bandwidth) {
+  RuntimeBin& bin = runtime_bins[slot];
+  bin.block_size = AUDIO_SAMPLE_RATE_HZ / (bandwidth);
+  while (bin.block_size % 4 != 0) {
+    bin.block_size -= 1;
+  }
+  if (bin.block_size > TEST_HISTORY_LENGTH - 1) {
+    bin.block_size = TEST_HISTORY_LENGTH - 1;
+  }
+  bin.window_step = 4096.0 / bin.block_size;
+  bin.k = (int)(0.5 + ((bin.block_size * bin.target_freq) / AUDIO_SAMPLE_RATE_HZ));
+  float w = (2.0 * TEST_PI * bin.k) / bin.block_size;
+  float cosine = cos(w);
+  bin.coeff = 2.0 * cosine;
+}
+
+// init_goertzel_constants_musical()
+static void runtime_goertzel_constants_musical() {
+  for (uint16_t i = 0; i < TEST_NUM_FREQS; i++) {
+    uint16_t note = TEST_BOTTOM_NOTE + (i * TEST_NOTE_STEP);
+    runtime_bins[i].target_freq = notes[note];
+
+    float neighbor_left;
+    float neighbor_right;
+    if (note == 0) {
+      neighbor_left = notes[note];
+      neighbor_right = notes[note + 1];
+    }
+    else if (note == TEST_NUM_FREQS - 1) {
+      neighbor_left = notes[note - 1];
+      neighbor_right = notes[note];
+    }
+    else {
+      neighbor_left = notes[note - 1];
+      neighbor_right = notes[note + 1];
+    }
+
+    float neighbor_distance_hz = fmaxf(
+        fabsf(runtime_bins[i].target_freq - neighbor_left),
+        fabsf(runtime_bins[i].target_freq - neighbor_right));
+    runtime_goertzel(i, neighbor_distance_hz * 4.0);
+  }
+}
+
+void setUp(void) {
+  runtime_window_lookup();
+  runtime_goertzel_constants_musical();
+}
+
+void tearDown(void) {}
+
+void test_lut_matches_build_configuration(void) {
+  TEST_ASSERT_EQUAL_INT(AUDIO_SAMPLE_RATE_HZ, GOERTZEL_LUT_SAMPLE_RATE_HZ);
+  TEST_ASSERT_EQUAL_INT(TEST_NUM_FREQS, GOERTZEL_LUT_NUM_FREQS);
+  TEST_ASSERT_EQUAL_INT(TEST_BOTTOM_NOTE, GOERTZEL_LUT_BOTTOM_NOTE);
+  TEST_ASSERT_EQUAL_INT(TEST_NOTE_STEP, GOERTZEL_LUT_NOTE_STEP);
+  TEST_ASSERT_EQUAL_INT(4096, sizeof(window_lookup) / sizeof(window_lookup[0]));
+}
+
+void test_window_matches_runtime(void) {
+  for (uint16_t i = 0; i < 4096; i++) {
+    TEST_ASSERT_EQUAL_FLOAT(runtime_window[i], window_lookup[i]);
+  }
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, window_lookup[1024]);
+  TEST_ASSERT_EQUAL_FLOAT(window_lookup[0], window_lookup[4095]);
+}
+
+void test_bins_match_runtime(void) {
+  for (uint16_t i = 0; i < TEST_NUM_FREQS; i++) {
+    const GoertzelBinConstants& lut = GOERTZEL_BIN_LUT[i];
+    TEST_ASSERT_EQUAL_FLOAT(runtime_bins[i].target_freq, lut.target_freq);
+    TEST_ASSERT_EQUAL_UINT32(runtime_bins[i].block_size, lut.block_size);
+    TEST_ASSERT_EQUAL_FLOAT(runtime_bins[i].window_step, lut.window_step);
+    TEST_ASSERT_EQUAL_FLOAT(runtime_bins[i].k, lut.k);
+    TEST_ASSERT_EQUAL_FLOAT(runtime_bins[i].coeff, lut.coeff);
+  }
+}
+
+void test_bins_are_a_half_step_ladder(void) {
+  for (uint16_t i = 1; i < TEST_NUM_FREQS; i++) {
+    const float ratio = GOERTZEL_BIN_LUT[i].target_freq / GOERTZEL_BIN_LUT[i - 1].target_freq;
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, powf(2.0f, 1.0f / 12.0f), ratio);
+    TEST_ASSERT_TRUE(GOERTZEL_BIN_LUT[i].block_size <= GOERTZEL_BIN_LUT[i - 1].block_size);
+    TEST_ASSERT_EQUAL_UINT32(0, GOERTZEL_BIN_LUT[i].block_size % 4);
+  }
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_lut_matches_build_configuration);
+  RUN_TEST(test_window_matches_runtime);
+  RUN_TEST(test_bins_match_runtime);
+  RUN_TEST(test_bins_are_a_half_step_ladder);
+  return UNITY_END();
+}
@@ -29,7 +29,6 @@ void audio_task(void* param) {
 
 void setUp(void) {
     init_audio_data_sync();
-    init_window_lookup();
     init_goertzel_constants_musical();
     init_params();
     init_pattern_registry();
@@ -0,0 +1,166 @@
+// Harmonic/percussive split tests
+// Running time median vs a brute-force median, the mask on a sustained tone
+// and on a broadband hit, the energy split, and that the flux of the
+// percussive part follows the hits of a clip whose sustained partials swell.
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include <algorithm>
+#include "../../src/audio/hpss.h"
+
+#define TEST_BINS 64
+
+static HpssState state;
+static float mask[TEST_BINS];
+
+static uint32_t rng_state = 1;
+
+// Uniform in [0, 1)
+static float rng_uniform() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return (rng_state >> 8) * (1.0f / 16777216.0f);
+}
+
+static float brute_median(float* values, int count) {
+  std::sort(values, values + count);
+  return (count & 1) ? values[count / 2] : 0.5f * (values[count / 2 - 1] + values[count / 2]);
+}
+
+void setUp(void) {
+  hpss_init(&state, TEST_BINS);
+}
+void tearDown(void) {}
+
+void test_running_median_matches_brute_force(void) {
+  static float frames[400][TEST_BINS];
+  float p, h;
+  for (int n = 0; n < 400; n++) {
+    for (int i = 0; i < TEST_BINS; i++) {
+      // Quantised so repeated values exercise the delete search
+      frames[n][i] = floorf(rng_uniform() * 8.0f) / 8.0f;
+    }
+    hpss_process(&state, frames[n], mask, &p, &h);
+
+    const int count = std::min(n + 1, HPSS_TIME_FRAMES);
+    for (int i = 0; i < TEST_BINS; i++) {
+      float window[HPSS_TIME_FRAMES];
+      for (int k = 0; k < count; k++) {
+        window[k] = frames[n - k][i];
+      }
+      TEST_ASSERT_EQUAL_FLOAT(brute_median(window, count), hpss_harmonic(&state, i));
+    }
+  }
+}
+
+void test_sustained_tone_is_harmonic(void) {
+  float frame[TEST_BINS] = {0};
+  frame[20] = 0.8f;
+  float p, h;
+  for (int n = 0; n < HPSS_TIME_FRAMES; n++) {
+    hpss_process(&state, frame, mask, &p, &h);
+  }
+  TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, mask[20]);
+  TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.8f / TEST_BINS, h);
+  TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, p);
+}
+
+void test_broadband_hit_is_percussive(void) {
+  float quiet[TEST_BINS];
+  for (int i = 0; i < TEST_BINS; i++) quiet[i] = 0.01f;
+  float p, h;
+  for (int n = 0; n < HPSS_TIME_FRAMES; n++) {
+    hpss_process(&state, quiet, mask, &p, &h);
+  }
+
+  float hit[TEST_BINS];
+  for (int i = 0; i < TEST_BINS; i++) hit[i] = (i < 32) ? 0.9f : 0.01f;
+  hpss_process(&state, hit, mask, &p, &h);
+  for (int i = 2; i < 30; i++) {
+    TEST_ASSERT_GREATER_THAN_FLOAT(0.99f, mask[i]);
+  }
+  TEST_ASSERT_GREATER_THAN_FLOAT(h, p);
+}
+
+// The parts add up to the frame, the mask stays in 0..1, silence splits to zero
+void test_energies_partition_the_frame(void) {
+  float p, h;
+  for (int n = 0; n < 50; n++) {
+    float frame[TEST_BINS];
+    float mean = 0.0f;
+    for (int i = 0; i < TEST_BINS; i++) {
+      frame[i] = rng_uniform();
+      mean += frame[i];
+    }
+    mean /= TEST_BINS;
+    hpss_process(&state, frame, mask, &p, &h);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, mean, p + h);
+    for (int i = 0; i < TEST_BINS; i++) {
+      TEST_ASSERT_TRUE(mask[i] >= 0.0f && mask[i] <= 1.0f);
+    }
+  }
+
+  float silence[TEST_BINS] = {0};
+  hpss_init(&state, TEST_BINS);
+  hpss_process(&state, silence, mask, &p, &h);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, p);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, h);
+}
+
+// Swelling sustained partials plus a broadband hit every 25 ticks (120 BPM at
+// 50 Hz): novelty as update_novelty() computes it (positive flux, mean over
+// bins). The percussive flux puts most of its energy on the hit ticks.
+void test_percussive_flux_follows_hits(void) {
+  float last_raw[TEST_BINS] = {0};
+  float last_perc[TEST_BINS] = {0};
+  float raw_on = 0.0f, raw_off = 0.0f, perc_on = 0.0f, perc_off = 0.0f;
+  float p, h;
+
+  for (int n = 0; n < 500; n++) {
+    const bool hit = (n % 25) == 0;
+    float frame[TEST_BINS];
+    for (int i = 0; i < TEST_BINS; i++) {
+      frame[i] = 0.02f;
+    }
+    const int partials[] = {12, 19, 24, 31, 36};
+    for (int k = 0; k < 5; k++) {
+      frame[partials[k]] = 0.5f + 0.3f * sinf(n * 0.7f + k);
+    }
+    if (hit) {
+      for (int i = 0; i < TEST_BINS; i++) frame[i] += 0.4f;
+    }
+    hpss_process(&state, frame, mask, &p, &h);
+
+    float raw = 0.0f, perc = 0.0f;
+    for (int i = 0; i < TEST_BINS; i++) {
+      raw += fmaxf(0.0f, frame[i] - last_raw[i]);
+      perc += fmaxf(0.0f, frame[i] * mask[i] - last_perc[i]);
+      last_raw[i] = frame[i];
+      last_perc[i] = frame[i] * mask[i];
+    }
+    if (n < 50) continue;
+    if (hit) {
+      raw_on += raw;
+      perc_on += perc;
+    } else {
+      raw_off += raw;
+      perc_off += perc;
+    }
+  }
+
+  // Swell flux between hits mostly gone, hit flux mostly kept
+  TEST_ASSERT_LESS_THAN_FLOAT(0.1f * raw_off, perc_off);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.5f * raw_on, perc_on);
+  TEST_ASSERT_GREATER_THAN_FLOAT(raw_on / (raw_on + raw_off), perc_on / (perc_on + perc_off));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_running_median_matches_brute_force);
+  RUN_TEST(test_sustained_tone_is_harmonic);
+  RUN_TEST(test_broadband_hit_is_percussive);
+  RUN_TEST(test_energies_partition_the_frame);
+  RUN_TEST(test_percussive_flux_follows_hits);
+  return UNITY_END();
+}
@@ -55,7 +55,6 @@ void test_audio_capture() {
     Serial.println("\n=== TEST 2: Audio Capture (Read 100 Samples) ===");
 
     init_i2s_microphone();
-    init_window_lookup();
     init_goertzel_constants_musical();
 
     vTaskDelay(pdMS_TO_TICKS(500));
@@ -107,7 +106,6 @@ void test_fft_accuracy() {
     Serial.println("\n=== TEST 3: FFT Accuracy (Frequency Bin Response) ===");
 
     init_i2s_microphone();
-    init_window_lookup();
     init_goertzel_constants_musical();
     init_audio_data_sync();
 
@@ -180,7 +178,6 @@ void test_audio_latency() {
     Serial.println("\n=== TEST 4: Audio-to-LED Latency (<20ms) ===");
 
     init_i2s_microphone();
-    init_window_lookup();
     init_goertzel_constants_musical();
     init_audio_data_sync();
     init_pattern_registry();
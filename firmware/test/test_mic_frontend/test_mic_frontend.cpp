@@ -0,0 +1,135 @@
+// Microphone front end tests
+// Checks the fused conversion against the original acquire_sample_chunk()
+// conversion (bit-exact with the DC blocker bypassed), and the DC blocker
+// against a double-precision reference.
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include "../../src/audio/mic_frontend.h"
+
+#define TEST_SAMPLE_RATE 12800
+#define TEST_CHUNK_SIZE 64
+#define TEST_CHUNKS 64
+#define TEST_WORDS (TEST_CHUNK_SIZE * TEST_CHUNKS)
+
+static uint32_t raw_words[TEST_WORDS];
+static float out[TEST_WORDS];
+static float expected[TEST_WORDS];
+static MicFrontend fe;
+
+// SPH0645-format slot words: 18-bit sample left-aligned in 32 bits, a
+// realistic DC offset, a tone, LCG noise in every bit below the sample,
+// and runs pinned at both clamp edges and the extreme slot values
+static void build_raw_words() {
+  uint32_t lcg = 0x1234567u;
+  for (int i = 0; i < TEST_WORDS; i++) {
+    lcg = lcg * 1664525u + 1013904223u;
+    int32_t sample = -6640 + (int32_t)(40000.0 * sin(2.0 * M_PI * 440.0 * i / TEST_SAMPLE_RATE)) +
+                     (int32_t)((lcg >> 20) & 0x3ff) - 512;
+    if (i / 512 == 3) sample = 140000;    // Above +clamp after trim
+    if (i / 512 == 5) sample = -140000;   // Below -clamp after trim
+    raw_words[i] = ((uint32_t)sample << 14) | (lcg & 0x3fff);
+  }
+  raw_words[100] = 0x7fffffffu;
+  raw_words[101] = 0x80000000u;
+  raw_words[102] = 0x00000000u;
+  raw_words[103] = 0xffffffffu;
+}
+
+// The conversion acquire_sample_chunk() did before the fused front end:
+// per-sample shift/trim/clamp/bias loop, then dsps_mulc_f32 by recip_scale
+static void legacy_convert(const uint32_t* words, float* dest, int count) {
+  const float recip_scale = 1.0 / 131072.0;
+  for (int i = 0; i < count; i++) {
+    int32_t v = (((int32_t)words[i]) >> 14) + 7000;
+    v = v < (int32_t)-131072 ? (int32_t)-131072 : v;
+    v = v > (int32_t)131072 ? (int32_t)131072 : v;
+    dest[i] = v - 360;
+  }
+  for (int i = 0; i < count; i++) dest[i] = dest[i] * recip_scale;
+}
+
+void setUp(void) {
+  build_raw_words();
+}
+
+void tearDown(void) {}
+
+void test_bypass_is_bit_exact_with_legacy_conversion(void) {
+  legacy_convert(raw_words, expected, TEST_WORDS);
+  mic_frontend_init(&fe, TEST_SAMPLE_RATE, 0.0f, 1.0f);
+  for (int c = 0; c < TEST_CHUNKS; c++) {
+    mic_frontend_process(&fe, raw_words + c * TEST_CHUNK_SIZE, out + c * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE);
+  }
+  TEST_ASSERT_EQUAL_MEMORY(expected, out, sizeof(out));
+}
+
+void test_in_place_matches_out_of_place(void) {
+  mic_frontend_init(&fe, TEST_SAMPLE_RATE, MIC_FRONTEND_DC_CUTOFF_HZ, 1.0f);
+  mic_frontend_process(&fe, raw_words, expected, TEST_WORDS);
+
+  static uint32_t buffer[TEST_WORDS];
+  memcpy(buffer, raw_words, sizeof(buffer));
+  mic_frontend_init(&fe, TEST_SAMPLE_RATE, MIC_FRONTEND_DC_CUTOFF_HZ, 1.0f);
+  for (int c = 0; c < TEST_CHUNKS; c++) {
+    uint32_t* chunk = buffer + c * TEST_CHUNK_SIZE;
+    mic_frontend_process(&fe, chunk, reinterpret_cast<float*>(chunk), TEST_CHUNK_SIZE);
+  }
+  TEST_ASSERT_EQUAL_MEMORY(expected, buffer, sizeof(buffer));
+}
+
+void test_dc_blocker_matches_reference(void) {
+  legacy_convert(raw_words, expected, TEST_WORDS);
+  const double gain = 2.0;
+  const double pole = exp(-2.0 * M_PI * MIC_FRONTEND_DC_CUTOFF_HZ / TEST_SAMPLE_RATE);
+  double x1 = 0.0, y1 = 0.0;
+  for (int i = 0; i < TEST_WORDS; i++) {
+    double x = expected[i] * gain;
+    double y = x - x1 + pole * y1;
+    x1 = x;
+    y1 = y;
+    expected[i] = (float)y;
+  }
+
+  mic_frontend_init(&fe, TEST_SAMPLE_RATE, MIC_FRONTEND_DC_CUTOFF_HZ, (float)gain);
+  for (int c = 0; c < TEST_CHUNKS; c++) {
+    mic_frontend_process(&fe, raw_words + c * TEST_CHUNK_SIZE, out + c * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE);
+  }
+  // Direct form II carries the blocker's DC gain (1 / (1 - R), ~680x) in
+  // its state, so the full-scale clamp runs cost ~1e-4 FS of rounding; still
+  // below the SPH0645's 65 dB noise floor
+  float max_error = 0.0f;
+  for (int i = 0; i < TEST_WORDS; i++) {
+    max_error = fmaxf(max_error, fabsf(expected[i] - out[i]));
+  }
+  TEST_ASSERT_FLOAT_WITHIN(2e-4f, 0.0f, max_error);
+}
+
+void test_dc_blocker_removes_offset(void) {
+  // Constant input: a pure DC offset of 0.05 full scale after conversion
+  static uint32_t dc_words[TEST_WORDS];
+  for (int i = 0; i < TEST_WORDS; i++) dc_words[i] = (uint32_t)((6554 - 7000 + 360) * (1 << 14));
+
+  mic_frontend_init(&fe, TEST_SAMPLE_RATE, MIC_FRONTEND_DC_CUTOFF_HZ, 1.0f);
+  for (int pass = 0; pass < 4; pass++) {  // ~1.3 s, several time constants
+    mic_frontend_process(&fe, dc_words, out, TEST_WORDS);
+  }
+  for (int i = TEST_WORDS - TEST_CHUNK_SIZE; i < TEST_WORDS; i++) {
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, out[i]);
+  }
+
+  mic_frontend_reset(&fe);
+  mic_frontend_process(&fe, dc_words, out, 1);
+  TEST_ASSERT_FLOAT_WITHIN(1e-6f, 6554.0f / 131072.0f, out[0]);  // Step passes until the blocker settles
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bypass_is_bit_exact_with_legacy_conversion);
+  RUN_TEST(test_in_place_matches_out_of_place);
+  RUN_TEST(test_dc_blocker_matches_reference);
+  RUN_TEST(test_dc_blocker_removes_offset);
+  return UNITY_END();
+}
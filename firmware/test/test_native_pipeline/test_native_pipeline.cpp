@@ -0,0 +1,224 @@
+// Native pipeline smoke tests (env:native)
+// Drives the real audio path (fake I2S -> Goertzel -> tempo) and every
+// registered pattern through the color pipeline and transmit_leds() on host.
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <Arduino.h>
+#include <FastLED.h>
+#include "host_runtime.h"
+#include "../../src/audio/goertzel.h"
+#include "../../src/led_driver.h"
+#include "../../src/pattern_execution.h"
+#include "../../src/pattern_registry.h"
+#include "../../src/pattern_audio_interface.h"
+
+#define TEST_TONE_HZ 440.0f
+#define TEST_AUDIO_STEPS 400
+
+struct ToneSource {
+  float freq_hz;
+  float amplitude;
+  uint64_t sample_index;
+};
+
+static ToneSource tone = {TEST_TONE_HZ, 0.25f, 0};
+
+static size_t tone_source(uint32_t* dest, size_t words, void* ctx) {
+  ToneSource* t = static_cast<ToneSource*>(ctx);
+  for (size_t i = 0; i < words; i++, t->sample_index++) {
+    float phase = 6.2831853f * t->freq_hz * (float)t->sample_index / AUDIO_CAPTURE_RATE_HZ;
+    dest[i] = host_i2s_word(t->amplitude * sinf(phase));
+  }
+  return words;
+}
+
+// Advance the pinned clock by one chunk per step, as the I2S DMA would
+static void run_audio(int steps) {
+  const int64_t chunk_us = (int64_t)AUDIO_CHUNK_SIZE * 1000000 / AUDIO_SAMPLE_RATE_HZ;
+  for (int i = 0; i < steps; i++) {
+    hal_advance_time_us(chunk_us);
+    host_audio_step();
+  }
+}
+
+// Byte-array warm-start store standing in for NVS
+struct MemoryStore {
+  uint8_t data[1024];
+  size_t length;
+};
+
+static MemoryStore warm_start_memory;
+
+static size_t memory_read(void* context, uint8_t* buffer, size_t capacity) {
+  MemoryStore* m = static_cast<MemoryStore*>(context);
+  if (m->length <= capacity) memcpy(buffer, m->data, m->length);
+  return m->length;
+}
+
+static bool memory_write(void* context, const uint8_t* data, size_t length) {
+  MemoryStore* m = static_cast<MemoryStore*>(context);
+  if (length > sizeof(m->data)) return false;
+  memcpy(m->data, data, length);
+  m->length = length;
+  return true;
+}
+
+static const AudioWarmStartStore warm_start_store = {&warm_start_memory, memory_read, memory_write};
+
+static bool leds_finite() {
+  for (int i = 0; i < NUM_LEDS; i++) {
+    if (!std::isfinite(leds[i].r) || !std::isfinite(leds[i].g) || !std::isfinite(leds[i].b)) return false;
+  }
+  return true;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_i2s_word_round_trip(void) {
+  const float values[] = {0.0f, 0.1f, -0.1f, 0.5f, -0.9f};
+  for (float v : values) {
+    int32_t raw = (int32_t)host_i2s_word(v);
+    float back = (float)(((raw >> 14) + 7000) - 360) / 131072.0f;
+    TEST_ASSERT_FLOAT_WITHIN(1.0f / 131072.0f, v, back);
+  }
+}
+
+void test_tone_peaks_at_matching_bin(void) {
+  hal_i2s_set_source(tone_source, &tone);
+  run_audio(TEST_AUDIO_STEPS);
+
+  uint16_t peak = 0;
+  for (uint16_t i = 1; i < NUM_FREQS; i++) {
+    if (spectrogram[i] > spectrogram[peak]) peak = i;
+  }
+  TEST_ASSERT_FLOAT_WITHIN(TEST_TONE_HZ * 0.06f, TEST_TONE_HZ, frequencies_musical[peak].target_freq);
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.0f, audio_level);
+}
+
+void test_analysis_profiles_keep_tone_peak(void) {
+  hal_i2s_set_source(tone_source, &tone);
+  for (uint8_t p = 0; p < ANALYSIS_PROFILE_COUNT; p++) {
+    TEST_ASSERT_TRUE(set_analysis_profile(p));
+    run_audio(TEST_AUDIO_STEPS);
+
+    uint16_t peak = 0;
+    for (uint16_t i = 1; i < NUM_FREQS; i++) {
+      if (spectrogram[i] > spectrogram[peak]) peak = i;
+    }
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(TEST_TONE_HZ * 0.06f, TEST_TONE_HZ, frequencies_musical[peak].target_freq,
+                                     ANALYSIS_PROFILES[p].name);
+    const AnalysisProfileStats stats = get_analysis_profile_stats(p);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(TEST_AUDIO_STEPS, stats.frames);
+  }
+  TEST_ASSERT_FALSE(set_analysis_profile(ANALYSIS_PROFILE_COUNT));
+  TEST_ASSERT_TRUE(set_analysis_profile(ANALYSIS_PROFILE_STANDARD));
+  run_audio(1);
+  TEST_ASSERT_EQUAL_UINT8(ANALYSIS_PROFILE_STANDARD, get_analysis_profile());
+}
+
+void test_all_patterns_render(void) {
+  hal_i2s_set_source(tone_source, &tone);
+  for (uint8_t p = 0; p < g_num_patterns; p++) {
+    TEST_ASSERT_TRUE(select_pattern(p));
+    for (int frame = 0; frame < 8; frame++) {
+      run_audio(2);
+      host_render_frame(frame * 0.01f);
+      TEST_ASSERT_TRUE_MESSAGE(leds_finite(), g_pattern_registry[p].name);
+    }
+  }
+}
+
+// Every audio frame lands in the shared history, stamped into the payload
+void test_spectrogram_history_follows_frames(void) {
+  hal_i2s_set_source(tone_source, &tone);
+  run_audio(4);
+  const uint32_t before = spectrogram_history_count(&spectrogram_history);
+  run_audio(10);
+  TEST_ASSERT_EQUAL_UINT32(before + 10, spectrogram_history_count(&spectrogram_history));
+  TEST_ASSERT_EQUAL_UINT32(before + 9, audio_back.payload.history_frame);
+
+  uint8_t row[SPECTROGRAM_HISTORY_BINS];
+  TEST_ASSERT_TRUE(spectrogram_history_read(&spectrogram_history, audio_back.payload.history_frame, 0, row));
+  for (uint16_t i = 0; i < NUM_FREQS; i++) {
+    TEST_ASSERT_FLOAT_WITHIN(0.5f / 255.0f + 1e-6f, fminf(audio_back.payload.spectrogram_smooth[i], 1.0f),
+                             row[i] / 255.0f);
+  }
+}
+
+// The published band features equal the per-call band sums on the same frame
+void test_band_features_match_band_sums(void) {
+  hal_i2s_set_source(tone_source, &tone);
+  for (int step = 0; step < 20; step++) {
+    run_audio(5);
+    const AudioDataSnapshot& audio = audio_back;
+    TEST_ASSERT_TRUE(AUDIO_BASS() == get_audio_band_energy(audio, 0, 8));
+    TEST_ASSERT_TRUE(AUDIO_MIDS() == get_audio_band_energy(audio, 16, 32));
+    TEST_ASSERT_TRUE(AUDIO_TREBLE() == get_audio_band_energy(audio, 48, 63));
+    TEST_ASSERT_TRUE(AUDIO_KICK() == get_audio_band_energy(audio, KICK_START, KICK_END));
+    TEST_ASSERT_TRUE(AUDIO_SNARE() == get_audio_band_energy(audio, SNARE_START, SNARE_END));
+    TEST_ASSERT_TRUE(AUDIO_VOCAL() == get_audio_band_energy(audio, VOCAL_START, VOCAL_END));
+    TEST_ASSERT_TRUE(AUDIO_HATS() == get_audio_band_energy(audio, HATS_START, HATS_END));
+    TEST_ASSERT_TRUE(AUDIO_BASS_ABS() == get_audio_band_energy_absolute(audio, 0, 8));
+    TEST_ASSERT_TRUE(AUDIO_MIDS_ABS() == get_audio_band_energy_absolute(audio, 16, 32));
+    TEST_ASSERT_TRUE(AUDIO_TREBLE_ABS() == get_audio_band_energy_absolute(audio, 48, 63));
+  }
+}
+
+// A finished calibration and a changed gain are written by the audio task once
+// the input goes silent and restored by the next boot; a corrupted record is
+// refused without side effects
+void test_warm_start_restores_calibration(void) {
+  set_audio_warm_start_store(&warm_start_store);
+  hal_i2s_set_source(tone_source, &tone);
+  start_noise_calibration();
+  run_audio(NOISE_CALIBRATION_FRAMES + 1);
+  TEST_ASSERT_EQUAL_UINT32(0, noise_calibration_active_frames_remaining);
+
+  // The tone reads as music, so the requested save waits for silence
+  configuration.microphone_gain = 1.5f;
+  save_config();
+  run_audio(1);
+  TEST_ASSERT_FALSE(silence_detected);
+  TEST_ASSERT_EQUAL_UINT32(0, warm_start_memory.length);
+
+  silence_detected = true;
+  service_audio_warm_start(millis());
+  TEST_ASSERT_EQUAL_UINT32(AUDIO_WARM_START_BLOB_SIZE, warm_start_memory.length);
+
+  float calibrated[NUM_FREQS];
+  memcpy(calibrated, noise_spectrum, sizeof(calibrated));
+  TEST_ASSERT_GREATER_THAN_FLOAT(0.0f, calibrated[0] + calibrated[NUM_FREQS / 2]);
+
+  // Cold boot state, then restore
+  memset(noise_spectrum, 0, sizeof(float) * NUM_FREQS);
+  configuration.microphone_gain = 1.0f;
+  TEST_ASSERT_TRUE(load_audio_warm_start());
+  TEST_ASSERT_EQUAL_FLOAT_ARRAY(calibrated, noise_spectrum, NUM_FREQS);
+  TEST_ASSERT_EQUAL_FLOAT(1.5f, configuration.microphone_gain);
+
+  warm_start_memory.data[sizeof(AudioWarmStartHeader) + 8] ^= 0xFF;
+  configuration.microphone_gain = 1.0f;
+  TEST_ASSERT_FALSE(load_audio_warm_start());
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, configuration.microphone_gain);
+
+  memset(noise_spectrum, 0, sizeof(float) * NUM_FREQS);
+  set_audio_warm_start_store(nullptr);
+}
+
+int main(int argc, char** argv) {
+  hal_set_time_us(1000000);
+  host_runtime_init();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_i2s_word_round_trip);
+  RUN_TEST(test_tone_peaks_at_matching_bin);
+  RUN_TEST(test_analysis_profiles_keep_tone_peak);
+  RUN_TEST(test_all_patterns_render);
+  RUN_TEST(test_spectrogram_history_follows_frames);
+  RUN_TEST(test_band_features_match_band_sums);
+  RUN_TEST(test_warm_start_restores_calibration);
+  return UNITY_END();
+}
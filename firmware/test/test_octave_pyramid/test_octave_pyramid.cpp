@@ -0,0 +1,195 @@
+// Octave pyramid tests
+// The half-band cascade (pass band, alias rejection, chunking), the bin-to-level
+// mapping over the real bin layout, each bin's frequency response against the
+// full-rate block engine, and the per-frame cost of both.
+
+#include <unity.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <stdint.h>
+#include "../../src/audio/octave_pyramid.h"
+#include "../test_utils/goertzel_fixture.h"
+
+#define TEST_RATE FIXTURE_SAMPLE_RATE
+#define TEST_BINS FIXTURE_NOTE_BINS
+#define TEST_HISTORY 4096
+
+static float storage[TEST_HISTORY];
+static SampleRing ring;
+static GoertzelBlockBin bins[TEST_BINS];
+static OctavePyramid pyramid;
+static float magnitudes[TEST_BINS];
+static float reference[TEST_BINS];
+
+// Sine (plus optional LCG noise) into both the full-rate ring and the pyramid, in chunks
+static void feed(double hz, double amplitude, float noise, uint32_t chunk, double phase = 0.0) {
+  sample_ring_init(&ring, storage, TEST_HISTORY);
+  TEST_ASSERT_TRUE(octave_pyramid_init(&pyramid, bins, TEST_BINS, TEST_RATE, OCTAVE_PYRAMID_MAX_LEVELS));
+  FixtureTone tone = fixture_tone(hz, amplitude, noise, phase);
+  float samples[256];
+  for (uint32_t n = 0; n < 2 * TEST_HISTORY; n += chunk) {
+    fixture_tone_fill(&tone, samples, chunk);
+    sample_ring_write(&ring, samples, chunk);
+    octave_pyramid_push(&pyramid, samples, chunk);
+  }
+}
+
+// Sine amplitude of a level's newest 256 samples, from their RMS
+static float level_amplitude(uint8_t level) {
+  const SampleRing* r = octave_pyramid_level(&pyramid, level);
+  double power = 0.0;
+  for (uint32_t age = 0; age < 256; age++) {
+    power += sample_ring_at(r, age) * sample_ring_at(r, age);
+  }
+  return (float)sqrt(2.0 * power / 256);
+}
+
+void setUp(void) {
+  fixture_note_bins(bins, TEST_BINS);
+}
+
+void tearDown(void) {}
+
+void test_halfband_passes_and_rejects(void) {
+  // 0.15 fs of level 1's input (the pass band edge) passes every level
+  feed(0.15 * TEST_RATE, 0.5, 0.0f, 64);
+  TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.5f, level_amplitude(1));
+  feed(0.15 * TEST_RATE / 8, 0.5, 0.0f, 64);
+  TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.5f, level_amplitude(4));
+  // Above 0.35 fs would alias into the pass band of the level below: rejected
+  feed(0.36 * TEST_RATE, 0.5, 0.0f, 64);
+  TEST_ASSERT_TRUE(level_amplitude(1) < 0.5f * 0.001f);
+  feed(0.36 * TEST_RATE / 4, 0.5, 0.0f, 64);
+  TEST_ASSERT_TRUE(level_amplitude(3) < 0.5f * 0.001f);
+}
+
+void test_chunking_does_not_change_the_levels(void) {
+  feed(330.0, 0.5, 0.2f, 64);
+  float expected[128];
+  const SampleRing* r = octave_pyramid_level(&pyramid, 3);
+  for (uint32_t age = 0; age < 128; age++) expected[age] = sample_ring_at(r, age);
+  feed(330.0, 0.5, 0.2f, 16);
+  for (uint32_t age = 0; age < 128; age++) TEST_ASSERT_EQUAL_FLOAT(expected[age], sample_ring_at(r, age));
+  TEST_ASSERT_NULL(octave_pyramid_level(&pyramid, 0));
+  TEST_ASSERT_NULL(octave_pyramid_level(&pyramid, OCTAVE_PYRAMID_MAX_LEVELS));
+}
+
+void test_bins_map_to_the_coarsest_sufficient_level(void) {
+  TEST_ASSERT_TRUE(octave_pyramid_init(&pyramid, bins, TEST_BINS, TEST_RATE, OCTAVE_PYRAMID_MAX_LEVELS));
+  TEST_ASSERT_EQUAL_UINT8(OCTAVE_PYRAMID_MAX_LEVELS - 1, pyramid.bin_level[0]);
+  TEST_ASSERT_EQUAL_UINT8(0, pyramid.bin_level[TEST_BINS - 1]);
+  uint32_t full_rate_samples = 0;
+  uint32_t pyramid_samples = 0;
+  for (uint16_t b = 0; b < TEST_BINS; b++) {
+    const uint8_t l = pyramid.bin_level[b];
+    if (b > 0) TEST_ASSERT_TRUE(l <= pyramid.bin_level[b - 1]);
+    // Alias-free at the chosen level, and the next coarser one would not be
+    const double level_rate = (double)TEST_RATE / (1u << l);
+    const double edge = fixture_bin_centre_hz(bins[b]) + (double)TEST_RATE / bins[b].block_size;
+    // Pass band in float, as octave_pyramid_init() compares it (bin 54's edge sits on it)
+    const float passband_hz = OCTAVE_PYRAMID_PASSBAND * TEST_RATE / (1u << l);
+    TEST_ASSERT_TRUE(edge <= passband_hz);
+    if (l + 1 < OCTAVE_PYRAMID_MAX_LEVELS) TEST_ASSERT_TRUE(edge > passband_hz / 2);
+    // Same centre and window span, a 2^l shorter block
+    TEST_ASSERT_INT_WITHIN(1, bins[b].block_size >> l, pyramid.bins[b].block_size);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 4096.0f, pyramid.bins[b].window_step * pyramid.bins[b].block_size);
+    const double centre = acos(pyramid.bins[b].coeff / 2.0) * level_rate / (2.0 * M_PI);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, (float)fixture_bin_centre_hz(bins[b]), (float)centre);
+    full_rate_samples += bins[b].block_size;
+    pyramid_samples += pyramid.bins[b].block_size;
+  }
+  printf("  %u full-rate block samples -> %u on the pyramid\n", (unsigned)full_rate_samples,
+         (unsigned)pyramid_samples);
+  TEST_ASSERT_TRUE(pyramid_samples * 4 < full_rate_samples);
+
+  // One level keeps every bin at full rate and reads exactly as the block engine
+  TEST_ASSERT_TRUE(octave_pyramid_init(&pyramid, bins, TEST_BINS, TEST_RATE, 1));
+  feed(440.0, 0.5, 0.2f, 64);
+  TEST_ASSERT_TRUE(octave_pyramid_init(&pyramid, bins, TEST_BINS, TEST_RATE, 1));
+  octave_pyramid_magnitudes(&pyramid, &ring, window_lookup, 4, magnitudes);
+  for (uint16_t b = 0; b < TEST_BINS; b++) {
+    TEST_ASSERT_EQUAL_FLOAT(goertzel_block_magnitude(&ring, 1, window_lookup, &bins[b]), magnitudes[b]);
+  }
+  TEST_ASSERT_FALSE(octave_pyramid_init(&pyramid, bins, TEST_BINS, TEST_RATE, OCTAVE_PYRAMID_MAX_LEVELS + 1));
+}
+
+// A real tone reads as its response plus the window's leakage from the
+// negative-frequency image, which adds or cancels with the tone's phase at the
+// block start. The pyramid's blocks end earlier (half-band delay) than the
+// full-rate ones, so compare power averaged over phases 0, pi/4, pi/2, 3pi/4,
+// where the image's cross term cancels exactly.
+static void phase_averaged_response(uint16_t bin, double hz, float* expected, float* actual) {
+  double expected_power = 0.0;
+  double actual_power = 0.0;
+  for (int p = 0; p < 4; p++) {
+    feed(hz, 0.5, 0.0f, 64, p * M_PI / 4.0);
+    const double e = goertzel_block_magnitude(&ring, 1, window_lookup, &bins[bin]);
+    const double a = octave_pyramid_magnitude(&pyramid, &ring, window_lookup, bin);
+    expected_power += e * e / 4.0;
+    actual_power += a * a / 4.0;
+  }
+  *expected = (float)sqrt(expected_power);
+  *actual = (float)sqrt(actual_power);
+}
+
+// Each bin's response to tones from two bandwidths below to two above its
+// centre, against the full-rate block engine's response to the same tones.
+// Block sizes that do not divide by 2^level are rounded, which stretches the
+// response by up to 0.5 / N; that shows most on the steep skirts.
+void test_bin_frequency_response_matches_block_engine(void) {
+  double worst = 0.0;
+  for (uint16_t b = 0; b < TEST_BINS; b++) {
+    const double centre = fixture_bin_centre_hz(bins[b]);
+    const double bandwidth = (double)TEST_RATE / bins[b].block_size;
+    float peak, actual;
+    phase_averaged_response(b, centre, &peak, &actual);
+    TEST_ASSERT_TRUE(peak > 0.35f);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f * peak, peak, actual);
+    for (int step = -8; step <= 8; step++) {
+      float expected;
+      phase_averaged_response(b, centre + step * bandwidth / 4.0, &expected, &actual);
+      const double error = fabs(actual - expected) / peak;
+      worst = fmax(worst, error);
+      TEST_ASSERT_TRUE(error < 0.03);
+    }
+  }
+  printf("  worst response difference %.4f of the bin's peak\n", worst);
+}
+
+void test_lanes_match_one_bin(void) {
+  feed(523.25, 0.4, 0.2f, 64);
+  octave_pyramid_magnitudes(&pyramid, &ring, window_lookup, 4, magnitudes);
+  for (uint16_t b = 0; b < TEST_BINS; b++) {
+    TEST_ASSERT_EQUAL_FLOAT(octave_pyramid_magnitude(&pyramid, &ring, window_lookup, b), magnitudes[b]);
+  }
+}
+
+void test_frame_cost(void) {
+  feed(440.0, 0.5, 0.2f, 64);
+  float chunk[64] = {0};
+  const int frames = 400;
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) {
+    octave_pyramid_push(&pyramid, chunk, 64);
+    octave_pyramid_magnitudes(&pyramid, &ring, window_lookup, 4, magnitudes);
+  }
+  const double pyramid_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+  start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) goertzel_block_magnitudes(&ring, 1, window_lookup, bins, TEST_BINS, 4, reference);
+  const double block_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+  printf("  octave pyramid x4 %.1f us/frame (push included), full-rate block x4 %.1f us/frame\n",
+         pyramid_us, block_us);
+  TEST_ASSERT_TRUE(pyramid_us < block_us);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_halfband_passes_and_rejects);
+  RUN_TEST(test_chunking_does_not_change_the_levels);
+  RUN_TEST(test_bins_map_to_the_coarsest_sufficient_level);
+  RUN_TEST(test_bin_frequency_response_matches_block_engine);
+  RUN_TEST(test_lanes_match_one_bin);
+  RUN_TEST(test_frame_cost);
+  return UNITY_END();
+}
@@ -0,0 +1,151 @@
+// Palette LUT cache tests
+// PaletteCache must reproduce the keyframe-search color_from_palette() bit for
+// bit, including progress wrap-around and palettes whose last keyframe is not 255.
+
+#include <unity.h>
+#include <cmath>
+#include <stdint.h>
+#include "../../src/lut/palette_lut.h"
+
+// Keyframe data copied from palettes.cpp: {position, R, G, B}
+static const uint8_t palette_sunset_real[] = {
+	0, 120, 0, 0,
+	22, 179, 22, 0,
+	51, 255, 104, 0,
+	85, 167, 22, 18,
+	135, 100, 0, 103,
+	198, 16, 0, 130,
+	255, 0, 0, 160
+};
+
+static const uint8_t palette_rivendell[] = {
+	0, 1, 14, 5,
+	101, 16, 36, 14,
+	165, 56, 68, 30,
+	242, 150, 156, 99,
+	255, 150, 156, 99
+};
+
+static const uint8_t palette_lava[] = {
+	0, 0, 0, 0,
+	46, 18, 0, 0,
+	96, 113, 0, 0,
+	108, 142, 3, 1,
+	119, 175, 17, 1,
+	146, 213, 44, 2,
+	174, 255, 82, 4,
+	188, 255, 115, 4,
+	202, 255, 156, 4,
+	218, 255, 203, 4,
+	234, 255, 255, 4,
+	244, 255, 255, 71,
+	255, 255, 255, 255
+};
+
+// Ends before 255: positions past the last keyframe fall back to entry 0
+static const uint8_t palette_short[] = {
+	10, 200, 10, 0,
+	128, 0, 90, 250,
+	200, 30, 30, 30
+};
+
+// Keyframe search as color_from_palette() did it before the cache
+static CRGBF reference_color(const uint8_t* data, uint8_t num_entries, float progress, float brightness) {
+	progress = fmodf(progress, 1.0f);
+	if (progress < 0.0f) progress += 1.0f;
+	uint8_t pos = (uint8_t)(progress * 255.0f);
+
+	uint8_t entry1_idx = 0, entry2_idx = 0;
+	uint8_t pos1 = 0, pos2 = 255;
+	for (uint8_t i = 0; i < num_entries - 1; i++) {
+		uint8_t p1 = data[i * 4 + 0];
+		uint8_t p2 = data[(i + 1) * 4 + 0];
+		if (pos >= p1 && pos <= p2) {
+			entry1_idx = i;
+			entry2_idx = i + 1;
+			pos1 = p1;
+			pos2 = p2;
+			break;
+		}
+	}
+
+	uint8_t r1 = data[entry1_idx * 4 + 1], g1 = data[entry1_idx * 4 + 2], b1 = data[entry1_idx * 4 + 3];
+	uint8_t r2 = data[entry2_idx * 4 + 1], g2 = data[entry2_idx * 4 + 2], b2 = data[entry2_idx * 4 + 3];
+
+	float blend = 0.0f;
+	if (pos2 > pos1) {
+		blend = (float)(pos - pos1) / (float)(pos2 - pos1);
+	}
+
+	float r = (r1 * (1.0f - blend) + r2 * blend) / 255.0f;
+	float g = (g1 * (1.0f - blend) + g2 * blend) / 255.0f;
+	float b = (b1 * (1.0f - blend) + b2 * blend) / 255.0f;
+	return {r * brightness, g * brightness, b * brightness};
+}
+
+static void assert_cache_matches(const uint8_t* data, uint8_t num_entries) {
+	PaletteCache cache;
+	cache.init(data, num_entries, 7);
+	TEST_ASSERT_TRUE(cache.initialized);
+
+	const float brightness[] = {0.0f, 0.05f, 0.37f, 1.0f, 1.6f};
+	for (int i = -2000; i <= 6000; i++) {
+		float progress = i * 0.000731f;
+		for (float bri : brightness) {
+			CRGBF expect = reference_color(data, num_entries, progress, bri);
+			CRGBF got = cache.get(progress, bri);
+			TEST_ASSERT_TRUE(expect.r == got.r && expect.g == got.g && expect.b == got.b);
+		}
+	}
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_sunset_real_bit_exact(void) {
+	assert_cache_matches(palette_sunset_real, sizeof(palette_sunset_real) / 4);
+}
+
+void test_rivendell_bit_exact(void) {
+	assert_cache_matches(palette_rivendell, sizeof(palette_rivendell) / 4);
+}
+
+void test_lava_bit_exact(void) {
+	assert_cache_matches(palette_lava, sizeof(palette_lava) / 4);
+}
+
+void test_short_palette_fallback_bit_exact(void) {
+	assert_cache_matches(palette_short, sizeof(palette_short) / 4);
+}
+
+void test_position_edges(void) {
+	TEST_ASSERT_EQUAL_UINT32(0, palette_position(0.0f));
+	TEST_ASSERT_EQUAL_UINT32(0, palette_position(1.0f));       // wraps
+	TEST_ASSERT_EQUAL_UINT32(254, palette_position(0.999f));
+	TEST_ASSERT_EQUAL_UINT32(127, palette_position(-0.5f));
+	TEST_ASSERT_EQUAL_UINT32(63, palette_position(2.25f));
+}
+
+void test_invalid_source_not_initialized(void) {
+	PaletteCache cache;
+	cache.init(nullptr, 4, 0);
+	TEST_ASSERT_FALSE(cache.initialized);
+	cache.init(palette_lava, 1, 0);
+	TEST_ASSERT_FALSE(cache.initialized);
+	cache.init(palette_lava, sizeof(palette_lava) / 4, 3);
+	TEST_ASSERT_TRUE(cache.initialized);
+	TEST_ASSERT_EQUAL_UINT32(3, cache.palette_id);
+	cache.clear();
+	TEST_ASSERT_FALSE(cache.initialized);
+}
+
+int main(int argc, char** argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_sunset_real_bit_exact);
+	RUN_TEST(test_rivendell_bit_exact);
+	RUN_TEST(test_lava_bit_exact);
+	RUN_TEST(test_short_palette_fallback_bit_exact);
+	RUN_TEST(test_position_edges);
+	RUN_TEST(test_invalid_source_not_initialized);
+	return UNITY_END();
+}
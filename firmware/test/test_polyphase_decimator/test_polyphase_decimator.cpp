@@ -0,0 +1,136 @@
+// Polyphase decimator tests
+// Sweeps tones through the 16 kHz and 32 kHz capture paths down to the
+// 12.8 kHz analysis rate: passband flatness, rejection of everything that
+// would alias below the analysis Nyquist, chunk-boundary continuity, and the
+// per-chunk cost.
+
+#include <unity.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <stdint.h>
+#include "../../src/audio/polyphase_decimator.h"
+
+#define TEST_OUT_RATE 12800
+#define TEST_OUT_CHUNK 64
+#define TEST_WARMUP_CHUNKS 4
+#define TEST_MEASURE_CHUNKS 40
+#define TEST_ALIAS_REJECTION_DB 55.0
+#define TEST_PASSBAND_EDGE_HZ 4000.0
+
+static PolyphaseDecimator dec;
+static float in[POLYPHASE_MAX_IN_CHUNK];
+static float out[TEST_OUT_CHUNK];
+
+// Output RMS relative to input RMS, in dB, for a unit sine at freq_hz
+static double tone_gain_db(uint32_t in_rate, double freq_hz) {
+  polyphase_decimator_reset(&dec);
+  uint64_t index = 0;
+  double power = 0.0;
+  for (int c = 0; c < TEST_WARMUP_CHUNKS + TEST_MEASURE_CHUNKS; c++) {
+    for (uint16_t i = 0; i < dec.in_chunk; i++, index++) {
+      in[i] = (float)sin(2.0 * M_PI * freq_hz * (double)index / in_rate);
+    }
+    polyphase_decimator_process(&dec, in, out);
+    if (c < TEST_WARMUP_CHUNKS) continue;
+    for (uint16_t i = 0; i < TEST_OUT_CHUNK; i++) power += (double)out[i] * out[i];
+  }
+  const double rms = sqrt(power / (TEST_MEASURE_CHUNKS * TEST_OUT_CHUNK));
+  return 20.0 * log10(fmax(rms, 1e-12) / sqrt(0.5));
+}
+
+static void sweep(uint32_t in_rate) {
+  TEST_ASSERT_TRUE(polyphase_decimator_init(&dec, in_rate, TEST_OUT_RATE, TEST_OUT_CHUNK));
+
+  for (double f = 50.0; f <= TEST_PASSBAND_EDGE_HZ; f += 150.0) {
+    TEST_ASSERT_FLOAT_WITHIN(0.1, 0.0, tone_gain_db(in_rate, f));
+  }
+
+  // Everything from the analysis Nyquist (plus the Kaiser transition
+  // rounding) up to the capture Nyquist would fold into the analyzed band
+  double worst_db = -300.0;
+  for (double f = 0.5 * TEST_OUT_RATE + 100.0; f < 0.5 * in_rate; f += 97.0) {
+    worst_db = fmax(worst_db, tone_gain_db(in_rate, f));
+  }
+  printf("  %u Hz capture: worst alias %.1f dB\n", (unsigned)in_rate, worst_db);
+  TEST_ASSERT_TRUE(worst_db < -TEST_ALIAS_REJECTION_DB);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_rejects_bad_ratios(void) {
+  TEST_ASSERT_FALSE(polyphase_decimator_init(&dec, 12800, 12800, TEST_OUT_CHUNK));   // Not a decimation
+  TEST_ASSERT_FALSE(polyphase_decimator_init(&dec, 44100, 12800, TEST_OUT_CHUNK));   // up = 128
+  TEST_ASSERT_FALSE(polyphase_decimator_init(&dec, 16000, 12800, 63));               // 63 * 5 / 4 not whole
+  TEST_ASSERT_FALSE(polyphase_decimator_init(&dec, 64000, 12800, 128));              // 640-sample input chunk
+}
+
+void test_chunk_sizes(void) {
+  TEST_ASSERT_TRUE(polyphase_decimator_init(&dec, 16000, TEST_OUT_RATE, TEST_OUT_CHUNK));
+  TEST_ASSERT_EQUAL_UINT16(80, dec.in_chunk);
+  TEST_ASSERT_EQUAL_UINT16(24, dec.taps_per_phase);
+  TEST_ASSERT_TRUE(polyphase_decimator_init(&dec, 32000, TEST_OUT_RATE, TEST_OUT_CHUNK));
+  TEST_ASSERT_EQUAL_UINT16(160, dec.in_chunk);
+  TEST_ASSERT_EQUAL_UINT16(48, dec.taps_per_phase);
+}
+
+void test_16k_sweep(void) {
+  sweep(16000);
+}
+
+void test_32k_sweep(void) {
+  sweep(32000);
+}
+
+void test_dc_passes_at_unity(void) {
+  TEST_ASSERT_TRUE(polyphase_decimator_init(&dec, 16000, TEST_OUT_RATE, TEST_OUT_CHUNK));
+  for (uint16_t i = 0; i < dec.in_chunk; i++) in[i] = 0.5f;
+  for (int c = 0; c < 3; c++) polyphase_decimator_process(&dec, in, out);
+  for (uint16_t i = 0; i < TEST_OUT_CHUNK; i++) TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0.5f, out[i]);
+}
+
+void test_in_place_matches_separate_output(void) {
+  TEST_ASSERT_TRUE(polyphase_decimator_init(&dec, 32000, TEST_OUT_RATE, TEST_OUT_CHUNK));
+  static PolyphaseDecimator twin;
+  twin = dec;
+  float chunk[POLYPHASE_MAX_IN_CHUNK];
+  for (int c = 0; c < 5; c++) {
+    for (uint16_t i = 0; i < dec.in_chunk; i++) {
+      in[i] = (float)sin(0.037 * (c * dec.in_chunk + i));
+      chunk[i] = in[i];
+    }
+    polyphase_decimator_process(&dec, in, out);
+    polyphase_decimator_process(&twin, chunk, chunk);
+    TEST_ASSERT_EQUAL_MEMORY(out, chunk, sizeof(out));
+  }
+}
+
+void test_chunk_cost(void) {
+  const uint32_t rates[] = {16000, 32000};
+  for (uint32_t rate : rates) {
+    TEST_ASSERT_TRUE(polyphase_decimator_init(&dec, rate, TEST_OUT_RATE, TEST_OUT_CHUNK));
+    for (uint16_t i = 0; i < dec.in_chunk; i++) in[i] = (float)sin(0.1 * i);
+    const int chunks = 20000;
+    auto start = std::chrono::steady_clock::now();
+    for (int c = 0; c < chunks; c++) polyphase_decimator_process(&dec, in, out);
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    const double per_chunk_ns = (double)ns / chunks;
+    printf("  %u Hz capture: %.0f ns/chunk, %u MACs/chunk\n", (unsigned)rate, per_chunk_ns,
+           (unsigned)(TEST_OUT_CHUNK * dec.taps_per_phase));
+    // A 64-sample chunk spans 5 ms; the decimator must be a tiny slice of it
+    TEST_ASSERT_TRUE(per_chunk_ns < 250000.0);
+  }
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_rejects_bad_ratios);
+  RUN_TEST(test_chunk_sizes);
+  RUN_TEST(test_16k_sweep);
+  RUN_TEST(test_32k_sweep);
+  RUN_TEST(test_dc_passes_at_unity);
+  RUN_TEST(test_in_place_matches_separate_output);
+  RUN_TEST(test_chunk_cost);
+  return UNITY_END();
+}
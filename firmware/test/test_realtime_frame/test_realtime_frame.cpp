@@ -0,0 +1,237 @@
+// Binary realtime frame codec round-trip tests
+// Encodes random telemetry sequences and checks the decoder reproduces the
+// quantized values, that deltas stay smaller than keyframes, and that the
+// decoder refuses deltas it cannot apply.
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include "../../src/realtime_frame.h"
+
+static RealtimeFrameEncoder enc;
+static RealtimeFrameDecoder dec;
+static uint8_t wire[REALTIME_FRAME_MAX_BYTES];
+
+static uint32_t rng_state = 2463534242u;
+
+static float next_unit() {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return (rng_state >> 8) / 16777216.0f;
+}
+
+static void random_frame(RealtimeFrameData* d) {
+  memset(d, 0, sizeof(*d));
+  d->fps = 100.0f + 80.0f * next_unit();
+  d->frame_time_us = (uint32_t)(4000 + 6000 * next_unit());
+  d->render_avg_us = 3000.0f * next_unit();
+  d->quantize_avg_us = 500.0f * next_unit();
+  d->rmt_wait_avg_us = 800.0f * next_unit();
+  d->rmt_tx_avg_us = 1200.0f * next_unit();
+  d->cpu_percent = 100.0f * next_unit();
+  d->memory_percent = 100.0f * next_unit();
+  d->memory_free_kb = (uint32_t)(300 * next_unit());
+  d->vu_level = next_unit();
+  d->vu_level_raw = next_unit();
+  d->tempo_confidence = next_unit();
+  d->locked_tempo_bpm = 60.0f + 120.0f * next_unit();
+  d->tempo_lock_state = (uint8_t)(next_unit() * 4);
+  for (int i = 0; i < REALTIME_FRAME_SPECTRUM_BINS; i++) d->spectrum[i] = next_unit();
+  for (int i = 0; i < REALTIME_FRAME_CHROMA_BINS; i++) d->chromagram[i] = next_unit();
+  d->brightness = next_unit();
+  d->softness = next_unit();
+  d->color = next_unit();
+  d->color_range = next_unit();
+  d->saturation = next_unit();
+  d->warmth = next_unit();
+  d->background = next_unit();
+  d->dithering = 1.0f;
+  d->speed = next_unit();
+  d->palette_id = (uint8_t)(next_unit() * 33);
+  d->custom_param_1 = next_unit();
+  d->custom_param_2 = next_unit();
+  d->custom_param_3 = next_unit();
+  d->current_pattern = (uint8_t)(next_unit() * 46);
+}
+
+// Decoded values must equal quantize -> dequantize of the input
+static void assert_matches_quantized(const RealtimeFrameData* in, const RealtimeFrameData* out) {
+  uint8_t a[REALTIME_FRAME_STATE_BYTES];
+  uint8_t b[REALTIME_FRAME_STATE_BYTES];
+  realtime_frame_quantize(in, a);
+  realtime_frame_quantize(out, b);
+  TEST_ASSERT_EQUAL_MEMORY(a, b, REALTIME_FRAME_STATE_BYTES);
+}
+
+void setUp(void) {
+  memset(&enc, 0, sizeof(enc));
+  memset(&dec, 0, sizeof(dec));
+  rng_state = 2463534242u;
+}
+
+void tearDown(void) {}
+
+void test_quantization_error_bounds(void) {
+  RealtimeFrameData in, out;
+  uint8_t state[REALTIME_FRAME_STATE_BYTES];
+  for (int n = 0; n < 200; n++) {
+    random_frame(&in);
+    realtime_frame_quantize(&in, state);
+    realtime_frame_dequantize(state, &out);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, in.fps, out.fps);
+    TEST_ASSERT_EQUAL_UINT32(in.frame_time_us, out.frame_time_us);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, in.render_avg_us, out.render_avg_us);
+    TEST_ASSERT_FLOAT_WITHIN(0.25f, in.cpu_percent, out.cpu_percent);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, in.locked_tempo_bpm, out.locked_tempo_bpm);
+    TEST_ASSERT_EQUAL_UINT8(in.tempo_lock_state, out.tempo_lock_state);
+    for (int i = 0; i < REALTIME_FRAME_SPECTRUM_BINS; i++) {
+      TEST_ASSERT_FLOAT_WITHIN(0.5f / 255.0f + 1e-6f, in.spectrum[i], out.spectrum[i]);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.5f / 255.0f + 1e-6f, in.brightness, out.brightness);
+    TEST_ASSERT_EQUAL_UINT8(in.palette_id, out.palette_id);
+    TEST_ASSERT_EQUAL_UINT8(in.current_pattern, out.current_pattern);
+  }
+}
+
+void test_out_of_range_values_saturate(void) {
+  RealtimeFrameData in, out;
+  uint8_t state[REALTIME_FRAME_STATE_BYTES];
+  random_frame(&in);
+  in.vu_level = 3.0f;
+  in.tempo_confidence = -1.0f;
+  in.spectrum[0] = NAN;
+  in.frame_time_us = 1000000;
+  in.fps = 1.0e6f;
+  realtime_frame_quantize(&in, state);
+  realtime_frame_dequantize(state, &out);
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, out.vu_level);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, out.tempo_confidence);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, out.spectrum[0]);
+  TEST_ASSERT_EQUAL_UINT32(65535, out.frame_time_us);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 6553.5f, out.fps);
+}
+
+void test_round_trip_sequence(void) {
+  RealtimeFrameData in, out;
+  random_frame(&in);
+  int keyframes = 0;
+  for (int n = 0; n < 300; n++) {
+    // Slowly varying telemetry: only a few fields move per frame
+    in.vu_level = next_unit();
+    in.spectrum[n % REALTIME_FRAME_SPECTRUM_BINS] = next_unit();
+    in.chromagram[n % REALTIME_FRAME_CHROMA_BINS] = next_unit();
+    if (n % 50 == 0) in.current_pattern = (uint8_t)(n / 50);
+
+    size_t len = realtime_frame_encode(&enc, &in, 1000u + n * 33u, wire, sizeof(wire));
+    TEST_ASSERT_TRUE(len >= REALTIME_FRAME_HEADER_BYTES);
+    if (wire[3] & REALTIME_FRAME_FLAG_KEYFRAME) keyframes++;
+
+    uint32_t ts = 0;
+    TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_OK, realtime_frame_decode(&dec, wire, len, &out, &ts));
+    TEST_ASSERT_EQUAL_UINT32(1000u + n * 33u, ts);
+    assert_matches_quantized(&in, &out);
+  }
+  // First frame plus one per keyframe interval
+  TEST_ASSERT_EQUAL_INT(1 + (300 - 1) / (REALTIME_FRAME_KEYFRAME_INTERVAL + 1), keyframes);
+}
+
+void test_delta_smaller_than_keyframe(void) {
+  RealtimeFrameData in;
+  random_frame(&in);
+  size_t key_len = realtime_frame_encode(&enc, &in, 0, wire, sizeof(wire));
+  TEST_ASSERT_EQUAL_UINT32(REALTIME_FRAME_MAX_BYTES, key_len);
+
+  in.vu_level = 0.5f;
+  in.tempo_confidence = 0.25f;
+  size_t delta_len = realtime_frame_encode(&enc, &in, 33, wire, sizeof(wire));
+  TEST_ASSERT_EQUAL_UINT8(0, wire[3] & REALTIME_FRAME_FLAG_KEYFRAME);
+  TEST_ASSERT_TRUE(delta_len <= REALTIME_FRAME_HEADER_BYTES + REALTIME_FRAME_BITMAP_BYTES + 2);
+
+  // Unchanged frame: header + empty bitmap only
+  size_t idle_len = realtime_frame_encode(&enc, &in, 66, wire, sizeof(wire));
+  TEST_ASSERT_EQUAL_UINT32(REALTIME_FRAME_HEADER_BYTES + REALTIME_FRAME_BITMAP_BYTES, idle_len);
+}
+
+void test_fully_changed_frame_falls_back_to_keyframe(void) {
+  RealtimeFrameData in;
+  random_frame(&in);
+  realtime_frame_encode(&enc, &in, 0, wire, sizeof(wire));
+  random_frame(&in);
+  size_t len = realtime_frame_encode(&enc, &in, 33, wire, sizeof(wire));
+  TEST_ASSERT_TRUE(len <= REALTIME_FRAME_MAX_BYTES);
+  if (!(wire[3] & REALTIME_FRAME_FLAG_KEYFRAME)) {
+    TEST_ASSERT_TRUE(len < REALTIME_FRAME_MAX_BYTES);
+  }
+}
+
+void test_missed_frame_needs_keyframe(void) {
+  RealtimeFrameData in, out;
+  random_frame(&in);
+  size_t len = realtime_frame_encode(&enc, &in, 0, wire, sizeof(wire));
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_OK, realtime_frame_decode(&dec, wire, len, &out, NULL));
+
+  // Frame 2 is dropped, frame 3 is a delta against it
+  in.vu_level = 0.1f;
+  realtime_frame_encode(&enc, &in, 33, wire, sizeof(wire));
+  in.vu_level = 0.2f;
+  len = realtime_frame_encode(&enc, &in, 66, wire, sizeof(wire));
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_NEED_KEYFRAME, realtime_frame_decode(&dec, wire, len, &out, NULL));
+
+  // A fresh decoder cannot start from a delta either
+  RealtimeFrameDecoder fresh;
+  realtime_frame_decoder_reset(&fresh);
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_NEED_KEYFRAME, realtime_frame_decode(&fresh, wire, len, &out, NULL));
+
+  // Encoder reset (new subscriber / client request) resynchronizes
+  realtime_frame_encoder_reset(&enc);
+  len = realtime_frame_encode(&enc, &in, 99, wire, sizeof(wire));
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_OK, realtime_frame_decode(&dec, wire, len, &out, NULL));
+  assert_matches_quantized(&in, &out);
+}
+
+void test_rejects_malformed_frames(void) {
+  RealtimeFrameData in, out;
+  random_frame(&in);
+  size_t len = realtime_frame_encode(&enc, &in, 0, wire, sizeof(wire));
+
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_TRUNCATED, realtime_frame_decode(&dec, wire, 5, &out, NULL));
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_TRUNCATED, realtime_frame_decode(&dec, wire, len - 1, &out, NULL));
+  TEST_ASSERT_FALSE(dec.has_state);
+
+  wire[2] = REALTIME_FRAME_VERSION + 1;
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_BAD_VERSION, realtime_frame_decode(&dec, wire, len, &out, NULL));
+  wire[2] = REALTIME_FRAME_VERSION;
+  wire[0] = '{';
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_BAD_MAGIC, realtime_frame_decode(&dec, wire, len, &out, NULL));
+  wire[0] = REALTIME_FRAME_MAGIC0;
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_OK, realtime_frame_decode(&dec, wire, len, &out, NULL));
+
+  // Delta whose bitmap claims more bytes than were sent
+  in.vu_level = 0.9f;
+  in.spectrum[3] = 0.9f;
+  len = realtime_frame_encode(&enc, &in, 33, wire, sizeof(wire));
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_TRUNCATED, realtime_frame_decode(&dec, wire, len - 1, &out, NULL));
+  TEST_ASSERT_EQUAL_INT(REALTIME_DECODE_OK, realtime_frame_decode(&dec, wire, len, &out, NULL));
+}
+
+void test_encode_rejects_short_buffer(void) {
+  RealtimeFrameData in;
+  random_frame(&in);
+  TEST_ASSERT_EQUAL_UINT32(0, realtime_frame_encode(&enc, &in, 0, wire, REALTIME_FRAME_MAX_BYTES - 1));
+  TEST_ASSERT_FALSE(enc.has_state);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_quantization_error_bounds);
+  RUN_TEST(test_out_of_range_values_saturate);
+  RUN_TEST(test_round_trip_sequence);
+  RUN_TEST(test_delta_smaller_than_keyframe);
+  RUN_TEST(test_fully_changed_frame_falls_back_to_keyframe);
+  RUN_TEST(test_missed_frame_needs_keyframe);
+  RUN_TEST(test_rejects_malformed_frames);
+  RUN_TEST(test_encode_rejects_short_buffer);
+  return UNITY_END();
+}
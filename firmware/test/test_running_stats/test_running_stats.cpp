@@ -0,0 +1,232 @@
+// Running statistics property tests
+// Feeds random streams through RunningSum and RunningExtremum and compares
+// every step against a brute-force recomputation over a plain history array,
+// including the floor-and-scale rescale that reduce_tempo_history() applies
+// and the check_silence() mapping of the windowed extremes.
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include "../../src/audio/running_stats.h"
+
+#define TEST_MAX_WINDOW 1024
+#define TEST_MAX_WIDTH 64
+#define TEST_MAX_ROWS 16
+
+static uint32_t rng_state = 1;
+
+static void rng_seed(uint32_t seed) {
+  rng_state = seed;
+}
+
+// Uniform in [0, 1)
+static float rng_uniform() {
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return (rng_state >> 8) * (1.0f / 16777216.0f);
+}
+
+static float history[70000];
+static float deque_values[TEST_MAX_WINDOW];
+static uint16_t deque_stamps[TEST_MAX_WINDOW];
+
+// Max (or min) of history[count - window .. count) (the whole history while shorter)
+static float brute_extremum(uint32_t count, uint16_t window, bool track_max) {
+  const uint32_t start = count > window ? count - window : 0;
+  float best = history[start];
+  for (uint32_t i = start + 1; i < count; i++) {
+    best = track_max ? fmaxf(best, history[i]) : fminf(best, history[i]);
+  }
+  return best;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_running_sum_matches_resum(void) {
+  static float rows[TEST_MAX_ROWS * TEST_MAX_WIDTH];
+  static float sums[TEST_MAX_WIDTH];
+  static float mirror[TEST_MAX_ROWS][TEST_MAX_WIDTH];
+  const uint16_t shapes[][2] = {{12, 64}, {1, 8}, {5, 3}, {16, 1}};
+
+  for (const auto& shape : shapes) {
+    const uint16_t capacity = shape[0];
+    const uint16_t width = shape[1];
+    RunningSum rs;
+    running_sum_init(&rs, rows, sums, capacity, width);
+    memset(mirror, 0, sizeof(mirror));
+    rng_seed(capacity * 100 + width);
+
+    uint16_t head = 0;
+    for (uint32_t n = 0; n < 50u * capacity + 3; n++) {
+      float row[TEST_MAX_WIDTH];
+      for (uint16_t i = 0; i < width; i++) {
+        row[i] = rng_uniform();
+      }
+      running_sum_push(&rs, row);
+      head = (head + 1) % capacity;
+      memcpy(mirror[head], row, sizeof(float) * width);
+      TEST_ASSERT_EQUAL_UINT16(head, rs.head);
+
+      float means[TEST_MAX_WIDTH];
+      running_sum_means(&rs, means);
+      for (uint16_t i = 0; i < width; i++) {
+        float sum = 0.0f;
+        for (uint16_t r = 0; r < capacity; r++) {
+          sum += mirror[r][i];
+        }
+        TEST_ASSERT_EQUAL_FLOAT(mirror[head][i], rows[head * width + i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f, sum / capacity, means[i]);
+        // Right after a lap the sums are rebuilt in row order: exact
+        if (head == 0) {
+          TEST_ASSERT_EQUAL_FLOAT(sum, sums[i]);
+        }
+      }
+    }
+  }
+}
+
+// Until the window fills, rows not yet written count as zero (like the
+// zero-initialised spectrogram_average[] it replaces)
+void test_running_sum_means_cover_the_full_window(void) {
+  float rows[4 * 2];
+  float sums[2];
+  RunningSum rs;
+  running_sum_init(&rs, rows, sums, 4, 2);
+  const float row[2] = {4.0f, 8.0f};
+  running_sum_push(&rs, row);
+
+  float means[2];
+  running_sum_means(&rs, means);
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, means[0]);
+  TEST_ASSERT_EQUAL_FLOAT(2.0f, means[1]);
+}
+
+void test_extremum_matches_brute_force(void) {
+  const uint16_t windows[] = {1, 2, 7, 128, 1024};
+  for (uint16_t window : windows) {
+    for (int track_max = 0; track_max < 2; track_max++) {
+      RunningExtremum re;
+      running_extremum_init(&re, deque_values, deque_stamps, window, track_max != 0);
+      TEST_ASSERT_EQUAL_FLOAT(-1.0f, running_extremum_value(&re, -1.0f));
+      rng_seed(window * 2 + track_max);
+
+      for (uint32_t n = 0; n < 3000; n++) {
+        // Quantised so equal values (deque ties) are common
+        const float v = floorf(rng_uniform() * 16.0f);
+        history[n] = v;
+        running_extremum_push(&re, v);
+        TEST_ASSERT_EQUAL_FLOAT(brute_extremum(n + 1, window, track_max != 0),
+                                running_extremum_value(&re, -1.0f));
+      }
+    }
+  }
+}
+
+// Monotonic streams are the deque's worst cases: increasing keeps one entry
+// for a max, decreasing keeps the whole window
+void test_extremum_monotonic_streams(void) {
+  const uint16_t window = 64;
+  for (int direction = 0; direction < 2; direction++) {
+    RunningExtremum re;
+    running_extremum_init(&re, deque_values, deque_stamps, window, true);
+    for (uint32_t n = 0; n < 500; n++) {
+      const float v = direction ? (float)n : (float)(1000 - n);
+      history[n] = v;
+      running_extremum_push(&re, v);
+      TEST_ASSERT_EQUAL_FLOAT(brute_extremum(n + 1, window, true), running_extremum_value(&re, 0.0f));
+      TEST_ASSERT_TRUE(re.size <= window);
+    }
+    TEST_ASSERT_EQUAL_UINT16(direction ? 1 : window, re.size);
+  }
+}
+
+// Push stamps are 16-bit: the window stays right across their wrap
+void test_extremum_survives_stamp_wrap(void) {
+  const uint16_t window = 1000;
+  RunningExtremum re;
+  running_extremum_init(&re, deque_values, deque_stamps, window, false);
+  rng_seed(7);
+  for (uint32_t n = 0; n < 70000; n++) {
+    history[n] = rng_uniform();
+    running_extremum_push(&re, history[n]);
+    if (n % 97 == 0 || (n > 65500 && n < 65600)) {
+      TEST_ASSERT_EQUAL_FLOAT(brute_extremum(n + 1, window, false), running_extremum_value(&re, 0.0f));
+    }
+  }
+}
+
+// Mirrors reduce_tempo_history(): every stored value becomes
+// fmaxf(v * gain, floor), with new values arriving in between
+void test_extremum_rescale_matches_rescaled_history(void) {
+  const uint16_t window = 128;
+  for (int track_max = 0; track_max < 2; track_max++) {
+    RunningExtremum re;
+    running_extremum_init(&re, deque_values, deque_stamps, window, track_max != 0);
+    rng_seed(11 + track_max);
+
+    for (uint32_t n = 0; n < 4000; n++) {
+      // Long silent stretches pile values onto the floor
+      history[n] = (n % 1000 > 800) ? 0.0f : rng_uniform();
+      running_extremum_push(&re, history[n]);
+
+      if (rng_uniform() < 0.2f) {
+        const float gain = 1.0f - 0.1f * rng_uniform();
+        for (uint32_t i = 0; i <= n; i++) {
+          history[i] = fmaxf(history[i] * gain, 0.00001f);
+        }
+        running_extremum_rescale(&re, gain, 0.00001f);
+      }
+
+      TEST_ASSERT_EQUAL_FLOAT(brute_extremum(n + 1, window, track_max != 0),
+                              running_extremum_value(&re, 0.0f));
+    }
+  }
+}
+
+// check_silence() maps the window through sqrt(min(0.5, x * scale) * 2); the
+// mapped extremes of the raw window equal the extremes of the mapped window
+void test_silence_mapping_of_extremes(void) {
+  const uint16_t window = 128;
+  RunningExtremum max_window;
+  RunningExtremum min_window;
+  static float min_values[TEST_MAX_WINDOW];
+  static uint16_t min_stamps[TEST_MAX_WINDOW];
+  running_extremum_init(&max_window, deque_values, deque_stamps, window, true);
+  running_extremum_init(&min_window, min_values, min_stamps, window, false);
+  rng_seed(3);
+
+  for (uint32_t n = 0; n < 2000; n++) {
+    history[n] = logf(1.0f + rng_uniform() * rng_uniform());
+    running_extremum_push(&max_window, history[n]);
+    running_extremum_push(&min_window, history[n]);
+    if (n + 1 < window) {
+      continue;
+    }
+
+    const float scale = 1.0f / (0.05f + rng_uniform());
+    float brute_max = 0.0f;
+    float brute_min = 1.0f;
+    for (uint32_t i = n + 1 - window; i <= n; i++) {
+      const float mapped = sqrtf(fminf(0.5f, history[i] * scale) * 2.0f);
+      brute_max = fmaxf(brute_max, mapped);
+      brute_min = fminf(brute_min, mapped);
+    }
+    const float max_val = sqrtf(fminf(0.5f, running_extremum_value(&max_window, 0.0f) * scale) * 2.0f);
+    const float min_val = sqrtf(fminf(0.5f, running_extremum_value(&min_window, 0.0f) * scale) * 2.0f);
+    TEST_ASSERT_EQUAL_FLOAT(brute_max, max_val);
+    TEST_ASSERT_EQUAL_FLOAT(brute_min, min_val);
+  }
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_running_sum_matches_resum);
+  RUN_TEST(test_running_sum_means_cover_the_full_window);
+  RUN_TEST(test_extremum_matches_brute_force);
+  RUN_TEST(test_extremum_monotonic_streams);
+  RUN_TEST(test_extremum_survives_stamp_wrap);
+  RUN_TEST(test_extremum_rescale_matches_rescaled_history);
+  RUN_TEST(test_silence_mapping_of_extremes);
+  return UNITY_END();
+}
@@ -0,0 +1,135 @@
+// SampleRing wraparound and windowed-read tests
+// Verifies the ring against the legacy flat shift-left history layout.
+
+#include <unity.h>
+#include <cstring>
+#include <stdint.h>
+#include "../../src/audio/sample_ring.h"
+
+#define RING_CAPACITY 256
+#define CHUNK 64
+
+static float storage[RING_CAPACITY];
+static float flat[RING_CAPACITY];   // Legacy layout: newest sample at flat[RING_CAPACITY - 1]
+static SampleRing ring;
+static float next_value = 1.0f;
+
+static void push(uint32_t count) {
+  float chunk[RING_CAPACITY * 2];
+  for (uint32_t i = 0; i < count; i++) chunk[i] = next_value++;
+  sample_ring_write(&ring, chunk, count);
+
+  uint32_t kept = count < RING_CAPACITY ? count : RING_CAPACITY;
+  memmove(flat, flat + kept, (RING_CAPACITY - kept) * sizeof(float));
+  memcpy(flat + RING_CAPACITY - kept, chunk + (count - kept), kept * sizeof(float));
+}
+
+static void assert_window_matches_flat(uint32_t length, uint32_t age) {
+  SampleSpan span = sample_ring_window(&ring, length, age);
+  TEST_ASSERT_EQUAL_UINT32(length, sample_span_length(span));
+
+  float linear[RING_CAPACITY];
+  sample_span_copy(span, linear);
+  const float* expected = &flat[RING_CAPACITY - age - length];
+  for (uint32_t i = 0; i < length; i++) {
+    TEST_ASSERT_EQUAL_FLOAT(expected[i], linear[i]);
+    TEST_ASSERT_EQUAL_FLOAT(expected[i], sample_span_at(span, i));
+  }
+}
+
+void setUp() {
+  memset(flat, 0, sizeof(flat));
+  next_value = 1.0f;
+  TEST_ASSERT_TRUE(sample_ring_init(&ring, storage, RING_CAPACITY));
+}
+
+void tearDown() {}
+
+void test_rejects_non_power_of_two() {
+  SampleRing bad;
+  float buf[100];
+  TEST_ASSERT_FALSE(sample_ring_init(&bad, buf, 100));
+  TEST_ASSERT_FALSE(sample_ring_init(&bad, buf, 0));
+}
+
+void test_empty_ring_reads_silence() {
+  SampleSpan span = sample_ring_window(&ring, RING_CAPACITY);
+  TEST_ASSERT_EQUAL_UINT32(RING_CAPACITY, sample_span_length(span));
+  for (uint32_t i = 0; i < RING_CAPACITY; i++) TEST_ASSERT_EQUAL_FLOAT(0.0f, sample_span_at(span, i));
+}
+
+void test_age_indexing() {
+  push(10);
+  TEST_ASSERT_EQUAL_FLOAT(10.0f, sample_ring_at(&ring, 0));
+  TEST_ASSERT_EQUAL_FLOAT(9.0f, sample_ring_at(&ring, 1));
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, sample_ring_at(&ring, 9));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, sample_ring_at(&ring, 10));
+}
+
+void test_contiguous_window_before_wrap() {
+  push(CHUNK);
+  SampleSpan span = sample_ring_window(&ring, CHUNK);
+  TEST_ASSERT_TRUE(sample_span_is_contiguous(span));
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, span.first[0]);
+  TEST_ASSERT_EQUAL_FLOAT((float)CHUNK, span.first[CHUNK - 1]);
+}
+
+void test_window_splits_across_wrap() {
+  push(RING_CAPACITY - 10);
+  push(CHUNK);  // Head now 54 samples past the wrap point
+  SampleSpan span = sample_ring_window(&ring, CHUNK);
+  TEST_ASSERT_FALSE(sample_span_is_contiguous(span));
+  TEST_ASSERT_EQUAL_UINT32(10, span.first_length);
+  TEST_ASSERT_EQUAL_UINT32(CHUNK - 10, span.second_length);
+  assert_window_matches_flat(CHUNK, 0);
+}
+
+void test_all_lengths_and_ages_match_flat_layout() {
+  // Walk the head through several wraps with odd-sized writes
+  const uint32_t writes[] = {64, 37, 64, 100, 1, 64, 255, 64, 64, 3};
+  for (uint32_t w : writes) {
+    push(w);
+    for (uint32_t length = 1; length <= RING_CAPACITY; length += 17) {
+      for (uint32_t age = 0; age + length <= RING_CAPACITY; age += 29) {
+        assert_window_matches_flat(length, age);
+      }
+    }
+    assert_window_matches_flat(RING_CAPACITY, 0);
+  }
+}
+
+void test_oversized_write_keeps_newest() {
+  push(RING_CAPACITY + 40);
+  TEST_ASSERT_EQUAL_FLOAT((float)(RING_CAPACITY + 40), sample_ring_at(&ring, 0));
+  assert_window_matches_flat(RING_CAPACITY, 0);
+}
+
+void test_window_length_clamped_to_capacity() {
+  push(CHUNK);
+  SampleSpan span = sample_ring_window(&ring, RING_CAPACITY * 2, 10);
+  TEST_ASSERT_EQUAL_UINT32(RING_CAPACITY - 10, sample_span_length(span));
+}
+
+void test_head_counter_wraparound() {
+  // Head near 2^32: masking must stay continuous across the integer wrap
+  ring.head = 0xFFFFFFFFu - 20;
+  push(CHUNK);
+  for (uint32_t age = 0; age < CHUNK; age++) {
+    TEST_ASSERT_EQUAL_FLOAT(flat[RING_CAPACITY - 1 - age], sample_ring_at(&ring, age));
+  }
+  assert_window_matches_flat(CHUNK, 0);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_rejects_non_power_of_two);
+  RUN_TEST(test_empty_ring_reads_silence);
+  RUN_TEST(test_age_indexing);
+  RUN_TEST(test_contiguous_window_before_wrap);
+  RUN_TEST(test_window_splits_across_wrap);
+  RUN_TEST(test_all_lengths_and_ages_match_flat_layout);
+  RUN_TEST(test_oversized_write_keeps_newest);
+  RUN_TEST(test_window_length_clamped_to_capacity);
+  RUN_TEST(test_head_counter_wraparound);
+  return UNITY_END();
+}
@@ -0,0 +1,140 @@
+// Spectrogram history ring tests
+// Quantisation, age addressing across the wrap, refusal of frames that are
+// unwritten or too close to the writer, and a writer/reader thread stress
+// where every successful read must hold the frame it asked for.
+
+#include <unity.h>
+#include <cstring>
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include "../../src/audio/spectrogram_history.h"
+
+static SpectrogramHistory history;
+
+// Frame n: every bin holds (n + bin) & 0xFF after quantisation
+static void fill_frame(uint32_t n, float* frame) {
+  for (int i = 0; i < SPECTROGRAM_HISTORY_BINS; i++) {
+    frame[i] = ((n + i) & 0xFF) / 255.0f;
+  }
+}
+
+void setUp(void) {
+  spectrogram_history_init(&history);
+}
+void tearDown(void) {}
+
+void test_quantisation_rounds_and_clamps(void) {
+  float frame[SPECTROGRAM_HISTORY_BINS] = {0};
+  frame[0] = -0.5f;
+  frame[1] = 0.0f;
+  frame[2] = 0.5f / 255.0f;          // rounds up to 1
+  frame[3] = 0.49f / 255.0f;         // rounds down to 0
+  frame[4] = 0.5f;
+  frame[5] = 1.0f;
+  frame[6] = 7.0f;
+  TEST_ASSERT_EQUAL_UINT32(1, spectrogram_history_push(&history, frame));
+
+  uint8_t row[SPECTROGRAM_HISTORY_BINS];
+  TEST_ASSERT_TRUE(spectrogram_history_read(&history, 0, 0, row));
+  const uint8_t expected[7] = {0, 0, 1, 0, 128, 255, 255};
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, row, 7);
+  TEST_ASSERT_EQUAL_FLOAT(128.0f / 255.0f, spectrogram_history_value(&history, 0, 0, 4));
+}
+
+void test_ages_address_past_frames_across_the_wrap(void) {
+  float frame[SPECTROGRAM_HISTORY_BINS];
+  const uint32_t total = SPECTROGRAM_HISTORY_FRAMES * 3 + 17;
+  for (uint32_t n = 0; n < total; n++) {
+    fill_frame(n, frame);
+    spectrogram_history_push(&history, frame);
+  }
+  const uint32_t newest = total - 1;
+  TEST_ASSERT_EQUAL_UINT32(total, spectrogram_history_count(&history));
+
+  uint8_t row[SPECTROGRAM_HISTORY_BINS];
+  for (uint16_t age = 0; age < SPECTROGRAM_HISTORY_DEPTH; age++) {
+    TEST_ASSERT_TRUE(spectrogram_history_read(&history, newest, age, row));
+    for (int i = 0; i < SPECTROGRAM_HISTORY_BINS; i++) {
+      TEST_ASSERT_EQUAL_UINT8((newest - age + i) & 0xFF, row[i]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(((newest - age + 9) & 0xFF) / 255.0f,
+                            spectrogram_history_value(&history, newest, age, 9));
+  }
+}
+
+void test_unavailable_frames_are_refused(void) {
+  uint8_t row[SPECTROGRAM_HISTORY_BINS];
+  float frame[SPECTROGRAM_HISTORY_BINS];
+
+  // Nothing pushed yet
+  TEST_ASSERT_FALSE(spectrogram_history_read(&history, 0, 0, row));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, spectrogram_history_value(&history, 0, 0, 0));
+
+  for (uint32_t n = 0; n < 10; n++) {
+    fill_frame(n + 1, frame);
+    spectrogram_history_push(&history, frame);
+  }
+  // Before the first frame, and a frame from the future
+  TEST_ASSERT_FALSE(spectrogram_history_read(&history, 9, 10, row));
+  TEST_ASSERT_FALSE(spectrogram_history_read(&history, 10, 0, row));
+  for (int i = 0; i < SPECTROGRAM_HISTORY_BINS; i++) TEST_ASSERT_EQUAL_UINT8(0, row[i]);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, spectrogram_history_value(&history, 9, 0, SPECTROGRAM_HISTORY_BINS));
+
+  // The depth limit counts from the newest pushed frame, not from the anchor:
+  // an anchor that has fallen behind loses its oldest ages
+  for (uint32_t n = 10; n < 300; n++) {
+    fill_frame(n + 1, frame);
+    spectrogram_history_push(&history, frame);
+  }
+  const uint16_t lag = SPECTROGRAM_HISTORY_DEPTH / 4;
+  TEST_ASSERT_TRUE(spectrogram_history_read(&history, 299, SPECTROGRAM_HISTORY_DEPTH - 1, row));
+  TEST_ASSERT_FALSE(spectrogram_history_read(&history, 299, SPECTROGRAM_HISTORY_DEPTH, row));
+  TEST_ASSERT_TRUE(spectrogram_history_read(&history, 299 - lag, SPECTROGRAM_HISTORY_DEPTH - 1 - lag, row));
+  TEST_ASSERT_FALSE(spectrogram_history_read(&history, 299 - lag, SPECTROGRAM_HISTORY_DEPTH - lag, row));
+}
+
+// Writer thread pushes a frame every few microseconds (far faster than the
+// 5 ms audio frame); the reader anchors on the newest frame and walks back
+// through the ages. A torn or lapped row must never be reported as valid.
+void test_concurrent_reads_never_return_a_wrong_frame(void) {
+  std::atomic<bool> stop{false};
+  std::thread writer([&]() {
+    float frame[SPECTROGRAM_HISTORY_BINS];
+    for (uint32_t n = 0; !stop.load(std::memory_order_relaxed); n++) {
+      fill_frame(n, frame);
+      spectrogram_history_push(&history, frame);
+      std::this_thread::sleep_for(std::chrono::microseconds(5));
+    }
+  });
+
+  while (spectrogram_history_count(&history) == 0) {
+    std::this_thread::yield();
+  }
+
+  uint32_t good = 0;
+  uint8_t row[SPECTROGRAM_HISTORY_BINS];
+  for (int pass = 0; pass < 20000; pass++) {
+    const uint32_t newest = spectrogram_history_count(&history) - 1;
+    for (uint16_t age = 0; age < SPECTROGRAM_HISTORY_DEPTH; age += 7) {
+      if (!spectrogram_history_read(&history, newest, age, row)) continue;
+      for (int i = 0; i < SPECTROGRAM_HISTORY_BINS; i++) {
+        TEST_ASSERT_EQUAL_UINT8((newest - age + i) & 0xFF, row[i]);
+      }
+      good++;
+    }
+  }
+  stop.store(true);
+  writer.join();
+  TEST_ASSERT_GREATER_THAN_UINT32(0, good);
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_quantisation_rounds_and_clamps);
+  RUN_TEST(test_ages_address_past_frames_across_the_wrap);
+  RUN_TEST(test_unavailable_frames_are_refused);
+  RUN_TEST(test_concurrent_reads_never_return_a_wrong_frame);
+  return UNITY_END();
+}
@@ -0,0 +1,217 @@
+// Tempo bank vs block tempo Goertzel parity tests
+// Feeds synthetic novelty curves through the incremental bank tick-by-tick and
+// compares every bin against the windowed Goertzel in calculate_magnitude_of_tempo().
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include "../../src/audio/tempo_bank.h"
+#include "../test_utils/goertzel_fixture.h"
+
+#define TEST_NOVELTY_HZ 50
+#define TEST_HISTORY_LENGTH 1024
+#define TEST_NUM_TEMPI 192
+#define TEST_TEMPO_LOW 50
+#define TEST_TEMPO_HIGH 150
+
+static float novelty[TEST_HISTORY_LENGTH];
+static FixtureTempoBin tempo_bins[TEST_NUM_TEMPI];
+static uint16_t block_sizes[TEST_NUM_TEMPI];
+static float dft_k[TEST_NUM_TEMPI];
+static float coeffs[TEST_NUM_TEMPI];
+static float cosines[TEST_NUM_TEMPI];
+static float sines[TEST_NUM_TEMPI];
+static TempoBank bank;
+
+// init_tempo_goertzel_constants() layout, plus the block reference's constants
+static void build_bins() {
+  tempo_bank_reset(&bank, TEST_NUM_TEMPI, window_lookup, FIXTURE_WINDOW_LENGTH);
+  fixture_tempo_bins(tempo_bins, TEST_NUM_TEMPI, TEST_TEMPO_LOW, TEST_TEMPO_HIGH, TEST_NOVELTY_HZ, TEST_HISTORY_LENGTH);
+  for (uint16_t i = 0; i < TEST_NUM_TEMPI; i++) {
+    const uint32_t n = tempo_bins[i].block_size;
+    const float k = tempo_bins[i].k;
+    const float w = (2.0f * (float)M_PI * k) / n;
+    block_sizes[i] = n;
+    dft_k[i] = k;
+    cosines[i] = cosf(w);
+    sines[i] = sinf(w);
+    coeffs[i] = 2.0f * cosines[i];
+    tempo_bank_configure_bin(&bank, i, n, k);
+  }
+}
+
+// Mirrors calculate_magnitude_of_tempo() on novelty * scale
+static void block_tempo(uint16_t bin, float scale, float* magnitude, float* phase) {
+  const uint32_t n = block_sizes[bin];
+  const float window_step = 4096.0f / n;
+  float q1 = 0, q2 = 0, window_pos = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    float x = novelty[((TEST_HISTORY_LENGTH - 1) - n) + i] * scale;
+    float q0 = coeffs[bin] * q1 - q2 + x * window_lookup[(uint32_t)window_pos];
+    q2 = q1;
+    q1 = q0;
+    window_pos += window_step;
+  }
+  *phase = atan2f(q2 * sines[bin], q1 - q2 * cosines[bin]);
+  float mag_sq = (q1 * q1) + (q2 * q2) - q1 * q2 * coeffs[bin];
+  *magnitude = sqrtf(fmaxf(mag_sq, 0.0f)) / (n / 2.0f);
+}
+
+static void bank_tempo(uint16_t bin, float scale, float* magnitude, float* phase) {
+  float real, imag;
+  tempo_bank_goertzel_output(&bank, bin, scale, &real, &imag);
+  *phase = atan2f(imag, real);
+  *magnitude = sqrtf(real * real + imag * imag) / (block_sizes[bin] / 2.0f);
+}
+
+static uint32_t tick_clock = 0;
+static uint32_t noise_state = 98765;
+
+// Mirrors log_novelty(): bank first (pre-shift history), then shift in the new value
+static void push_tick(float value) {
+  tempo_bank_push(&bank, novelty, TEST_HISTORY_LENGTH);
+  memmove(novelty, novelty + 1, sizeof(float) * (TEST_HISTORY_LENGTH - 1));
+  novelty[TEST_HISTORY_LENGTH - 1] = value;
+  tick_clock++;
+}
+
+// Onset-like pulses at bpm plus a noise floor (log(1 + flux) shaped)
+static void push_beats(float bpm, uint32_t ticks, float noise_amp) {
+  const float period = (TEST_NOVELTY_HZ * 60.0f) / bpm;
+  for (uint32_t t = 0; t < ticks; t++) {
+    float beat_pos = fmodf((float)tick_clock, period);
+    float pulse = (beat_pos < 1.0f) ? 0.4f : 0.0f;
+    push_tick(logf(1.0f + pulse + noise_amp * fixture_uniform(&noise_state)));
+  }
+}
+
+// Neighbouring tempo bins share a block size and DFT index, so argmax ties are
+// broken by float rounding: compare the underlying DFT bin instead
+static void assert_same_peak(uint16_t expected, uint16_t actual) {
+  TEST_ASSERT_EQUAL_UINT16(block_sizes[expected], block_sizes[actual]);
+  TEST_ASSERT_EQUAL_FLOAT(dft_k[expected], dft_k[actual]);
+}
+
+static float max_novelty() {
+  float m = 0.00001f;
+  for (uint32_t i = 0; i < TEST_HISTORY_LENGTH; i++) m = fmaxf(m, novelty[i]);
+  return m;
+}
+
+static float phase_distance(float a, float b) {
+  float d = fabsf(a - b);
+  return fminf(d, 2.0f * (float)M_PI - d);
+}
+
+static uint16_t argmax_block(float scale) {
+  uint16_t best = 0;
+  float best_mag = -1.0f;
+  for (uint16_t i = 0; i < TEST_NUM_TEMPI; i++) {
+    float m, p;
+    block_tempo(i, scale, &m, &p);
+    if (m > best_mag) { best_mag = m; best = i; }
+  }
+  return best;
+}
+
+static uint16_t argmax_bank(float scale) {
+  uint16_t best = 0;
+  float best_mag = -1.0f;
+  for (uint16_t i = 0; i < TEST_NUM_TEMPI; i++) {
+    float m, p;
+    bank_tempo(i, scale, &m, &p);
+    if (m > best_mag) { best_mag = m; best = i; }
+  }
+  return best;
+}
+
+// Worst per-bin magnitude error relative to the strongest block bin
+static float max_relative_error(float scale) {
+  float block_mag[TEST_NUM_TEMPI];
+  float peak = 0.0f;
+  for (uint16_t i = 0; i < TEST_NUM_TEMPI; i++) {
+    float p;
+    block_tempo(i, scale, &block_mag[i], &p);
+    peak = fmaxf(peak, block_mag[i]);
+  }
+  float worst = 0.0f;
+  for (uint16_t i = 0; i < TEST_NUM_TEMPI; i++) {
+    float m, p;
+    bank_tempo(i, scale, &m, &p);
+    worst = fmaxf(worst, fabsf(m - block_mag[i]) / peak);
+  }
+  return worst;
+}
+
+void setUp(void) {
+  memset(novelty, 0, sizeof(novelty));
+  tick_clock = 0;
+  noise_state = 98765;
+  build_bins();
+}
+
+void tearDown(void) {}
+
+void test_every_bin_tracks_block_goertzel(void) {
+  push_beats(120.0f, 2000, 0.05f);
+  float scale = 1.0f / max_novelty();
+
+  TEST_ASSERT_LESS_THAN_FLOAT(0.06f, max_relative_error(scale));
+  assert_same_peak(argmax_block(scale), argmax_bank(scale));
+}
+
+void test_peak_phase_matches_block_goertzel(void) {
+  push_beats(128.0f, 1500, 0.05f);
+  float scale = 1.0f / max_novelty();
+
+  uint16_t peak = argmax_block(scale);
+  float block_mag, block_phase, bank_mag, bank_phase;
+  block_tempo(peak, scale, &block_mag, &block_phase);
+  bank_tempo(peak, scale, &bank_mag, &bank_phase);
+  TEST_ASSERT_LESS_THAN_FLOAT(0.1f, phase_distance(block_phase, bank_phase));
+
+  // Phase must keep advancing with the beat tick by tick, not only at refresh
+  push_beats(128.0f, 7, 0.05f);
+  scale = 1.0f / max_novelty();
+  block_tempo(peak, scale, &block_mag, &block_phase);
+  bank_tempo(peak, scale, &bank_mag, &bank_phase);
+  TEST_ASSERT_LESS_THAN_FLOAT(0.1f, phase_distance(block_phase, bank_phase));
+}
+
+void test_tempo_change_is_tracked_without_full_refresh(void) {
+  push_beats(90.0f, 1100, 0.02f);
+  push_beats(140.0f, 1100, 0.02f);
+  float scale = 1.0f / max_novelty();
+
+  assert_same_peak(argmax_block(scale), argmax_bank(scale));
+  TEST_ASSERT_LESS_THAN_FLOAT(0.06f, max_relative_error(scale));
+}
+
+void test_scale_matches_scaled_history(void) {
+  push_beats(100.0f, 1200, 0.05f);
+  for (uint32_t i = 0; i < TEST_HISTORY_LENGTH; i++) novelty[i] *= 0.9f;
+  tempo_bank_scale(&bank, 0.9f);
+  float scale = 1.0f / max_novelty();
+
+  TEST_ASSERT_LESS_THAN_FLOAT(0.06f, max_relative_error(scale));
+}
+
+void test_resync_bounds_drift_over_long_run(void) {
+  // ~40 minutes of novelty at 50 Hz
+  push_beats(115.0f, 120000, 0.3f);
+  float scale = 1.0f / max_novelty();
+
+  TEST_ASSERT_LESS_THAN_FLOAT(0.06f, max_relative_error(scale));
+  assert_same_peak(argmax_block(scale), argmax_bank(scale));
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_bin_tracks_block_goertzel);
+  RUN_TEST(test_peak_phase_matches_block_goertzel);
+  RUN_TEST(test_tempo_change_is_tracked_without_full_refresh);
+  RUN_TEST(test_scale_matches_scaled_history);
+  RUN_TEST(test_resync_bounds_drift_over_long_run);
+  return UNITY_END();
+}
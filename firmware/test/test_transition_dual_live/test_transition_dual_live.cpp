@@ -0,0 +1,159 @@
+// Dual-live transition tests (env:native)
+// K1TransitionAdapter renders the outgoing and incoming patterns live into the
+// shared pool's simple buffers and blends into leds[]; these check that
+// patterns honor context.leds, that the outgoing side keeps animating, and
+// that completion hands the pool buffers back.
+
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "host_runtime.h"
+#include "../../src/led_driver.h"
+#include "../../src/parameters.h"
+#include "../../src/pattern_execution.h"
+#include "../../src/pattern_registry.h"
+#include "../../src/shared_pattern_buffers.h"
+#include "../../src/transitions/transition_adapter.hpp"
+
+#define TEST_FRAME_MS 10
+#define TEST_DURATION_MS 400
+
+static CRGBF scratch[NUM_LEDS];
+static AudioDataSnapshot silent_audio;
+static int64_t now_us = 1000000;
+
+static uint8_t pattern_index(const char* name) {
+  for (uint8_t i = 0; i < g_num_patterns; i++) {
+    if (strcmp(g_pattern_registry[i].name, name) == 0) return i;
+  }
+  TEST_FAIL_MESSAGE("pattern not registered");
+  return 0;
+}
+
+// One loop_gpu() render step without the color pipeline, so leds[] holds the
+// blended pattern output
+static bool transition_frame() {
+  now_us += TEST_FRAME_MS * 1000;
+  hal_set_time_us(now_us);
+  PatternRenderContext context(leds, NUM_LEDS, now_us / 1e6f, get_params(), silent_audio);
+  return g_transition_adapter.update(context);
+}
+
+static void render_into(uint8_t index, CRGBF* out) {
+  PatternRenderContext context(out, NUM_LEDS, now_us / 1e6f, get_params(), silent_audio);
+  g_pattern_registry[index].draw_fn(context);
+}
+
+static bool same_pixel(const CRGBF& a, const CRGBF& b) {
+  return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+void setUp(void) {
+  hal_set_time_us(now_us);
+  memset(&silent_audio, 0, sizeof(silent_audio));
+  g_transition_adapter.setEnabled(true);
+  g_transition_adapter.setDefaultType(TRANSITION_FADE);
+  g_transition_adapter.setDefaultDuration(TEST_DURATION_MS);
+  g_transition_adapter.setDefaultCurve(EASE_LINEAR);
+}
+
+void tearDown(void) {
+  while (g_transition_adapter.isActive()) transition_frame();
+}
+
+void test_patterns_render_only_into_context(void) {
+  const CRGBF sentinel(0.123f, 0.456f, 0.789f);
+  for (uint8_t p = 0; p < g_num_patterns; p++) {
+    for (int i = 0; i < NUM_LEDS; i++) leds[i] = sentinel;
+    render_into(p, scratch);
+    for (int i = 0; i < NUM_LEDS; i++) {
+      TEST_ASSERT_TRUE_MESSAGE(same_pixel(leds[i], sentinel), g_pattern_registry[p].name);
+    }
+  }
+}
+
+void test_outgoing_pattern_renders_live(void) {
+  g_current_pattern_index = pattern_index("Diamond Lattice");
+  render_into(g_current_pattern_index, leds);
+  TEST_ASSERT_TRUE(g_transition_adapter.beginTransition(pattern_index("Departure")));
+  TEST_ASSERT_TRUE(g_transition_adapter.isActive());
+
+  // Edge pixels stay fully on the outgoing side for the first half of a
+  // center-origin fade; a frozen capture would not change between frames
+  int changed = 0;
+  CRGBF prev = leds[0];
+  for (int f = 0; f < 8; f++) {
+    TEST_ASSERT_TRUE(transition_frame());
+    if (!same_pixel(leds[0], prev)) changed++;
+    prev = leds[0];
+  }
+  TEST_ASSERT_GREATER_THAN(4, changed);
+}
+
+void test_completion_switches_pattern_and_releases_buffers(void) {
+  const uint8_t from = pattern_index("Lava");
+  const uint8_t to = pattern_index("Departure");
+  g_current_pattern_index = from;
+  const uint8_t channel_before = g_transition_adapter.getLiveChannel();
+
+  TEST_ASSERT_TRUE(g_transition_adapter.beginTransition(to));
+  TEST_ASSERT_FALSE(acquire_simple_buffer());  // held by the transition
+
+  int frames = 0;
+  while (transition_frame()) frames++;
+  TEST_ASSERT_INT_WITHIN(2, TEST_DURATION_MS / TEST_FRAME_MS, frames);
+
+  TEST_ASSERT_FALSE(g_transition_adapter.isActive());
+  TEST_ASSERT_EQUAL_UINT8(to, g_current_pattern_index);
+  TEST_ASSERT_EQUAL_UINT8(channel_before ^ 1, g_transition_adapter.getLiveChannel());
+
+  // Final frame is the incoming pattern
+  render_into(to, scratch);
+  TEST_ASSERT_EQUAL_MEMORY(scratch, leds, sizeof(scratch));
+
+  TEST_ASSERT_TRUE(acquire_simple_buffer());
+  release_simple_buffer();
+}
+
+void test_partial_progress_blends_both_patterns(void) {
+  const uint8_t from = pattern_index("Lava");
+  const uint8_t to = pattern_index("Departure");
+  g_current_pattern_index = from;
+  TEST_ASSERT_TRUE(g_transition_adapter.beginTransition(to));
+  // 40% through a linear fade: center pixel at 0.8 blend, edges still outgoing
+  const int frames = (TEST_DURATION_MS * 2 / 5) / TEST_FRAME_MS;
+  for (int f = 0; f < frames; f++) transition_frame();
+
+  CRGBF a[NUM_LEDS];
+  CRGBF b[NUM_LEDS];
+  render_into(from, a);
+  render_into(to, b);
+  const CRGBF& c = leds[STRIP_CENTER_POINT];
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, a[STRIP_CENTER_POINT].r + (b[STRIP_CENTER_POINT].r - a[STRIP_CENTER_POINT].r) * 0.8f, c.r);
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, a[STRIP_CENTER_POINT].g + (b[STRIP_CENTER_POINT].g - a[STRIP_CENTER_POINT].g) * 0.8f, c.g);
+  TEST_ASSERT_FLOAT_WITHIN(1e-4f, a[STRIP_CENTER_POINT].b + (b[STRIP_CENTER_POINT].b - a[STRIP_CENTER_POINT].b) * 0.8f, c.b);
+  TEST_ASSERT_TRUE(same_pixel(leds[0], a[0]));
+  TEST_ASSERT_TRUE(same_pixel(leds[NUM_LEDS - 1], a[NUM_LEDS - 1]));
+}
+
+void test_no_free_buffer_switches_instantly(void) {
+  g_current_pattern_index = pattern_index("Lava");
+  TEST_ASSERT_TRUE(acquire_simple_buffer());
+  TEST_ASSERT_TRUE(g_transition_adapter.beginTransition(pattern_index("Twilight")));
+  TEST_ASSERT_FALSE(g_transition_adapter.isActive());
+  TEST_ASSERT_EQUAL_UINT8(pattern_index("Twilight"), g_current_pattern_index);
+  release_simple_buffer();
+}
+
+int main(int argc, char** argv) {
+  host_runtime_init();
+  UNITY_BEGIN();
+  RUN_TEST(test_patterns_render_only_into_context);
+  RUN_TEST(test_outgoing_pattern_renders_live);
+  RUN_TEST(test_completion_switches_pattern_and_releases_buffers);
+  RUN_TEST(test_partial_progress_blends_both_patterns);
+  RUN_TEST(test_no_free_buffer_switches_instantly);
+  return UNITY_END();
+}
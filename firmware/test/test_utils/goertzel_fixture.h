@@ -0,0 +1,122 @@
+// Shared fixture for the Goertzel engine tests (pure C++, host and device)
+// The note bins and Gaussian window come straight from the generated tables
+// (goertzel_lut.h), so every engine is tested on the firmware's real layout;
+// the tempo bins mirror init_tempo_goertzel_constants(). Test signals are
+// sines plus LCG noise, generated sample by sample.
+
+#pragma once
+
+#include <cmath>
+#include <stdint.h>
+#include "../../src/audio/goertzel_lut.h"
+#include "../../src/audio/goertzel_block.h"
+
+#define FIXTURE_SAMPLE_RATE GOERTZEL_LUT_SAMPLE_RATE_HZ
+#define FIXTURE_NOTE_BINS GOERTZEL_LUT_NUM_FREQS
+#define FIXTURE_WINDOW_LENGTH GOERTZEL_LUT_WINDOW_LENGTH
+
+// ============================================================================
+// NOTE BINS (GOERTZEL_BIN_LUT[], half-steps from notes[BOTTOM_NOTE] = 77.78 Hz)
+// ============================================================================
+
+inline void fixture_note_bins(GoertzelBlockBin* bins, uint16_t count) {
+  for (uint16_t i = 0; i < count; i++) {
+    bins[i].block_size = GOERTZEL_BIN_LUT[i].block_size;
+    bins[i].window_step = GOERTZEL_BIN_LUT[i].window_step;
+    bins[i].coeff = GOERTZEL_BIN_LUT[i].coeff;
+  }
+}
+
+// Frequency the bin's coefficient is actually tuned to (k / N quantization)
+inline double fixture_bin_centre_hz(const GoertzelBlockBin& bin) {
+  return acos(bin.coeff / 2.0) * FIXTURE_SAMPLE_RATE / (2.0 * M_PI);
+}
+
+// ============================================================================
+// TEMPO BINS (init_tempo_goertzel_constants())
+// ============================================================================
+
+struct FixtureTempoBin {
+  float hz;
+  uint32_t block_size;  // Neighbour-spacing block, clamped to history - 1
+  float k;              // DFT index of the tempo in the block
+};
+
+inline void fixture_tempo_bins(FixtureTempoBin* bins, uint16_t count, float low_bpm, float high_bpm,
+                               float novelty_hz, uint32_t history_length) {
+  for (uint16_t i = 0; i < count; i++) {
+    const float progress = (float)i / count;
+    bins[i].hz = ((high_bpm - low_bpm) * progress + low_bpm) / 60.0f;
+  }
+  for (uint16_t i = 0; i < count; i++) {
+    const float left = bins[i > 0 ? i - 1 : i].hz;
+    const float right = bins[i < count - 1 ? i + 1 : i].hz;
+    const float max_distance = fmaxf(fabsf(left - bins[i].hz), fabsf(right - bins[i].hz));
+    uint32_t n = (uint32_t)(novelty_hz / (max_distance * 0.5f));
+    if (n >= history_length) n = history_length - 1;
+    bins[i].block_size = n;
+    bins[i].k = floorf(0.5f + ((n * bins[i].hz) / novelty_hz));
+  }
+}
+
+// ============================================================================
+// TEST SIGNALS
+// ============================================================================
+
+// Uniform in [0, 1) from a 32-bit LCG
+inline float fixture_uniform(uint32_t* state) {
+  *state = *state * 1664525u + 1013904223u;
+  return (float)(*state >> 8) / 16777216.0f;
+}
+
+// amplitude * sin(2*pi*hz*t + phase) plus uniform noise of width `noise`
+struct FixtureTone {
+  double hz;
+  double amplitude;
+  double phase;
+  float noise;
+  uint32_t lcg;
+  uint32_t sample;  // Next sample index
+};
+
+inline FixtureTone fixture_tone(double hz, double amplitude, float noise = 0.0f, double phase = 0.0) {
+  return FixtureTone{hz, amplitude, phase, noise, 0xC0FFEEu, 0};
+}
+
+// Add the next `count` samples of the tone to out[]
+inline void fixture_tone_add(FixtureTone* tone, float* out, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++, tone->sample++) {
+    out[i] += (float)(tone->amplitude * sin(2.0 * M_PI * tone->hz * tone->sample / FIXTURE_SAMPLE_RATE + tone->phase));
+    if (tone->noise != 0.0f) {
+      out[i] += (fixture_uniform(&tone->lcg) - 0.5f) * tone->noise;
+    }
+  }
+}
+
+// Write the next `count` samples of the tone to out[]
+inline void fixture_tone_fill(FixtureTone* tone, float* out, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    out[i] = 0.0f;
+  }
+  fixture_tone_add(tone, out, count);
+}
+
+// Write the next `count` samples of the summed tones to out[]
+inline void fixture_tones_fill(FixtureTone* tones, uint8_t num_tones, float* out, uint32_t count) {
+  fixture_tone_fill(&tones[0], out, count);
+  for (uint8_t t = 1; t < num_tones; t++) {
+    fixture_tone_add(&tones[t], out, count);
+  }
+}
+
+// Reset the ring and write `total` samples of the summed tones, 64 at a time,
+// so the head ends at total % capacity
+inline void fixture_fill_ring(SampleRing* ring, float* storage, uint32_t capacity, FixtureTone* tones,
+                              uint8_t num_tones, uint32_t total) {
+  sample_ring_init(ring, storage, capacity);
+  float chunk[64];
+  for (uint32_t n = 0; n < total; n += 64) {
+    fixture_tones_fill(tones, num_tones, chunk, 64);
+    sample_ring_write(ring, chunk, 64);
+  }
+}
@@ -0,0 +1,142 @@
+// Audio pipeline bench: drives the full audio -> LED path on the host from a
+// pluggable audio source (host_audio_sources.h) instead of the I2S microphone,
+// one host_audio_step() + host_render_frame() per audio chunk, and reports
+// throughput and end-to-end latency.
+//
+// Build (from repo root, same source set as [env:native]):
+//   g++ -O2 -std=gnu++17 -pthread -Ifirmware/native/hal_shims -Ifirmware/native/host_runtime -Ifirmware/src \
+//     tools/audio_pipeline_bench.cpp firmware/native/hal_shims/*.cpp firmware/native/host_runtime/*.cpp \
+//     $(find firmware/src -name '*.cpp' ! -name main.cpp ! -name 'webserver*' ! -name wifi_monitor.cpp \
+//       ! -name connection_state.cpp ! -name udp_echo.cpp ! -name tempo_validation_stubs.cpp \
+//       ! -path '*/network/*' ! -path '*/diagnostics/*') -o audio_pipeline_bench
+// Run:
+//   ./audio_pipeline_bench --wav track.wav [--loop] [--seconds 60]
+//       As fast as the CPU allows. Throughput (realtime_x) and per-chunk
+//       pipeline latency: source read through transmit_leds().
+//   ./audio_pipeline_bench --udp 9750 [--seconds 60]
+//   python3 tools/udp_pcm_send.py track.wav --port 9750
+//       Paced by the sender. Latency is sender timestamp of the newest sample
+//       in a chunk -> end of the LED frame that first reflects it, so it
+//       includes socket transit and the wait for a full chunk. Stops after
+//       --seconds of audio or 2 s without packets.
+//
+// Frames are rendered once per chunk (the device renders on its own clock);
+// compare runs on the same machine only.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <esp_timer.h>
+
+#include "host_runtime.h"
+#include "host_audio_sources.h"
+#include "audio/audio_config.h"
+#include "audio/microphone.h"
+
+struct Args {
+  std::string wav;
+  int udp_port = -1;
+  bool loop = false;
+  double seconds = 0.0;   // 0 = whole file (WAV) / until the sender stops (UDP)
+};
+
+static void parse_args(int argc, char** argv, Args& a) {
+  for (int i=1;i<argc;++i) {
+    std::string k = argv[i];
+    auto nexts = [&](std::string def)->std::string{ if (i+1<argc) return std::string(argv[++i]); return def; };
+    auto nextd = [&](double def)->double{ if (i+1<argc) return std::stod(argv[++i]); return def; };
+    if (k == "--wav") a.wav = nexts(a.wav);
+    else if (k == "--udp") a.udp_port = (int)nextd(a.udp_port);
+    else if (k == "--loop") a.loop = true;
+    else if (k == "--seconds") a.seconds = nextd(a.seconds);
+  }
+}
+
+static void report(const char* label, std::vector<double> v) {
+  if (v.empty()) return;
+  std::sort(v.begin(), v.end());
+  double sum = 0.0;
+  for (double x : v) sum += x;
+  printf("  %-12s avg=%9.1f p50=%9.1f p99=%9.1f max=%9.1f us\n", label, sum / v.size(), v[v.size() / 2],
+         v[std::min(v.size() - 1, v.size() * 99 / 100)], v.back());
+}
+
+int main(int argc, char** argv) {
+  Args args; parse_args(argc, argv, args);
+  if (args.wav.empty() == (args.udp_port < 0)) {
+    std::cerr << "usage: audio_pipeline_bench (--wav file.wav [--loop] | --udp PORT) [--seconds N]" << std::endl;
+    return 2;
+  }
+
+  static WavFileSource wav;
+  static UdpPcmSource udp;
+  std::string err;
+  const bool use_udp = args.udp_port >= 0;
+  if (use_udp) {
+    if (!udp_pcm_source_open(&udp, (uint16_t)args.udp_port, &err)) { std::cerr << "audio_pipeline_bench: " << err << std::endl; return 1; }
+    printf("Listening on 127.0.0.1:%u for %u Hz int16 PCM\n", (unsigned)udp.port, (unsigned)AUDIO_CAPTURE_RATE_HZ);
+    fflush(stdout);
+  } else if (!wav_file_source_open(&wav, args.wav, args.loop, &err)) {
+    std::cerr << "audio_pipeline_bench: " << err << std::endl;
+    return 1;
+  }
+
+  const int64_t chunk_us = (int64_t)AUDIO_CHUNK_SIZE * 1000000 / AUDIO_SAMPLE_RATE_HZ;
+  uint64_t max_chunks = args.seconds > 0.0 ? (uint64_t)(args.seconds * 1e6 / chunk_us) : UINT64_MAX;
+  if (!use_udp && !args.loop) max_chunks = std::min<uint64_t>(max_chunks, wav_file_source_chunks(&wav));
+  if (max_chunks == UINT64_MAX) max_chunks = (uint64_t)(600.0 * 1e6 / chunk_us);  // --loop without --seconds
+
+  hal_set_time_us(1000000);
+  host_runtime_init();
+  audio_source_select(use_udp ? &udp.source : &wav.source);
+
+  std::vector<double> audio_us, render_us, pipeline_us, e2e_us;
+  uint64_t chunks = 0, beats = 0, idle_chunks = 0;
+  const uint32_t timeouts_before = get_i2s_timeout_state().timeout_count;
+  int64_t start_us = 0, end_us = 0;   // Counted chunks only: not waiting for the UDP sender
+  while (chunks < max_chunks) {
+    hal_advance_time_us(chunk_us);
+    const uint32_t timeouts = get_i2s_timeout_state().timeout_count;
+    const int64_t t0 = host_monotonic_us();
+    beats += host_audio_step();
+    const int64_t t1 = host_monotonic_us();
+    host_render_frame((float)(chunks * chunk_us) / 1e6f);
+    const int64_t t2 = host_monotonic_us();
+
+    if (use_udp && get_i2s_timeout_state().timeout_count != timeouts) {
+      // No chunk within the 100 ms read bound: silence, not a measurement
+      if (udp.packets > 0 && ++idle_chunks * 100 >= 2000) break;
+      continue;
+    }
+    idle_chunks = 0;
+    if (chunks++ == 0) start_us = t0;
+    end_us = t2;
+    audio_us.push_back((double)(t1 - t0));
+    render_us.push_back((double)(t2 - t1));
+    pipeline_us.push_back((double)(t2 - t0));
+    if (use_udp) e2e_us.push_back((double)(t2 - udp.chunk_sent_us));
+  }
+  const double wall_s = (double)(end_us - start_us) / 1e6;
+  audio_source_select(nullptr);
+
+  const double audio_s = (double)chunks * chunk_us / 1e6;
+  printf("source=%s chunks=%llu audio_s=%.2f wall_s=%.2f realtime_x=%.1f chunks_per_s=%.0f beats=%llu timeouts=%u\n",
+         use_udp ? "udp" : "wav", (unsigned long long)chunks, audio_s, wall_s, wall_s > 0.0 ? audio_s / wall_s : 0.0,
+         wall_s > 0.0 ? chunks / wall_s : 0.0, (unsigned long long)beats,
+         (unsigned)(get_i2s_timeout_state().timeout_count - timeouts_before));
+  report("audio_step", audio_us);
+  report("render", render_us);
+  report("pipeline", pipeline_us);
+  if (use_udp) {
+    report("end_to_end", e2e_us);
+    printf("  udp packets=%llu lost=%llu malformed=%llu overflow_samples=%llu\n",
+           (unsigned long long)udp.packets, (unsigned long long)udp.lost_packets,
+           (unsigned long long)udp.bad_packets, (unsigned long long)udp.overflow_samples);
+    udp_pcm_source_close(&udp);
+  }
+  return 0;
+}
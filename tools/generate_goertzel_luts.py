@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""
+Generate flash-resident lookup tables for the Goertzel note analysis.
+
+The Gaussian window (window_lookup[4096], 16 KB), the quarter-step note table
+and the per-bin Goertzel constants used to be computed into DRAM at boot by
+init_window_lookup() and init_goertzel_constants_musical(). As const arrays
+they live in flash/rodata and boot does no exp/cos work.
+
+Values are computed the way the boot-time code computed them (float32
+intermediates where the C++ used float), so the tables read the same as the
+old runtime values; test/test_goertzel_lut checks this on host.
+
+Output: firmware/src/audio/goertzel_lut.h
+Usage: python3 tools/generate_goertzel_luts.py > firmware/src/audio/goertzel_lut.h
+"""
+
+import math
+import struct
+import sys
+
+# Configuration (must match audio_config.h / goertzel.h; goertzel.cpp static_asserts it)
+AUDIO_SAMPLE_RATE_HZ = 12800
+NUM_FREQS = 64
+BOTTOM_NOTE = 12
+NOTE_STEP = 2
+SAMPLE_HISTORY_LENGTH = 4096
+WINDOW_LENGTH = 4096
+WINDOW_SIGMA = 0.8
+PI = 3.1415926535897932384626433832795  # Arduino PI
+
+# Quarter-step note table from 55 Hz
+NOTES = [
+    55.0, 56.635235, 58.27047, 60.00294, 61.73541, 63.5709, 65.40639, 67.351025, 69.29566, 71.355925,
+    73.41619, 75.59897, 77.78175, 80.09432, 82.40689, 84.856975, 87.30706, 89.902835, 92.49861, 95.248735,
+    97.99886, 100.91253, 103.8262, 106.9131, 110.0, 113.27045, 116.5409, 120.00585, 123.4708, 127.1418,
+    130.8128, 134.70205, 138.5913, 142.71185, 146.8324, 151.19795, 155.5635, 160.18865, 164.8138, 169.71395,
+    174.6141, 179.80565, 184.9972, 190.49745, 195.9977, 201.825, 207.6523, 213.82615, 220.0, 226.54095,
+    233.0819, 240.0118, 246.9417, 254.28365, 261.6256, 269.4041, 277.1826, 285.4237, 293.6648, 302.3959,
+    311.127, 320.3773, 329.6276, 339.4279, 349.2282, 359.6113, 369.9944, 380.9949, 391.9954, 403.65005,
+    415.3047, 427.65235, 440.0, 453.0819, 466.1638, 480.02355, 493.8833, 508.5672, 523.2511, 538.8082,
+    554.3653, 570.8474, 587.3295, 604.79175, 622.254, 640.75455, 659.2551, 678.8558, 698.4565, 719.22265,
+    739.9888, 761.98985, 783.9909, 807.30015, 830.6094, 855.3047, 880.0, 906.16375, 932.3275, 960.04705,
+    987.7666, 1017.1343, 1046.502, 1077.6165, 1108.731, 1141.695, 1174.659, 1209.5835, 1244.508, 1281.509,
+    1318.51, 1357.7115, 1396.913, 1438.4455, 1479.978, 1523.98, 1567.982, 1614.6005, 1661.219, 1710.6095,
+    1760.0, 1812.3275, 1864.655, 1920.094, 1975.533, 2034.269, 2093.005, 2155.233, 2217.461, 2283.3895,
+    2349.318, 2419.167, 2489.016, 2563.018, 2637.02, 2715.4225, 2793.825, 2876.8905, 2959.956, 3047.96,
+    3135.964, 3229.2005, 3322.437, 3421.2185, 3520.0, 3624.655, 3729.31, 3840.1875, 3951.065, 4068.537,
+    4186.009, 4310.4655, 4434.922, 4566.779, 4698.636, 4838.334, 4978.032, 5126.0365, 5274.041, 5430.8465,
+    5587.652, 5753.7815, 5919.911, 6095.919, 6271.927, 6458.401, 6644.875, 6842.4375, 7040.0, 7249.31,
+    7458.62, 7680.375, 7902.13, 8137.074, 8372.018, 8620.931, 8869.844, 9133.558, 9397.272, 9676.668,
+    9956.064, 10252.072, 10548.08, 10861.69, 11175.3, 11507.56, 11839.82, 12191.835, 12543.85, 12916.8,
+    13289.75, 13684.875, 14080.0, 14498.62, 14917.24, 15360.75, 15804.26, 16274.145, 16744.03, 17241.855,
+    17739.68, 18267.11, 18794.54, 19353.36, 19912.18, 20504.17, 21096.16, 21723.38, 22350.6, 23015.12,
+    23679.64, 24383.67, 25087.7, 25833.6, 26579.5, 27369.75, 28160.0, 28997.24, 29834.48, 30721.5,
+    31608.52, 32548.295, 33488.07, 34483.72, 35479.37, 36534.225, 37589.08, 38706.665, 39824.25, 41008.285,
+    42192.32, 43446.76, 44701.2, 46030.24, 47359.28, 48767.34, 50175.4, 51667.2,
+]
+
+
+def f32(x):
+    """Round a double to the nearest float32, as a C++ float assignment does."""
+    return struct.unpack("f", struct.pack("f", x))[0]
+
+
+def c_float(x):
+    """float32 literal that parses back to the same value."""
+    text = f"{f32(x):.9g}"
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def window_value(i):
+    """One half of the mirrored Gaussian, as init_window_lookup() computed it."""
+    half = WINDOW_LENGTH // 2
+    sigma = f32(WINDOW_SIGMA)
+    n_minus_half = f32(i - half // 2)
+    x = f32(n_minus_half / f32(f32(sigma * half) / 2))
+    return f32(math.exp(-0.5 * math.pow(x, 2)))
+
+
+def bin_constants(i):
+    """Goertzel constants of note bin i, as init_goertzel() computed them."""
+    note = BOTTOM_NOTE + i * NOTE_STEP
+    target = f32(NOTES[note])
+    if note == 0:
+        left, right = NOTES[note], NOTES[note + 1]
+    elif note == NUM_FREQS - 1:
+        left, right = NOTES[note - 1], NOTES[note]
+    else:
+        left, right = NOTES[note - 1], NOTES[note + 1]
+    distance = max(abs(f32(target - f32(left))), abs(f32(target - f32(right))))
+    bandwidth = f32(distance * 4.0)
+
+    block_size = int(f32(AUDIO_SAMPLE_RATE_HZ / bandwidth))
+    block_size -= block_size % 4
+    block_size = min(block_size, SAMPLE_HISTORY_LENGTH - 1)
+
+    window_step = f32(4096.0 / block_size)
+    k = float(int(0.5 + f32(f32(block_size * target) / AUDIO_SAMPLE_RATE_HZ)))
+    w = f32((2.0 * PI * k) / block_size)
+    coeff = f32(2.0 * f32(math.cos(w)))
+    return target, block_size, window_step, k, coeff
+
+
+def generate_goertzel_lut():
+    """Generate C header with the window, note and bin tables."""
+    print("// Auto-generated by tools/generate_goertzel_luts.py")
+    print("// DO NOT EDIT MANUALLY")
+    print("//")
+    print("// Flash-resident tables for the Goertzel note analysis: the Gaussian block")
+    print("// window, the quarter-step note table and each note bin's constants.")
+    print("// Included by goertzel.cpp only (the arrays are defined here).")
+    print()
+    print("#ifndef GOERTZEL_LUT_H")
+    print("#define GOERTZEL_LUT_H")
+    print()
+    print("#include <stdint.h>")
+    print()
+    print("// Configuration the tables were generated for")
+    print(f"#define GOERTZEL_LUT_SAMPLE_RATE_HZ {AUDIO_SAMPLE_RATE_HZ}")
+    print(f"#define GOERTZEL_LUT_NUM_FREQS {NUM_FREQS}")
+    print(f"#define GOERTZEL_LUT_BOTTOM_NOTE {BOTTOM_NOTE}")
+    print(f"#define GOERTZEL_LUT_NOTE_STEP {NOTE_STEP}")
+    print(f"#define GOERTZEL_LUT_WINDOW_LENGTH {WINDOW_LENGTH}")
+    print()
+    print("// Note bin constants (init_goertzel())")
+    print("struct GoertzelBinConstants {")
+    print("    float target_freq;                   // Note frequency (Hz)")
+    print("    uint16_t block_size;                 // Samples per block (multiple of 4)")
+    print("    float window_step;                   // window_lookup[] increment per sample")
+    print("    float k;                             // DFT index of the note in the block")
+    print("    float coeff;                         // 2*cos(2*pi*k / block_size)")
+    print("};")
+    print()
+    print(f"// {NUM_FREQS} half-step bins from notes[{BOTTOM_NOTE}]")
+    print(f"const GoertzelBinConstants GOERTZEL_BIN_LUT[{NUM_FREQS}] = {{")
+    for i in range(NUM_FREQS):
+        target, block_size, window_step, k, coeff = bin_constants(i)
+        print(f"    {{ {c_float(target):>12}, {block_size:4d}, {c_float(window_step):>14}, "
+              f"{c_float(k):>7}, {c_float(coeff):>15} }},  // Bin {i:2d}")
+    print("};")
+    print()
+    print(f"// Quarter-step notes from 55 Hz ({len(NOTES)} entries)")
+    print(f"const float notes[{len(NOTES)}] = {{")
+    for row in range(0, len(NOTES), 8):
+        print("    " + ", ".join(c_float(v) for v in NOTES[row:row + 8]) + ",")
+    print("};")
+    print()
+    print(f"// Gaussian block window (sigma {WINDOW_SIGMA}), mirrored about the centre")
+    print(f"const float window_lookup[{WINDOW_LENGTH}] = {{")
+    half = [window_value(i) for i in range(WINDOW_LENGTH // 2)]
+    values = half + half[::-1]
+    for row in range(0, WINDOW_LENGTH, 8):
+        print("    " + ", ".join(c_float(v) for v in values[row:row + 8]) + ",")
+    print("};")
+    print()
+    print("#endif  // GOERTZEL_LUT_H")
+
+
+def main():
+    """Main entry point."""
+    try:
+        generate_goertzel_lut()
+        return 0
+    except Exception as e:
+        print(f"Error generating Goertzel LUT: {e}", file=sys.stderr)
+        return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,169 @@
+// Binary realtime telemetry frames (mirror of firmware/src/realtime_frame.{h,cpp}).
+// Keep the layout and quantization in sync with the firmware codec.
+
+const MAGIC0 = 0x4b; // 'K'
+const MAGIC1 = 0x31; // '1'
+const VERSION = 1;
+const FLAG_KEYFRAME = 0x01;
+const SPECTRUM_BINS = 64;
+const CHROMA_BINS = 12;
+const HEADER_BYTES = 12;
+const STATE_BYTES = 112;
+const BITMAP_BYTES = STATE_BYTES / 8;
+const KEYFRAME_INTERVAL = 30;
+
+// State record offsets
+const OFF = {
+  fps: 0, frame_time_us: 2, render_avg_us: 4, quantize_avg_us: 6, rmt_wait_avg_us: 8, rmt_tx_avg_us: 10,
+  cpu_percent: 12, memory_percent: 13, memory_free_kb: 14,
+  vu_level: 16, vu_level_raw: 17, tempo_confidence: 18, locked_tempo_bpm: 19, tempo_lock_state: 21,
+  spectrum: 22, chromagram: 22 + SPECTRUM_BINS, params: 22 + SPECTRUM_BINS + CHROMA_BINS,
+  current_pattern: 22 + SPECTRUM_BINS + CHROMA_BINS + 13,
+};
+const UNIT_PARAMS = ['brightness', 'softness', 'color', 'color_range', 'saturation', 'warmth', 'background', 'dithering', 'speed'];
+const CUSTOM_PARAMS = ['custom_param_1', 'custom_param_2', 'custom_param_3'];
+
+// Round half away from zero like lroundf(); NaN/negative -> 0
+function sat(v, scale, max) {
+  const s = Number(v) * scale;
+  if (!(s > 0)) return 0;
+  if (s >= max) return max;
+  return Math.floor(s + 0.5);
+}
+const qUnit = (v) => sat(v, 255, 255);
+
+function quantize(d) {
+  const s = Buffer.alloc(STATE_BYTES);
+  const p = d.performance || {};
+  const a = d.audio || {};
+  const prm = d.parameters || {};
+  s.writeUInt16LE(sat(p.fps, 10, 65535), OFF.fps);
+  s.writeUInt16LE(sat(p.frame_time_us, 1, 65535), OFF.frame_time_us);
+  s.writeUInt16LE(sat(p.render_avg_us, 1, 65535), OFF.render_avg_us);
+  s.writeUInt16LE(sat(p.quantize_avg_us, 1, 65535), OFF.quantize_avg_us);
+  s.writeUInt16LE(sat(p.rmt_wait_avg_us, 1, 65535), OFF.rmt_wait_avg_us);
+  s.writeUInt16LE(sat(p.rmt_tx_avg_us, 1, 65535), OFF.rmt_tx_avg_us);
+  s[OFF.cpu_percent] = sat(p.cpu_percent, 2, 255);
+  s[OFF.memory_percent] = sat(p.memory_percent, 2, 255);
+  s.writeUInt16LE(sat(p.memory_free_kb, 1, 65535), OFF.memory_free_kb);
+  s[OFF.vu_level] = qUnit(a.vu_level);
+  s[OFF.vu_level_raw] = qUnit(a.vu_level_raw);
+  s[OFF.tempo_confidence] = qUnit(a.tempo_confidence);
+  s.writeUInt16LE(sat(a.locked_tempo_bpm, 10, 65535), OFF.locked_tempo_bpm);
+  s[OFF.tempo_lock_state] = (a.tempo_lock_state | 0) & 0xff;
+  for (let i = 0; i < SPECTRUM_BINS; i++) s[OFF.spectrum + i] = qUnit((a.spectrum || [])[i]);
+  for (let i = 0; i < CHROMA_BINS; i++) s[OFF.chromagram + i] = qUnit((a.chromagram || [])[i]);
+  UNIT_PARAMS.forEach((k, i) => { s[OFF.params + i] = qUnit(prm[k]); });
+  s[OFF.params + 9] = (prm.palette_id | 0) & 0xff;
+  CUSTOM_PARAMS.forEach((k, i) => { s[OFF.params + 10 + i] = qUnit(prm[k]); });
+  s[OFF.current_pattern] = (d.current_pattern | 0) & 0xff;
+  return s;
+}
+
+function dequantize(s) {
+  const parameters = {};
+  UNIT_PARAMS.forEach((k, i) => { parameters[k] = s[OFF.params + i] / 255; });
+  parameters.palette_id = s[OFF.params + 9];
+  CUSTOM_PARAMS.forEach((k, i) => { parameters[k] = s[OFF.params + 10 + i] / 255; });
+  return {
+    performance: {
+      fps: s.readUInt16LE(OFF.fps) / 10,
+      frame_time_us: s.readUInt16LE(OFF.frame_time_us),
+      render_avg_us: s.readUInt16LE(OFF.render_avg_us),
+      quantize_avg_us: s.readUInt16LE(OFF.quantize_avg_us),
+      rmt_wait_avg_us: s.readUInt16LE(OFF.rmt_wait_avg_us),
+      rmt_tx_avg_us: s.readUInt16LE(OFF.rmt_tx_avg_us),
+      cpu_percent: s[OFF.cpu_percent] / 2,
+      memory_percent: s[OFF.memory_percent] / 2,
+      memory_free_kb: s.readUInt16LE(OFF.memory_free_kb),
+    },
+    audio: {
+      vu_level: s[OFF.vu_level] / 255,
+      vu_level_raw: s[OFF.vu_level_raw] / 255,
+      tempo_confidence: s[OFF.tempo_confidence] / 255,
+      locked_tempo_bpm: s.readUInt16LE(OFF.locked_tempo_bpm) / 10,
+      tempo_lock_state: s[OFF.tempo_lock_state],
+      spectrum: Array.from(s.subarray(OFF.spectrum, OFF.spectrum + SPECTRUM_BINS), (v) => v / 255),
+      chromagram: Array.from(s.subarray(OFF.chromagram, OFF.chromagram + CHROMA_BINS), (v) => v / 255),
+    },
+    parameters,
+    current_pattern: s[OFF.current_pattern],
+  };
+}
+
+function header(flags, seq, baseSeq, timestampMs) {
+  const h = Buffer.alloc(HEADER_BYTES);
+  h[0] = MAGIC0; h[1] = MAGIC1; h[2] = VERSION; h[3] = flags;
+  h.writeUInt16LE(seq, 4);
+  h.writeUInt16LE(baseSeq, 6);
+  h.writeUInt32LE(timestampMs >>> 0, 8);
+  return h;
+}
+
+class Encoder {
+  constructor() { this.seq = 0; this.state = null; this.sinceKey = 0; }
+  reset() { this.state = null; this.sinceKey = 0; }
+
+  // data: same shape as the JSON "realtime" message (+ audio.spectrum/chromagram)
+  encode(data, timestampMs) {
+    const state = quantize(data);
+    const baseSeq = this.seq;
+    const seq = (this.seq + 1) & 0xffff;
+    let body = null;
+    if (this.state && this.sinceKey < KEYFRAME_INTERVAL) {
+      const bitmap = Buffer.alloc(BITMAP_BYTES);
+      const changed = [];
+      for (let i = 0; i < STATE_BYTES; i++) {
+        if (state[i] !== this.state[i]) { bitmap[i >> 3] |= 1 << (i & 7); changed.push(state[i]); }
+      }
+      if (BITMAP_BYTES + changed.length < STATE_BYTES) body = Buffer.concat([bitmap, Buffer.from(changed)]);
+    }
+    let out;
+    if (body) {
+      out = Buffer.concat([header(0, seq, baseSeq, timestampMs), body]);
+      this.sinceKey++;
+    } else {
+      out = Buffer.concat([header(FLAG_KEYFRAME, seq, seq, timestampMs), state]);
+      this.sinceKey = 0;
+    }
+    this.state = state;
+    this.seq = seq;
+    return out;
+  }
+}
+
+class Decoder {
+  constructor() { this.seq = 0; this.state = null; }
+
+  // Returns { ok: true, frame, timestamp_ms } or { ok: false, error }
+  decode(buf) {
+    buf = Buffer.from(buf);
+    if (buf.length < HEADER_BYTES) return { ok: false, error: 'truncated' };
+    if (buf[0] !== MAGIC0 || buf[1] !== MAGIC1) return { ok: false, error: 'bad_magic' };
+    if (buf[2] !== VERSION) return { ok: false, error: 'bad_version' };
+    const seq = buf.readUInt16LE(4);
+    const baseSeq = buf.readUInt16LE(6);
+    const body = buf.subarray(HEADER_BYTES);
+    let state;
+    if (buf[3] & FLAG_KEYFRAME) {
+      if (body.length < STATE_BYTES) return { ok: false, error: 'truncated' };
+      state = Buffer.from(body.subarray(0, STATE_BYTES));
+    } else {
+      if (!this.state || baseSeq !== this.seq) return { ok: false, error: 'need_keyframe' };
+      if (body.length < BITMAP_BYTES) return { ok: false, error: 'truncated' };
+      state = Buffer.from(this.state);
+      let n = BITMAP_BYTES;
+      for (let i = 0; i < STATE_BYTES; i++) {
+        if (body[i >> 3] & (1 << (i & 7))) {
+          if (n >= body.length) return { ok: false, error: 'truncated' };
+          state[i] = body[n++];
+        }
+      }
+    }
+    this.state = state;
+    this.seq = seq;
+    return { ok: true, frame: dequantize(state), timestamp_ms: buf.readUInt32LE(8) };
+  }
+}
+
+module.exports = { VERSION, KEYFRAME_INTERVAL, HEADER_BYTES, STATE_BYTES, Encoder, Decoder, quantize, dequantize };
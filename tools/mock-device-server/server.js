@@ -4,6 +4,8 @@
 const http = require('http');
 const fs = require('fs');
 const path = require('path');
+const crypto = require('crypto');
+const realtimeFrame = require('./realtime_frame');
 
 const PORT = Number(process.env.MOCK_DEVICE_PORT || 8080);
 const UI_ROOT = path.resolve(__dirname, '../../firmware/data/ui');
@@ -376,6 +378,28 @@ const server = http.createServer((req, res) => {
     return; // Defer response to 'end'
   }
 
+  if (path === '/api/realtime/config') {
+    if (method === 'GET') return ok(res, realtimeConfigResponse());
+    if (method === 'POST') {
+      let body = '';
+      req.on('data', (chunk) => (body += chunk));
+      req.on('end', () => {
+        try {
+          const update = body ? JSON.parse(body) : {};
+          if (typeof update.enabled === 'boolean') realtimeConfig.enabled = update.enabled;
+          if (Number.isInteger(update.interval_ms)) realtimeConfig.interval_ms = Math.min(5000, Math.max(100, update.interval_ms));
+          if (Number.isInteger(update.binary_interval_ms)) realtimeConfig.binary_interval_ms = Math.min(5000, Math.max(16, update.binary_interval_ms));
+          restartRealtimeTimers();
+          return ok(res, realtimeConfigResponse());
+        } catch (e) {
+          return json(res, 400, { error: 'Bad Request' });
+        }
+      });
+      return; // Defer response to 'end'
+    }
+    return methodNotAllowed(res);
+  }
+
   if (path === '/api/rmt/diag') {
     if (method !== 'GET') return methodNotAllowed(res);
     return ok(res, {
@@ -408,8 +432,171 @@ const server = http.createServer((req, res) => {
   return notFound(res);
 });
 
+// ---------------------------------------------------------------------------
+// Realtime WebSocket (/ws): JSON text frames by default, binary delta frames
+// after {"type":"subscribe","format":"binary"} (see realtime_frame.js)
+// ---------------------------------------------------------------------------
+
+const WS_GUID = '258EAFA5-E914-47DA-95CA-C5AB0DC85B11';
+const realtimeConfig = { enabled: true, interval_ms: 250, binary_interval_ms: 33 };
+const wsClients = new Set();
+const realtimeEncoder = new realtimeFrame.Encoder();
+let nextClientId = 1;
+let jsonTimer = null;
+let binaryTimer = null;
+
+function realtimeConfigResponse() {
+  return { ...realtimeConfig, binary_version: realtimeFrame.VERSION };
+}
+
+function wsSend(client, opcode, payload) {
+  const len = payload.length;
+  let head;
+  if (len < 126) {
+    head = Buffer.from([0x80 | opcode, len]);
+  } else if (len < 65536) {
+    head = Buffer.alloc(4);
+    head[0] = 0x80 | opcode; head[1] = 126; head.writeUInt16BE(len, 2);
+  } else {
+    head = Buffer.alloc(10);
+    head[0] = 0x80 | opcode; head[1] = 127; head.writeBigUInt64BE(BigInt(len), 2);
+  }
+  if (!client.socket.destroyed) client.socket.write(Buffer.concat([head, payload]));
+}
+
+const wsText = (client, obj) => wsSend(client, 0x1, Buffer.from(JSON.stringify(obj)));
+
+// Parse complete client frames from client.buffer (clients always mask)
+function wsReadFrames(client, onFrame) {
+  let buf = client.buffer;
+  while (buf.length >= 2) {
+    const opcode = buf[0] & 0x0f;
+    let len = buf[1] & 0x7f;
+    let off = 2;
+    if (len === 126) { if (buf.length < 4) break; len = buf.readUInt16BE(2); off = 4; }
+    else if (len === 127) { if (buf.length < 10) break; len = Number(buf.readBigUInt64BE(2)); off = 10; }
+    const masked = (buf[1] & 0x80) !== 0;
+    const maskOff = off;
+    if (masked) off += 4;
+    if (buf.length < off + len) break;
+    const payload = Buffer.from(buf.subarray(off, off + len));
+    if (masked) for (let i = 0; i < len; i++) payload[i] ^= buf[maskOff + (i & 3)];
+    onFrame(opcode, payload);
+    buf = buf.subarray(off + len);
+  }
+  client.buffer = buf;
+}
+
+function handleWsMessage(client, text) {
+  let msg = null;
+  try { msg = JSON.parse(text); } catch (e) { /* not JSON: echo below */ }
+  if (msg && msg.type === 'subscribe') {
+    client.format = msg.format === 'binary' ? 'binary' : 'json';
+    if (client.format === 'binary') realtimeEncoder.reset();
+    const resp = { type: 'subscribed', format: client.format };
+    if (client.format === 'binary') {
+      resp.version = realtimeFrame.VERSION;
+      resp.interval_ms = realtimeConfig.binary_interval_ms;
+    }
+    return wsText(client, resp);
+  }
+  if (msg && msg.type === 'keyframe') return realtimeEncoder.reset();
+  wsText(client, { type: 'echo', message: text, timestamp: Date.now() });
+}
+
+server.on('upgrade', (req, socket) => {
+  const key = req.headers['sec-websocket-key'];
+  if ((req.url || '').split('?')[0] !== '/ws' || !key) {
+    socket.end('HTTP/1.1 400 Bad Request\r\n\r\n');
+    return;
+  }
+  const accept = crypto.createHash('sha1').update(key + WS_GUID).digest('base64');
+  socket.write('HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n' +
+    `Sec-WebSocket-Accept: ${accept}\r\n\r\n`);
+
+  const client = { id: nextClientId++, socket, format: 'json', buffer: Buffer.alloc(0) };
+  wsClients.add(client);
+  process.stdout.write(`[MockDevice] WS client #${client.id} connected\n`);
+  wsText(client, { type: 'welcome', client_id: client.id, timestamp: Date.now(), formats: ['json', 'binary'], binary_version: realtimeFrame.VERSION });
+
+  socket.on('data', (chunk) => {
+    client.buffer = Buffer.concat([client.buffer, chunk]);
+    wsReadFrames(client, (opcode, payload) => {
+      if (opcode === 0x1) handleWsMessage(client, payload.toString('utf8'));
+      else if (opcode === 0x9) wsSend(client, 0xA, payload);
+      else if (opcode === 0x8) { wsSend(client, 0x8, Buffer.alloc(0)); socket.end(); }
+    });
+  });
+  const drop = () => wsClients.delete(client);
+  socket.on('close', drop);
+  socket.on('error', drop);
+});
+
+// Synthetic telemetry in the JSON "realtime" shape (+ spectrum/chromagram)
+function mockRealtimeData() {
+  const t = Date.now() / 1000;
+  const beat = Math.pow(Math.max(0, Math.cos(t * Math.PI * 2)), 8); // 120 BPM pulse
+  return {
+    type: 'realtime',
+    timestamp: Date.now(),
+    performance: {
+      fps: 118 + 4 * Math.sin(t * 0.5),
+      frame_time_us: 8200,
+      render_avg_us: 5100,
+      quantize_avg_us: 410,
+      rmt_wait_avg_us: 600,
+      rmt_tx_avg_us: 2100,
+      cpu_percent: 42 + 5 * Math.sin(t * 0.3),
+      memory_percent: 37.5,
+      memory_free_kb: 182,
+    },
+    audio: {
+      vu_level: 0.3 + 0.6 * beat,
+      vu_level_raw: 0.35 + 0.6 * beat,
+      tempo_confidence: 0.8,
+      locked_tempo_bpm: 120,
+      tempo_lock_state: 2,
+      tempo_lock_state_name: 'LOCKED',
+      spectrum: Array.from({ length: 64 }, (_, i) => Math.max(0, Math.min(1, (1 - i / 64) * (0.4 + 0.6 * beat) + 0.05 * Math.sin(t * 3 + i)))),
+      chromagram: Array.from({ length: 12 }, (_, i) => 0.5 + 0.5 * Math.sin(t + i * 0.5)),
+    },
+    parameters: { ...global.__k1_params, dithering: 1.0, custom_param_1: 0.5, custom_param_2: 0.5, custom_param_3: 0.5 },
+    current_pattern: global.__k1_current_pattern ? global.__k1_current_pattern.index : 0,
+  };
+}
+
+function broadcastJson() {
+  if (!realtimeConfig.enabled) return;
+  const clients = [...wsClients].filter((c) => c.format === 'json');
+  if (clients.length === 0) return;
+  const data = mockRealtimeData();
+  // Firmware JSON carries the lock state as a string and no arrays
+  const msg = { ...data, audio: { ...data.audio, tempo_lock_state: data.audio.tempo_lock_state_name } };
+  delete msg.audio.tempo_lock_state_name;
+  delete msg.audio.spectrum;
+  delete msg.audio.chromagram;
+  const payload = Buffer.from(JSON.stringify(msg));
+  clients.forEach((c) => wsSend(c, 0x1, payload));
+}
+
+function broadcastBinary() {
+  if (!realtimeConfig.enabled) return;
+  const clients = [...wsClients].filter((c) => c.format === 'binary');
+  if (clients.length === 0) return;
+  const frame = realtimeEncoder.encode(mockRealtimeData(), Date.now());
+  clients.forEach((c) => wsSend(c, 0x2, frame));
+}
+
+function restartRealtimeTimers() {
+  clearInterval(jsonTimer);
+  clearInterval(binaryTimer);
+  jsonTimer = setInterval(broadcastJson, realtimeConfig.interval_ms);
+  binaryTimer = setInterval(broadcastBinary, realtimeConfig.binary_interval_ms);
+}
+
 server.listen(PORT, () => {
   console.log(`[MockDevice] Listening on http://localhost:${PORT}`);
+  restartRealtimeTimers();
 });
 
 function pathResolve(rel) {
@@ -0,0 +1,88 @@
+// Palette LUT benchmark: color_from_palette() calls/second with the per-call
+// keyframe search (old path) vs the 256-entry PaletteCache lookup.
+// Build: g++ -O2 -std=c++17 -Ifirmware/src tools/palette_lut_bench.cpp -o palette_lut_bench
+// Run:   ./palette_lut_bench --frames 20000
+//
+// Each frame calls the palette once per LED (160) with a moving progress, as
+// the spectrum/tunnel/LGP families do. Keyframe counts span 5..13 entries.
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "lut/palette_lut.h"
+
+static const int kLeds = 160;
+
+// Keyframe data copied from palettes.cpp: {position, R, G, B}
+static const uint8_t palette_rivendell[] = {
+  0, 1, 14, 5,  101, 16, 36, 14,  165, 56, 68, 30,  242, 150, 156, 99,  255, 150, 156, 99
+};
+static const uint8_t palette_sunset_real[] = {
+  0, 120, 0, 0,  22, 179, 22, 0,  51, 255, 104, 0,  85, 167, 22, 18,
+  135, 100, 0, 103,  198, 16, 0, 130,  255, 0, 0, 160
+};
+static const uint8_t palette_lava[] = {
+  0, 0, 0, 0,  46, 18, 0, 0,  96, 113, 0, 0,  108, 142, 3, 1,  119, 175, 17, 1,
+  146, 213, 44, 2,  174, 255, 82, 4,  188, 255, 115, 4,  202, 255, 156, 4,
+  218, 255, 203, 4,  234, 255, 255, 4,  244, 255, 255, 71,  255, 255, 255, 255
+};
+
+struct Palette {
+  const char* name;
+  const uint8_t* data;
+  uint8_t num_entries;
+};
+
+static const Palette kPalettes[] = {
+  {"rivendell (5 keyframes)", palette_rivendell, sizeof(palette_rivendell) / 4},
+  {"sunset_real (7 keyframes)", palette_sunset_real, sizeof(palette_sunset_real) / 4},
+  {"lava (13 keyframes)", palette_lava, sizeof(palette_lava) / 4},
+};
+
+static volatile float sink;
+
+// Old color_from_palette(): wrap, quantize, keyframe search, interpolate
+static CRGBF search_color(const Palette& p, float progress, float brightness) {
+  progress = fmodf(progress, 1.0f);
+  if (progress < 0.0f) progress += 1.0f;
+  CRGBF c = palette_keyframe_sample(p.data, p.num_entries, (uint8_t)(progress * 255.0f));
+  return {c.r * brightness, c.g * brightness, c.b * brightness};
+}
+
+template <typename Fn>
+static double calls_per_second(uint32_t frames, Fn color) {
+  float acc = 0.0f;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t f = 0; f < frames; f++) {
+    float phase = f * 0.0037f;
+    for (int i = 0; i < kLeds; i++) {
+      CRGBF c = color(phase + i * (1.0f / kLeds), 0.8f);
+      acc += c.r + c.g + c.b;
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  sink = acc;
+  double s = std::chrono::duration<double>(t1 - t0).count();
+  return (double)frames * kLeds / s;
+}
+
+int main(int argc, char** argv) {
+  uint32_t frames = 20000;
+  for (int i = 1; i < argc; i++) {
+    if (std::string(argv[i]) == "--frames" && i + 1 < argc) frames = (uint32_t)std::stoul(argv[++i]);
+  }
+
+  std::printf("frames=%u leds=%d\n", frames, kLeds);
+  for (const Palette& p : kPalettes) {
+    PaletteCache cache;
+    cache.init(p.data, p.num_entries, 0);
+    double before = calls_per_second(frames, [&](float x, float b) { return search_color(p, x, b); });
+    double after = calls_per_second(frames, [&](float x, float b) { return cache.get(x, b); });
+    std::printf("%-28s search %8.1f Mcalls/s   cache %8.1f Mcalls/s   x%.1f\n",
+                p.name, before / 1e6, after / 1e6, after / before);
+  }
+  return 0;
+}
@@ -0,0 +1,224 @@
+// Spectrum engine benchmark: cost and accuracy of the engines that can produce
+// the 64 note bins, so each deployment can pick the cheaper one that is
+// accurate enough:
+//   block Goertzel, 1 and 4 lanes   (GOERTZEL_SLIDING_ENABLED 0, GOERTZEL_BLOCK_LANES)
+//   sliding Goertzel                (default)
+//   octave pyramid, 4 lanes         (GOERTZEL_OCTAVE_PYRAMID_ENABLED 1)
+//   constant-Q FFT                  (CONSTANT_Q_FFT_ENABLED 1)
+// Build: g++ -O2 -std=gnu++17 -Ifirmware/src/audio tools/spectrum_engine_bench.cpp \
+//          firmware/src/audio/goertzel_block.cpp firmware/src/audio/sliding_goertzel.cpp \
+//          firmware/src/audio/constant_q.cpp firmware/src/audio/octave_pyramid.cpp -o spectrum_engine_bench
+// Run:   ./spectrum_engine_bench [--frames 4000] [--threshold 0.1]
+//        (--threshold is the constant-Q kernel cut; lower is more accurate but
+//        needs a larger CONSTANT_Q_KERNEL_CAPACITY)
+//
+// Every engine sees the same 12.8 kHz signal (a slow log chirp over the note
+// range plus a second tone and noise) in 64-sample chunks, one analysis per
+// chunk as calculate_magnitudes() runs. Cost covers everything an engine does
+// per chunk (the sliding engine's per-sample ingest and one-bin resync
+// included). Accuracy is against the one-bin block engine, whose output the
+// rest of the pipeline is tuned on: RMS and worst bin error as a fraction of
+// the frame's strongest bin, and how often the strongest bin differs (on the
+// chirp, most of the octave pyramid's error is its half-band delay on the low
+// bins; a steady tone reads within ~2% of peak). Cycles are read with rdtsc on
+// x86 hosts; on device only the ratios carry over.
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_RDTSC 1
+#endif
+
+#include "constant_q.h"
+#include "goertzel_block.h"
+#include "octave_pyramid.h"
+#include "sliding_goertzel.h"
+
+static const int kRate = 12800;
+static const int kChunk = 64;
+static const int kBins = 64;
+static const int kHistory = 4096;
+
+static float window_lookup[4096];
+static float history_storage[kHistory];
+static SampleRing history;
+static GoertzelBlockBin block_bins[kBins];
+static SlidingGoertzelBin sliding_bins[kBins];
+static SlidingGoertzelBank sliding_bank;
+static ConstantQ constant_q;
+static OctavePyramid octave_pyramid;
+static float reference[kBins];
+static volatile float sink;
+
+static uint64_t now_cycles() {
+#ifdef HAVE_RDTSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// Same window and note bin layout as goertzel_lut.h (tools/generate_goertzel_luts.py)
+static void setup_bins() {
+  for (int i = 0; i < 2048; i++) {
+    float w = std::exp(-0.5 * std::pow((i - 1024) / (0.8 * 1024), 2));
+    window_lookup[i] = w;
+    window_lookup[4095 - i] = w;
+  }
+  sliding_goertzel_reset(&sliding_bank, sliding_bins, kBins, window_lookup, 4096);
+  for (int i = 0; i < kBins; i++) {
+    const double f = 77.78175 * std::pow(2.0, i / 12.0);
+    const double bandwidth = 4.0 * f * (std::pow(2.0, 1.0 / 24.0) - 1.0);
+    uint16_t n = (uint16_t)(kRate / bandwidth);
+    n -= n % 4;
+    const float k = (int)(0.5 + n * f / kRate);
+    block_bins[i] = {n, 4096.0f / n, (float)(2.0 * std::cos(2.0 * M_PI * k / n))};
+    sliding_goertzel_configure_bin(&sliding_bank, i, n, k);
+  }
+}
+
+// Log chirp 55 Hz -> 2.4 kHz and back every 20 s, a fixed 1.2 kHz tone and noise.
+// Restarted per engine so all of them see the same samples.
+static uint32_t signal_lcg;
+static double signal_phase;
+
+static void next_chunk(uint32_t chunk_index, float* out) {
+  uint32_t& lcg = signal_lcg;
+  double& phase = signal_phase;
+  for (int i = 0; i < kChunk; i++) {
+    const double t = (double)(chunk_index * kChunk + i) / kRate;
+    const double sweep = std::fabs(std::fmod(t / 10.0, 2.0) - 1.0);
+    const double hz = 55.0 * std::pow(2400.0 / 55.0, 1.0 - sweep);
+    phase += 2.0 * M_PI * hz / kRate;
+    lcg = lcg * 1664525u + 1013904223u;
+    out[i] = (float)(0.4 * std::sin(phase) + 0.1 * std::sin(2.0 * M_PI * 1200.0 * t)) +
+             ((float)(lcg >> 8) / 16777216.0f - 0.5f) * 0.05f;
+  }
+}
+
+struct Result {
+  double ns_per_frame;
+  double cycles_per_frame;
+  double rms_error;
+  double worst_error;
+  double peak_moved_pct;
+};
+
+// Engine: void(const float* chunk, float* magnitudes); called with the history
+// BEFORE the chunk is written (as goertzel_ingest_samples()), analysing after
+template <typename Ingest, typename Analyze>
+static Result run(uint32_t frames, Ingest ingest, Analyze analyze) {
+  sample_ring_init(&history, history_storage, kHistory);
+  signal_lcg = 0x5EEDu;
+  signal_phase = 0.0;
+  float chunk[kChunk];
+  float magnitudes[kBins];
+  // Warm up: fill the history so every block is complete
+  for (uint32_t c = 0; c < kHistory / kChunk; c++) {
+    next_chunk(c, chunk);
+    ingest(chunk);
+    sample_ring_write(&history, chunk, kChunk);
+  }
+
+  double ns = 0.0;
+  uint64_t cycles = 0;
+  double squared_error = 0.0;
+  double worst = 0.0;
+  uint32_t peak_moved = 0;
+  for (uint32_t f = 0; f < frames; f++) {
+    next_chunk(kHistory / kChunk + f, chunk);
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = now_cycles();
+    ingest(chunk);
+    sample_ring_write(&history, chunk, kChunk);
+    analyze(magnitudes);
+    cycles += now_cycles() - c0;
+    ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+
+    int ref_peak = 0;
+    int peak = 0;
+    for (int i = 0; i < kBins; i++) {
+      reference[i] = goertzel_block_magnitude(&history, 1, window_lookup, &block_bins[i]);
+      if (reference[i] > reference[ref_peak]) ref_peak = i;
+      if (magnitudes[i] > magnitudes[peak]) peak = i;
+    }
+    const double scale = reference[ref_peak] > 0.0f ? reference[ref_peak] : 1.0;
+    for (int i = 0; i < kBins; i++) {
+      const double error = std::fabs(magnitudes[i] - reference[i]) / scale;
+      squared_error += error * error;
+      worst = std::fmax(worst, error);
+    }
+    peak_moved += peak != ref_peak;
+    sink = magnitudes[0];
+  }
+  return {ns / frames, (double)cycles / frames, std::sqrt(squared_error / (frames * (double)kBins)), worst,
+          100.0 * peak_moved / frames};
+}
+
+static void report(const char* name, size_t state_bytes, const Result& r) {
+#ifdef HAVE_RDTSC
+  std::printf("%-26s %8.1f us/frame %10.0f cycles/frame %7zu B  rms %.4f  worst %.3f  peak moved %5.1f%%\n", name,
+              r.ns_per_frame / 1000.0, r.cycles_per_frame, state_bytes, r.rms_error, r.worst_error, r.peak_moved_pct);
+#else
+  std::printf("%-26s %8.1f us/frame %7zu B  rms %.4f  worst %.3f  peak moved %5.1f%%\n", name,
+              r.ns_per_frame / 1000.0, state_bytes, r.rms_error, r.worst_error, r.peak_moved_pct);
+#endif
+}
+
+int main(int argc, char** argv) {
+  uint32_t frames = 4000;
+  float threshold = CONSTANT_Q_DEFAULT_THRESHOLD;
+  for (int i = 1; i < argc; i++) {
+    if (std::string(argv[i]) == "--frames" && i + 1 < argc) frames = (uint32_t)std::stoul(argv[++i]);
+    if (std::string(argv[i]) == "--threshold" && i + 1 < argc) threshold = std::stof(argv[++i]);
+  }
+
+  setup_bins();
+  const bool constant_q_ok = constant_q_init(&constant_q, block_bins, kBins, window_lookup, threshold);
+
+  auto no_ingest = [](const float*) {};
+  Result block1 = run(frames, no_ingest, [](float* m) {
+    goertzel_block_magnitudes(&history, 1, window_lookup, block_bins, kBins, 1, m);
+  });
+  Result block4 = run(frames, no_ingest, [](float* m) {
+    goertzel_block_magnitudes(&history, 1, window_lookup, block_bins, kBins, 4, m);
+  });
+  octave_pyramid_init(&octave_pyramid, block_bins, kBins, kRate, OCTAVE_PYRAMID_MAX_LEVELS);
+  Result pyramid = run(
+      frames, [](const float* chunk) { octave_pyramid_push(&octave_pyramid, chunk, kChunk); },
+      [](float* m) { octave_pyramid_magnitudes(&octave_pyramid, &history, window_lookup, 4, m); });
+  Result sliding = run(
+      frames, [](const float* chunk) { sliding_goertzel_ingest(&sliding_bank, &history, chunk, kChunk); },
+      [](float* m) {
+        sliding_goertzel_resync_next(&sliding_bank, &history);
+        for (int i = 0; i < kBins; i++) m[i] = sliding_goertzel_magnitude(&sliding_bank, i);
+      });
+
+  std::printf("frames=%u bins=%d chunk=%d @ %d Hz (errors vs one-bin block engine, fraction of peak bin)\n",
+              frames, kBins, kChunk, kRate);
+  report("block Goertzel, 1 lane", sizeof(block_bins), block1);
+  report("block Goertzel, 4 lanes", sizeof(block_bins), block4);
+  report("sliding Goertzel", sizeof(sliding_bins), sliding);
+  report("octave pyramid, 4 lanes", sizeof(octave_pyramid), pyramid);
+  if (constant_q_ok) {
+    Result cq = run(frames, no_ingest, [](float* m) {
+      static float bands[CONSTANT_Q_FFT_BANDS];
+      constant_q_analyze(&constant_q, &history, 1, m, bands);
+    });
+    char name[64];
+    std::snprintf(name, sizeof(name), "constant-Q FFT, th %.3g", threshold);
+    report(name, sizeof(constant_q), cq);
+    std::printf("constant-Q kernel: %u of %d coefficients\n", (unsigned)constant_q.kernel_used,
+                CONSTANT_Q_KERNEL_CAPACITY);
+  } else {
+    std::printf("constant-Q FFT, th %.3g: kernels exceed CONSTANT_Q_KERNEL_CAPACITY (%d)\n", threshold,
+                CONSTANT_Q_KERNEL_CAPACITY);
+  }
+  return 0;
+}
@@ -0,0 +1,178 @@
+// Tempo bank benchmark: cost per novelty tick of the round-robin block tempo
+// Goertzel (old update_tempo) vs the incremental tempo bank (all 192 bins/tick).
+// Build: g++ -O2 -std=c++17 -Ifirmware/src/audio tools/tempo_bank_bench.cpp \
+//          firmware/src/audio/tempo_bank.cpp firmware/src/audio/sliding_goertzel.cpp -o tempo_bank_bench
+// Run:   ./tempo_bank_bench --ticks 20000
+//
+// One novelty tick (50 Hz) spans two reference frames (100 FPS). Cycles are read
+// with rdtsc on x86 hosts; elsewhere only nanoseconds are reported.
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_RDTSC 1
+#endif
+
+#include "tempo_bank.h"
+
+static const int kHistory = 1024;
+static const int kTempi = 192;
+static const int kNoveltyHz = 50;
+static const int kFramesPerTick = 2;
+
+static float window_lookup[4096];
+static float novelty[kHistory];
+static float novelty_normalized[kHistory];
+static uint16_t block_size[kTempi];
+static float coeff[kTempi], cosine[kTempi], sine[kTempi];
+static float magnitude[kTempi], phase[kTempi];
+static TempoBank bank;
+static volatile float sink;
+
+static uint64_t now_cycles() {
+#ifdef HAVE_RDTSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static void setup_bins() {
+  for (int i = 0; i < 2048; i++) {
+    float w = std::exp(-0.5 * std::pow((i - 1024) / (0.8 * 1024), 2));
+    window_lookup[i] = w;
+    window_lookup[4095 - i] = w;
+  }
+  tempo_bank_reset(&bank, kTempi, window_lookup, 4096);
+  float hz[kTempi];
+  for (int i = 0; i < kTempi; i++) hz[i] = (100.0f * i / kTempi + 50.0f) / 60.0f;
+  for (int i = 0; i < kTempi; i++) {
+    float l = hz[i > 0 ? i - 1 : i], r = hz[i < kTempi - 1 ? i + 1 : i];
+    uint32_t n = (uint32_t)(kNoveltyHz / (std::fmax(std::fabs(l - hz[i]), std::fabs(r - hz[i])) * 0.5f));
+    if (n >= (uint32_t)kHistory) n = kHistory - 1;
+    float k = std::floor(0.5f + n * hz[i] / kNoveltyHz);
+    float w = 2.0f * (float)M_PI * k / n;
+    block_size[i] = (uint16_t)n;
+    cosine[i] = std::cos(w);
+    sine[i] = std::sin(w);
+    coeff[i] = 2.0f * cosine[i];
+    tempo_bank_configure_bin(&bank, i, (uint16_t)n, k);
+  }
+}
+
+// normalize_novelty_curve(): runs every frame in both paths
+static float normalize() {
+  float max_val = 0.00001f;
+  for (int i = 0; i < kHistory; i++) max_val = std::fmax(max_val, novelty[i]);
+  float scale = 1.0f / max_val;
+  for (int i = 0; i < kHistory; i++) novelty_normalized[i] = novelty[i] * scale;
+  return scale;
+}
+
+// calculate_magnitude_of_tempo() block path
+static void block_bin(int bin) {
+  uint32_t n = block_size[bin];
+  float q1 = 0, q2 = 0, pos = 0, step = 4096.0f / n;
+  for (uint32_t i = 0; i < n; i++) {
+    float q0 = coeff[bin] * q1 - q2 + novelty_normalized[(kHistory - 1 - n) + i] * window_lookup[(uint32_t)pos];
+    q2 = q1;
+    q1 = q0;
+    pos += step;
+  }
+  phase[bin] = std::atan2(q2 * sine[bin], q1 - q2 * cosine[bin]);
+  magnitude[bin] = std::sqrt(std::fmax(q1 * q1 + q2 * q2 - q1 * q2 * coeff[bin], 0.0f)) / (n / 2.0f);
+}
+
+static void log_novelty(float value, bool feed_bank) {
+  if (feed_bank) tempo_bank_push(&bank, novelty, kHistory);
+  std::memmove(novelty, novelty + 1, sizeof(float) * (kHistory - 1));
+  novelty[kHistory - 1] = value;
+}
+
+static float next_value(uint32_t t) {
+  return std::log(1.0f + ((t % 25) == 0 ? 0.4f : 0.0f) + 0.05f * ((t * 2654435761u) >> 24) / 256.0f);
+}
+
+struct Result {
+  double ns_per_tick;
+  double cycles_per_tick;
+};
+
+template <typename Fn>
+static Result measure(uint32_t ticks, Fn tick) {
+  auto t0 = std::chrono::steady_clock::now();
+  uint64_t c0 = now_cycles();
+  for (uint32_t t = 0; t < ticks; t++) tick(t);
+  uint64_t c1 = now_cycles();
+  auto t1 = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+  return {ns / ticks, (double)(c1 - c0) / ticks};
+}
+
+static void report(const char* name, const Result& r) {
+#ifdef HAVE_RDTSC
+  std::printf("%-38s %10.0f ns/tick %12.0f cycles/tick\n", name, r.ns_per_tick, r.cycles_per_tick);
+#else
+  std::printf("%-38s %10.0f ns/tick\n", name, r.ns_per_tick);
+#endif
+}
+
+int main(int argc, char** argv) {
+  uint32_t ticks = 20000;
+  for (int i = 1; i < argc; i++) {
+    if (std::string(argv[i]) == "--ticks" && i + 1 < argc) ticks = (uint32_t)std::stoul(argv[++i]);
+  }
+
+  setup_bins();
+
+  // Old update_tempo(): one block bin per frame, tempogram refreshed every ~192 frames
+  uint32_t calc_bin = 0;
+  Result round_robin = measure(ticks, [&](uint32_t t) {
+    log_novelty(next_value(t), false);
+    for (int f = 0; f < kFramesPerTick; f++) {
+      normalize();
+      block_bin(calc_bin);
+      calc_bin = (calc_bin + 1) % kTempi;
+    }
+  });
+
+  // Old path if every bin were refreshed each tick
+  Result full_block = measure(ticks / 20 + 1, [&](uint32_t t) {
+    log_novelty(next_value(t), false);
+    for (int f = 0; f < kFramesPerTick; f++) normalize();
+    for (int b = 0; b < kTempi; b++) block_bin(b);
+  });
+
+  // Tempo bank: push per tick, all 192 bins read back once per tick (as update_tempo())
+  std::memset(novelty, 0, sizeof(novelty));
+  Result incremental = measure(ticks, [&](uint32_t t) {
+    log_novelty(next_value(t), true);
+    float scale = 1.0f;
+    for (int f = 0; f < kFramesPerTick; f++) scale = normalize();
+    for (int b = 0; b < kTempi; b++) {
+      if (b > 0 && tempo_bank_same_slot(&bank, b, b - 1)) {
+        phase[b] = phase[b - 1];
+        magnitude[b] = magnitude[b - 1];
+        continue;
+      }
+      float re, im;
+      tempo_bank_goertzel_output(&bank, b, scale, &re, &im);
+      phase[b] = std::atan2(im, re);
+      magnitude[b] = std::sqrt(re * re + im * im) / (block_size[b] / 2.0f);
+    }
+  });
+
+  sink = magnitude[0] + phase[0];
+
+  std::printf("ticks=%u bins=%d frames/tick=%d\n", ticks, kTempi, kFramesPerTick);
+  report("round-robin block (1 bin/frame)", round_robin);
+  report("block, all bins every tick", full_block);
+  report("tempo bank, all bins every tick", incremental);
+  return 0;
+}
@@ -0,0 +1,119 @@
+// Triple-buffer stress helper: one writer publishes frames, one reader borrows
+// the newest slot and holds it for a simulated render, checking that the
+// borrowed frame is never torn and never changes while held. Writes a CSV row.
+// Build: g++ -O3 -std=c++17 -pthread -Ifirmware/src/audio tools/triple_buffer_stress.cpp -o triple_buffer_stress
+// Run:   ./triple_buffer_stress --frames 1000000 --bins 860 --writer-hz 0 --hold-us 0 --out triple.csv
+//
+// --bins 860 floats ~= sizeof(AudioDataPayload). --writer-hz 0 publishes as
+// fast as possible (worst-case contention).
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "frame_triple_buffer.h"
+
+struct Args {
+  uint64_t frames = 1'000'000ULL;   // reader frames to run
+  int bins = 860;
+  double writer_hz = 0.0;           // 0 = unthrottled
+  int hold_us = 0;                  // simulated render time while holding a frame
+  std::string out = "triple.csv";
+};
+
+static void parse_args(int argc, char** argv, Args& a) {
+  for (int i=1;i<argc;++i) {
+    std::string k = argv[i];
+    auto next = [&](uint64_t def)->uint64_t{ if (i+1<argc) return std::stoull(argv[++i]); return def; };
+    auto nexti = [&](int def)->int{ if (i+1<argc) return std::stoi(argv[++i]); return def; };
+    auto nextd = [&](double def)->double{ if (i+1<argc) return std::stod(argv[++i]); return def; };
+    auto nexts = [&](std::string def)->std::string{ if (i+1<argc) return std::string(argv[++i]); return def; };
+    if (k == "--frames") a.frames = next(a.frames);
+    else if (k == "--bins") a.bins = nexti(a.bins);
+    else if (k == "--writer-hz") a.writer_hz = nextd(a.writer_hz);
+    else if (k == "--hold-us") a.hold_us = nexti(a.hold_us);
+    else if (k == "--out") a.out = nexts(a.out);
+  }
+}
+
+// Frame layout: [0] = tick, [1..bins) = tick + i (every element derives from the tick)
+static bool frame_consistent(const float* f, int bins, uint32_t* tick_out) {
+  uint32_t tick = (uint32_t)f[0];
+  for (int i=1;i<bins;++i) {
+    if (f[i] != float((tick + i) & 0xFFFFFF)) return false;
+  }
+  *tick_out = tick;
+  return true;
+}
+
+int main(int argc, char** argv) {
+  Args args; parse_args(argc, argv, args);
+  if (args.bins < 2) args.bins = 2;
+
+  FrameTripleBuffer tb;
+  frame_triple_buffer_init(&tb);
+  std::vector<std::vector<float>> slots(FRAME_TRIPLE_BUFFER_SLOTS, std::vector<float>(args.bins, 0.f));
+  for (auto& s : slots) for (int i=1;i<args.bins;++i) s[i] = float(i & 0xFFFFFF);
+  std::atomic<bool> running{true};
+
+  // Writer: fills its own slot in place, then publishes with one exchange
+  std::thread writer([&]{
+    using namespace std::chrono;
+    auto period = duration<double>(args.writer_hz > 0 ? 1.0/args.writer_hz : 0.0);
+    auto next = steady_clock::now();
+    uint32_t tick = 1;
+    while (running.load(std::memory_order_relaxed)) {
+      float* f = slots[frame_triple_buffer_write_slot(&tb)].data();
+      uint32_t t = tick & 0xFFFFFF;
+      f[0] = float(t);
+      for (int i=1;i<args.bins;++i) f[i] = float((t + i) & 0xFFFFFF);
+      frame_triple_buffer_publish(&tb);
+      tick++;
+      if (args.writer_hz > 0) {
+        next += duration_cast<steady_clock::duration>(period);
+        std::this_thread::sleep_until(next);
+      }
+    }
+  });
+
+  uint64_t fresh = 0, torn = 0, changed_while_held = 0, backwards = 0;
+  uint32_t last_tick = 0;
+  double acquire_ns_total = 0.0;
+  for (uint64_t frame=0; frame<args.frames; ++frame) {
+    auto t0 = std::chrono::steady_clock::now();
+    bool got = frame_triple_buffer_acquire(&tb);
+    const float* f = slots[frame_triple_buffer_read_slot(&tb)].data();
+    auto t1 = std::chrono::steady_clock::now();
+    acquire_ns_total += std::chrono::duration<double, std::nano>(t1 - t0).count();
+    if (got) ++fresh;
+
+    uint32_t tick_a = 0, tick_b = 0;
+    if (!frame_consistent(f, args.bins, &tick_a)) { ++torn; continue; }
+    // Ticks wrap at 24 bits (exact in float); only flag clear regressions
+    if (got && last_tick != 0 && ((tick_a - last_tick) & 0xFFFFFF) > 0x800000) ++backwards;
+    last_tick = tick_a;
+
+    if (args.hold_us > 0) std::this_thread::sleep_for(std::chrono::microseconds(args.hold_us));
+    if (!frame_consistent(f, args.bins, &tick_b) || tick_b != tick_a) ++changed_while_held;
+  }
+  running.store(false);
+  writer.join();
+
+  std::ofstream ofs(args.out);
+  ofs << "frames,bins,published,fresh,torn,changed_while_held,backwards,acquire_ns_avg\n";
+  ofs << args.frames << "," << args.bins << "," << tb.published << "," << fresh << "," << torn << ","
+      << changed_while_held << "," << backwards << "," << (acquire_ns_total / double(args.frames)) << "\n";
+  ofs.close();
+
+  bool ok = (torn == 0 && changed_while_held == 0 && backwards == 0);
+  std::cout << "Wrote " << args.out << ": published=" << tb.published << " fresh=" << fresh
+            << " torn=" << torn << " changed_while_held=" << changed_while_held
+            << " backwards=" << backwards << " acquire_ns_avg=" << (acquire_ns_total / double(args.frames))
+            << (ok ? " OK" : " FAIL") << std::endl;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""
+Stream a WAV file as int16 PCM datagrams to the host UdpPcmSource
+(firmware/native/host_runtime/host_audio_sources.h), paced in real time.
+
+Usage:
+  python3 tools/udp_pcm_send.py track.wav --port 9750 [--rate 12800] [--chunk 64] [--loop]
+
+The WAV (16-bit PCM, any channel count and rate) is mixed to mono and linearly
+resampled to --rate, which must match the firmware's AUDIO_CAPTURE_RATE_HZ.
+Each packet carries its CLOCK_MONOTONIC send time so the receiver can measure
+end-to-end latency on the same machine.
+"""
+import argparse, socket, struct, sys, time, wave
+
+MAGIC = b"K1PC"
+HEADER = struct.Struct("<4sIQIHH")  # magic, seq, send_time_us, rate, count, reserved
+
+def load_mono(path: str, rate: int):
+  with wave.open(path, 'rb') as wf:
+    if wf.getsampwidth() != 2:
+      sys.exit("udp_pcm_send: only 16-bit PCM WAV is supported")
+    channels, src_rate = wf.getnchannels(), wf.getframerate()
+    frames = wf.readframes(wf.getnframes())
+  pcm = struct.unpack("<%dh" % (len(frames) // 2), frames)
+  mono = [sum(pcm[i:i + channels]) / channels for i in range(0, len(pcm), channels)]
+  if src_rate == rate or not mono:
+    return [int(v) for v in mono]
+  step = src_rate / rate
+  out = []
+  for i in range(int(len(mono) / step)):
+    x = i * step
+    i0 = int(x)
+    i1 = min(i0 + 1, len(mono) - 1)
+    out.append(int(round(mono[i0] + (mono[i1] - mono[i0]) * (x - i0))))
+  return out
+
+def main():
+  ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+  ap.add_argument("wav")
+  ap.add_argument("--port", type=int, default=9750)
+  ap.add_argument("--rate", type=int, default=12800, help="AUDIO_CAPTURE_RATE_HZ of the receiver")
+  ap.add_argument("--chunk", type=int, default=64, help="samples per packet")
+  ap.add_argument("--loop", action="store_true")
+  args = ap.parse_args()
+
+  samples = load_mono(args.wav, args.rate)
+  sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+  dest = ("127.0.0.1", args.port)
+  period = args.chunk / args.rate
+  seq = 0
+  start = time.monotonic()
+  print("Sending %.1f s of %d Hz PCM to %s:%d" % (len(samples) / args.rate, args.rate, *dest))
+  while True:
+    for pos in range(0, len(samples) - args.chunk + 1, args.chunk):
+      # A packet leaves once its last sample has "happened"
+      delay = start + (seq + 1) * period - time.monotonic()
+      if delay > 0:
+        time.sleep(delay)
+      block = samples[pos:pos + args.chunk]
+      header = HEADER.pack(MAGIC, seq & 0xFFFFFFFF, time.monotonic_ns() // 1000, args.rate, len(block), 0)
+      sock.sendto(header + struct.pack("<%dh" % len(block), *block), dest)
+      seq += 1
+    if not args.loop:
+      break
+
+if __name__ == "__main__":
+  main()
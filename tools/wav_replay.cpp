@@ -0,0 +1,118 @@
+// WAV replay: feeds a WAV file through the real audio path (acquire_sample_chunk
+// -> calculate_magnitudes -> get_chromagram -> run_vu -> update_novelty ->
+// update_tempo -> update_tempi_phase -> beat gate) on the host as fast as the
+// CPU allows, on a virtual clock that advances one chunk per step. Writes one
+// CSV row per audio frame plus a cycle-cost summary on stdout.
+//
+// Build (from repo root, same source set as [env:native]):
+//   g++ -O2 -std=gnu++17 -pthread -Ifirmware/native/hal_shims -Ifirmware/native/host_runtime -Ifirmware/src \
+//     tools/wav_replay.cpp firmware/native/hal_shims/*.cpp firmware/native/host_runtime/*.cpp \
+//     $(find firmware/src -name '*.cpp' ! -name main.cpp ! -name 'webserver*' ! -name wifi_monitor.cpp \
+//       ! -name connection_state.cpp ! -name udp_echo.cpp ! -name tempo_validation_stubs.cpp \
+//       ! -path '*/network/*' ! -path '*/diagnostics/*') -o wav_replay
+// Run:
+//   ./wav_replay --in track.wav --out track.csv [--no-spectrum] [--max-seconds 30]
+//
+// Input: PCM 16/24/32-bit or 32-bit float, any channel count (mixed to mono),
+// any rate (resampled to the I2S capture rate, AUDIO_CAPTURE_RATE_HZ), fed in
+// place of the microphone by WavFileSource (host_audio_sources.h). CSV columns:
+//   frame,time_s,step_us,audio_level,tempo_confidence,best_bpm,beat,spec_0..spec_63
+// step_us is host wall time for one host_audio_step(); compare runs on the same
+// machine only.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <esp_timer.h>
+
+#include "host_runtime.h"
+#include "host_audio_sources.h"
+#include "audio/audio_config.h"
+#include "audio/goertzel.h"
+#include "audio/tempo.h"
+
+struct Args {
+  std::string in;
+  std::string out = "wav_replay.csv";
+  bool spectrum = true;
+  double max_seconds = 0.0;   // 0 = whole file
+};
+
+static void parse_args(int argc, char** argv, Args& a) {
+  for (int i=1;i<argc;++i) {
+    std::string k = argv[i];
+    auto nexts = [&](std::string def)->std::string{ if (i+1<argc) return std::string(argv[++i]); return def; };
+    auto nextd = [&](double def)->double{ if (i+1<argc) return std::stod(argv[++i]); return def; };
+    if (k == "--in") a.in = nexts(a.in);
+    else if (k == "--out") a.out = nexts(a.out);
+    else if (k == "--no-spectrum") a.spectrum = false;
+    else if (k == "--max-seconds") a.max_seconds = nextd(a.max_seconds);
+  }
+}
+
+int main(int argc, char** argv) {
+  Args args; parse_args(argc, argv, args);
+  if (args.in.empty()) {
+    std::cerr << "usage: wav_replay --in file.wav [--out out.csv] [--no-spectrum] [--max-seconds N]" << std::endl;
+    return 2;
+  }
+
+  static WavFileSource wav;
+  std::string err;
+  if (!wav_file_source_open(&wav, args.in, false, &err)) { std::cerr << "wav_replay: " << err << std::endl; return 1; }
+  if (args.max_seconds > 0.0) {
+    wav.samples.resize(std::min(wav.samples.size(), (size_t)(args.max_seconds * AUDIO_CAPTURE_RATE_HZ)));
+  }
+
+  const int64_t chunk_us = (int64_t)AUDIO_CHUNK_SIZE * 1000000 / AUDIO_SAMPLE_RATE_HZ;
+  hal_set_time_us(1000000);
+  host_runtime_init();
+  audio_source_select(&wav.source);
+
+  std::ofstream ofs(args.out);
+  ofs << "frame,time_s,step_us,audio_level,tempo_confidence,best_bpm,beat";
+  if (args.spectrum) for (int i=0;i<NUM_FREQS;++i) ofs << ",spec_" << i;
+  ofs << "\n";
+
+  const uint64_t total_frames = wav_file_source_chunks(&wav);
+  std::vector<double> step_us(total_frames);
+  uint64_t beats = 0;
+  char line[64];
+  for (uint64_t frame=0; frame<total_frames; ++frame) {
+    hal_advance_time_us(chunk_us);
+    auto t0 = std::chrono::steady_clock::now();
+    bool beat = host_audio_step();
+    auto t1 = std::chrono::steady_clock::now();
+    step_us[frame] = std::chrono::duration<double, std::micro>(t1 - t0).count();
+    beats += beat;
+
+    snprintf(line, sizeof(line), "%llu,%.4f,%.2f", (unsigned long long)frame,
+             (double)(frame + 1) * chunk_us / 1e6, step_us[frame]);
+    ofs << line << "," << audio_level << "," << tempo_confidence << "," << host_best_bpm() << "," << (beat ? 1 : 0);
+    if (args.spectrum) for (int i=0;i<NUM_FREQS;++i) ofs << "," << spectrogram[i];
+    ofs << "\n";
+  }
+  ofs.close();
+
+  double audio_s = (double)total_frames * chunk_us / 1e6;
+  double total_us = 0.0;
+  for (double v : step_us) total_us += v;
+  std::vector<double> sorted = step_us;
+  std::sort(sorted.begin(), sorted.end());
+  double p50 = sorted.empty() ? 0.0 : sorted[sorted.size() / 2];
+  double p99 = sorted.empty() ? 0.0 : sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)];
+  double speed = total_us > 0.0 ? audio_s * 1e6 / total_us : 0.0;
+
+  std::cout << "Wrote " << args.out << ": frames=" << total_frames << " audio_s=" << audio_s
+            << " beats=" << beats << " step_us_avg=" << (total_frames ? total_us / total_frames : 0.0)
+            << " p50=" << p50 << " p99=" << p99 << " realtime_x=" << speed << std::endl;
+  return 0;
+}